@@ -58,3 +58,8 @@ void sys_init(void) { sys_tick_init(); }
 volatile uint32_t sys_tick_counter = 0;
 
 void SysTick_Handler(void) { sys_tick_counter++; }
+
+uint32_t sys_get_tick(void) { return sys_tick_counter; }
+
+// No measurement front end wired up yet
+struct meas_channel_s *sys_get_channel(void) { return NULL; }
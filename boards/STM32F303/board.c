@@ -13,7 +13,11 @@
 #include "gpio_defaults.h"
 #include "measlib/drivers/api.h"
 #include "measlib/drivers/hal.h"
+#include "measlib/modules/vna/channel.h"
+#include "measlib/modules/vna/trace.h"
+#include "measlib/sys/fat.h"
 #include "measlib/sys/input_service.h"
+#include "measlib/sys/scpi/scpi_def.h"
 #include "measlib/sys/shell_service.h"
 #include "measlib/sys/touch_service.h"
 #include <stdint.h>
@@ -297,6 +301,48 @@ static void gpio_init_defaults(void) {
   GPIOF->AFR[1] = VAL_GPIOF_AFRH;
 }
 
+// -- Measurement Channel --
+
+// Sweep length on this board (RAM: 20 bytes per point)
+#define BOARD_VNA_POINTS 201
+
+static meas_vna_channel_t vna_ch;
+static meas_vna_trace_t vna_trace;
+static meas_complex_t vna_samples[BOARD_VNA_POINTS];
+static meas_real_t vna_trace_freq[BOARD_VNA_POINTS];
+static meas_complex_t vna_trace_data[BOARD_VNA_POINTS];
+static bool vna_ready = false;
+
+// VNA channel on the ADC/synth front end; SCPI sweeps it and reads trace 1
+static void vna_setup(meas_hal_rx_api_t *rx, meas_hal_synth_api_t *synth) {
+  meas_object_t *obj = &vna_ch.base.base;
+  if (meas_vna_trace_init(&vna_trace, &vna_ch, vna_trace_freq, vna_trace_data,
+                          BOARD_VNA_POINTS) != MEAS_OK ||
+      meas_vna_channel_init(&vna_ch, &vna_trace.base) != MEAS_OK)
+    return;
+  vna_ch.hal_rx = rx;
+  vna_ch.hal_synth = synth;
+  meas_object_set_prop(obj, MEAS_PROP_VNA_BUFFER_PTR,
+                       (meas_variant_t){.type = PROP_TYPE_PTR,
+                                        .p_val = vna_samples});
+  meas_object_set_prop(obj, MEAS_PROP_VNA_BUFFER_CAP,
+                       (meas_variant_t){.type = PROP_TYPE_INT64,
+                                        .i_val = BOARD_VNA_POINTS});
+  meas_object_set_prop(obj, MEAS_PROP_VNA_POINTS,
+                       (meas_variant_t){.type = PROP_TYPE_INT64,
+                                        .i_val = BOARD_VNA_POINTS});
+  if (meas_channel_configure(&vna_ch.base) != MEAS_OK)
+    return;
+
+  scpi_def_set_channel(&vna_ch.base);
+  scpi_def_set_trace(1, &vna_trace.base);
+  vna_ready = true;
+}
+
+meas_channel_t *sys_get_channel(void) {
+  return vna_ready ? &vna_ch.base : NULL;
+}
+
 /**
  * @brief System Initialization (Framework Hook)
  * Called from main loop to initialize platform drivers.
@@ -308,8 +354,8 @@ void sys_init(void) {
   gpio_init_defaults();
   sys_tick_init();
 
-  meas_drv_adc_init();
-  meas_drv_synth_init();
+  meas_hal_rx_api_t *rx = meas_drv_adc_init();
+  meas_hal_synth_api_t *synth = meas_drv_synth_init();
   meas_hal_io_api_t *io = meas_drv_controls_init();
   meas_input_service_init(io, NULL);
 
@@ -318,10 +364,24 @@ void sys_init(void) {
 
   meas_drv_wdg_init();
   meas_drv_flash_init();
-  meas_drv_usb_init(); // Restored USB Init
+  // SCPI shell on the USB VCP
+  meas_shell_service_init(meas_drv_usb_init(), NULL);
 
-  meas_drv_sd_init();
-  meas_drv_lcd_init();
+  void *sd_ctx = meas_drv_sd_init();
+  void *lcd_ctx = meas_drv_lcd_init();
+  // SPI1 is shared: each driver lets the other's DMA transfer finish first
+  meas_drv_sd_set_bus_wait(sd_ctx, meas_drv_lcd_wait, lcd_ctx);
+  meas_drv_lcd_set_bus_wait(lcd_ctx, meas_drv_sd_wait, sd_ctx);
+
+  // Card filesystem for MMEMory (traces, screenshots)
+  static meas_fat_t sd_fat;
+  const meas_fs_api_t *fs = meas_fat_get_api();
+  if (sd_ctx &&
+      meas_fat_init(&sd_fat, meas_drv_sd_get_api(), sd_ctx) == MEAS_OK &&
+      fs->mount(&sd_fat.base) == MEAS_OK)
+    scpi_def_set_storage(fs, &sd_fat.base);
+
+  vna_setup(rx, synth);
 
   // 2. Event Loop Init
   // meas_event_loop_init(); // Not needed (Static Init)
@@ -330,3 +390,5 @@ void sys_init(void) {
 volatile uint32_t sys_tick_counter = 0;
 
 void SysTick_Handler(void) { sys_tick_counter++; }
+
+uint32_t sys_get_tick(void) { return sys_tick_counter; }
@@ -18,6 +18,15 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+/**
+ * @brief Completion callback for asynchronous transfers.
+ * Invoked from the DMA interrupt once the last pixel has left the SPI FIFO
+ * and the bus has been released.
+ *
+ * @param user User data registered with the transfer.
+ */
+typedef void (*meas_drv_lcd_done_cb_t)(void *user);
+
 /**
  * @brief Initialize the LCD Driver (GPIO, SPI, DMA, Controller).
  *
@@ -67,6 +76,48 @@ void meas_drv_lcd_fill_rect(void *ctx, meas_rect_t rect, meas_pixel_t color);
  */
 void meas_drv_lcd_blit(void *ctx, meas_rect_t rect, const void *pixels);
 
+/**
+ * @brief Start a non-blocking Blit to a rectangular area.
+ *
+ * Programs the window and kicks the DMA, then returns immediately. The
+ * source buffer must stay untouched until @p done fires (or
+ * meas_drv_lcd_is_busy() returns false). Only one transfer can be in flight.
+ *
+ * @param ctx Driver Context
+ * @param rect Destination rectangle
+ * @param pixels Source buffer (RGB565). Must be accessible by DMA (SRAM).
+ * @param done Optional completion callback (called from ISR context).
+ * @param user User data passed to @p done.
+ * @return MEAS_OK if started, MEAS_BUSY if a transfer is still in flight.
+ */
+meas_status_t meas_drv_lcd_blit_async(void *ctx, meas_rect_t rect,
+                                      const void *pixels,
+                                      meas_drv_lcd_done_cb_t done, void *user);
+
+/**
+ * @brief Check whether an asynchronous transfer is in flight.
+ * @param ctx Driver Context
+ * @return true while the DMA owns the bus.
+ */
+bool meas_drv_lcd_is_busy(void *ctx);
+
+/**
+ * @brief Block until the pending asynchronous transfer has completed.
+ * Must be called before the SPI bus is handed to another device (SD Card).
+ * @param ctx Driver Context
+ */
+void meas_drv_lcd_wait(void *ctx);
+
+/**
+ * @brief Set the hook that frees the shared SPI bus before drawing.
+ * Typically meas_drv_sd_wait() with the SD Card context.
+ * @param ctx Driver Context
+ * @param wait Called before each bus access (NULL for none)
+ * @param wait_ctx Passed to @p wait
+ */
+void meas_drv_lcd_set_bus_wait(void *ctx, void (*wait)(void *ctx),
+                               void *wait_ctx);
+
 /**
  * @brief Set the display orientation and subpixel order.
  *
@@ -8,12 +8,17 @@
  * Implements a low-level Block Device driver for SD Cards using SPI.
  * Handles the initialization, block reading, and block writing.
  * Does not include a Filesystem.
+ *
+ * Data blocks are moved by DMA and multi-block transfers are advanced from
+ * the DMA interrupt, so the CPU is free while the card streams. The
+ * blocking calls start the same transfer and wait for it.
  */
 
 #ifndef MEASLIB_DRIVERS_STM32F303_DRV_SD_H
 #define MEASLIB_DRIVERS_STM32F303_DRV_SD_H
 
 #include "measlib/drivers/hal.h"
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -31,8 +36,16 @@ typedef enum {
   MEAS_SD_TIMEOUT,     ///< Timeout occurred
   MEAS_SD_CRC_ERROR,   ///< CRC Check failed
   MEAS_SD_WRITE_ERROR, ///< Write protection or internal error
+  MEAS_SD_BUSY,        ///< Another transfer is in flight
 } meas_sd_status_t;
 
+/**
+ * @brief Completion of an asynchronous transfer (interrupt context).
+ * @param user User pointer given when the transfer was started.
+ * @param status Result of the whole transfer.
+ */
+typedef void (*meas_drv_sd_done_cb_t)(void *user, meas_sd_status_t status);
+
 // --- API ---
 
 /**
@@ -74,6 +87,66 @@ meas_sd_status_t meas_drv_sd_write_blocks(void *ctx, uint32_t sector,
                                           const uint8_t *buffer,
                                           uint32_t count);
 
+/**
+ * @brief Start reading blocks and return at once.
+ *
+ * @param ctx Driver context.
+ * @param sector Start sector index (LBA).
+ * @param buffer Destination; must stay valid until @p done is called.
+ * @param count Number of blocks to read.
+ * @param done Completion callback (may be NULL).
+ * @param user Passed to @p done.
+ * @return MEAS_SD_OK if the transfer was started, MEAS_SD_BUSY while another
+ *         one runs.
+ */
+meas_sd_status_t meas_drv_sd_read_async(void *ctx, uint32_t sector,
+                                        uint8_t *buffer, uint32_t count,
+                                        meas_drv_sd_done_cb_t done,
+                                        void *user);
+
+/**
+ * @brief Start writing blocks and return at once.
+ *
+ * @param ctx Driver context.
+ * @param sector Start sector index (LBA).
+ * @param buffer Source data; must stay valid until @p done is called.
+ * @param count Number of blocks to write.
+ * @param done Completion callback (may be NULL).
+ * @param user Passed to @p done.
+ * @return MEAS_SD_OK if the transfer was started, MEAS_SD_BUSY while another
+ *         one runs.
+ */
+meas_sd_status_t meas_drv_sd_write_async(void *ctx, uint32_t sector,
+                                         const uint8_t *buffer,
+                                         uint32_t count,
+                                         meas_drv_sd_done_cb_t done,
+                                         void *user);
+
+/**
+ * @brief Check whether a transfer is in flight.
+ * @param ctx Driver context.
+ * @return true while the card owns the SPI bus.
+ */
+bool meas_drv_sd_is_busy(void *ctx);
+
+/**
+ * @brief Block until the transfer in flight has completed.
+ * Must not be called with interrupts disabled.
+ * @param ctx Driver context.
+ */
+void meas_drv_sd_wait(void *ctx);
+
+/**
+ * @brief Set the hook that frees the shared SPI bus before a transfer.
+ * Typically meas_drv_lcd_wait() with the LCD context.
+ *
+ * @param ctx Driver context.
+ * @param wait Called before each transfer (NULL for none).
+ * @param wait_ctx Passed to @p wait.
+ */
+void meas_drv_sd_set_bus_wait(void *ctx, void (*wait)(void *ctx),
+                              void *wait_ctx);
+
 /**
  * @brief Get the total number of sectors on the card.
  *
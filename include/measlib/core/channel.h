@@ -13,6 +13,7 @@
 #ifndef MEASLIB_CORE_CHANNEL_H
 #define MEASLIB_CORE_CHANNEL_H
 
+#include "measlib/core/event.h"
 #include "measlib/core/object.h"
 
 /**
@@ -21,6 +22,7 @@
  */
 struct meas_channel_s {
   meas_object_t base; /**< Inherits from generic object */
+  uint32_t sweep_seq; /**< Number of the latest sweep started */
 };
 
 // Typedef for consistency
@@ -63,4 +65,45 @@ typedef struct {
 
 } meas_channel_api_t;
 
+/**
+ * @brief Sweep completion.
+ * A channel publishes EVENT_STATE_CHANGED with a PROP_TYPE_INT64 payload
+ * holding its sweep_seq when a started sweep ends (completed or aborted),
+ * see meas_channel_publish_done(). Events still queued from an earlier
+ * sweep carry an older number than the sweep started since.
+ *
+ * The VNA and SA channels report it; the GEN and DMM stubs have no sweep
+ * (no start_sweep), so INITiate fails on them.
+ */
+#define MEAS_CHANNEL_SWEEP_DONE(ev)                                            \
+  ((ev)->type == EVENT_STATE_CHANGED && (ev)->payload.type == PROP_TYPE_INT64)
+
+/**
+ * @brief Sweep number a completion event belongs to.
+ */
+#define MEAS_CHANNEL_SWEEP_SEQ(ev) ((uint32_t)(ev)->payload.i_val)
+
+/**
+ * @brief Apply the channel settings to its drivers via VTable.
+ */
+meas_status_t meas_channel_configure(meas_channel_t *ch);
+
+/**
+ * @brief Start a sweep via VTable.
+ * Numbers the sweep first (sweep_seq), so completion events of earlier
+ * sweeps can be told apart.
+ */
+meas_status_t meas_channel_start_sweep(meas_channel_t *ch);
+
+/**
+ * @brief Abort the current sweep via VTable.
+ */
+meas_status_t meas_channel_abort_sweep(meas_channel_t *ch);
+
+/**
+ * @brief Publish the end of the current sweep (MEAS_CHANNEL_SWEEP_DONE).
+ * Called by channel implementations when a sweep completes or is aborted.
+ */
+meas_status_t meas_channel_publish_done(meas_channel_t *ch);
+
 #endif // MEASLIB_CORE_CHANNEL_H
@@ -24,7 +24,8 @@ typedef enum {
   EVENT_STATE_CHANGED, /**< Operational state (e.g. Idle->Sweep) changed */
   EVENT_ERROR,         /**< An error condition occurred */
   EVENT_INPUT_KEY,     /**< Physical Button Press */
-  EVENT_INPUT_TOUCH    /**< Touch Screen Event */
+  EVENT_INPUT_TOUCH,   /**< Touch Screen Event */
+  EVENT_INPUT_GESTURE  /**< Recognized gesture (see meas_gesture_pack) */
 } meas_event_type_t;
 
 /**
@@ -61,6 +62,29 @@ meas_status_t meas_subscribe(meas_object_t *pub, meas_event_cb_t cb, void *ctx);
  */
 meas_status_t meas_event_publish(meas_event_t ev);
 
+/**
+ * @brief Merge Callback for coalesced publishing.
+ *
+ * @param queued Newest pending event (may be updated in place).
+ * @param ev Event being published.
+ * @return true if @p ev was folded into @p queued.
+ */
+typedef bool (*meas_event_merge_cb_t)(meas_event_t *queued,
+                                      const meas_event_t *ev);
+
+/**
+ * @brief Publish an event, merging it into the newest pending one if possible.
+ * Keeps high-rate streams (drag deltas) from flooding the queue: while the
+ * previous step is still waiting for dispatch, only one entry exists.
+ * Call from thread context only (not from an ISR).
+ *
+ * @param ev The event structure to publish.
+ * @param merge Merge policy.
+ * @return meas_status_t MEAS_OK on success, MEAS_BUSY if queue full.
+ */
+meas_status_t meas_event_publish_coalesced(meas_event_t ev,
+                                           meas_event_merge_cb_t merge);
+
 /**
  * @brief Dispatch pending events to subscribers.
  * Internal loop or called by main superloop.
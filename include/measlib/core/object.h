@@ -18,6 +18,21 @@
 // Forward declaration of the base object handle
 typedef struct meas_object_s meas_object_t;
 
+/**
+ * @brief Property Descriptor
+ * Metadata that lets generic layers (e.g. SCPI) expose a property without
+ * property-specific code.
+ */
+typedef struct {
+  meas_id_t key;         /**< Property ID */
+  const char *name;      /**< Human-readable name */
+  const char *scpi;      /**< SCPI header path ("SENSe:FREQuency:STARt") */
+  meas_prop_type_t type; /**< Value type */
+  const char *unit;      /**< Unit suffix ("HZ"), or NULL */
+  meas_real_t min;       /**< Valid range (min == max: unbounded) */
+  meas_real_t max;
+} meas_prop_desc_t;
+
 /**
  * @brief Base Object Interface (VTable)
  * Contains function pointers common to all objects in the system.
@@ -57,6 +72,14 @@ typedef struct {
    */
   void (*destroy)(meas_object_t *obj);
 
+  /**
+   * @brief Describe the object's properties (optional).
+   * @param obj Pointer to the object instance.
+   * @param count Output number of descriptors.
+   * @return Descriptor table.
+   */
+  const meas_prop_desc_t *(*get_props)(meas_object_t *obj, size_t *count);
+
 } meas_object_api_t;
 
 /**
@@ -89,6 +112,13 @@ meas_status_t meas_object_set_prop(meas_object_t *obj, meas_id_t key,
 meas_status_t meas_object_get_prop(meas_object_t *obj, meas_id_t key,
                                    meas_variant_t *val);
 
+/**
+ * @brief Get the property descriptors via VTable.
+ * @return Descriptor table (NULL and *count = 0 if the object has none).
+ */
+const meas_prop_desc_t *meas_object_get_props(meas_object_t *obj,
+                                              size_t *count);
+
 /**
  * @brief Increase reference count.
  */
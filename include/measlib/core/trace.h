@@ -50,13 +50,6 @@ typedef struct {
   meas_status_t (*get_data)(meas_trace_t *t, const meas_real_t **x,
                             const meas_real_t **y, size_t *count);
 
-  /**
-   * @brief Set the data format.
-   * @param t Trace instance.
-   * @param fmt Desired format.
-   * @return meas_status_t
-   */
-
   /**
    * @brief Copy data into the trace buffer.
    * @param t Trace instance.
@@ -66,6 +59,14 @@ typedef struct {
    */
   meas_status_t (*copy_data)(meas_trace_t *t, const void *data, size_t size);
 
+  /**
+   * @brief Get the data format (optional; TRACE_FMT_REAL if NULL).
+   * A complex trace holds `count` interleaved (re, im) pairs in Y.
+   * @param t Trace instance.
+   * @return meas_trace_fmt_t
+   */
+  meas_trace_fmt_t (*get_format)(meas_trace_t *t);
+
 } meas_trace_api_t;
 
 /**
@@ -74,6 +75,11 @@ typedef struct {
 meas_status_t meas_trace_get_data(meas_trace_t *t, const meas_real_t **x,
                                   const meas_real_t **y, size_t *count);
 
+/**
+ * @brief Helper: Get the data format of a trace.
+ */
+meas_trace_fmt_t meas_trace_get_format(meas_trace_t *t);
+
 /**
  * @brief Helper: Copy data into trace.
  */
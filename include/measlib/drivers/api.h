@@ -49,10 +49,25 @@ uint32_t sys_enter_critical(void);
  */
 void sys_exit_critical(uint32_t state);
 
+/**
+ * @brief System Time
+ * @return Milliseconds since boot (SysTick, wraps after ~49 days).
+ */
+uint32_t sys_get_tick(void);
+
 /**
  * @brief System Initialization
  * Platform-specific hardware setup (Clocks, SysTick, HAL).
  */
 void sys_init(void);
 
+struct meas_channel_s;
+
+/**
+ * @brief Measurement channel set up by sys_init().
+ * Ticked by the superloop and swept by SCPI INITiate.
+ * @return Active channel, or NULL if the board has none.
+ */
+struct meas_channel_s *sys_get_channel(void);
+
 #endif // MEASLIB_DRIVERS_API_H
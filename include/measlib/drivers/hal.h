@@ -81,6 +81,13 @@ typedef struct {
                            size_t len);
 } meas_hal_flash_api_t;
 
+/**
+ * @brief Link transfer completion (endpoint-complete / DMA-complete IRQ).
+ * @param user User pointer given to send_async.
+ * @param sent Bytes actually transferred.
+ */
+typedef void (*meas_hal_link_done_t)(void *user, size_t sent);
+
 /**
  * @brief Communication Link Interface (USB CDC / UART)
  */
@@ -88,8 +95,23 @@ typedef struct {
   meas_status_t (*send)(void *ctx, const void *data, size_t len);
   meas_status_t (*recv)(void *ctx, void *data, size_t len, size_t *read);
   bool (*is_connected)(void *ctx);
+  /**
+   * Optional: start a transfer and return at once. @p data must stay valid
+   * until @p done is called from the completion interrupt (also on abort,
+   * with the bytes that went out). Links without it are driven through
+   * send() from the poll loop.
+   */
+  meas_status_t (*send_async)(void *ctx, const void *data, size_t len,
+                              meas_hal_link_done_t done, void *user);
 } meas_hal_link_api_t;
 
+/**
+ * @brief Completion of an asynchronous storage transfer.
+ * @param user User pointer given to read_async / write_async.
+ * @param status MEAS_OK if all blocks were transferred.
+ */
+typedef void (*meas_hal_storage_done_t)(void *user, meas_status_t status);
+
 /**
  * @brief Storage (Block Device) Interface
  * For SD Card, Flash, etc.
@@ -101,6 +123,17 @@ typedef struct {
                          uint32_t count);
   uint32_t (*get_capacity)(void *ctx); // Returns sector count
   bool (*is_ready)(void *ctx);
+  /**
+   * Optional: start a transfer and return at once (MEAS_BUSY while another
+   * one runs). @p buffer must stay valid until @p done is called, usually
+   * from the DMA interrupt.
+   */
+  meas_status_t (*read_async)(void *ctx, uint32_t sector, void *buffer,
+                              uint32_t count, meas_hal_storage_done_t done,
+                              void *user);
+  meas_status_t (*write_async)(void *ctx, uint32_t sector, const void *buffer,
+                               uint32_t count, meas_hal_storage_done_t done,
+                               void *user);
 } meas_hal_storage_api_t;
 
 /**
@@ -13,8 +13,37 @@
 #define MEASLIB_MODULES_VNA_TRACE_H
 
 #include "measlib/core/trace.h"
+#include "measlib/modules/vna/channel.h"
 
-// VNA Traces typically store Complex S-Parameters
-// No extra structs needed if core/trace.h handles generic complex data well.
+/**
+ * @brief Complex S-Parameter Trace
+ * Holds the last sweep of a VNA channel (sink node target). Buffers are
+ * caller-owned; the stimulus axis follows the channel's start/stop/points.
+ */
+typedef struct {
+  meas_trace_t base;
+  const meas_vna_channel_t *channel; /**< Sweep the stimulus comes from */
+  meas_real_t *freq;                 /**< X: stimulus in Hz (cap) */
+  meas_complex_t *data;              /**< Y: S-parameters (cap) */
+  size_t cap;                        /**< Capacity in points */
+  size_t count;                      /**< Valid points */
+  uint64_t axis_start;               /**< Span the axis was built for */
+  uint64_t axis_stop;
+  size_t axis_count;
+} meas_vna_trace_t;
+
+/**
+ * @brief Initialize a VNA trace.
+ * @param t Trace structure.
+ * @param ch Channel whose sweep the trace holds (stimulus axis).
+ * @param freq Stimulus buffer (@p cap entries).
+ * @param data Response buffer (@p cap entries).
+ * @param cap Capacity in points.
+ * @return MEAS_OK, or MEAS_ERROR on invalid arguments.
+ */
+meas_status_t meas_vna_trace_init(meas_vna_trace_t *t,
+                                  const meas_vna_channel_t *ch,
+                                  meas_real_t *freq, meas_complex_t *data,
+                                  size_t cap);
 
 #endif // MEASLIB_MODULES_VNA_TRACE_H
@@ -0,0 +1,149 @@
+/**
+ * @file fat.h
+ * @brief FAT16 / FAT32 Filesystem (meas_fs_api_t on a Block Device).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Implements the storage facade on any meas_hal_storage_api_t device (SD
+ * Card) in the format PCs read directly. The volume is either the whole
+ * device or the first FAT partition of its MBR; it is used as formatted.
+ *
+ * - Short (8.3) names only. Paths use '/' and are case-insensitive.
+ * - open() opens an existing file or creates it, positioned at 0. A write
+ *   drops whatever followed the position it started at: writing from 0
+ *   replaces the file, writing after seek(size) appends.
+ * - Sectors go through a small LRU write-back cache. FAT sectors are written
+ *   to every FAT copy.
+ * - Each file keeps its cluster chain as runs of consecutive clusters, so
+ *   seeks and sequential access do not walk the FAT again.
+ * - Whole sectors move straight between the caller's buffer and the device,
+ *   one multi-sector transfer per contiguous run. New clusters are taken
+ *   after the last one allocated, which keeps files contiguous.
+ * - close(), unmount() and meas_fat_sync() write everything back.
+ */
+
+#ifndef MEASLIB_SYS_FAT_H
+#define MEASLIB_SYS_FAT_H
+
+#include "measlib/core/storage.h"
+#include "measlib/drivers/hal.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Sector size (the only one supported).
+ */
+#define MEAS_FAT_SECTOR_SIZE 512
+
+/**
+ * @brief Sectors in the write-back cache.
+ */
+#ifndef MEAS_FAT_CACHE_SECTORS
+#define MEAS_FAT_CACHE_SECTORS 4
+#endif
+
+/**
+ * @brief Files open at the same time (per volume).
+ */
+#ifndef MEAS_FAT_MAX_FILES
+#define MEAS_FAT_MAX_FILES 2
+#endif
+
+/**
+ * @brief Runs of consecutive clusters remembered per file.
+ * Clusters past the last run are found by walking the FAT.
+ */
+#ifndef MEAS_FAT_CHAIN_RUNS
+#define MEAS_FAT_CHAIN_RUNS 8
+#endif
+
+/**
+ * @brief Cached Sector
+ */
+typedef struct {
+  uint32_t lba;
+  uint32_t used; ///< LRU stamp
+  bool valid;
+  bool dirty;
+  uint8_t data[MEAS_FAT_SECTOR_SIZE];
+} meas_fat_sector_t;
+
+/**
+ * @brief Consecutive clusters of a chain.
+ */
+typedef struct {
+  uint32_t index;   ///< Position of the first cluster in the file
+  uint32_t cluster; ///< First cluster
+  uint32_t count;
+} meas_fat_run_t;
+
+/**
+ * @brief Open File
+ */
+typedef struct {
+  meas_file_t base; ///< Handle given out (base.impl: the volume)
+  bool open;
+  bool dirty;     ///< Directory entry needs updating
+  bool truncated; ///< Writes since open / seek already dropped the tail
+  uint16_t entry_off;
+  uint32_t entry_lba; ///< Directory entry
+  uint32_t first;     ///< First cluster (0: none)
+  uint32_t size;
+  uint32_t pos;
+  uint32_t clusters;  ///< Chain length (known once truncated)
+  uint32_t cur_index; ///< Last cluster looked up
+  uint32_t cur;
+  meas_fat_run_t runs[MEAS_FAT_CHAIN_RUNS];
+  uint8_t run_count;
+  uint32_t known; ///< Chain positions covered by the runs (from 0)
+} meas_fat_file_t;
+
+/**
+ * @brief FAT Volume (pass &base as the meas_fs_api_t driver instance)
+ */
+typedef struct {
+  meas_object_t base;
+  const meas_hal_storage_api_t *dev;
+  void *dev_ctx;
+
+  bool mounted;
+  uint8_t fat_bits; ///< 16 or 32
+  uint8_t num_fats;
+  uint8_t cluster_sectors;
+  uint32_t fat_start;
+  uint32_t fat_sectors; ///< Per FAT copy
+  uint32_t root_start;  ///< FAT16 root directory region
+  uint32_t root_sectors;
+  uint32_t root_cluster; ///< FAT32 root directory
+  uint32_t data_start;
+  uint32_t cluster_count;
+  uint32_t next_free; ///< Where the next allocation starts looking
+  uint32_t fsinfo;    ///< FAT32 FSInfo sector still to invalidate (0: none)
+
+  uint32_t stamp;
+  meas_fat_sector_t cache[MEAS_FAT_CACHE_SECTORS];
+  meas_fat_file_t files[MEAS_FAT_MAX_FILES];
+} meas_fat_t;
+
+/**
+ * @brief Set up a volume on a block device (not mounted yet).
+ * @param fat Volume.
+ * @param dev Block device (read and write are used).
+ * @param dev_ctx Device context.
+ */
+meas_status_t meas_fat_init(meas_fat_t *fat, const meas_hal_storage_api_t *dev,
+                            void *dev_ctx);
+
+/**
+ * @brief Get the filesystem API VTable.
+ */
+const meas_fs_api_t *meas_fat_get_api(void);
+
+/**
+ * @brief Write back open files' entries and all cached sectors.
+ * Files stay open; long-running writers call this to bound data loss.
+ */
+meas_status_t meas_fat_sync(meas_fat_t *fat);
+
+#endif // MEASLIB_SYS_FAT_H
@@ -0,0 +1,80 @@
+/**
+ * @file remote_display.h
+ * @brief Remote Display Mirroring over a Byte Stream (USB CDC).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Mirrors every tile the render service sends to the LCD. There is no copy
+ * of the previous frame to diff against, so each screen row keeps a 32-bit
+ * hash of what was last transmitted: rows that come out of a redraw
+ * unchanged cost nothing, changed rows are RLE-encoded. Bandwidth therefore
+ * follows the change rate, not the resolution or the redraw rate.
+ *
+ * Wire format (multi-byte fields little-endian):
+ *
+ *     0xA5 0x5A | type u8 | len u16 | payload[len] | sum u8
+ *
+ * `sum` makes the byte sum of type, len, payload and sum zero (mod 256).
+ * - HELLO: width u16, height u16, pixel format u8 (0 = RGB565). Sent on
+ *   (re)start; the host clears its screen.
+ * - ROW: y u16, then one row of RLE packets as in screenshot.h.
+ */
+
+#ifndef MEAS_SYS_REMOTE_DISPLAY_H
+#define MEAS_SYS_REMOTE_DISPLAY_H
+
+#include "measlib/core/io.h"
+#include "measlib/ui/core.h"
+#include <stdint.h>
+
+/**
+ * @brief Transmit buffer size (two are used, ping-pong).
+ * Must hold one worst-case row message.
+ */
+#ifndef MEAS_REMOTE_TX_SIZE
+#define MEAS_REMOTE_TX_SIZE 1024
+#endif
+
+#define MEAS_REMOTE_SYNC0 0xA5
+#define MEAS_REMOTE_SYNC1 0x5A
+
+/**
+ * @brief Message Types
+ */
+typedef enum {
+  MEAS_REMOTE_MSG_HELLO = 0x01,
+  MEAS_REMOTE_MSG_ROW = 0x02,
+} meas_remote_msg_t;
+
+/**
+ * @brief Link Statistics
+ */
+typedef struct {
+  uint32_t bytes;        /**< Bytes handed to the stream */
+  uint32_t rows_sent;    /**< Rows encoded */
+  uint32_t rows_skipped; /**< Redrawn rows found unchanged */
+} meas_remote_stats_t;
+
+/**
+ * @brief Start mirroring to @p io.
+ * Sends HELLO and redraws @p ui fully so the host gets a complete screen.
+ */
+meas_status_t meas_remote_display_start(meas_io_t *io, meas_ui_t *ui);
+
+/**
+ * @brief Stop mirroring (the render service hook is removed).
+ */
+void meas_remote_display_stop(void);
+
+/**
+ * @brief Resend the whole screen (e.g. host reconnected or lost sync).
+ */
+void meas_remote_display_refresh(void);
+
+/**
+ * @brief Statistics since start.
+ */
+meas_remote_stats_t meas_remote_display_stats(void);
+
+#endif // MEAS_SYS_REMOTE_DISPLAY_H
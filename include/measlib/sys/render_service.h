@@ -10,6 +10,68 @@
 #define MEAS_SYS_RENDER_SERVICE_H
 
 #include "measlib/ui/core.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Default tiles rendered per update call.
+ */
+#ifndef MEAS_RENDER_TILES_PER_UPDATE
+#define MEAS_RENDER_TILES_PER_UPDATE 6
+#endif
+
+/**
+ * @brief Default time budget per update call (ms).
+ */
+#ifndef MEAS_RENDER_BUDGET_MS
+#define MEAS_RENDER_BUDGET_MS 4
+#endif
+
+/**
+ * @brief Default frame-rate cap (frames started per second).
+ */
+#ifndef MEAS_RENDER_TARGET_FPS
+#define MEAS_RENDER_TARGET_FPS 30
+#endif
+
+/**
+ * @brief Tile buffers (1 or 2).
+ * Two let rasterizing overlap the LCD DMA of the previous tile; one halves
+ * the tile RAM and waits for each transfer before drawing the next tile.
+ */
+#ifndef MEAS_RENDER_TILE_BUFFERS
+#define MEAS_RENDER_TILE_BUFFERS 2
+#endif
+
+#if MEAS_RENDER_TILE_BUFFERS < 1 || MEAS_RENDER_TILE_BUFFERS > 2
+#error "MEAS_RENDER_TILE_BUFFERS must be 1 or 2"
+#endif
+
+/**
+ * @brief Placement of the CPU-only pools (display list, static layer cache).
+ * Tile and line buffers are DMA sources and stay in main SRAM. The pools are
+ * only touched by the CPU; on the STM32F303 they go to the CCM, which DMA
+ * cannot reach.
+ */
+#ifndef MEAS_RENDER_POOL_RAM
+#if defined(F303)
+#define MEAS_RENDER_POOL_RAM __attribute__((section(".ccm")))
+#else
+#define MEAS_RENDER_POOL_RAM
+#endif
+#endif
+
+/**
+ * @brief RAM budgets of the service (bytes), checked at compile time.
+ * DMA: tile and line buffers. Pools: display list and layer cache (fits the
+ * 8 KB STM32F303 CCM).
+ */
+#ifndef MEAS_RENDER_DMA_RAM_BUDGET
+#define MEAS_RENDER_DMA_RAM_BUDGET 12288
+#endif
+#ifndef MEAS_RENDER_POOL_RAM_BUDGET
+#define MEAS_RENDER_POOL_RAM_BUDGET 8192
+#endif
 
 /**
  * @brief Initialize the Render Service.
@@ -20,8 +82,55 @@ meas_ui_t *meas_render_service_init(void *display_ctx);
 
 /**
  * @brief Poll/Update the Render Service.
- * Draws the next frame if needed.
+ * Starts a frame when tiles are dirty and the frame slot is due, then renders
+ * a bounded slice of it. Call every superloop pass until the frame is done.
  */
 void meas_render_service_update(void);
 
+/**
+ * @brief Limit the work of one update call.
+ * @param max_tiles Tiles per call (at least 1).
+ * @param budget_ms Stop starting new tiles after this long (0 = no limit).
+ */
+void meas_render_service_set_budget(uint8_t max_tiles, uint16_t budget_ms);
+
+/**
+ * @brief Cap the frame rate.
+ * @param fps Frames started per second (0 = as fast as invalidated).
+ */
+void meas_render_service_set_frame_rate(uint8_t fps);
+
+/**
+ * @brief Check whether a frame is partially rendered.
+ */
+bool meas_render_service_busy(void);
+
+/**
+ * @brief Strip Callback for meas_render_service_capture().
+ * @param y First screen row of the strip.
+ * @param pixels Strip pixels, row-major, MEAS_UI_SCREEN_WIDTH per row.
+ * @param h Rows in the strip.
+ * @return MEAS_OK to continue; anything else aborts the capture.
+ */
+typedef meas_status_t (*meas_render_strip_cb_t)(void *user_data, int16_t y,
+                                                const meas_pixel_t *pixels,
+                                                int16_t h);
+
+/**
+ * @brief Observe every tile sent to the LCD (e.g. remote display).
+ * Called right after the tile's transfer starts; the pixels stay valid for
+ * the duration of the call. The return value is ignored. NULL removes it.
+ */
+void meas_render_service_set_tile_hook(meas_render_strip_cb_t cb,
+                                       void *user_data);
+
+/**
+ * @brief Re-render the whole screen strip by strip (no LCD output).
+ * Each tile is drawn into the service's own tile buffer and handed to @p cb,
+ * so a capture needs no framebuffer. Blocks until done; the display frame in
+ * progress (if any) is not disturbed.
+ */
+meas_status_t meas_render_service_capture(meas_render_strip_cb_t cb,
+                                          void *user_data);
+
 #endif // MEAS_SYS_RENDER_SERVICE_H
@@ -0,0 +1,66 @@
+/**
+ * @file scpi_block.h
+ * @brief SCPI Array Responses (IEEE 488.2 Definite-Length Blocks).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Binary responses are sent as "#<n><length><payload>"; the core ends the
+ * response message after the last query. Arrays of meas_real_t follow the
+ * context's FORMat settings. When the requested encoding is the native one
+ * (REAL,64 in host byte order) the source buffer itself is handed to the
+ * link; other encodings are converted through a small staging buffer.
+ *
+ * Array responses are resumable: when the link takes fewer bytes than
+ * offered, the writer returns SCPI_RES_PENDING and continues from
+ * scpi_resume() once the link has drained.
+ */
+
+#ifndef MEASLIB_SYS_SCPI_BLOCK_H
+#define MEASLIB_SYS_SCPI_BLOCK_H
+
+#include "measlib/sys/scpi/scpi_types.h"
+#include "measlib/types.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Staging buffer for converted block payloads (bytes).
+ */
+#ifndef SCPI_BLOCK_STAGE_SIZE
+#define SCPI_BLOCK_STAGE_SIZE 128
+#endif
+
+/**
+ * @brief Write the "#<n><length>" header of a definite-length block.
+ * The caller then writes exactly @p len payload bytes.
+ * @return false if the link did not take the header.
+ */
+bool scpi_write_block_header(scpi_context_t *ctx, size_t len);
+
+/**
+ * @brief Write a complete block response from one buffer (no copy).
+ * @p data must stay valid while the response is pending.
+ */
+scpi_status_t scpi_write_block(scpi_context_t *ctx, const void *data,
+                               size_t len);
+
+/**
+ * @brief Write an array in the context's FORMat (ASCii text or a block).
+ *
+ * @param ctx SCPI context.
+ * @param values Source values (sent in place when the encoding is native);
+ *               must stay valid while the response is pending.
+ * @param count Number of values.
+ * @return SCPI_RES_OK, SCPI_RES_PENDING if the link filled up, or
+ *         SCPI_RES_ERR_EXECUTION.
+ */
+scpi_status_t scpi_write_reals(scpi_context_t *ctx, const meas_real_t *values,
+                               size_t count);
+
+/**
+ * @brief Bytes per value of a FORMat (0 for ASCii).
+ */
+size_t scpi_format_width(scpi_format_t format);
+
+#endif // MEASLIB_SYS_SCPI_BLOCK_H
@@ -4,6 +4,18 @@
  *
  * @author Architected by momentics <momentics@gmail.com>
  * @copyright (c) 2026 momentics
+ *
+ * A line is an IEEE 488.2 program message: units separated by ';'. A unit
+ * header starting with ':' is absolute, one starting with '*' is a common
+ * command, and any other is relative to the level of the previous unit's
+ * command (falling back to the root), so "FORM:BORD SWAP;DATA REAL,64"
+ * sets both FORMat settings. The responses of all queries in a message
+ * form one response message ("a;b;c\r\n").
+ *
+ * Input is parsed on receipt into a queue of units and executed from it,
+ * so the link keeps being read while a unit is pending. Overlapped commands
+ * (INITiate, MMEMory:STORe) only start their operation; *OPC? and *WAI
+ * wait for it without holding up the parser.
  */
 
 #ifndef MEASLIB_SYS_SCPI_CORE_H
@@ -26,6 +38,8 @@ void scpi_init(scpi_context_t *ctx, char *buffer, size_t buffer_len,
 
 /**
  * @brief Process an input string
+ * For links that take every write: a response that stalls is dropped
+ * (SCPI_RES_ERR_EXECUTION) and the remaining input is still processed.
  * @param ctx Pointer to context
  * @param data Input data
  * @param len Length of data
@@ -33,11 +47,94 @@ void scpi_init(scpi_context_t *ctx, char *buffer, size_t buffer_len,
  */
 scpi_status_t scpi_process(scpi_context_t *ctx, const char *data, size_t len);
 
+/**
+ * @brief Queue input without executing it
+ * Complete lines are split into units and their headers resolved at once;
+ * the units wait in the context's queue for scpi_execute(). Input is taken
+ * while a unit is pending, up to SCPI_QUEUE_DEPTH queued units.
+ * @param ctx Pointer to context
+ * @param data Input data
+ * @param len Length of data
+ * @return Bytes consumed; the rest is taken once the queue has room
+ */
+size_t scpi_receive(scpi_context_t *ctx, const char *data, size_t len);
+
+/**
+ * @brief Execute queued units
+ * Continues a pending unit first, then runs the queue until it is empty or
+ * a unit goes pending (a response the link cannot hold yet, *WAI).
+ * @param ctx Pointer to context
+ * @return SCPI_RES_PENDING if a unit is pending, otherwise the status of
+ *         the last unit executed
+ */
+scpi_status_t scpi_execute(scpi_context_t *ctx);
+
+/**
+ * @brief Receive and execute input
+ * @param ctx Pointer to context
+ * @param data Input data
+ * @param len Length of data
+ * @param[out] status Status of the last command (may be NULL)
+ * @return Bytes consumed; less than @p len only while a unit is pending
+ *         and the queue is full
+ */
+size_t scpi_feed(scpi_context_t *ctx, const char *data, size_t len,
+                 scpi_status_t *status);
+
+/**
+ * @brief Continue a pending unit and the queue behind it (same as
+ * scpi_execute(); call when the link has room or an operation completed)
+ * @param ctx Pointer to context
+ * @return SCPI_RES_PENDING while a unit is pending, otherwise the final status
+ */
+scpi_status_t scpi_resume(scpi_context_t *ctx);
+
+/**
+ * @brief Number of parsed units waiting (including a pending one)
+ */
+size_t scpi_queued(const scpi_context_t *ctx);
+
+/**
+ * @brief True while a unit is pending (response or wait in progress)
+ */
+bool scpi_busy(const scpi_context_t *ctx);
+
+/**
+ * @brief Run a command step now and again from scpi_resume() while it
+ * returns SCPI_RES_PENDING (resumable responses, *WAI-style waits)
+ * @param ctx Pointer to context
+ * @param step Step function; writes through scpi_write() may come up short
+ * @return Result of the first step
+ */
+scpi_status_t scpi_defer(scpi_context_t *ctx, scpi_resume_t step);
+
+/**
+ * @brief Write response data of the current query
+ * Queries of one message share one response: the ';' separator goes before
+ * each query's data and the terminator after the last. Handlers write only
+ * their data.
+ * @return Bytes taken (see scpi_write_t)
+ */
+size_t scpi_write(scpi_context_t *ctx, const char *data, size_t len);
+
 /**
  * @brief Register the command tree
+ * The tree is compiled into a perfect hash table (see scpi_hash.h), so header
+ * lookup does not depend on the number of commands. Registering the current
+ * tree again is a no-op.
+ * @param root Root of the command tree
+ * @return true if compiled; false if it exceeds the hash limits (lookup then
+ *         walks the tree linearly)
+ */
+bool scpi_register_tree(const scpi_command_t *root);
+
+/**
+ * @brief Register a tree whose lists were changed in place (always
+ * recompiles; see scpi_register_tree())
  * @param root Root of the command tree
+ * @return true if compiled
  */
-void scpi_register_tree(const scpi_command_t *root);
+bool scpi_rebuild_tree(const scpi_command_t *root);
 
 /**
  * @brief Get the next parameter from the context
@@ -64,4 +161,17 @@ scpi_status_t scpi_param_int(scpi_context_t *ctx, int32_t *val);
  */
 scpi_status_t scpi_param_float(scpi_context_t *ctx, float *val);
 
+/**
+ * @brief Get the next parameter as a number with an optional suffix
+ * The suffix is an IEEE 488.2 multiplier followed by the unit, either part
+ * optional: "1.5GHZ", "100 k", "10 Hz", "500 MV". Any case, so M is milli
+ * and MA mega; MHZ and MOHM are the SCPI exceptions meaning mega.
+ * @param ctx Context
+ * @param unit Accepted unit (e.g. "HZ"; NULL: multipliers only)
+ * @param val Output value
+ * @return SCPI_RES_ERR_INVALID_SUFFIX for any other suffix
+ */
+scpi_status_t scpi_param_number(scpi_context_t *ctx, const char *unit,
+                                double *val);
+
 #endif // MEASLIB_SYS_SCPI_CORE_H
@@ -0,0 +1,74 @@
+/**
+ * @file scpi_def.h
+ * @brief SCPI Command Set of the Instrument.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#ifndef MEASLIB_SYS_SCPI_DEF_H
+#define MEASLIB_SYS_SCPI_DEF_H
+
+#include "measlib/core/channel.h"
+#include "measlib/core/storage.h"
+#include "measlib/core/trace.h"
+#include <stdint.h>
+
+/**
+ * @brief Traces readable through TRACe:DATA? / TRACe:STIMulus?
+ */
+#ifndef SCPI_DEF_MAX_TRACES
+#define SCPI_DEF_MAX_TRACES 4
+#endif
+
+/**
+ * @brief Bytes written to a file per scpi_def_poll() by MMEMory:STORe.
+ */
+#ifndef SCPI_DEF_STORE_CHUNK
+#define SCPI_DEF_STORE_CHUNK 256
+#endif
+
+/**
+ * @brief Top-level subsystems generated from property descriptors.
+ */
+#ifndef SCPI_DEF_MAX_PROP_ROOTS
+#define SCPI_DEF_MAX_PROP_ROOTS 4
+#endif
+
+/**
+ * @brief Register the command tree.
+ */
+void scpi_def_init(void);
+
+/**
+ * @brief Expose a trace to remote readout.
+ * @param n Trace number as used in the commands (1..SCPI_DEF_MAX_TRACES).
+ * @param trace Trace object (NULL removes it).
+ */
+void scpi_def_set_trace(uint8_t n, meas_trace_t *trace);
+
+/**
+ * @brief Set the channel swept by INITiate.
+ * Its sweep-completion event ends the operation *OPC / *OPC? / *WAI wait
+ * for (see MEAS_CHANNEL_SWEEP_DONE). Its property descriptors become
+ * commands (e.g. SENSe:FREQuency:STARt, see scpi_prop.h); the tree is
+ * rebuilt, so call this while no SCPI input is queued.
+ * @param ch Channel (NULL: INITiate fails).
+ */
+void scpi_def_set_channel(meas_channel_t *ch);
+
+/**
+ * @brief Set the filesystem used by MMEMory commands.
+ * @param fs Filesystem API (NULL: MMEMory commands fail).
+ * @param drv Filesystem driver instance.
+ */
+void scpi_def_set_storage(const meas_fs_api_t *fs, meas_object_t *drv);
+
+/**
+ * @brief Advance overlapped operations (MMEMory:STORe file writes).
+ * Call from the superloop; each call writes at most SCPI_DEF_STORE_CHUNK
+ * bytes.
+ */
+void scpi_def_poll(void);
+
+#endif // MEASLIB_SYS_SCPI_DEF_H
@@ -0,0 +1,79 @@
+/**
+ * @file scpi_hash.h
+ * @brief SCPI Command Tree Compiler (Perfect Hash).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Compiles a `scpi_command_t` tree once, when it is registered, into a single
+ * static perfect hash table. Every command list of the tree gets a level id;
+ * the keys are (level, normalized header), with both the short form ("MEAS?",
+ * lowercase letters dropped) and the long form ("MEASURE?") of each pattern.
+ *
+ * Placement uses hash-and-displace: keys are grouped into buckets, and each
+ * bucket gets a displacement that sends all of its keys to free slots. A
+ * lookup hashes the token once, reads one displacement and one slot, and
+ * verifies the single candidate, so a header costs O(token length)
+ * regardless of the vocabulary size.
+ */
+
+#ifndef MEASLIB_SYS_SCPI_HASH_H
+#define MEASLIB_SYS_SCPI_HASH_H
+
+#include "measlib/sys/scpi/scpi_types.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Commands over all levels of the tree (at most 254).
+ */
+#ifndef SCPI_HASH_MAX_COMMANDS
+#define SCPI_HASH_MAX_COMMANDS 128
+#endif
+
+/**
+ * @brief Command lists (levels) in the tree (at most 254).
+ */
+#ifndef SCPI_HASH_MAX_LEVELS
+#define SCPI_HASH_MAX_LEVELS 32
+#endif
+
+/**
+ * @brief Hash slots (power of two, at least two per command).
+ */
+#ifndef SCPI_HASH_SLOTS
+#define SCPI_HASH_SLOTS 256
+#endif
+
+#if SCPI_HASH_MAX_COMMANDS > 254 || SCPI_HASH_MAX_LEVELS > 254
+#error "SCPI hash ids are 8-bit"
+#endif
+#if (SCPI_HASH_SLOTS & (SCPI_HASH_SLOTS - 1)) != 0
+#error "SCPI_HASH_SLOTS must be a power of two"
+#endif
+
+/**
+ * @brief Level id of the root command list.
+ */
+#define SCPI_HASH_ROOT 0
+
+/**
+ * @brief Compile a command tree into the hash table.
+ *
+ * @param root Root command list (NULL clears the table).
+ * @return false if the tree exceeds the table limits or has duplicate
+ *         headers on one level; the table is then empty.
+ */
+bool scpi_hash_compile(const scpi_command_t *root);
+
+/**
+ * @brief Look up a header token on a level.
+ *
+ * @param[in,out] level Level to search; on success, the level of the
+ *                      command's children.
+ * @param token Header token (NUL-terminated, any case).
+ * @return The matching command, or NULL.
+ */
+const scpi_command_t *scpi_hash_find(uint8_t *level, const char *token);
+
+#endif // MEASLIB_SYS_SCPI_HASH_H
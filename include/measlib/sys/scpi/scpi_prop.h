@@ -0,0 +1,78 @@
+/**
+ * @file scpi_prop.h
+ * @brief SCPI Commands Generated from Property Descriptors.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Objects that describe their properties (meas_object_get_props()) are
+ * bound once; the SCPI header paths of their descriptors are then merged
+ * into command lists. "SENSe:FREQuency:STARt" gives "STARt <value>" and
+ * "STARt?" under shared "SENSe" and "FREQuency" nodes.
+ *
+ * All generated commands share one set and one query callback, which find
+ * the property through the command's user_data and go through
+ * meas_object_set_prop() / meas_object_get_prop(). Numeric values take the
+ * descriptor's unit and k/M/G multipliers (scpi_param_number()) or
+ * MINimum / MAXimum, and are checked against the descriptor's range.
+ * Adding a property to a descriptor table adds its commands.
+ */
+
+#ifndef MEASLIB_SYS_SCPI_PROP_H
+#define MEASLIB_SYS_SCPI_PROP_H
+
+#include "measlib/core/object.h"
+#include "measlib/sys/scpi/scpi_types.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Bound properties (over all objects).
+ */
+#ifndef SCPI_PROP_MAX_BINDINGS
+#define SCPI_PROP_MAX_BINDINGS 16
+#endif
+
+/**
+ * @brief Generated command entries below the root (including list ends).
+ */
+#ifndef SCPI_PROP_MAX_NODES
+#define SCPI_PROP_MAX_NODES 48
+#endif
+
+/**
+ * @brief Storage for generated header patterns (bytes).
+ */
+#ifndef SCPI_PROP_TEXT_SIZE
+#define SCPI_PROP_TEXT_SIZE 256
+#endif
+
+#if SCPI_PROP_MAX_BINDINGS > 255
+#error "SCPI property bindings are 8-bit"
+#endif
+
+/**
+ * @brief Drop all bindings and generated commands.
+ * The generated lists must not be registered (or queued) any more.
+ */
+void scpi_prop_reset(void);
+
+/**
+ * @brief Bind the SCPI-visible properties of an object.
+ * Descriptors with a header path and an INT64, REAL or BOOL type are used.
+ * @param obj Object (kept; must outlive the bindings).
+ * @return false if the bindings are full (those that fit are kept).
+ */
+bool scpi_prop_bind(meas_object_t *obj);
+
+/**
+ * @brief Generate the command lists of all bound properties.
+ * Builds from scratch on each call.
+ * @param list Receives the top-level entries (no list end is written).
+ * @param cap Entries available in @p list.
+ * @return Entries written; 0 if the tree did not fit the limits or two
+ *         properties share a header path.
+ */
+size_t scpi_prop_build(scpi_command_t *list, size_t cap);
+
+#endif // MEASLIB_SYS_SCPI_PROP_H
@@ -0,0 +1,109 @@
+/**
+ * @file scpi_status.h
+ * @brief SCPI Status Model (IEEE 488.2 Status Byte / Event Status).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * The Standard Event Status Register (ESR) latches events until read by
+ * *ESR? or cleared by *CLS; *ESE selects which of them set the ESB summary
+ * bit of the Status Byte. *SRE selects the Status Byte bits that request
+ * service (MSS / RQS), which is reported through an optional handler.
+ *
+ * Overlapped commands (INITiate) register as pending operations. *OPC sets
+ * the OPC event once none is left, *OPC? answers "1" at that moment, and
+ * *WAI holds the following commands until then.
+ */
+
+#ifndef MEASLIB_SYS_SCPI_STATUS_H
+#define MEASLIB_SYS_SCPI_STATUS_H
+
+#include "measlib/sys/scpi/scpi_types.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Standard Event Status Register bits
+#define SCPI_ESR_OPC 0x01 // Operation Complete
+#define SCPI_ESR_QYE 0x04 // Query Error
+#define SCPI_ESR_DDE 0x08 // Device-Dependent Error
+#define SCPI_ESR_EXE 0x10 // Execution Error
+#define SCPI_ESR_CME 0x20 // Command Error
+#define SCPI_ESR_PON 0x80 // Power On
+
+// Status Byte bits
+#define SCPI_STB_ESB 0x20 // Enabled standard event latched
+#define SCPI_STB_MSS 0x40 // Master summary (service requested)
+
+/**
+ * @brief Service request handler (e.g. USBTMC interrupt-IN notification).
+ * @param user User pointer.
+ * @param stb Status byte at the time of the request.
+ */
+typedef void (*scpi_srq_cb_t)(void *user, uint8_t stb);
+
+/**
+ * @brief Power-on state: registers cleared, PON latched, no pending
+ * operations.
+ */
+void scpi_status_init(void);
+
+/**
+ * @brief Set the service request handler (NULL: none).
+ */
+void scpi_status_set_srq_handler(scpi_srq_cb_t cb, void *user);
+
+/**
+ * @brief Latch standard events (SCPI_ESR_* bits).
+ */
+void scpi_status_event(uint8_t bits);
+
+/**
+ * @brief Latch the event class of a command result (CME, EXE).
+ */
+void scpi_status_error(scpi_status_t res);
+
+/**
+ * @brief Status Byte (*STB?).
+ */
+uint8_t scpi_status_byte(void);
+
+/**
+ * @brief Read and clear the ESR (*ESR?).
+ */
+uint8_t scpi_status_read_esr(void);
+
+/**
+ * @brief Set the enable masks (*ESE, *SRE).
+ */
+void scpi_status_set_ese(uint8_t mask);
+void scpi_status_set_sre(uint8_t mask);
+uint8_t scpi_status_ese(void);
+uint8_t scpi_status_sre(void);
+
+/**
+ * @brief Clear the event registers (*CLS); cancels a pending *OPC.
+ */
+void scpi_status_clear(void);
+
+/**
+ * @brief Register the start / end of an overlapped operation.
+ */
+void scpi_status_op_begin(void);
+void scpi_status_op_end(void);
+
+/**
+ * @brief True while an overlapped operation is in progress.
+ */
+bool scpi_status_op_pending(void);
+
+/**
+ * @brief *OPC: latch OPC once no operation is pending.
+ */
+void scpi_status_opc(void);
+
+/**
+ * @brief Forget pending operations and a pending *OPC (*RST, abort).
+ */
+void scpi_status_op_reset(void);
+
+#endif // MEASLIB_SYS_SCPI_STATUS_H
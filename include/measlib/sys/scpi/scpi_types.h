@@ -16,18 +16,60 @@
 // SCPI Status Codes
 typedef enum {
   SCPI_RES_OK = 0,
+  SCPI_RES_PENDING = 1, // Response continues once the link has room
   SCPI_RES_ERR_SYNTAX = -100,
   SCPI_RES_ERR_INVALID_HEADER = -113,
   SCPI_RES_ERR_PARAM_NOT_ALLOWED = -108,
   SCPI_RES_ERR_MISSING_PARAM = -109,
   SCPI_RES_ERR_DATA_TYPE = -104,
+  SCPI_RES_ERR_INVALID_SUFFIX = -131,
+  SCPI_RES_ERR_EXECUTION = -200,
+  SCPI_RES_ERR_OUT_OF_RANGE = -222,
+  SCPI_RES_ERR_TOO_MUCH_DATA = -223,
 } scpi_status_t;
 
+/**
+ * @brief Parsed units waiting for execution.
+ */
+#ifndef SCPI_QUEUE_DEPTH
+#define SCPI_QUEUE_DEPTH 8
+#endif
+
+/**
+ * @brief Longest parameter text of one queued unit (including the NUL).
+ */
+#ifndef SCPI_QUEUE_PARAM_LEN
+#define SCPI_QUEUE_PARAM_LEN 48
+#endif
+
+// Response data format (FORMat[:DATA])
+typedef enum {
+  SCPI_FORMAT_ASCII = 0, // Comma-separated text (*RST default)
+  SCPI_FORMAT_REAL32,    // IEEE 754 single, definite-length block
+  SCPI_FORMAT_REAL64,    // IEEE 754 double, definite-length block
+  SCPI_FORMAT_INT32,     // Two's complement 32-bit, definite-length block
+} scpi_format_t;
+
 // Context structure
 struct scpi_context_s;
+
+// Returns the bytes taken. While a resumable response is active
+// (ctx->resume set) fewer than len means the link is full; otherwise the
+// write blocks until everything is taken or the link is gone.
 typedef size_t (*scpi_write_t)(struct scpi_context_s *ctx, const char *data,
                                size_t len);
 
+// Continues a response; SCPI_RES_PENDING while more remains
+typedef scpi_status_t (*scpi_resume_t)(struct scpi_context_s *ctx);
+
+// A program message unit, parsed on receipt and executed later
+typedef struct {
+  const struct scpi_command_s *cmd; // NULL: no command (see error)
+  scpi_status_t error;              // Parse error, reported when executed
+  bool last;                        // Ends its program message
+  char params[SCPI_QUEUE_PARAM_LEN];
+} scpi_unit_t;
+
 typedef struct scpi_context_s {
   char *buffer;
   size_t buffer_len;
@@ -35,6 +77,22 @@ typedef struct scpi_context_s {
   void *user_context;
   scpi_write_t write;
   char *params; // Pointer to current command parameters
+  scpi_format_t format; // FORMat[:DATA]
+  bool swapped;         // FORMat:BORDer SWAPped (least significant first)
+  scpi_resume_t resume; // Unit in progress (the queue waits for it)
+  // Parser state (IEEE 488.2 compound messages)
+  char *next_unit; // Units of the received line not yet queued
+  const struct scpi_command_s *path; // Header path kept across ';'
+  uint8_t path_level;                // Hash level of the path
+  // Parsed units, oldest first
+  scpi_unit_t queue[SCPI_QUEUE_DEPTH];
+  uint8_t queue_head;
+  uint8_t queue_count;
+  // Execution state of the message at the head of the queue
+  const struct scpi_command_s *command; // Command being executed
+  bool answered; // A query of this message has responded
+  bool separate; // ';' owed before the next response data
+  bool discard;  // An error skips the rest of the message
 } scpi_context_t;
 
 // Callback function type
@@ -45,8 +103,9 @@ typedef struct scpi_command_s {
   const char *pattern;
   scpi_callback_t callback;
   const struct scpi_command_s *children;
+  const void *user_data; // For callbacks shared by several commands
 } scpi_command_t;
 
-#define SCPI_CMD_LIST_END {NULL, NULL, NULL}
+#define SCPI_CMD_LIST_END {NULL, NULL, NULL, NULL}
 
 #endif // MEASLIB_SYS_SCPI_TYPES_H
@@ -16,4 +16,12 @@ bool scpi_strncasecmp(const char *s1, const char *s2, size_t n);
 bool scpi_is_separator(char c);
 bool scpi_is_terminator(char c);
 
+/**
+ * @brief Compare a header token with one form of a command pattern.
+ * The long form is the whole pattern ("MEASure?" -> "MEASURE?"), the short
+ * form drops its lowercase letters ("MEAS?"). Case-insensitive.
+ */
+bool scpi_header_match(const char *pattern, const char *token,
+                       bool short_form);
+
 #endif // MEASLIB_SYS_SCPI_UTILS_H
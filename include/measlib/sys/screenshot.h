@@ -0,0 +1,72 @@
+/**
+ * @file screenshot.h
+ * @brief Streaming Screenshot Export.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * There is no framebuffer to read back, so a screenshot re-renders the screen
+ * tile by tile (meas_render_service_capture) and streams each strip out as it
+ * is produced. Memory use is the render service's tile buffer plus a few
+ * bytes of staging for headers.
+ *
+ * Formats (all multi-byte fields little-endian, pixels RGB565):
+ * - BMP: 16 bpp BI_BITFIELDS with a negative height (rows top-down), so rows
+ *   can be written in render order.
+ * - RLE: "MRLE", uint16 width, uint16 height, then each row as packets that
+ *   never span rows. Header byte `h`: bit 7 set = run of (h & 0x7F) + 1
+ *   copies of the following pixel; clear = h + 1 literal pixels follow.
+ */
+
+#ifndef MEAS_SYS_SCREENSHOT_H
+#define MEAS_SYS_SCREENSHOT_H
+
+#include "measlib/core/io.h"
+#include "measlib/core/storage.h"
+#include "measlib/types.h"
+#include <stddef.h>
+
+/**
+ * @brief Output Formats
+ */
+typedef enum {
+  MEAS_SCREENSHOT_BMP = 0, /**< Uncompressed Windows bitmap */
+  MEAS_SCREENSHOT_RLE,     /**< Row packets (see file header) */
+} meas_screenshot_format_t;
+
+/**
+ * @brief Byte Sink
+ * Called with chunks in file order; @p data is only valid during the call.
+ */
+typedef meas_status_t (*meas_screenshot_write_t)(void *user_data,
+                                                 const void *data,
+                                                 size_t size);
+
+/**
+ * @brief Stream a screenshot to a sink.
+ */
+meas_status_t meas_screenshot_write(meas_screenshot_format_t format,
+                                    meas_screenshot_write_t write,
+                                    void *user_data);
+
+/**
+ * @brief Size of the screenshot in bytes.
+ * Constant for BMP; RLE runs a counting pass (a full re-render).
+ */
+size_t meas_screenshot_size(meas_screenshot_format_t format);
+
+/**
+ * @brief Stream a screenshot to an IO stream (e.g. USB CDC).
+ * Each chunk is flushed before its buffer is reused.
+ */
+meas_status_t meas_screenshot_to_io(meas_io_t *io,
+                                    meas_screenshot_format_t format);
+
+/**
+ * @brief Write a screenshot to an open file.
+ */
+meas_status_t meas_screenshot_to_file(const meas_fs_api_t *fs,
+                                      meas_file_t *file,
+                                      meas_screenshot_format_t format);
+
+#endif // MEAS_SYS_SCREENSHOT_H
@@ -4,21 +4,51 @@
  *
  * @author Architected by momentics <momentics@gmail.com>
  * @copyright (c) 2026 momentics
+ *
+ * SCPI responses go into a transmit ring instead of straight to the link.
+ * The ring is drained in packets: a transfer starts once a packet's worth
+ * is buffered (or the response is complete), and with an asynchronous link
+ * each endpoint-complete interrupt starts the next one. When the ring is
+ * full, array responses return and continue on a later poll, so a long
+ * query does not hold up the superloop.
+ *
+ * Input is read and parsed into the SCPI unit queue on every poll, also
+ * while a response or *WAI is pending; only a full queue stops reading.
  */
 
 #ifndef MEAS_SYS_SHELL_SERVICE_H
 #define MEAS_SYS_SHELL_SERVICE_H
 
+#include "measlib/types.h"
+
 /**
- * @brief Initialize the Shell Service.
- * @param link Pointer to the communication link API (e.g. USB CDC).
- * @param ctx Pointer to the link context.
+ * @brief Transmit ring size (bytes, power of two).
  */
-#include "measlib/types.h"
+#ifndef MEAS_SHELL_TX_SIZE
+#define MEAS_SHELL_TX_SIZE 512
+#endif
+
+/**
+ * @brief Largest single link transfer (USB FS bulk packet).
+ */
+#ifndef MEAS_SHELL_TX_CHUNK
+#define MEAS_SHELL_TX_CHUNK 64
+#endif
+
+/**
+ * @brief Buffered bytes that start a transfer before the response ends.
+ */
+#ifndef MEAS_SHELL_TX_WATERMARK
+#define MEAS_SHELL_TX_WATERMARK MEAS_SHELL_TX_CHUNK
+#endif
+
+#if (MEAS_SHELL_TX_SIZE & (MEAS_SHELL_TX_SIZE - 1)) != 0
+#error "MEAS_SHELL_TX_SIZE must be a power of two"
+#endif
 
 /**
  * @brief Initialize the Shell Service.
- * @param link Pointer to the communication link API (e.g. USB CDC).
+ * @param link_api Pointer to the communication link API (e.g. USB CDC).
  * @param ctx Pointer to the link context.
  * @return MEAS_OK on success.
  */
@@ -26,8 +56,14 @@ meas_status_t meas_shell_service_init(const void *link_api, void *ctx);
 
 /**
  * @brief Poll the Shell Service.
- * Reads input and processes commands (or echoes).
+ * Advances overlapped operations, reads and queues input, executes queued
+ * units, and flushes the transmit ring. Returns without waiting for the link.
  */
 void meas_shell_service_poll(void);
 
+/**
+ * @brief Bytes in the transmit ring (including the transfer in flight).
+ */
+size_t meas_shell_service_tx_pending(void);
+
 #endif // MEAS_SYS_SHELL_SERVICE_H
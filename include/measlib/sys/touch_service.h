@@ -20,7 +20,8 @@ void meas_touch_service_init(const meas_hal_touch_api_t *api, void *ctx);
 
 /**
  * @brief Poll the touch panel.
- * Dispatches EVENT_INPUT_TOUCH if pressed.
+ * Feeds the gesture recognizer and publishes EVENT_INPUT_GESTURE events
+ * (press, release, tap, long press, drag/zoom steps, fling, inertial scroll).
  */
 void meas_touch_service_poll(void);
 
@@ -0,0 +1,33 @@
+/**
+ * @file button.h
+ * @brief Push Button Widget.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#ifndef MEASLIB_UI_COMPONENTS_BUTTON_H
+#define MEASLIB_UI_COMPONENTS_BUTTON_H
+
+#include "measlib/ui/components/widget.h"
+
+/**
+ * @brief Push Button
+ * Shows the pressed state while the finger is down; clicks on TAP.
+ */
+typedef struct {
+  meas_widget_t base;
+  const char *text;
+  void (*on_click)(void *user_data);
+  void *user_data;
+} meas_button_t;
+
+void meas_button_init(meas_button_t *b, meas_rect_t bounds, const char *text,
+                      void (*on_click)(void *user_data), void *user_data);
+
+/**
+ * @brief Change the caption (redraws only if the pointer differs).
+ */
+void meas_button_set_text(meas_button_t *b, const char *text);
+
+#endif // MEASLIB_UI_COMPONENTS_BUTTON_H
@@ -0,0 +1,49 @@
+/**
+ * @file graph.h
+ * @brief Trace Graph Widget.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#ifndef MEASLIB_UI_COMPONENTS_GRAPH_H
+#define MEASLIB_UI_COMPONENTS_GRAPH_H
+
+#include "measlib/ui/components/widget.h"
+
+/**
+ * @brief Pan/Zoom Callback (pixel deltas from the gesture).
+ */
+typedef void (*meas_graph_move_cb_t)(void *user_data, int16_t dx, int16_t dy);
+
+/**
+ * @brief Trace Graph
+ * Draws a polyline already scaled to screen coordinates. Drags and inertial
+ * scrolls are reported as pan, long-press drags as zoom; the owner rescales
+ * and calls meas_graph_set_trace().
+ *
+ * The points are referenced, also by the display list of the frame being
+ * rendered: they must stay valid, and unchanged while
+ * meas_render_service_busy(). Owners updating traces at sweep rate keep two
+ * buffers and hand over the one just filled.
+ */
+typedef struct {
+  meas_widget_t base;
+  const meas_point_t *points; /**< Not copied (see below) */
+  uint16_t count;
+  meas_pixel_t trace_color;
+  meas_graph_move_cb_t on_pan;
+  meas_graph_move_cb_t on_zoom;
+  void *user_data;
+} meas_graph_t;
+
+void meas_graph_init(meas_graph_t *g, meas_rect_t bounds,
+                     meas_pixel_t trace_color);
+
+/**
+ * @brief Set the trace (always redraws: point contents may have changed).
+ */
+void meas_graph_set_trace(meas_graph_t *g, const meas_point_t *points,
+                          uint16_t count);
+
+#endif // MEASLIB_UI_COMPONENTS_GRAPH_H
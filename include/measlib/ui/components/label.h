@@ -0,0 +1,49 @@
+/**
+ * @file label.h
+ * @brief Text Label and Numeric Readout Widgets.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#ifndef MEASLIB_UI_COMPONENTS_LABEL_H
+#define MEASLIB_UI_COMPONENTS_LABEL_H
+
+#include "measlib/ui/components/widget.h"
+
+/**
+ * @brief Static Text Label
+ */
+typedef struct {
+  meas_widget_t base;
+  const char *text; /**< Not copied; must outlive the label */
+  uint8_t align;    /**< meas_align_t flags within the bounds */
+} meas_label_t;
+
+/**
+ * @brief Fixed-Point Readout (value / 10^decimals followed by a unit).
+ */
+typedef struct {
+  meas_widget_t base;
+  int32_t value;
+  uint8_t decimals;
+  const char *unit; /**< Optional suffix (e.g. "dB") */
+} meas_readout_t;
+
+void meas_label_init(meas_label_t *l, meas_rect_t bounds, const char *text,
+                     uint8_t align);
+
+/**
+ * @brief Change the text (redraws only if the string differs).
+ */
+void meas_label_set_text(meas_label_t *l, const char *text);
+
+void meas_readout_init(meas_readout_t *r, meas_rect_t bounds,
+                       uint8_t decimals, const char *unit);
+
+/**
+ * @brief Update the value (redraws only if it changed).
+ */
+void meas_readout_set_value(meas_readout_t *r, int32_t value);
+
+#endif // MEASLIB_UI_COMPONENTS_LABEL_H
@@ -0,0 +1,61 @@
+/**
+ * @file menu_view.h
+ * @brief Menu List Widget.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Presents a static `meas_menu_item_t` array (terminated by an item with a
+ * NULL label) as a column of fixed-height rows. Selection changes redraw only
+ * the two rows involved; entering or leaving a submenu redraws the list.
+ */
+
+#ifndef MEASLIB_UI_COMPONENTS_MENU_VIEW_H
+#define MEASLIB_UI_COMPONENTS_MENU_VIEW_H
+
+#include "measlib/ui/components/widget.h"
+#include "measlib/ui/menu.h"
+
+/**
+ * @brief Submenu nesting depth.
+ */
+#ifndef MEAS_MENU_VIEW_DEPTH
+#define MEAS_MENU_VIEW_DEPTH 4
+#endif
+
+/**
+ * @brief Menu List
+ */
+typedef struct {
+  meas_widget_t base;
+  const meas_menu_item_t *items; /**< Current level */
+  const meas_menu_item_t *stack[MEAS_MENU_VIEW_DEPTH]; /**< Parent levels */
+  uint8_t stack_sel[MEAS_MENU_VIEW_DEPTH]; /**< Selection to restore */
+  uint8_t depth;
+  uint8_t count;    /**< Rows in the current level */
+  uint8_t selected; /**< Highlighted row */
+  int16_t item_h;   /**< Row height (pixels) */
+  void *user_data;  /**< Passed to ACTION callbacks */
+  void (*on_edit)(void *user_data, const meas_menu_item_t *item);
+} meas_menu_view_t;
+
+void meas_menu_view_init(meas_menu_view_t *m, meas_rect_t bounds,
+                         const meas_menu_item_t *items, int16_t item_h);
+
+/**
+ * @brief Highlight a row (redraws the old and new row only).
+ */
+void meas_menu_view_set_selected(meas_menu_view_t *m, uint8_t index);
+
+/**
+ * @brief Run the selected item (action, toggle, submenu or edit hook).
+ */
+void meas_menu_view_activate(meas_menu_view_t *m);
+
+/**
+ * @brief Return to the parent level.
+ * @return false if already at the top level.
+ */
+bool meas_menu_view_back(meas_menu_view_t *m);
+
+#endif // MEASLIB_UI_COMPONENTS_MENU_VIEW_H
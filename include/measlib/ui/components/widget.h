@@ -0,0 +1,167 @@
+/**
+ * @file widget.h
+ * @brief Retained Widget Tree.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Widgets are statically allocated nodes linked into a tree rooted in a
+ * `meas_widget_tree_t`. Each node owns a screen rectangle that contains all
+ * of its children, which gives the tree its spatial structure:
+ *
+ * - Property setters invalidate only the widget's bounds (the UI dirty map is
+ *   per tile), and only when the value actually changes.
+ * - Drawing and hit-testing skip whole subtrees whose bounds miss the tile or
+ *   the touch point, so cost follows the widgets involved, not the tree size.
+ * - A touch sequence is captured by the widget hit on PRESS and routed to it
+ *   until RELEASE.
+ *
+ * Concrete widgets (label.h, button.h, graph.h, menu_view.h) embed
+ * `meas_widget_t` as their first member.
+ */
+
+#ifndef MEASLIB_UI_COMPONENTS_WIDGET_H
+#define MEASLIB_UI_COMPONENTS_WIDGET_H
+
+#include "measlib/ui/core.h"
+#include "measlib/ui/fonts.h"
+#include "measlib/ui/gesture.h"
+#include "measlib/ui/render.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Widget Flags
+ */
+#define MEAS_WIDGET_VISIBLE (1U << 0) /**< Drawn and hit-testable */
+#define MEAS_WIDGET_ENABLED (1U << 1) /**< Receives touch */
+#define MEAS_WIDGET_PRESSED (1U << 2) /**< Touch is down on the widget */
+
+typedef struct meas_widget_s meas_widget_t;
+typedef struct meas_widget_tree_s meas_widget_tree_t;
+
+/**
+ * @brief Widget VTable
+ */
+typedef struct {
+  /**
+   * @brief Draw the widget (clip is set to its bounds).
+   */
+  void (*draw)(const meas_widget_t *w, meas_render_ctx_t *ctx,
+               const meas_render_api_t *api);
+
+  /**
+   * @brief Handle a gesture routed to the widget (optional).
+   * @return true if consumed; false lets it bubble to the parent.
+   */
+  bool (*on_gesture)(meas_widget_t *w, const meas_gesture_event_t *ev);
+} meas_widget_api_t;
+
+/**
+ * @brief Widget Node
+ */
+struct meas_widget_s {
+  const meas_widget_api_t *api;
+  meas_widget_tree_t *tree; /**< Set when attached; NULL while detached */
+  meas_widget_t *parent;
+  meas_widget_t *first_child; /**< Bottom of the child z-order */
+  meas_widget_t *last_child;  /**< Top of the child z-order */
+  meas_widget_t *prev;
+  meas_widget_t *next;
+
+  meas_rect_t bounds; /**< Screen coordinates; contains all children */
+  meas_id_t id;
+  uint8_t flags;
+  meas_pixel_t fg_color;
+  meas_pixel_t bg_color;
+  const meas_font_t *font; /**< NULL inherits the context font */
+};
+
+/**
+ * @brief Widget Tree (one per screen).
+ */
+struct meas_widget_tree_s {
+  meas_widget_t root;     /**< Full-screen container */
+  meas_ui_t *ui;          /**< Invalidation target */
+  meas_widget_t *capture; /**< Widget owning the current touch sequence */
+};
+
+/**
+ * @brief Plain container (draws nothing, only children).
+ */
+extern const meas_widget_api_t meas_widget_container_api;
+
+/**
+ * @brief Filled container (bg_color over its bounds).
+ */
+extern const meas_widget_api_t meas_widget_panel_api;
+
+// --- Tree ---
+
+/**
+ * @brief Initialize a tree and attach it to the UI controller.
+ * Also sets `ui->widgets` so the layout draws and routes input through it.
+ */
+void meas_widget_tree_init(meas_widget_tree_t *tree, meas_ui_t *ui);
+
+/**
+ * @brief Draw the subtrees overlapping the context's tile and clip.
+ */
+void meas_widget_tree_draw(const meas_widget_tree_t *tree,
+                           meas_render_ctx_t *ctx,
+                           const meas_render_api_t *api);
+
+/**
+ * @brief Route a gesture: PRESS hit-tests and captures, later events of the
+ * sequence go to the captured widget, bubbling to parents if unhandled.
+ * @return true if a widget consumed the event.
+ */
+bool meas_widget_tree_dispatch(meas_widget_tree_t *tree,
+                               const meas_gesture_event_t *ev);
+
+/**
+ * @brief Top-most enabled, visible widget under a point (NULL if none).
+ */
+meas_widget_t *meas_widget_hit_test(meas_widget_t *root, int16_t x,
+                                    int16_t y);
+
+// --- Nodes ---
+
+/**
+ * @brief Initialize a node (visible, enabled, detached).
+ */
+void meas_widget_init(meas_widget_t *w, const meas_widget_api_t *api,
+                      meas_rect_t bounds);
+
+/**
+ * @brief Append @p child on top of @p parent's children and invalidate it.
+ */
+void meas_widget_add(meas_widget_t *parent, meas_widget_t *child);
+
+/**
+ * @brief Detach a widget (and its subtree), invalidating the area it covered.
+ */
+void meas_widget_remove(meas_widget_t *w);
+
+/**
+ * @brief Mark the widget's bounds for redraw (no-op if detached or hidden).
+ */
+void meas_widget_invalidate(const meas_widget_t *w);
+
+/**
+ * @brief Mark part of a widget for redraw (clipped to its bounds).
+ */
+void meas_widget_invalidate_rect(const meas_widget_t *w, meas_rect_t rect);
+
+void meas_widget_set_bounds(meas_widget_t *w, meas_rect_t bounds);
+void meas_widget_set_visible(meas_widget_t *w, bool visible);
+void meas_widget_set_enabled(meas_widget_t *w, bool enabled);
+void meas_widget_set_colors(meas_widget_t *w, meas_pixel_t fg,
+                            meas_pixel_t bg);
+
+/**
+ * @brief Check whether the widget and all its ancestors are visible.
+ */
+bool meas_widget_is_shown(const meas_widget_t *w);
+
+#endif // MEASLIB_UI_COMPONENTS_WIDGET_H
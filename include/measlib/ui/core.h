@@ -12,10 +12,39 @@
 #ifndef MEASLIB_UI_CORE_H
 #define MEASLIB_UI_CORE_H
 
+#include "measlib/core/event.h"
 #include "measlib/core/object.h"
 #include "measlib/types.h"
 #include "measlib/ui/render.h"
 
+/**
+ * @brief Screen Geometry (shared by the UI Core and the Render Service).
+ * The screen is rendered as full-width horizontal tiles; one bit per tile in
+ * `meas_ui_t.dirty_map`. Indexed-color tiles take half the RAM, which the
+ * default spends on twice the tile height.
+ */
+#ifndef MEAS_UI_SCREEN_WIDTH
+#define MEAS_UI_SCREEN_WIDTH 320
+#endif
+#ifndef MEAS_UI_SCREEN_HEIGHT
+#define MEAS_UI_SCREEN_HEIGHT 240
+#endif
+#ifndef MEAS_UI_TILE_HEIGHT
+#ifdef MEAS_UI_INDEXED_COLOR
+#define MEAS_UI_TILE_HEIGHT 16
+#else
+#define MEAS_UI_TILE_HEIGHT 8
+#endif
+#endif
+#define MEAS_UI_TILE_COUNT                                                     \
+  ((MEAS_UI_SCREEN_HEIGHT + MEAS_UI_TILE_HEIGHT - 1) / MEAS_UI_TILE_HEIGHT)
+
+#if MEAS_UI_TILE_COUNT > 32
+#error "dirty_map holds at most 32 tiles"
+#endif
+
+struct meas_widget_tree_s;
+
 // Forward decl
 typedef struct {
   meas_rect_t rect;
@@ -38,15 +67,26 @@ typedef struct {
   meas_ui_zone_t
       hit_zones[16]; /**< Registered interactive zones for current frame */
   uint8_t zone_count;
+  struct meas_widget_tree_s *widgets; /**< Retained widget tree (optional) */
+  const struct meas_smith_s *chart;   /**< Smith / polar grid (optional);
+                                           set static_dirty on change */
 
   // Rendering
-  uint32_t dirty_map; /**< Dirty Tile Bitmask (30 tiles max) */
+  uint32_t dirty_map;  /**< Dirty Tile Bitmask (bit per tile, 32 max) */
+  uint8_t stage_skip;  /**< Stages omitted by draw (bit per render stage) */
+  bool static_dirty;   /**< Static layers changed; cached copy is stale */
 } meas_ui_t;
 
 void meas_ui_invalidate_rect(meas_ui_t *ui, int16_t x, int16_t y, int16_t w,
                              int16_t h);
 void meas_ui_force_redraw(meas_ui_t *ui);
 
+/**
+ * @brief Invalidate the static layers (background, grid).
+ * Call on layout changes affecting them; also schedules a full redraw.
+ */
+void meas_ui_invalidate_static(meas_ui_t *ui);
+
 /**
  * @brief Rendering Pipeline Stages
  * Defines the strict z-order of drawing operations.
@@ -60,6 +100,12 @@ typedef enum {
   RENDER_STAGE_COUNT
 } meas_render_stage_t;
 
+/**
+ * @brief Stages that only change with the layout (cached by the renderer).
+ */
+#define MEAS_UI_STATIC_STAGES                                                  \
+  ((1U << RENDER_STAGE_BG) | (1U << RENDER_STAGE_GRID))
+
 /**
  * @brief Pipeline Step
  * A single operation in the drawing sequence.
@@ -80,7 +126,8 @@ typedef struct {
   meas_status_t (*update)(meas_ui_t *ui);
   meas_status_t (*draw)(meas_ui_t *ui, meas_render_ctx_t *ctx,
                         const meas_render_api_t *draw_api);
-  meas_status_t (*handle_input)(meas_ui_t *ui, meas_variant_t input_event);
+  meas_status_t (*handle_input)(meas_ui_t *ui,
+                                const meas_event_t *input_event);
 
 } meas_ui_api_t;
 
@@ -0,0 +1,140 @@
+/**
+ * @file display_list.h
+ * @brief Display List (Deferred Rendering) for the Tiled Pipeline.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * The layout is executed once per frame against a recording render API
+ * (`meas_render_dl_api`). Every primitive is stored as a compact command with
+ * its vertical bounding range and the context state (colors, font, clip)
+ * captured at call time. After recording, each tile gets its own list of the
+ * commands overlapping it (in recording order), so a tile replays exactly
+ * those. A polyline is a single command; its entry in a tile's list names the
+ * segments crossing that tile.
+ *
+ * Ownership rules:
+ * - Strings and short point lists (up to MEAS_DL_INLINE_POINTS) are copied
+ *   into the list arena.
+ * - Longer point lists (traces), blit images and min/max columns are kept by
+ *   reference. They must stay valid and unchanged until the frame has been
+ *   replayed: owners refreshing them while a frame is in progress write into
+ *   a second buffer (see meas_render_service_busy()).
+ * - Reads of the target (`get_pixel`) are not available while recording.
+ */
+
+#ifndef MEASLIB_UI_DISPLAY_LIST_H
+#define MEASLIB_UI_DISPLAY_LIST_H
+
+#include "measlib/ui/core.h"
+#include "measlib/ui/render.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Maximum number of recorded commands per frame (at most 256).
+ */
+#ifndef MEAS_DL_MAX_CMDS
+#define MEAS_DL_MAX_CMDS 64
+#endif
+
+#if MEAS_DL_MAX_CMDS > 256
+#error "Display list command indices are 8-bit"
+#endif
+
+/**
+ * @brief Capacity of the per-tile lists (one entry per command and tile).
+ */
+#ifndef MEAS_DL_MAX_REFS
+#define MEAS_DL_MAX_REFS 192
+#endif
+
+/**
+ * @brief Size of the arena holding copied points and strings (bytes).
+ */
+#ifndef MEAS_DL_ARENA_SIZE
+#define MEAS_DL_ARENA_SIZE 512
+#endif
+
+/**
+ * @brief Longest point list copied into the arena; longer ones are referenced.
+ */
+#ifndef MEAS_DL_INLINE_POINTS
+#define MEAS_DL_INLINE_POINTS 32
+#endif
+
+/**
+ * @brief Recorded Draw Command.
+ */
+typedef struct {
+  uint8_t op;            /**< Primitive opcode (internal) */
+  uint8_t alpha;         /**< Opacity */
+  uint16_t count;        /**< Element count / extra scalar */
+  int16_t y_min;         /**< First screen row touched (inclusive) */
+  int16_t y_max;         /**< Last screen row touched (inclusive) */
+  meas_pixel_t fg_color; /**< Captured foreground color */
+  meas_pixel_t bg_color; /**< Captured background color */
+  int16_t args[6];       /**< Geometry arguments */
+  meas_rect_t clip_rect; /**< Captured effective clip */
+  const meas_font_t *font; /**< Captured font */
+  const void *data;        /**< Points / text / image / column data */
+} meas_dl_cmd_t;
+
+/**
+ * @brief Entry of a tile's command list.
+ */
+typedef struct {
+  uint8_t cmd;    /**< Command index */
+  uint16_t first; /**< Polylines: first point of the segments in the tile */
+  uint16_t count; /**< Polylines: points replayed for the tile */
+} meas_dl_ref_t;
+
+/**
+ * @brief Display List Object (Statically Allocated).
+ */
+typedef struct {
+  meas_dl_cmd_t cmds[MEAS_DL_MAX_CMDS];
+  uint16_t cmd_count;
+  uint16_t arena_used;
+  uint8_t arena[MEAS_DL_ARENA_SIZE];
+  bool overflow; /**< Capacity exceeded; list must not be replayed */
+
+  // Tile Lists: tile t replays refs [tile_refs[t], tile_refs[t + 1])
+  meas_dl_ref_t refs[MEAS_DL_MAX_REFS];
+  uint16_t tile_refs[MEAS_UI_TILE_COUNT + 1];
+} meas_dl_t;
+
+/**
+ * @brief Recording Render API.
+ * Pass this to `meas_ui_api_t.draw` between meas_dl_begin() and meas_dl_end().
+ */
+extern const meas_render_api_t meas_render_dl_api;
+
+/**
+ * @brief Start recording a frame.
+ * Resets the list and initializes @p ctx as a full-screen recording context.
+ *
+ * @param dl Target list.
+ * @param ctx Context to be handed to the layout draw routine.
+ */
+void meas_dl_begin(meas_dl_t *dl, meas_render_ctx_t *ctx);
+
+/**
+ * @brief Finish recording and build the per-tile lists.
+ * @param dl Target list.
+ * @return true if the list is complete and can be replayed.
+ */
+bool meas_dl_end(meas_dl_t *dl);
+
+/**
+ * @brief Replay the commands overlapping the context's rows.
+ * Each tile band covered by the context replays its own list.
+ *
+ * @param dl Recorded list.
+ * @param ctx Tile context (buffer, y_offset, height).
+ * @param api Rasterizer executing the commands (e.g. meas_render_cell_api).
+ */
+void meas_dl_replay(const meas_dl_t *dl, meas_render_ctx_t *ctx,
+                    const meas_render_api_t *api);
+
+#endif // MEASLIB_UI_DISPLAY_LIST_H
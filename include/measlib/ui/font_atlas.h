@@ -0,0 +1,116 @@
+/**
+ * @file font_atlas.h
+ * @brief Pre-Rasterized Font Atlas (Per-Glyph Row Runs).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * The bitmap fonts are converted on the host (tools/fontgen) into a uniform
+ * run encoding so the glyph blitter never scans bits at draw time:
+ *
+ * - Each glyph has a descriptor with its pen advance and the band of rows
+ *   that hold ink (blank rows above and below are not stored).
+ * - Each stored row is a count byte followed by one byte per horizontal run,
+ *   `(x << 4) | (length - 1)`, so glyphs up to 16 pixels wide fit.
+ * - An optional kerning table adjusts the advance of specific pairs.
+ *
+ * The generated tables live in src/ui/fonts/font_atlas.c and are referenced
+ * from the font descriptors (`meas_font_t.atlas`).
+ */
+
+#ifndef MEASLIB_UI_FONT_ATLAS_H
+#define MEASLIB_UI_FONT_ATLAS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Glyph Descriptor.
+ */
+typedef struct {
+  uint16_t offset; /**< First byte of the glyph's row stream in `runs` */
+  uint8_t advance; /**< Pen advance (pixels) */
+  uint8_t top;     /**< First stored row (relative to the text origin) */
+  uint8_t rows;    /**< Number of stored rows */
+} meas_atlas_glyph_t;
+
+/**
+ * @brief Kerning Pair (sorted by left, then right character).
+ */
+typedef struct {
+  char left;
+  char right;
+  int8_t adjust; /**< Added to the advance of `left` */
+} meas_kern_pair_t;
+
+/**
+ * @brief Run-Encoded Font Atlas.
+ */
+typedef struct meas_font_atlas {
+  uint8_t first_char; /**< Character of glyphs[0] */
+  uint8_t last_char;  /**< Last encoded character */
+  uint8_t fallback;   /**< Drawn for characters outside the range */
+  const meas_atlas_glyph_t *glyphs;
+  const uint8_t *runs;
+  const meas_kern_pair_t *kern; /**< NULL if the font is not kerned */
+  uint16_t kern_count;
+} meas_font_atlas_t;
+
+/**
+ * @brief Run Byte Decoding.
+ */
+#define MEAS_ATLAS_RUN_X(b) ((uint8_t)(b) >> 4)
+#define MEAS_ATLAS_RUN_LEN(b) (((uint8_t)(b) & 0x0FU) + 1U)
+
+/**
+ * @brief Resolve a character to its glyph descriptor.
+ */
+static inline const meas_atlas_glyph_t *
+meas_font_atlas_glyph(const meas_font_atlas_t *atlas, char c) {
+  uint8_t index = (uint8_t)c;
+  if (index < atlas->first_char || index > atlas->last_char)
+    index = atlas->fallback;
+  return &atlas->glyphs[index - atlas->first_char];
+}
+
+/**
+ * @brief Kerning adjustment for a character pair.
+ * @return Pixels added to the advance of @p left (0 if the pair is not kerned).
+ */
+static inline int8_t meas_font_atlas_kern(const meas_font_atlas_t *atlas,
+                                          char left, char right) {
+  // Binary search over the sorted pair table
+  uint16_t lo = 0;
+  uint16_t hi = atlas->kern_count;
+  uint16_t key = (uint16_t)(((uint8_t)left << 8) | (uint8_t)right);
+  while (lo < hi) {
+    uint16_t mid = (uint16_t)((lo + hi) / 2U);
+    const meas_kern_pair_t *p = &atlas->kern[mid];
+    uint16_t k = (uint16_t)(((uint8_t)p->left << 8) | (uint8_t)p->right);
+    if (k == key)
+      return p->adjust;
+    if (k < key)
+      lo = mid + 1U;
+    else
+      hi = mid;
+  }
+  return 0;
+}
+
+// --- Generated Atlases (src/ui/fonts/font_atlas.c) ---
+
+extern const meas_font_atlas_t font_5x7_atlas;
+extern const meas_font_atlas_t font_11x14_atlas;
+
+/**
+ * @brief Atlas reference for a font descriptor.
+ * The generator links the bitmap fonts before any atlas exists, so it builds
+ * them with MEAS_FONTGEN and the reference collapses to NULL.
+ */
+#ifdef MEAS_FONTGEN
+#define MEAS_FONT_ATLAS(name) NULL
+#else
+#define MEAS_FONT_ATLAS(name) (&name##_atlas)
+#endif
+
+#endif // MEASLIB_UI_FONT_ATLAS_H
@@ -13,12 +13,14 @@
 
 #include <stdint.h>
 
+struct meas_font_atlas;
+
 /**
  * @brief Font Descriptor
  */
 typedef struct {
-  const uint8_t *bitmap; /**< Pointer to raw bitmap data (column-major or
-                            row-major depending on impl) */
+  const uint8_t *bitmap; /**< Pointer to raw bitmap data (row-major, MSB =
+                            leftmost; 8 or 16 bits per row by height) */
   uint8_t width_max;     /**< Maximum character width */
   uint8_t height;        /**< Character height */
   uint8_t start_char;    /**< ASCII code of the first character */
@@ -35,6 +37,12 @@ typedef struct {
    */
   const uint8_t *(*get_glyph)(const uint8_t *font_data, char c, uint8_t *w_out,
                               uint8_t *h_out);
+
+  /**
+   * @brief Run-encoded atlas of the same glyphs (see font_atlas.h).
+   * NULL makes the renderer decode the bitmap directly.
+   */
+  const struct meas_font_atlas *atlas;
 } meas_font_t;
 
 // --- Available Fonts ---
@@ -0,0 +1,146 @@
+/**
+ * @file gesture.h
+ * @brief Touch Gesture Recognizer.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Turns raw single-point touch samples into gestures:
+ *
+ * - Samples are de-spiked (3-tap median) and smoothed before use.
+ * - A touch that stays within the slop radius is a TAP on release, or a
+ *   LONG_PRESS once held long enough.
+ * - Movement beyond the slop starts a DRAG. Dragging after a long press
+ *   drives ZOOM instead (single-touch panels have no pinch).
+ * - Releasing a drag fast enough produces a FLING, followed by inertial
+ *   SCROLL (or ZOOM) steps at a fixed rate until friction stops it.
+ *
+ * The recognizer is time-driven by the caller (`now_ms`) so it can be tested
+ * without a clock. Movement events carry the delta since the previous event
+ * of the same gesture, which lets a queue merge them by summing.
+ */
+
+#ifndef MEASLIB_UI_GESTURE_H
+#define MEASLIB_UI_GESTURE_H
+
+#include "measlib/types.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Recognizer step (ms): inertia and long-press run at this rate.
+ */
+#ifndef MEAS_GESTURE_TICK_MS
+#define MEAS_GESTURE_TICK_MS 16
+#endif
+
+/**
+ * @brief Gesture Kinds
+ */
+typedef enum {
+  MEAS_GESTURE_NONE = 0,
+  MEAS_GESTURE_PRESS,      /**< Finger down (x, y) */
+  MEAS_GESTURE_RELEASE,    /**< Finger up (x, y) */
+  MEAS_GESTURE_TAP,        /**< Short touch without movement (x, y) */
+  MEAS_GESTURE_LONG_PRESS, /**< Held without movement (x, y) */
+  MEAS_GESTURE_DRAG,       /**< Finger pan step (dx, dy) */
+  MEAS_GESTURE_ZOOM,       /**< Zoom step after a long press (dx, dy) */
+  MEAS_GESTURE_FLING,      /**< Drag released with speed (dx, dy in px/s) */
+  MEAS_GESTURE_SCROLL,     /**< Inertial pan step (dx, dy) */
+} meas_gesture_kind_t;
+
+/**
+ * @brief Gesture Event
+ */
+typedef struct {
+  meas_gesture_kind_t kind;
+  int16_t x;  /**< Filtered position (screen pixels) */
+  int16_t y;
+  int16_t dx; /**< Movement since the previous step (see kind) */
+  int16_t dy;
+} meas_gesture_event_t;
+
+/**
+ * @brief Gesture Event Sink
+ */
+typedef void (*meas_gesture_sink_t)(const meas_gesture_event_t *ev,
+                                    void *user_data);
+
+/**
+ * @brief Recognizer Tuning
+ */
+typedef struct {
+  uint8_t slop_px;            /**< Movement that turns a touch into a drag */
+  uint16_t long_press_ms;     /**< Hold time for LONG_PRESS */
+  uint16_t fling_min_px_s;    /**< Release speed that starts inertia */
+  uint8_t friction_q8;        /**< Velocity kept per step (256 = none) */
+} meas_gesture_config_t;
+
+/**
+ * @brief Default tuning for a 320x240 resistive panel.
+ */
+#define MEAS_GESTURE_CONFIG_DEFAULT                                            \
+  {.slop_px = 8, .long_press_ms = 600, .fling_min_px_s = 150,                 \
+   .friction_q8 = 240}
+
+/**
+ * @brief Recognizer State (Statically Allocated).
+ */
+typedef struct {
+  meas_gesture_config_t cfg;
+  meas_gesture_sink_t sink;
+  void *user_data;
+
+  uint8_t state;
+  bool zoom;             /**< Movement drives zoom (after long press) */
+  uint8_t hist_count;    /**< Raw samples in the median window */
+  int16_t hist_x[3];
+  int16_t hist_y[3];
+  int32_t fx_q4, fy_q4;  /**< Smoothed position (1/16 px) */
+  int16_t down_x, down_y;
+  int16_t last_x, last_y; /**< Position at the previous movement event */
+  uint32_t down_ms;
+  uint32_t sample_ms;
+  int32_t vx_q8, vy_q8;  /**< Velocity (1/256 px per step) */
+  int32_t ix_q8, iy_q8;  /**< Inertial sub-pixel remainder */
+  uint32_t next_step_ms;
+} meas_gesture_t;
+
+/**
+ * @brief Initialize a recognizer.
+ * @param cfg Tuning (NULL for MEAS_GESTURE_CONFIG_DEFAULT).
+ */
+void meas_gesture_init(meas_gesture_t *g, const meas_gesture_config_t *cfg,
+                       meas_gesture_sink_t sink, void *user_data);
+
+/**
+ * @brief Feed one touch sample.
+ * @param pt Touch position, or NULL when the panel reports no touch.
+ * @param now_ms Sample time.
+ */
+void meas_gesture_feed(meas_gesture_t *g, const meas_point_t *pt,
+                       uint32_t now_ms);
+
+/**
+ * @brief Advance timers (long press, inertia).
+ * Call every superloop pass; work happens at MEAS_GESTURE_TICK_MS steps.
+ */
+void meas_gesture_tick(meas_gesture_t *g, uint32_t now_ms);
+
+/**
+ * @brief Check for pending work (finger down or inertia running).
+ */
+bool meas_gesture_active(const meas_gesture_t *g);
+
+/**
+ * @brief Pack an event into an event payload (`meas_variant_t.i_val`).
+ * Layout: dx [15:0], dy [31:16], x [43:32], y [55:44], kind [63:56].
+ */
+int64_t meas_gesture_pack(const meas_gesture_event_t *ev);
+
+/**
+ * @brief Unpack an event payload.
+ */
+void meas_gesture_unpack(int64_t payload, meas_gesture_event_t *ev);
+
+#endif // MEASLIB_UI_GESTURE_H
@@ -0,0 +1,83 @@
+/**
+ * @file layer_cache.h
+ * @brief Static Layer Cache (RLE Tiles).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Holds a run-length encoded copy of the static pipeline stages (background,
+ * grid) per render tile. A dirty tile is initialized by decoding its runs
+ * instead of re-running the gradient and graticule primitives; the cache is
+ * rebuilt only when the layout invalidates the static layers.
+ *
+ * Runs come from a single static pool. Tiles that do not fit stay uncached
+ * and are drawn live.
+ */
+
+#ifndef MEASLIB_UI_LAYER_CACHE_H
+#define MEASLIB_UI_LAYER_CACHE_H
+
+#include "measlib/types.h"
+#include "measlib/ui/core.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Run pool capacity (4 bytes per run).
+ */
+#ifndef MEAS_LAYER_CACHE_RUNS
+#define MEAS_LAYER_CACHE_RUNS 768
+#endif
+
+/**
+ * @brief One run of identical pixels (row-major, may wrap rows).
+ */
+typedef struct {
+  uint16_t length;
+  meas_tile_pixel_t color;
+} meas_rle_run_t;
+
+/**
+ * @brief Static Layer Cache Object (Statically Allocated).
+ */
+typedef struct {
+  meas_rle_run_t runs[MEAS_LAYER_CACHE_RUNS];
+  uint16_t runs_used;
+  uint16_t tile_first[MEAS_UI_TILE_COUNT]; /**< First run of each tile */
+  uint16_t tile_runs[MEAS_UI_TILE_COUNT];  /**< Run count of each tile */
+  uint32_t valid_map; /**< Tiles holding a usable encoding */
+  bool full;          /**< Pool exhausted; stop encoding until reset */
+} meas_layer_cache_t;
+
+/**
+ * @brief Drop all cached tiles.
+ */
+void meas_layer_cache_reset(meas_layer_cache_t *cache);
+
+/**
+ * @brief Encode a rendered tile into the cache.
+ *
+ * @param cache Cache object.
+ * @param tile Tile index.
+ * @param pixels Tile pixels (static layers only).
+ * @param count Pixel count of the tile.
+ * @return MEAS_OK, or MEAS_ERROR if the pool is exhausted (tile uncached).
+ */
+meas_status_t meas_layer_cache_store(meas_layer_cache_t *cache, uint16_t tile,
+                                     const meas_tile_pixel_t *pixels,
+                                     size_t count);
+
+/**
+ * @brief Decode a cached tile.
+ *
+ * @param cache Cache object.
+ * @param tile Tile index.
+ * @param pixels Destination tile buffer.
+ * @param count Pixel count of the tile.
+ * @return true if the tile was restored, false if it must be drawn live.
+ */
+bool meas_layer_cache_restore(const meas_layer_cache_t *cache, uint16_t tile,
+                              meas_tile_pixel_t *pixels, size_t count);
+
+#endif // MEASLIB_UI_LAYER_CACHE_H
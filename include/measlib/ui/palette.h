@@ -0,0 +1,103 @@
+/**
+ * @file palette.h
+ * @brief Indexed Color Palette (8-bit tiles).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * With MEAS_UI_INDEXED_COLOR the rasterizer stores one palette index per tile
+ * pixel instead of an RGB565 value, halving tile RAM. Colors stay RGB565 in
+ * every API: they are mapped to an index when written and expanded through
+ * the palette when read back, blended, or sent to the LCD.
+ *
+ * Two mappings are provided:
+ * - meas_palette_match(): exact entry if the color is in the palette (theme
+ *   colors always are), else the nearest one. Memoized; meant for the solid
+ *   color of a primitive, once per call.
+ * - meas_palette_quantize(): nearest entry from a 512-cell inverse table
+ *   (RGB 3:3:3). Constant time; meant for per-pixel blend results.
+ */
+
+#ifndef MEASLIB_UI_PALETTE_H
+#define MEASLIB_UI_PALETTE_H
+
+#include "measlib/types.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Number of palette entries (one byte per index).
+ */
+#define MEAS_PALETTE_SIZE 256
+
+/**
+ * @brief Inverse table cells (3 bits per RGB component).
+ */
+#define MEAS_PALETTE_INVERSE_SIZE 512
+
+/**
+ * @brief Active palette: index to RGB565.
+ */
+extern meas_pixel_t meas_palette_lut[MEAS_PALETTE_SIZE];
+
+/**
+ * @brief Active inverse table: RGB 3:3:3 cell to nearest index.
+ */
+extern uint8_t meas_palette_inverse[MEAS_PALETTE_INVERSE_SIZE];
+
+/**
+ * @brief Tables loaded. Until then every lookup loads the default palette
+ * first, so they are valid before meas_palette_init() is called.
+ */
+extern bool meas_palette_ready;
+
+/**
+ * @brief Load the default palette.
+ * UI theme colors first, then a 6x6x6 color cube and a gray ramp, so blends
+ * between theme colors land on a close entry.
+ */
+void meas_palette_init(void);
+
+/**
+ * @brief Load a custom palette.
+ * Entries past @p count repeat the last color.
+ *
+ * @param colors RGB565 entries.
+ * @param count Number of entries (1..MEAS_PALETTE_SIZE).
+ * @return MEAS_OK, or MEAS_ERROR on invalid arguments.
+ */
+meas_status_t meas_palette_load(const meas_pixel_t *colors, uint16_t count);
+
+/**
+ * @brief Index of a color: the exact entry if present, else the nearest.
+ */
+uint8_t meas_palette_match(meas_pixel_t color);
+
+/**
+ * @brief Expand @p n indices to RGB565 (LCD feed, captures).
+ */
+void meas_palette_expand(meas_pixel_t *dst, const uint8_t *src, size_t n);
+
+/**
+ * @brief RGB565 color of an index.
+ */
+static inline meas_pixel_t meas_palette_color(uint8_t index) {
+  if (!meas_palette_ready)
+    meas_palette_init();
+  return meas_palette_lut[index];
+}
+
+/**
+ * @brief Nearest index of a color (inverse table lookup).
+ */
+static inline uint8_t meas_palette_quantize(meas_pixel_t color) {
+  if (!meas_palette_ready)
+    meas_palette_init();
+  uint32_t cell = ((uint32_t)(color >> 13) << 6) |
+                  ((uint32_t)((color >> 8) & 0x7U) << 3) |
+                  ((uint32_t)(color >> 2) & 0x7U);
+  return meas_palette_inverse[cell];
+}
+
+#endif // MEASLIB_UI_PALETTE_H
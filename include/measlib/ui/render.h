@@ -31,13 +31,39 @@ typedef struct {
  */
 #define MEAS_MAX_CLIP_STACK 8
 
+/**
+ * @brief Edges a filled polygon may bring into one tile for the active edge
+ * table. Tiles reached by more are filled row by row from all edges.
+ */
+#ifndef MEAS_MAX_POLYGON_EDGES
+#define MEAS_MAX_POLYGON_EDGES 32
+#endif
+
+/**
+ * @brief Fixed-point readouts (draw_number): maximum fractional digits and
+ * formatted length ("-2.147483648" plus terminator).
+ */
+#define MEAS_NUMBER_MAX_DECIMALS 9
+#define MEAS_NUMBER_MAX_CHARS 13
+
+/**
+ * @brief Tile Pixel Storage
+ * RGB565 by default. With MEAS_UI_INDEXED_COLOR tiles hold 8-bit indices into
+ * the active palette (see palette.h); colors passed to the API stay RGB565.
+ */
+#ifdef MEAS_UI_INDEXED_COLOR
+typedef uint8_t meas_tile_pixel_t;
+#else
+typedef meas_pixel_t meas_tile_pixel_t;
+#endif
+
 /**
  * @brief Render Context
  * Describes the target buffer or clipping region for drawing operations.
  * Important for Tile Rendering strategies.
  */
 typedef struct {
-  meas_pixel_t *buffer;  /**< Pointer to framebuffer or tile buffer */
+  meas_tile_pixel_t *buffer; /**< Pointer to framebuffer or tile buffer */
   int16_t width;         /**< Width of the drawing area */
   int16_t height;        /**< Height of the drawing area */
   int16_t x_offset;      /**< Global X offset (if drawing to a tile) */
@@ -111,6 +137,14 @@ typedef struct {
                int16_t h, const void *img, uint8_t alpha);
   void (*draw_text)(meas_render_ctx_t *ctx, int16_t x, int16_t y,
                     const char *text, uint8_t alpha);
+
+  /**
+   * @brief Draw a Fixed-Point Readout.
+   * Renders @p value / 10^decimals exactly like draw_text would render the
+   * formatted string ("-12.345"), without printf or a string argument.
+   */
+  void (*draw_number)(meas_render_ctx_t *ctx, int16_t x, int16_t y,
+                      int32_t value, uint8_t decimals, uint8_t alpha);
   void (*fill_gradient_v)(meas_render_ctx_t *ctx, int16_t x, int16_t y,
                           int16_t w, int16_t h, meas_pixel_t c1,
                           meas_pixel_t c2, uint8_t alpha);
@@ -151,6 +185,13 @@ typedef struct {
   void (*draw_line_thick)(meas_render_ctx_t *ctx, int16_t x0, int16_t y0,
                           int16_t x1, int16_t y1, uint8_t width, uint8_t alpha);
 
+  /**
+   * @brief Draw an Anti-Aliased Polyline (Traces).
+   * Wu-style lines with 16 coverage levels blended over the target.
+   */
+  void (*draw_polyline_aa)(meas_render_ctx_t *ctx, const meas_point_t *points,
+                           uint16_t count, uint8_t alpha);
+
   // Stack Clipping API
   void (*push_clip_rect)(meas_render_ctx_t *ctx, meas_rect_t rect);
   meas_rect_t (*pop_clip_rect)(meas_render_ctx_t *ctx);
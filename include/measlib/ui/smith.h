@@ -0,0 +1,90 @@
+/**
+ * @file smith.h
+ * @brief Smith Chart / Polar Graticule (Precomputed Span Tables).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * The graticule is rasterized once per layout into horizontal spans grouped
+ * by scanline: constant-R circles, constant-X arcs (clipped to |Gamma| <= 1)
+ * and the real axis for the impedance chart; |Gamma| circles and angle
+ * radials for the polar chart. Drawing a tile is a table lookup over the
+ * rows it covers, so the chart costs about as much as a rectangular grid.
+ */
+
+#ifndef MEASLIB_UI_SMITH_H
+#define MEASLIB_UI_SMITH_H
+
+#include "measlib/types.h"
+#include "measlib/ui/core.h"
+#include "measlib/ui/render.h"
+#include <stdint.h>
+
+/**
+ * @brief Span pool capacity (2 bytes per span).
+ * Sized for the largest chart that fits the screen height, before merging.
+ */
+#ifndef MEAS_SMITH_MAX_SPANS
+#define MEAS_SMITH_MAX_SPANS 2560
+#endif
+
+/**
+ * @brief Graticule Style.
+ */
+typedef enum {
+  MEAS_SMITH_IMPEDANCE, /**< Constant resistance / reactance (Z Smith) */
+  MEAS_SMITH_POLAR      /**< Reflection magnitude circles and radials */
+} meas_smith_style_t;
+
+/**
+ * @brief Horizontal pixel span [x0, x1] on one scanline.
+ * Columns are relative to the left edge of the chart box (cx - radius).
+ */
+typedef struct {
+  uint8_t x0;
+  uint8_t x1;
+} meas_span_t;
+
+/**
+ * @brief Precomputed Graticule (Statically Allocated).
+ */
+typedef struct meas_smith_s {
+  int16_t cx;     /**< Center X (Gamma = 0) */
+  int16_t cy;     /**< Center Y */
+  int16_t radius; /**< Radius of the |Gamma| = 1 circle */
+  int16_t y_top;  /**< Screen row of table row 0 */
+  uint16_t rows;  /**< Table rows (2 * radius + 1) */
+  uint16_t span_count;
+  uint16_t row_first[MEAS_UI_SCREEN_HEIGHT + 1]; /**< Spans of row r are
+                                                   [row_first[r],
+                                                   row_first[r + 1]) */
+  meas_span_t spans[MEAS_SMITH_MAX_SPANS];
+} meas_smith_t;
+
+/**
+ * @brief Build the span tables for a chart (once per layout change).
+ *
+ * @param chart Target chart.
+ * @param style Graticule style.
+ * @param cx Center X.
+ * @param cy Center Y.
+ * @param radius Outer circle radius in pixels (at most
+ *               (MEAS_UI_SCREEN_HEIGHT - 1) / 2).
+ * @return MEAS_OK, or MEAS_ERROR if the chart does not fit (chart empty).
+ */
+meas_status_t meas_smith_build(meas_smith_t *chart, meas_smith_style_t style,
+                               int16_t cx, int16_t cy, int16_t radius);
+
+/**
+ * @brief Draw the slice of the chart covered by the context.
+ * Uses `ctx->fg_color`; only the rows of the target tile are visited.
+ *
+ * @param chart Built chart.
+ * @param ctx Render context (tile).
+ * @param api Render API (spans are emitted as 1-row fill_rect calls).
+ * @param alpha Opacity.
+ */
+void meas_smith_draw(const meas_smith_t *chart, meas_render_ctx_t *ctx,
+                     const meas_render_api_t *api, uint8_t alpha);
+
+#endif // MEASLIB_UI_SMITH_H
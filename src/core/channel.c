@@ -18,3 +18,44 @@ void meas_channel_tick(meas_channel_t *ch) {
     }
   }
 }
+
+meas_status_t meas_channel_configure(meas_channel_t *ch) {
+  if (ch && ch->base.api) {
+    const meas_channel_api_t *api = (const meas_channel_api_t *)ch->base.api;
+    if (api->configure) {
+      return api->configure(ch);
+    }
+  }
+  return MEAS_ERROR;
+}
+
+meas_status_t meas_channel_start_sweep(meas_channel_t *ch) {
+  if (ch && ch->base.api) {
+    const meas_channel_api_t *api = (const meas_channel_api_t *)ch->base.api;
+    if (api->start_sweep) {
+      ch->sweep_seq++;
+      return api->start_sweep(ch);
+    }
+  }
+  return MEAS_ERROR;
+}
+
+meas_status_t meas_channel_abort_sweep(meas_channel_t *ch) {
+  if (ch && ch->base.api) {
+    const meas_channel_api_t *api = (const meas_channel_api_t *)ch->base.api;
+    if (api->abort_sweep) {
+      return api->abort_sweep(ch);
+    }
+  }
+  return MEAS_ERROR;
+}
+
+meas_status_t meas_channel_publish_done(meas_channel_t *ch) {
+  if (!ch)
+    return MEAS_ERROR;
+  meas_event_t ev = {.type = EVENT_STATE_CHANGED,
+                     .source = &ch->base,
+                     .payload = {.type = PROP_TYPE_INT64,
+                                 .i_val = ch->sweep_seq}};
+  return meas_event_publish(ev);
+}
@@ -60,6 +60,22 @@ meas_status_t meas_event_publish(meas_event_t ev) {
   return MEAS_OK;
 }
 
+meas_status_t meas_event_publish_coalesced(meas_event_t ev,
+                                           meas_event_merge_cb_t merge) {
+  if (merge) {
+    uint32_t status = sys_enter_critical();
+    if (q_head != q_tail) {
+      size_t last = (q_head + MAX_EVENT_QUEUE - 1) % MAX_EVENT_QUEUE;
+      if (merge(&event_queue[last], &ev)) {
+        sys_exit_critical(status);
+        return MEAS_OK;
+      }
+    }
+    sys_exit_critical(status);
+  }
+  return meas_event_publish(ev);
+}
+
 void meas_dispatch_events(void) {
   while (q_tail != q_head) {
     meas_event_t ev = event_queue[q_tail];
@@ -33,6 +33,17 @@ meas_status_t meas_object_get_prop(meas_object_t *obj, meas_id_t key,
   return MEAS_ERROR;
 }
 
+const meas_prop_desc_t *meas_object_get_props(meas_object_t *obj,
+                                              size_t *count) {
+  if (obj && obj->api && obj->api->get_props) {
+    return obj->api->get_props(obj, count);
+  }
+  if (count) {
+    *count = 0;
+  }
+  return NULL;
+}
+
 void meas_object_destroy(meas_object_t *obj) {
   if (obj && obj->api && obj->api->destroy) {
     obj->api->destroy(obj);
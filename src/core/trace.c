@@ -21,6 +21,16 @@ meas_status_t meas_trace_get_data(meas_trace_t *t, const meas_real_t **x,
   return MEAS_ERROR;
 }
 
+meas_trace_fmt_t meas_trace_get_format(meas_trace_t *t) {
+  if (t && t->base.api) {
+    const meas_trace_api_t *api = (const meas_trace_api_t *)t->base.api;
+    if (api->get_format) {
+      return api->get_format(t);
+    }
+  }
+  return TRACE_FMT_REAL;
+}
+
 meas_status_t meas_trace_copy_data(meas_trace_t *t, const void *data,
                                    size_t size) {
   if (t && t->base.api) {
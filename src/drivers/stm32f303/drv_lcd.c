@@ -77,6 +77,7 @@ typedef struct {
 #define RCC ((RCC_TypeDef *)0x40021000UL)
 #define DMA1 ((DMA_TypeDef *)0x40020000UL)
 #define DMA1_Channel3 ((DMA_Channel_TypeDef *)0x40020030UL)
+#define NVIC_ISER0 ((volatile uint32_t *)0xE000E100UL)
 
 #define RCC_AHBENR_DMA1EN (1UL << 0)
 #define RCC_AHBENR_GPIOAEN (1UL << 17)
@@ -99,6 +100,7 @@ typedef struct {
 #define SPI_SR_BSY (1UL << 7)
 
 #define DMA_CCR_EN (1UL << 0)
+#define DMA_CCR_TCIE (1UL << 1)
 #define DMA_CCR_DIR (1UL << 4)
 #define DMA_CCR_MINC (1UL << 7)
 #define DMA_CCR_PSIZE_0 (1UL << 8)
@@ -106,7 +108,10 @@ typedef struct {
 #define DMA_CCR_PL_1 (1UL << 13)
 
 #define DMA_ISR_TCIF3 (1UL << 9)
-#define DMA_IFCR_CGIF3 (1UL << 9)
+#define DMA_IFCR_CGIF3 (1UL << 8)
+
+// DMA1 Channel 3 is IRQ 13 (Vector74 in the ChibiOS-style vector table)
+#define DMA_IRQn 13
 
 #define LCD_CS_PORT GPIOB
 #define LCD_CD_PORT GPIOB
@@ -142,6 +147,11 @@ typedef struct {
   uint16_t width;
   uint16_t height;
   bool is_initialized;
+  volatile bool dma_busy;       ///< Asynchronous transfer in flight
+  meas_drv_lcd_done_cb_t on_done; ///< Completion callback (ISR context)
+  void *on_done_user;           ///< Callback user data
+  void (*bus_wait)(void *ctx);  ///< Frees the shared SPI bus (SD Card)
+  void *bus_wait_ctx;           ///< Bus wait hook context
 } meas_drv_lcd_t;
 
 static meas_drv_lcd_t lcd_ctx;
@@ -304,6 +314,46 @@ static void lcd_dma_wait(void) {
   DMA1_Channel3->CCR &= ~DMA_CCR_EN; // Disable
 }
 
+/**
+ * @brief Program DMA1 Channel 3 for a Mem2Periph 16-bit stream into SPI1.
+ *
+ * @param src Source address (single color or pixel buffer).
+ * @param count Number of 16-bit items.
+ * @param ccr_flags Extra CCR flags (MINC, TCIE).
+ */
+static void lcd_dma_start(const void *src, uint32_t count,
+                          uint32_t ccr_flags) {
+  DMA1_Channel3->CCR = DMA_CCR_MSIZE_0 | DMA_CCR_PSIZE_0 | DMA_CCR_DIR |
+                       DMA_CCR_PL_1 | ccr_flags;
+  DMA1_Channel3->CPAR = (uint32_t)&SPI1->DR;
+  DMA1_Channel3->CNDTR = count;
+  DMA1_Channel3->CMAR = (uint32_t)src;
+
+  SPI1->CR2 |= SPI_CR2_TXDMAEN;
+  DMA1_Channel3->CCR |= DMA_CCR_EN;
+}
+
+/**
+ * @brief Finish a DMA stream: drain the SPI FIFO and release the bus.
+ */
+static void lcd_dma_finish(void) {
+  SPI1->CR2 &= ~SPI_CR2_TXDMAEN;
+  spi_wait_busy(); // Last frame still shifting out after TC
+  LCD_CS_HIGH();
+}
+
+/**
+ * @brief Block until a pending asynchronous blit has completed.
+ * The blocking primitives call this first so they never interleave with an
+ * in-flight DMA transfer.
+ */
+static void lcd_wait_idle(meas_drv_lcd_t *lcd) {
+  while (lcd->dma_busy)
+    ;
+  if (lcd->bus_wait)
+    lcd->bus_wait(lcd->bus_wait_ctx);
+}
+
 // --- High-Level Drawing API (Context Aware) ---
 
 void meas_drv_lcd_set_window(void *ctx, meas_rect_t rect) {
@@ -311,6 +361,8 @@ void meas_drv_lcd_set_window(void *ctx, meas_rect_t rect) {
   if (!lcd || !lcd->is_initialized)
     return;
 
+  lcd_wait_idle(lcd);
+
   LCD_CS_LOW();
 
   lcd_spi_config_8bit();
@@ -346,27 +398,13 @@ void meas_drv_lcd_fill_rect(void *ctx, meas_rect_t rect, meas_pixel_t color) {
   // 4. Setup DMA for FILL
   // Mem2Periph, 16-bit (MSIZE=01, PSIZE=01), MINC=0 (Fixed Color), Priority
   // High
-  DMA1_Channel3->CCR = DMA_CCR_MSIZE_0 | DMA_CCR_PSIZE_0 | DMA_CCR_DIR |
-                       DMA_CCR_PL_1; // No MINC!
-  DMA1_Channel3->CNDTR = total_pixels;
-  DMA1_Channel3->CMAR = (uint32_t)&color;
-
-  // 5. Enable DMA Request on SPI
-  SPI1->CR2 |= SPI_CR2_TXDMAEN;
-
-  // 6. Start DMA
-  DMA1_Channel3->CCR |= DMA_CCR_EN;
+  lcd_dma_start(&color, total_pixels, 0); // No MINC!
 
-  // 7. Wait Completion (Blocking for safety)
+  // 5. Wait Completion (Blocking for safety, color lives on the stack)
   lcd_dma_wait();
 
-  // 8. Cleanup
-  SPI1->CR2 &= ~SPI_CR2_TXDMAEN;
-  spi_wait_busy(); // Wait used SPI FIFO to drain
-  while (SPI1->SR & SPI_SR_BSY)
-    ;
-
-  LCD_CS_HIGH();
+  // 6. Cleanup
+  lcd_dma_finish();
 }
 
 void meas_drv_lcd_blit(void *ctx, meas_rect_t rect, const void *pixels) {
@@ -388,23 +426,97 @@ void meas_drv_lcd_blit(void *ctx, meas_rect_t rect, const void *pixels) {
   LCD_CD_DATA(); // Data Mode
 
   // DMA for BLIT (MINC=1)
-  DMA1_Channel3->CCR = DMA_CCR_MSIZE_0 | DMA_CCR_PSIZE_0 | DMA_CCR_DIR |
-                       DMA_CCR_PL_1 | DMA_CCR_MINC; // MINC Enabled
-  DMA1_Channel3->CNDTR = total_pixels;
-  DMA1_Channel3->CMAR = (uint32_t)pixels;
-
-  SPI1->CR2 |= SPI_CR2_TXDMAEN;
-  DMA1_Channel3->CCR |= DMA_CCR_EN;
+  lcd_dma_start(pixels, total_pixels, DMA_CCR_MINC);
 
   lcd_dma_wait();
 
-  SPI1->CR2 &= ~SPI_CR2_TXDMAEN;
-  while (SPI1->SR & SPI_SR_BSY)
-    ;
+  lcd_dma_finish();
+}
 
-  LCD_CS_HIGH();
+meas_status_t meas_drv_lcd_blit_async(void *ctx, meas_rect_t rect,
+                                      const void *pixels,
+                                      meas_drv_lcd_done_cb_t done,
+                                      void *user) {
+  meas_drv_lcd_t *lcd = (meas_drv_lcd_t *)ctx;
+  if (!lcd || !lcd->is_initialized || !pixels)
+    return MEAS_ERROR;
+
+  if (lcd->dma_busy)
+    return MEAS_BUSY;
+
+  uint32_t total_pixels = (uint32_t)rect.w * rect.h;
+  if (total_pixels == 0) {
+    if (done)
+      done(user);
+    return MEAS_OK;
+  }
+
+  meas_drv_lcd_set_window(ctx, rect);
+
+  spi_wait_busy();
+  lcd_spi_config_16bit();
+
+  LCD_CS_LOW();
+  lcd_write_cmd(CMD_RAMWR);
+  LCD_CD_DATA(); // Data Mode
+
+  lcd->on_done = done;
+  lcd->on_done_user = user;
+  lcd->dma_busy = true;
+
+  // Completion is signalled by the TC interrupt (DMA1_Channel3_IRQHandler)
+  DMA1->IFCR = DMA_IFCR_CGIF3;
+  *NVIC_ISER0 = (1UL << DMA_IRQn);
+  lcd_dma_start(pixels, total_pixels, DMA_CCR_MINC | DMA_CCR_TCIE);
+
+  return MEAS_OK;
+}
+
+bool meas_drv_lcd_is_busy(void *ctx) {
+  meas_drv_lcd_t *lcd = (meas_drv_lcd_t *)ctx;
+  if (!lcd)
+    return false;
+  return lcd->dma_busy;
+}
+
+void meas_drv_lcd_wait(void *ctx) {
+  meas_drv_lcd_t *lcd = (meas_drv_lcd_t *)ctx;
+  if (!lcd)
+    return;
+  lcd_wait_idle(lcd);
+}
+
+void meas_drv_lcd_set_bus_wait(void *ctx, void (*wait)(void *ctx),
+                               void *wait_ctx) {
+  meas_drv_lcd_t *lcd = (meas_drv_lcd_t *)ctx;
+  if (!lcd)
+    return;
+  lcd->bus_wait = wait;
+  lcd->bus_wait_ctx = wait_ctx;
 }
 
+/**
+ * @brief DMA1 Channel 3 Interrupt Handler (LCD TX complete).
+ *
+ * Releases the SPI bus and notifies the owner of the asynchronous blit.
+ */
+void DMA1_Channel3_IRQHandler(void) {
+  if (DMA1->ISR & DMA_ISR_TCIF3) {
+    DMA1->IFCR = DMA_IFCR_CGIF3;
+    DMA1_Channel3->CCR &= ~(DMA_CCR_EN | DMA_CCR_TCIE);
+
+    lcd_dma_finish();
+
+    lcd_ctx.dma_busy = false;
+    if (lcd_ctx.on_done) {
+      lcd_ctx.on_done(lcd_ctx.on_done_user);
+    }
+  }
+}
+
+// Wire the handler into the vector table (IRQ 13 -> Vector74)
+void Vector74(void) __attribute__((alias("DMA1_Channel3_IRQHandler")));
+
 void meas_drv_lcd_set_orientation(void *ctx, uint8_t rotation, bool bgr_order) {
   meas_drv_lcd_t *lcd = (meas_drv_lcd_t *)ctx;
   if (!lcd || !lcd->is_initialized)
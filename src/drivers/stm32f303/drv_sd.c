@@ -12,12 +12,17 @@
  *   - PB4: MISO
  *   - PB5: MOSI
  *   - PB11: CS (Active Low)
+ * - Data blocks move by DMA: DMA1 Channel 2 (SPI1_RX, completion IRQ) and
+ *   Channel 3 (SPI1_TX, also used by the LCD). Multi-block transfers stream
+ *   with CMD18 / CMD25 (ACMD23 pre-erase) and are advanced block by block
+ *   from the Channel 2 interrupt.
  */
 
 #include "drv_sd.h"
 #include "measlib/drivers/hal.h"
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 // --- Hardware Definitions (Bare Metal) ---
 
@@ -56,6 +61,20 @@ typedef struct {
   volatile uint32_t APB1ENR;
 } RCC_TypeDef;
 
+typedef struct {
+  volatile uint32_t CCR;
+  volatile uint32_t CNDTR;
+  volatile uint32_t CPAR;
+  volatile uint32_t CMAR;
+  volatile uint32_t RES;
+} DMA_Channel_TypeDef;
+
+typedef struct {
+  volatile uint32_t ISR;
+  volatile uint32_t IFCR;
+  DMA_Channel_TypeDef Channel[7];
+} DMA_TypeDef;
+
 #define RCC_ADDR 0x40021000UL
 #define GPIOB_BASE (0x48000400UL) // AHB2
 #define SPI1_BASE (0x40013000UL)  // APB2
@@ -63,6 +82,12 @@ typedef struct {
 #define RCC ((RCC_TypeDef *)RCC_ADDR)
 #define GPIOB ((GPIO_TypeDef *)GPIOB_BASE)
 #define SPI1 ((SPI_TypeDef *)SPI1_BASE)
+#define DMA1 ((DMA_TypeDef *)0x40020000UL)
+#define DMA1_Channel2 ((DMA_Channel_TypeDef *)0x4002001CUL)
+#define DMA1_Channel3 ((DMA_Channel_TypeDef *)0x40020030UL)
+#define NVIC_ISER0 ((volatile uint32_t *)0xE000E100UL)
+
+#define RCC_AHBENR_DMA1EN (1UL << 0)
 
 #define RCC_AHBENR_GPIOBEN (1UL << 18)
 #define RCC_APB2ENR_SPI1EN (1UL << 12)
@@ -78,6 +103,8 @@ typedef struct {
 #define SPI_CR1_SSI (1UL << 8)
 #define SPI_CR1_SSM (1UL << 9)
 
+#define SPI_CR2_RXDMAEN (1UL << 0)
+#define SPI_CR2_TXDMAEN (1UL << 1)
 #define SPI_CR2_DS_0 (1UL << 8)
 #define SPI_CR2_DS_1 (1UL << 9)
 #define SPI_CR2_DS_2 (1UL << 10)
@@ -87,6 +114,22 @@ typedef struct {
 #define SPI_SR_TXE (1UL << 1)
 #define SPI_SR_BSY (1UL << 7)
 
+// DMA Register Bits
+#define DMA_CCR_EN (1UL << 0)
+#define DMA_CCR_TCIE (1UL << 1)
+#define DMA_CCR_TEIE (1UL << 3)
+#define DMA_CCR_DIR (1UL << 4)
+#define DMA_CCR_MINC (1UL << 7)
+#define DMA_CCR_PL_1 (1UL << 13)
+
+#define DMA_ISR_TCIF2 (1UL << 5)
+#define DMA_ISR_TEIF2 (1UL << 7)
+#define DMA_IFCR_CGIF2 (1UL << 4)
+#define DMA_IFCR_CGIF3 (1UL << 8)
+
+// DMA1 Channel 2 is IRQ 12 (Vector70 in the ChibiOS-style vector table)
+#define SD_DMA_IRQn 12
+
 // Pin Defs
 #define SD_CS_PIN 11 // PB11
 
@@ -111,16 +154,64 @@ typedef struct {
 #define CMD55 (55)         // APP_CMD
 #define CMD58 (58)         // READ_OCR
 
+#define SD_BLOCK_SIZE 512
+
+/**
+ * @brief Bytes clocked in per token / busy probe.
+ */
+#ifndef SD_PROBE_LEN
+#define SD_PROBE_LEN 32
+#endif
+
+// Wait limits in bytes on the bus (~2.25 MB/s at PCLK/4)
+#define SD_TOKEN_TIMEOUT 225000UL // ~100 ms
+#define SD_BUSY_TIMEOUT 1125000UL // ~500 ms
+
 // --- Context Definition ---
 
+/// Transfer phases (what the running DMA exchange is for)
+enum {
+  SD_JOB_IDLE = 0,
+  SD_JOB_TOKEN,    ///< Read: looking for the data token
+  SD_JOB_DATA,     ///< One 512-byte block
+  SD_JOB_RESPONSE, ///< Write: CRC, data response, busy
+  SD_JOB_BUSY,     ///< Write: card programming the block
+  SD_JOB_STOP,     ///< Multi-block: busy after the stop token / CMD12
+};
+
 typedef struct {
   bool initialized;
   uint8_t card_type; // 0:Unknown, 1:MMC, 2:v1, 4:v2, 8:Block
   uint32_t sector_count;
+
+  // Transfer in flight (owned by the DMA interrupt while not idle)
+  volatile uint8_t phase;
+  volatile meas_sd_status_t status; ///< Result of the last transfer
+  meas_sd_status_t error;           ///< Result once a stopping transfer ends
+  bool write;
+  bool multi;
+  uint8_t skip;      ///< Probe bytes that are CRC, not token
+  uint8_t *rx;       ///< Next read block
+  const uint8_t *tx; ///< Next write block
+  uint32_t left;     ///< Blocks not yet started
+  uint32_t wait;     ///< Bytes left before the current wait times out
+  meas_drv_sd_done_cb_t done;
+  void *done_user;
+
+  // Shared bus
+  void (*bus_wait)(void *ctx);
+  void *bus_wait_ctx;
+
+  // HAL completion (read_async / write_async)
+  meas_hal_storage_done_t hal_done;
+  void *hal_user;
 } meas_drv_sd_t;
 
 static meas_drv_sd_t sd_ctx;
 
+static uint8_t sd_probe[SD_PROBE_LEN];
+static const uint8_t sd_fill = 0xFF; // Clocked out while receiving
+
 // --- Hardware Helper Functions ---
 
 static void sd_select(void) {
@@ -236,73 +327,208 @@ static uint8_t sd_send_cmd(uint8_t cmd, uint32_t arg) {
   return res;
 }
 
-// --- Public API Implementation (Internal but exposed via HAL) ---
+// --- DMA Block Transfers ---
 
-meas_sd_status_t meas_drv_sd_read_blocks(void *ctx, uint32_t sector,
-                                         uint8_t *buffer, uint32_t count) {
-  meas_drv_sd_t *sd = (meas_drv_sd_t *)ctx;
-  if (!sd || !sd->initialized)
-    return MEAS_SD_NO_INIT;
-  if (!(sd->card_type & 8))
-    sector *= 512;
+/**
+ * @brief Start both SPI1 DMA channels for one exchange of @p len bytes.
+ * RX (Channel 2) raises the completion interrupt: it finishes only when the
+ * last byte has been clocked in, TX (Channel 3) runs without one.
+ */
+static void sd_dma_start(uint8_t *rx, uint32_t rx_flags, const uint8_t *tx,
+                         uint32_t tx_flags, uint16_t len) {
+  DMA1->IFCR = DMA_IFCR_CGIF2 | DMA_IFCR_CGIF3;
+
+  DMA1_Channel2->CCR = DMA_CCR_PL_1 | DMA_CCR_TCIE | DMA_CCR_TEIE | rx_flags;
+  DMA1_Channel2->CPAR = (uint32_t)&SD_SPI->DR;
+  DMA1_Channel2->CNDTR = len;
+  DMA1_Channel2->CMAR = (uint32_t)rx;
+
+  DMA1_Channel3->CCR = DMA_CCR_PL_1 | DMA_CCR_DIR | tx_flags;
+  DMA1_Channel3->CPAR = (uint32_t)&SD_SPI->DR;
+  DMA1_Channel3->CNDTR = len;
+  DMA1_Channel3->CMAR = (uint32_t)tx;
+
+  // RX first, so no received byte is missed (RM0316 SPI DMA sequence)
+  SD_SPI->CR2 |= SPI_CR2_RXDMAEN;
+  DMA1_Channel2->CCR |= DMA_CCR_EN;
+  DMA1_Channel3->CCR |= DMA_CCR_EN;
+  SD_SPI->CR2 |= SPI_CR2_TXDMAEN;
+}
 
-  sd_select();
-  // Restore proper SPI Config (Shared Bus Safety)
-  sd_spi_config_fast();
+static void sd_dma_stop(void) {
+  DMA1_Channel2->CCR = 0;
+  DMA1_Channel3->CCR = 0;
+  SD_SPI->CR2 &= ~(SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN);
+  // The LCD polls TCIF3 for its own transfers
+  DMA1->IFCR = DMA_IFCR_CGIF2 | DMA_IFCR_CGIF3;
+}
 
-  if (count == 1) {
-    if (sd_send_cmd(CMD17, sector) == 0) {
-      uint8_t token;
-      uint32_t to = 20000;
-      do {
-        token = sd_spi_receive();
-      } while ((token == 0xFF) && --to);
-      if (token != 0xFE) {
-        sd_deselect();
-        return MEAS_SD_TIMEOUT;
-      }
-      for (int i = 0; i < 512; i++)
-        *buffer++ = sd_spi_receive();
+static void sd_job_finish(meas_drv_sd_t *sd, meas_sd_status_t status) {
+  sd_deselect();
+  sd_spi_receive();
+  sd->status = status;
+  sd->phase = SD_JOB_IDLE;
+  if (sd->done)
+    sd->done(sd->done_user, status);
+}
+
+static void sd_job_fail(meas_drv_sd_t *sd, meas_sd_status_t status);
+
+/**
+ * @brief Clock @ref SD_PROBE_LEN bytes in by DMA and look at them from the
+ * interrupt. Token and busy waits never spin the CPU.
+ */
+static void sd_probe_start(meas_drv_sd_t *sd, uint8_t phase, uint8_t skip) {
+  if (sd->wait < SD_PROBE_LEN) {
+    sd_job_fail(sd, MEAS_SD_TIMEOUT);
+    return;
+  }
+  sd->wait -= SD_PROBE_LEN;
+  sd->phase = phase;
+  sd->skip = skip;
+  sd_dma_start(sd_probe, DMA_CCR_MINC, &sd_fill, 0, SD_PROBE_LEN);
+}
+
+/**
+ * @brief Take the card out of a multi-block transfer: Stop Tran token after
+ * a write, CMD12 during a read. Both are a few bytes clocked out from the
+ * interrupt; the busy time that follows is probed, then the transfer ends
+ * with sd->error.
+ */
+static void sd_job_stop(meas_drv_sd_t *sd) {
+  if (sd->write) {
+    sd_spi_transfer(0xFD); // Stop Tran token
+  } else {
+    sd_spi_transfer(0x40 | CMD12);
+    for (int i = 0; i < 4; i++)
+      sd_spi_transfer(0x00);
+    sd_spi_transfer(0x01);
+    sd_spi_receive(); // Stuff byte: the read stream ends here
+  }
+  sd->wait = SD_BUSY_TIMEOUT;
+  sd_probe_start(sd, SD_JOB_STOP, 0);
+}
+
+/**
+ * @brief End a transfer that failed. A multi-block transfer is stopped
+ * first, so the card does not stay in its data state.
+ */
+static void sd_job_fail(meas_drv_sd_t *sd, meas_sd_status_t status) {
+  if (!sd->multi || sd->phase == SD_JOB_STOP) {
+    sd_job_finish(sd, status);
+    return;
+  }
+  sd->error = status;
+  sd_job_stop(sd);
+}
+
+/**
+ * @brief Move the next block. @p have data bytes of a read block already
+ * came in with the probe that found its token.
+ */
+static void sd_data_start(meas_drv_sd_t *sd, uint16_t have) {
+  sd->left--;
+  sd->phase = SD_JOB_DATA;
+  if (sd->write) {
+    const uint8_t *src = sd->tx;
+    sd->tx += SD_BLOCK_SIZE;
+    sd_dma_start(sd_probe, 0, src, DMA_CCR_MINC, SD_BLOCK_SIZE);
+  } else {
+    uint8_t *dst = sd->rx + have;
+    sd->rx += SD_BLOCK_SIZE;
+    sd_dma_start(dst, DMA_CCR_MINC, &sd_fill, 0,
+                 (uint16_t)(SD_BLOCK_SIZE - have));
+  }
+}
+
+/**
+ * @brief Advance the transfer after a DMA exchange (interrupt context).
+ */
+static void sd_job_step(meas_drv_sd_t *sd) {
+  uint8_t phase = sd->phase;
+
+  switch (phase) {
+  case SD_JOB_DATA:
+    if (sd->write) {
+      // CRC, data response, then busy until the block is programmed
+      sd->wait = SD_BUSY_TIMEOUT;
+      sd_probe_start(sd, SD_JOB_RESPONSE, 0);
+    } else if (sd->left) {
+      // CRC, then the token of the next block
+      sd->wait = SD_TOKEN_TIMEOUT;
+      sd_probe_start(sd, SD_JOB_TOKEN, 2);
+    } else {
       sd_spi_receive();
       sd_spi_receive();
-    } else {
-      sd_deselect();
-      return MEAS_SD_ERROR;
+      if (sd->multi)
+        sd_job_stop(sd);
+      else
+        sd_job_finish(sd, MEAS_SD_OK);
     }
-  } else {
-    if (sd_send_cmd(CMD18, sector) == 0) {
-      do {
-        uint8_t token;
-        uint32_t to = 20000;
-        do {
-          token = sd_spi_receive();
-        } while ((token == 0xFF) && --to);
-        if (token != 0xFE) {
-          sd_deselect();
-          return MEAS_SD_TIMEOUT;
-        }
-        for (int i = 0; i < 512; i++)
-          *buffer++ = sd_spi_receive();
-        sd_spi_receive();
-        sd_spi_receive();
-      } while (--count);
-      sd_send_cmd(CMD12, 0);
+    break;
+
+  case SD_JOB_TOKEN:
+    for (uint16_t i = sd->skip; i < SD_PROBE_LEN; i++) {
+      if (sd_probe[i] == 0xFF)
+        continue;
+      if (sd_probe[i] != 0xFE) {
+        sd_job_fail(sd, MEAS_SD_ERROR); // Data error token
+        return;
+      }
+      uint16_t have = (uint16_t)(SD_PROBE_LEN - i - 1);
+      memcpy(sd->rx, &sd_probe[i + 1], have);
+      sd_data_start(sd, have);
+      return;
+    }
+    sd_probe_start(sd, SD_JOB_TOKEN, 0);
+    break;
+
+  case SD_JOB_RESPONSE:
+    if ((sd_probe[2] & 0x1F) != 0x05) {
+      if (!sd->multi) {
+        sd_job_finish(sd, MEAS_SD_WRITE_ERROR);
+        return;
+      }
+      sd->error = MEAS_SD_WRITE_ERROR; // Stop once the card is ready
+    }
+    // fall through
+  case SD_JOB_BUSY:
+    if (sd_probe[SD_PROBE_LEN - 1] != 0xFF) {
+      sd_probe_start(sd, SD_JOB_BUSY, 0);
+    } else if (sd->left && sd->error == MEAS_SD_OK) {
+      sd_spi_transfer(sd->multi ? 0xFC : 0xFE);
+      sd_data_start(sd, 0);
+    } else if (sd->multi) {
+      sd_job_stop(sd);
     } else {
-      sd_deselect();
-      return MEAS_SD_ERROR;
+      sd_job_finish(sd, MEAS_SD_OK);
     }
+    break;
+
+  case SD_JOB_STOP:
+    if (sd_probe[SD_PROBE_LEN - 1] != 0xFF)
+      sd_probe_start(sd, SD_JOB_STOP, 0);
+    else
+      sd_job_finish(sd, sd->error);
+    break;
+
+  default:
+    break;
   }
-  sd_deselect();
-  sd_spi_receive();
-  return MEAS_SD_OK;
 }
 
-meas_sd_status_t meas_drv_sd_write_blocks(void *ctx, uint32_t sector,
-                                          const uint8_t *buffer,
-                                          uint32_t count) {
-  meas_drv_sd_t *sd = (meas_drv_sd_t *)ctx;
+static meas_sd_status_t sd_job_start(meas_drv_sd_t *sd, uint32_t sector,
+                                     uint8_t *rx, const uint8_t *tx,
+                                     uint32_t count,
+                                     meas_drv_sd_done_cb_t done, void *user) {
   if (!sd || !sd->initialized)
     return MEAS_SD_NO_INIT;
+  if (count == 0)
+    return MEAS_SD_ERROR;
+  if (sd->phase != SD_JOB_IDLE)
+    return MEAS_SD_BUSY;
+  if (sd->bus_wait)
+    sd->bus_wait(sd->bus_wait_ctx); // Shared bus: let the LCD DMA finish
   if (!(sd->card_type & 8))
     sector *= 512;
 
@@ -310,55 +536,128 @@ meas_sd_status_t meas_drv_sd_write_blocks(void *ctx, uint32_t sector,
   // Restore proper SPI Config (Shared Bus Safety)
   sd_spi_config_fast();
 
-  if (count == 1) {
-    if (sd_send_cmd(CMD24, sector) == 0) {
-      sd_spi_transfer(0xFF);
-      sd_spi_transfer(0xFF);
-      sd_spi_transfer(0xFE);
-      for (int i = 0; i < 512; i++)
-        sd_spi_transfer(*buffer++);
-      sd_spi_transfer(0xFF);
-      sd_spi_transfer(0xFF);
-      if ((sd_spi_receive() & 0x1F) != 0x05) {
-        sd_deselect();
-        return MEAS_SD_WRITE_ERROR;
-      }
-      while (sd_spi_receive() == 0)
-        ;
-    } else {
-      sd_deselect();
-      return MEAS_SD_ERROR;
-    }
+  uint8_t res;
+  if (tx) {
+    // Pre-erase lets the card stream the blocks without reallocating
+    if (count > 1 && (sd->card_type & 6))
+      sd_send_cmd(ACMD23, count);
+    res = sd_send_cmd(count > 1 ? CMD25 : CMD24, sector);
   } else {
-    if (sd_send_cmd(CMD25, sector) == 0) {
-      sd_spi_transfer(0xFF);
-      sd_spi_transfer(0xFF);
-      do {
-        sd_spi_transfer(0xFC);
-        for (int i = 0; i < 512; i++)
-          sd_spi_transfer(*buffer++);
-        sd_spi_transfer(0xFF);
-        sd_spi_transfer(0xFF);
-        if ((sd_spi_receive() & 0x1F) != 0x05) {
-          sd_deselect();
-          return MEAS_SD_WRITE_ERROR;
-        }
-        while (sd_spi_receive() == 0)
-          ;
-      } while (--count);
-      sd_spi_transfer(0xFD);
-      while (sd_spi_receive() == 0)
-        ;
-    } else {
-      sd_deselect();
-      return MEAS_SD_ERROR;
-    }
+    res = sd_send_cmd(count > 1 ? CMD18 : CMD17, sector);
+  }
+  if (res != 0) {
+    sd_deselect();
+    sd_spi_receive();
+    return MEAS_SD_ERROR;
+  }
+
+  sd->write = (tx != NULL);
+  sd->multi = (count > 1);
+  sd->rx = rx;
+  sd->tx = tx;
+  sd->left = count;
+  sd->error = MEAS_SD_OK;
+  sd->done = done;
+  sd->done_user = user;
+
+  if (sd->write) {
+    sd_spi_transfer(0xFF);
+    sd_spi_transfer(0xFF);
+    sd_spi_transfer(sd->multi ? 0xFC : 0xFE);
+    sd_data_start(sd, 0);
+  } else {
+    sd->wait = SD_TOKEN_TIMEOUT;
+    sd_probe_start(sd, SD_JOB_TOKEN, 0);
   }
-  sd_deselect();
-  sd_spi_receive();
   return MEAS_SD_OK;
 }
 
+// --- Public API Implementation (Internal but exposed via HAL) ---
+
+meas_sd_status_t meas_drv_sd_read_async(void *ctx, uint32_t sector,
+                                        uint8_t *buffer, uint32_t count,
+                                        meas_drv_sd_done_cb_t done,
+                                        void *user) {
+  if (!buffer)
+    return MEAS_SD_ERROR;
+  return sd_job_start((meas_drv_sd_t *)ctx, sector, buffer, NULL, count,
+                      done, user);
+}
+
+meas_sd_status_t meas_drv_sd_write_async(void *ctx, uint32_t sector,
+                                         const uint8_t *buffer,
+                                         uint32_t count,
+                                         meas_drv_sd_done_cb_t done,
+                                         void *user) {
+  if (!buffer)
+    return MEAS_SD_ERROR;
+  return sd_job_start((meas_drv_sd_t *)ctx, sector, NULL, buffer, count,
+                      done, user);
+}
+
+bool meas_drv_sd_is_busy(void *ctx) {
+  meas_drv_sd_t *sd = (meas_drv_sd_t *)ctx;
+  if (!sd)
+    return false;
+  return sd->phase != SD_JOB_IDLE;
+}
+
+void meas_drv_sd_wait(void *ctx) {
+  meas_drv_sd_t *sd = (meas_drv_sd_t *)ctx;
+  if (!sd)
+    return;
+  while (sd->phase != SD_JOB_IDLE)
+    ;
+}
+
+void meas_drv_sd_set_bus_wait(void *ctx, void (*wait)(void *ctx),
+                              void *wait_ctx) {
+  meas_drv_sd_t *sd = (meas_drv_sd_t *)ctx;
+  if (!sd)
+    return;
+  sd->bus_wait = wait;
+  sd->bus_wait_ctx = wait_ctx;
+}
+
+meas_sd_status_t meas_drv_sd_read_blocks(void *ctx, uint32_t sector,
+                                         uint8_t *buffer, uint32_t count) {
+  meas_sd_status_t res =
+      meas_drv_sd_read_async(ctx, sector, buffer, count, NULL, NULL);
+  if (res != MEAS_SD_OK)
+    return res;
+  meas_drv_sd_wait(ctx);
+  return ((meas_drv_sd_t *)ctx)->status;
+}
+
+meas_sd_status_t meas_drv_sd_write_blocks(void *ctx, uint32_t sector,
+                                          const uint8_t *buffer,
+                                          uint32_t count) {
+  meas_sd_status_t res =
+      meas_drv_sd_write_async(ctx, sector, buffer, count, NULL, NULL);
+  if (res != MEAS_SD_OK)
+    return res;
+  meas_drv_sd_wait(ctx);
+  return ((meas_drv_sd_t *)ctx)->status;
+}
+
+/**
+ * @brief DMA1 Channel 2 Interrupt Handler (SD exchange complete).
+ */
+void DMA1_Channel2_IRQHandler(void) {
+  uint32_t isr = DMA1->ISR;
+  if (!(isr & (DMA_ISR_TCIF2 | DMA_ISR_TEIF2)))
+    return;
+  sd_dma_stop();
+  if (isr & DMA_ISR_TEIF2) {
+    sd_job_fail(&sd_ctx, MEAS_SD_ERROR);
+    return;
+  }
+  sd_job_step(&sd_ctx);
+}
+
+// Wire the handler into the vector table (IRQ 12 -> Vector70)
+void Vector70(void) __attribute__((alias("DMA1_Channel2_IRQHandler")));
+
 uint32_t meas_drv_sd_get_sector_count(void) { return sd_ctx.sector_count; }
 
 int meas_drv_sd_is_initialized(void) { return sd_ctx.initialized; }
@@ -383,6 +682,46 @@ static meas_status_t hal_sd_write(void *ctx, uint32_t sector,
   return (res == MEAS_SD_OK) ? MEAS_OK : MEAS_ERROR;
 }
 
+static void hal_sd_done(void *user, meas_sd_status_t status) {
+  meas_drv_sd_t *sd = (meas_drv_sd_t *)user;
+  if (sd->hal_done)
+    sd->hal_done(sd->hal_user, status == MEAS_SD_OK ? MEAS_OK : MEAS_ERROR);
+}
+
+static meas_status_t hal_sd_status(meas_sd_status_t res) {
+  if (res == MEAS_SD_OK)
+    return MEAS_OK;
+  return (res == MEAS_SD_BUSY) ? MEAS_BUSY : MEAS_ERROR;
+}
+
+static meas_status_t hal_sd_read_async(void *ctx, uint32_t sector,
+                                       void *buffer, uint32_t count,
+                                       meas_hal_storage_done_t done,
+                                       void *user) {
+  if (ctx != &sd_ctx)
+    return MEAS_ERROR;
+  if (sd_ctx.phase != SD_JOB_IDLE)
+    return MEAS_BUSY;
+  sd_ctx.hal_done = done;
+  sd_ctx.hal_user = user;
+  return hal_sd_status(meas_drv_sd_read_async(ctx, sector, (uint8_t *)buffer,
+                                              count, hal_sd_done, ctx));
+}
+
+static meas_status_t hal_sd_write_async(void *ctx, uint32_t sector,
+                                        const void *buffer, uint32_t count,
+                                        meas_hal_storage_done_t done,
+                                        void *user) {
+  if (ctx != &sd_ctx)
+    return MEAS_ERROR;
+  if (sd_ctx.phase != SD_JOB_IDLE)
+    return MEAS_BUSY;
+  sd_ctx.hal_done = done;
+  sd_ctx.hal_user = user;
+  return hal_sd_status(meas_drv_sd_write_async(
+      ctx, sector, (const uint8_t *)buffer, count, hal_sd_done, ctx));
+}
+
 static uint32_t hal_sd_get_capacity(void *ctx) {
   if (ctx != &sd_ctx)
     return 0;
@@ -401,6 +740,8 @@ static const meas_hal_storage_api_t sd_api = {
     .write = hal_sd_write,
     .get_capacity = hal_sd_get_capacity,
     .is_ready = hal_sd_is_ready,
+    .read_async = hal_sd_read_async,
+    .write_async = hal_sd_write_async,
 };
 
 const meas_hal_storage_api_t *meas_drv_sd_get_api(void) { return &sd_api; }
@@ -409,10 +750,9 @@ void *meas_drv_sd_init(void) {
   // 1. GPIO Init
   RCC->AHBENR |= RCC_AHBENR_GPIOBEN;
   RCC->APB2ENR |= RCC_APB2ENR_SPI1EN;
+  RCC->AHBENR |= RCC_AHBENR_DMA1EN;
 
-  sd_ctx.initialized = false;
-  sd_ctx.card_type = 0;
-  sd_ctx.sector_count = 0;
+  memset(&sd_ctx, 0, sizeof(sd_ctx));
 
   GPIOB->MODER &= ~((3UL << (3 * 2)) | (3UL << (4 * 2)) | (3UL << (5 * 2)) |
                     (3UL << (11 * 2)));
@@ -483,6 +823,7 @@ void *meas_drv_sd_init(void) {
 
   if (ty) {
     sd_spi_init(true);
+    *NVIC_ISER0 = (1UL << SD_DMA_IRQn);
     sd_ctx.initialized = true;
     return &sd_ctx;
   }
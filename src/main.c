@@ -42,6 +42,7 @@ int main(void) {
   // 1. Hardware Initialization
   sys_init();
   meas_dsp_tables_init();
+  active_ch = sys_get_channel();
 
   // 2. Main Superloop
   while (1) {
@@ -108,8 +108,8 @@ static void sa_fsm_tick(meas_channel_t *base_ch) {
     break;
 
   case SA_CH_STATE_NEXT:
-    // Continuous mode: go back to setup or acquire
-    // Logic for sweep could be added here
+    // Continuous mode: every pass completes a sweep, then the next starts
+    meas_channel_publish_done(base_ch);
     ch->state = SA_CH_STATE_SETUP;
     break;
   }
@@ -148,6 +148,8 @@ static meas_status_t sa_start(meas_channel_t *base_ch) {
  */
 static meas_status_t sa_abort(meas_channel_t *base_ch) {
   meas_sa_channel_t *ch = (meas_sa_channel_t *)base_ch;
+  if (ch->state != SA_CH_STATE_IDLE)
+    meas_channel_publish_done(base_ch);
   ch->state = SA_CH_STATE_IDLE;
   return MEAS_OK;
 }
@@ -21,6 +21,39 @@ static meas_status_t vna_get_prop(meas_object_t *obj, meas_id_t key,
                                   meas_variant_t *val);
 static const char *vna_get_name(meas_object_t *obj);
 
+// -- Property Descriptors --
+
+// Remotely settable properties (see scpi_prop.h)
+static const meas_prop_desc_t vna_props[] = {
+    {.key = MEAS_PROP_VNA_START_FREQ,
+     .name = "Start Frequency",
+     .scpi = "SENSe:FREQuency:STARt",
+     .type = PROP_TYPE_INT64,
+     .unit = "HZ",
+     .min = VNA_MIN_FREQ,
+     .max = VNA_MAX_FREQ},
+    {.key = MEAS_PROP_VNA_STOP_FREQ,
+     .name = "Stop Frequency",
+     .scpi = "SENSe:FREQuency:STOP",
+     .type = PROP_TYPE_INT64,
+     .unit = "HZ",
+     .min = VNA_MIN_FREQ,
+     .max = VNA_MAX_FREQ},
+    {.key = MEAS_PROP_VNA_POINTS,
+     .name = "Points",
+     .scpi = "SENSe:SWEep:POINts",
+     .type = PROP_TYPE_INT64,
+     .min = 1,
+     .max = VNA_MAX_POINTS},
+};
+
+static const meas_prop_desc_t *vna_get_props(meas_object_t *obj,
+                                             size_t *count) {
+  (void)obj;
+  *count = sizeof(vna_props) / sizeof(vna_props[0]);
+  return vna_props;
+}
+
 // -- Private Event Handler --
 
 static void vna_on_event(const meas_event_t *ev, void *ctx) {
@@ -121,9 +154,7 @@ static void vna_fsm_tick(meas_channel_t *base_ch) {
     if (ch->current_point >= ch->points) {
       // Sweep Complete
       ch->state = VNA_CH_STATE_IDLE;
-      meas_event_t ev = {.type = EVENT_STATE_CHANGED,
-                         .source = (meas_object_t *)base_ch};
-      meas_event_publish(ev);
+      meas_channel_publish_done(base_ch);
     } else {
       // Calc Next Freq
       // Linear Sweep: Start + (k * Step)
@@ -230,6 +261,8 @@ static meas_status_t vna_start_sweep(meas_channel_t *base_ch) {
 
 static meas_status_t vna_abort_sweep(meas_channel_t *base_ch) {
   meas_vna_channel_t *ch = (meas_vna_channel_t *)base_ch;
+  if (ch->state != VNA_CH_STATE_IDLE)
+    meas_channel_publish_done(base_ch);
   ch->state = VNA_CH_STATE_IDLE;
   return MEAS_OK;
 }
@@ -345,6 +378,7 @@ const meas_channel_api_t vna_channel_api = {.base =
                                                     .set_prop = vna_set_prop,
                                                     .get_prop = vna_get_prop,
                                                     .destroy = NULL,
+                                                    .get_props = vna_get_props,
                                                 },
                                             .configure = vna_configure,
                                             .start_sweep = vna_start_sweep,
@@ -0,0 +1,89 @@
+/**
+ * @file trace.c
+ * @brief VNA Trace Implementation.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/modules/vna/trace.h"
+#include <string.h>
+
+// Rebuild the stimulus axis when the channel's sweep plan changed
+static void vna_trace_update_axis(meas_vna_trace_t *t) {
+  const meas_vna_channel_t *ch = t->channel;
+  if (t->axis_start == ch->start_freq_hz && t->axis_stop == ch->stop_freq_hz &&
+      t->axis_count == t->count)
+    return;
+
+  meas_real_t start = (meas_real_t)ch->start_freq_hz;
+  meas_real_t step = 0;
+  if (t->count > 1)
+    step = (meas_real_t)(ch->stop_freq_hz - ch->start_freq_hz) /
+           (meas_real_t)(t->count - 1);
+  for (size_t i = 0; i < t->count; i++)
+    t->freq[i] = start + step * (meas_real_t)i;
+
+  t->axis_start = ch->start_freq_hz;
+  t->axis_stop = ch->stop_freq_hz;
+  t->axis_count = t->count;
+}
+
+static meas_status_t vna_trace_get_data(meas_trace_t *base,
+                                        const meas_real_t **x,
+                                        const meas_real_t **y, size_t *count) {
+  meas_vna_trace_t *t = (meas_vna_trace_t *)base;
+  if (x)
+    *x = t->freq;
+  if (y)
+    *y = (const meas_real_t *)t->data;
+  if (count)
+    *count = t->count;
+  return MEAS_OK;
+}
+
+static meas_status_t vna_trace_copy_data(meas_trace_t *base, const void *data,
+                                         size_t size) {
+  meas_vna_trace_t *t = (meas_vna_trace_t *)base;
+  if (!data)
+    return MEAS_ERROR;
+  size_t n = size / sizeof(meas_complex_t);
+  if (n > t->cap)
+    n = t->cap;
+  memcpy(t->data, data, n * sizeof(meas_complex_t));
+  t->count = n;
+  vna_trace_update_axis(t);
+  return MEAS_OK;
+}
+
+static meas_trace_fmt_t vna_trace_get_format(meas_trace_t *base) {
+  (void)base;
+  return TRACE_FMT_COMPLEX;
+}
+
+static const char *vna_trace_get_name(meas_object_t *obj) {
+  (void)obj;
+  return "VNA_Trace";
+}
+
+static const meas_trace_api_t vna_trace_api = {
+    .base = {.get_name = vna_trace_get_name},
+    .get_data = vna_trace_get_data,
+    .copy_data = vna_trace_copy_data,
+    .get_format = vna_trace_get_format,
+};
+
+meas_status_t meas_vna_trace_init(meas_vna_trace_t *t,
+                                  const meas_vna_channel_t *ch,
+                                  meas_real_t *freq, meas_complex_t *data,
+                                  size_t cap) {
+  if (!t || !ch || !freq || !data || cap == 0)
+    return MEAS_ERROR;
+  memset(t, 0, sizeof(*t));
+  t->base.base.api = (const meas_object_api_t *)&vna_trace_api;
+  t->channel = ch;
+  t->freq = freq;
+  t->data = data;
+  t->cap = cap;
+  return MEAS_OK;
+}
@@ -0,0 +1,1095 @@
+/**
+ * @file fat.c
+ * @brief FAT16 / FAT32 Filesystem (meas_fs_api_t on a Block Device).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/sys/fat.h"
+#include <ctype.h>
+#include <string.h>
+
+#define SECTOR MEAS_FAT_SECTOR_SIZE
+#define ENTRY_SIZE 32
+#define ENTRIES_PER_SECTOR (SECTOR / ENTRY_SIZE)
+
+#define ATTR_READ_ONLY 0x01
+#define ATTR_VOLUME_ID 0x08
+#define ATTR_DIRECTORY 0x10
+#define ATTR_ARCHIVE 0x20
+#define ATTR_LFN 0x0F
+
+#define ENTRY_FREE 0xE5
+#define ENTRY_END 0x00
+
+#define FAT32_MASK 0x0FFFFFFFUL
+
+// Entry dates (no RTC): 2026-01-01
+#define FAT_DATE (((2026 - 1980) << 9) | (1 << 5) | 1)
+
+#define FSINFO_LEAD 0x41615252UL
+#define FSINFO_STRUCT 0x61417272UL
+
+static uint16_t rd16(const uint8_t *p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t rd32(const uint8_t *p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+         ((uint32_t)p[3] << 24);
+}
+
+static void wr16(uint8_t *p, uint16_t v) {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+}
+
+static void wr32(uint8_t *p, uint32_t v) {
+  wr16(p, (uint16_t)v);
+  wr16(p + 2, (uint16_t)(v >> 16));
+}
+
+// --- Sector Cache ---
+
+static bool in_fat(const meas_fat_t *v, uint32_t lba) {
+  return lba >= v->fat_start && lba < v->fat_start + v->fat_sectors;
+}
+
+static meas_status_t cache_write_back(meas_fat_t *v, meas_fat_sector_t *s) {
+  if (!s->valid || !s->dirty)
+    return MEAS_OK;
+  uint32_t copies = in_fat(v, s->lba) ? v->num_fats : 1;
+  for (uint32_t i = 0; i < copies; i++) {
+    if (v->dev->write(v->dev_ctx, s->lba + i * v->fat_sectors, s->data, 1) !=
+        MEAS_OK)
+      return MEAS_ERROR;
+  }
+  s->dirty = false;
+  return MEAS_OK;
+}
+
+/**
+ * @brief Sector @p lba in the cache, evicting the least recently used one.
+ * @param fill Read it from the device (else it starts zeroed).
+ * @return NULL on a device error. Valid until the next cache_get().
+ */
+static meas_fat_sector_t *cache_get(meas_fat_t *v, uint32_t lba, bool fill) {
+  meas_fat_sector_t *victim = &v->cache[0];
+  for (size_t i = 0; i < MEAS_FAT_CACHE_SECTORS; i++) {
+    meas_fat_sector_t *s = &v->cache[i];
+    if (s->valid && s->lba == lba) {
+      s->used = ++v->stamp;
+      return s;
+    }
+    if (!s->valid)
+      victim = s;
+    else if (victim->valid && s->used < victim->used)
+      victim = s;
+  }
+
+  if (cache_write_back(v, victim) != MEAS_OK)
+    return NULL;
+  victim->valid = false;
+  if (fill) {
+    if (v->dev->read(v->dev_ctx, lba, victim->data, 1) != MEAS_OK)
+      return NULL;
+  } else {
+    memset(victim->data, 0, SECTOR);
+  }
+  victim->lba = lba;
+  victim->valid = true;
+  victim->dirty = false;
+  victim->used = ++v->stamp;
+  return victim;
+}
+
+static meas_status_t cache_flush(meas_fat_t *v) {
+  for (size_t i = 0; i < MEAS_FAT_CACHE_SECTORS; i++) {
+    if (cache_write_back(v, &v->cache[i]) != MEAS_OK)
+      return MEAS_ERROR;
+  }
+  return MEAS_OK;
+}
+
+// Sectors about to be overwritten from outside the cache
+static void cache_drop(meas_fat_t *v, uint32_t lba, uint32_t count) {
+  for (size_t i = 0; i < MEAS_FAT_CACHE_SECTORS; i++) {
+    meas_fat_sector_t *s = &v->cache[i];
+    if (s->valid && s->lba >= lba && s->lba - lba < count) {
+      s->valid = false;
+      s->dirty = false;
+    }
+  }
+}
+
+// Cached copies are newer than what was just read from the device
+static void cache_overlay(meas_fat_t *v, uint32_t lba, uint32_t count,
+                          uint8_t *buf) {
+  for (size_t i = 0; i < MEAS_FAT_CACHE_SECTORS; i++) {
+    const meas_fat_sector_t *s = &v->cache[i];
+    if (s->valid && s->lba >= lba && s->lba - lba < count)
+      memcpy(buf + (size_t)(s->lba - lba) * SECTOR, s->data, SECTOR);
+  }
+}
+
+// --- FAT ---
+
+static bool cluster_valid(const meas_fat_t *v, uint32_t c) {
+  return c >= 2 && c - 2 < v->cluster_count;
+}
+
+static uint32_t cluster_lba(const meas_fat_t *v, uint32_t c) {
+  return v->data_start + (c - 2) * v->cluster_sectors;
+}
+
+static uint32_t fat_eoc(const meas_fat_t *v) {
+  return v->fat_bits == 16 ? 0xFFFFUL : FAT32_MASK;
+}
+
+static meas_status_t fat_get(meas_fat_t *v, uint32_t c, uint32_t *val) {
+  uint32_t off = c * (v->fat_bits / 8U);
+  meas_fat_sector_t *s = cache_get(v, v->fat_start + off / SECTOR, true);
+  if (!s)
+    return MEAS_ERROR;
+  const uint8_t *p = &s->data[off % SECTOR];
+  *val = v->fat_bits == 16 ? rd16(p) : rd32(p) & FAT32_MASK;
+  return MEAS_OK;
+}
+
+static meas_status_t fat_set(meas_fat_t *v, uint32_t c, uint32_t val) {
+  uint32_t off = c * (v->fat_bits / 8U);
+  meas_fat_sector_t *s = cache_get(v, v->fat_start + off / SECTOR, true);
+  if (!s)
+    return MEAS_ERROR;
+  uint8_t *p = &s->data[off % SECTOR];
+  if (v->fat_bits == 16)
+    wr16(p, (uint16_t)val);
+  else
+    wr32(p, (rd32(p) & ~FAT32_MASK) | (val & FAT32_MASK)); // Keep top bits
+  s->dirty = true;
+  return MEAS_OK;
+}
+
+/**
+ * @brief Cluster after @p c (0 at the end of the chain).
+ * A free, bad or out-of-range link is an error.
+ */
+static meas_status_t fat_next(meas_fat_t *v, uint32_t c, uint32_t *next) {
+  uint32_t val;
+  if (fat_get(v, c, &val) != MEAS_OK)
+    return MEAS_ERROR;
+  if (val >= (v->fat_bits == 16 ? 0xFFF8UL : 0x0FFFFFF8UL)) {
+    *next = 0;
+    return MEAS_OK;
+  }
+  if (!cluster_valid(v, val))
+    return MEAS_ERROR;
+  *next = val;
+  return MEAS_OK;
+}
+
+// The free count in FSInfo goes stale with the first change: mark unknown
+static void fsinfo_invalidate(meas_fat_t *v) {
+  if (!v->fsinfo)
+    return;
+  meas_fat_sector_t *s = cache_get(v, v->fsinfo, true);
+  if (s) {
+    wr32(&s->data[488], 0xFFFFFFFFUL);
+    s->dirty = true;
+  }
+  v->fsinfo = 0;
+}
+
+/**
+ * @brief Allocate a cluster and link it after @p prev (0: new chain).
+ */
+static meas_status_t fat_alloc(meas_fat_t *v, uint32_t prev, uint32_t *out) {
+  uint32_t c = v->next_free;
+  for (uint32_t n = 0; n < v->cluster_count; n++, c++) {
+    if (!cluster_valid(v, c))
+      c = 2;
+    uint32_t val;
+    if (fat_get(v, c, &val) != MEAS_OK)
+      return MEAS_ERROR;
+    if (val != 0)
+      continue;
+    if (fat_set(v, c, fat_eoc(v)) != MEAS_OK ||
+        (prev && fat_set(v, prev, c) != MEAS_OK))
+      return MEAS_ERROR;
+    v->next_free = c + 1;
+    fsinfo_invalidate(v);
+    *out = c;
+    return MEAS_OK;
+  }
+  return MEAS_ERROR; // Volume full
+}
+
+static meas_status_t fat_free_chain(meas_fat_t *v, uint32_t c) {
+  while (c) {
+    uint32_t next;
+    if (fat_next(v, c, &next) != MEAS_OK || fat_set(v, c, 0) != MEAS_OK)
+      return MEAS_ERROR;
+    if (c < v->next_free)
+      v->next_free = c;
+    c = next;
+  }
+  fsinfo_invalidate(v);
+  return MEAS_OK;
+}
+
+// --- Directories ---
+
+typedef struct {
+  uint32_t cluster; ///< Current cluster (0: FAT16 root region)
+  uint32_t sector;  ///< Sector within the cluster / root region
+  uint32_t lba;
+  uint16_t entry; ///< Entry within the sector
+} fat_dir_t;
+
+static uint32_t entry_cluster(const meas_fat_t *v, const uint8_t *e) {
+  uint32_t c = rd16(e + 26);
+  if (v->fat_bits == 32)
+    c |= (uint32_t)rd16(e + 20) << 16;
+  return c;
+}
+
+static void entry_set_cluster(uint8_t *e, uint32_t c) {
+  wr16(e + 26, (uint16_t)c);
+  wr16(e + 20, (uint16_t)(c >> 16));
+}
+
+static void entry_init(uint8_t *e, const uint8_t *name, uint8_t attr,
+                       uint32_t cluster) {
+  memset(e, 0, ENTRY_SIZE);
+  memcpy(e, name, 11);
+  e[11] = attr;
+  wr16(e + 16, FAT_DATE); // Created
+  wr16(e + 18, FAT_DATE); // Accessed
+  wr16(e + 24, FAT_DATE); // Written
+  entry_set_cluster(e, cluster);
+}
+
+// Directory entry at the iterator; valid until the next cache access
+static uint8_t *dir_entry(meas_fat_t *v, const fat_dir_t *d,
+                          meas_fat_sector_t **sec) {
+  meas_fat_sector_t *s = cache_get(v, d->lba, true);
+  if (sec)
+    *sec = s;
+  return s ? &s->data[d->entry * ENTRY_SIZE] : NULL;
+}
+
+static void dir_open(const meas_fat_t *v, fat_dir_t *d, uint32_t cluster) {
+  if (cluster == 0 && v->fat_bits == 32)
+    cluster = v->root_cluster;
+  d->cluster = cluster;
+  d->sector = 0;
+  d->entry = 0;
+  d->lba = cluster ? cluster_lba(v, cluster) : v->root_start;
+}
+
+static meas_status_t dir_next(meas_fat_t *v, fat_dir_t *d, bool *end) {
+  *end = false;
+  if (++d->entry < ENTRIES_PER_SECTOR)
+    return MEAS_OK;
+  d->entry = 0;
+  if (d->cluster == 0) {
+    *end = (++d->sector >= v->root_sectors);
+    d->lba++;
+    return MEAS_OK;
+  }
+  if (++d->sector < v->cluster_sectors) {
+    d->lba++;
+    return MEAS_OK;
+  }
+  uint32_t next;
+  if (fat_next(v, d->cluster, &next) != MEAS_OK)
+    return MEAS_ERROR;
+  if (!next) {
+    *end = true;
+    return MEAS_OK;
+  }
+  d->cluster = next;
+  d->sector = 0;
+  d->lba = cluster_lba(v, next);
+  return MEAS_OK;
+}
+
+static bool entry_is_file(const uint8_t *e) {
+  return e[0] != ENTRY_FREE && e[11] != ATTR_LFN &&
+         !(e[11] & ATTR_VOLUME_ID);
+}
+
+/**
+ * @brief Look up an 8.3 @p name in a directory; @p d is left at the entry.
+ */
+static meas_status_t dir_find(meas_fat_t *v, uint32_t cluster,
+                              const uint8_t *name, fat_dir_t *d,
+                              bool *found) {
+  *found = false;
+  dir_open(v, d, cluster);
+  for (;;) {
+    const uint8_t *e = dir_entry(v, d, NULL);
+    if (!e)
+      return MEAS_ERROR;
+    if (e[0] == ENTRY_END)
+      return MEAS_OK;
+    if (entry_is_file(e) && memcmp(e, name, 11) == 0) {
+      *found = true;
+      return MEAS_OK;
+    }
+    bool end;
+    if (dir_next(v, d, &end) != MEAS_OK)
+      return MEAS_ERROR;
+    if (end)
+      return MEAS_OK;
+  }
+}
+
+static meas_status_t dir_zero_cluster(meas_fat_t *v, uint32_t c) {
+  for (uint32_t i = 0; i < v->cluster_sectors; i++) {
+    meas_fat_sector_t *s = cache_get(v, cluster_lba(v, c) + i, false);
+    if (!s)
+      return MEAS_ERROR;
+    s->dirty = true;
+  }
+  return MEAS_OK;
+}
+
+/**
+ * @brief Find a free entry, growing the directory by a cluster if needed.
+ */
+static meas_status_t dir_alloc(meas_fat_t *v, uint32_t cluster,
+                               fat_dir_t *d) {
+  dir_open(v, d, cluster);
+  for (;;) {
+    const uint8_t *e = dir_entry(v, d, NULL);
+    if (!e)
+      return MEAS_ERROR;
+    if (e[0] == ENTRY_END || e[0] == ENTRY_FREE)
+      return MEAS_OK;
+    bool end;
+    if (dir_next(v, d, &end) != MEAS_OK)
+      return MEAS_ERROR;
+    if (end)
+      break;
+  }
+  if (d->cluster == 0)
+    return MEAS_ERROR; // FAT16 root directory is full
+
+  uint32_t c;
+  if (fat_alloc(v, d->cluster, &c) != MEAS_OK ||
+      dir_zero_cluster(v, c) != MEAS_OK)
+    return MEAS_ERROR;
+  d->cluster = c;
+  d->sector = 0;
+  d->entry = 0;
+  d->lba = cluster_lba(v, c);
+  return MEAS_OK;
+}
+
+static meas_status_t dir_is_empty(meas_fat_t *v, uint32_t cluster,
+                                  bool *empty) {
+  fat_dir_t d;
+  *empty = true;
+  dir_open(v, &d, cluster);
+  for (;;) {
+    const uint8_t *e = dir_entry(v, &d, NULL);
+    if (!e)
+      return MEAS_ERROR;
+    if (e[0] == ENTRY_END)
+      return MEAS_OK;
+    if (entry_is_file(e) && e[0] != '.') {
+      *empty = false;
+      return MEAS_OK;
+    }
+    bool end;
+    if (dir_next(v, &d, &end) != MEAS_OK)
+      return MEAS_ERROR;
+    if (end)
+      return MEAS_OK;
+  }
+}
+
+// --- Paths ---
+
+/**
+ * @brief Convert one path component to a padded, upper-case 8.3 name.
+ */
+static bool fat_name(const char *src, size_t len, uint8_t *out) {
+  memset(out, ' ', 11);
+  if (len == 0 || src[0] == '.')
+    return false;
+  size_t n = 0;
+  bool ext = false;
+  for (size_t i = 0; i < len; i++) {
+    char c = src[i];
+    if (c == '.') {
+      if (ext)
+        return false;
+      ext = true;
+      n = 8;
+      continue;
+    }
+    if ((unsigned char)c < 0x20 || strchr("\"*+,:;<=>?[]|", c))
+      return false;
+    if (n >= (ext ? 11U : 8U))
+      return false;
+    out[n++] = (uint8_t)toupper((unsigned char)c);
+  }
+  if (out[0] == ENTRY_FREE)
+    out[0] = 0x05; // Kanji lead byte escape
+  return true;
+}
+
+static bool is_sep(char c) { return c == '/' || c == '\\'; }
+
+/**
+ * @brief Directory holding the last component of @p path, and its name.
+ * Directory cluster 0 is the root.
+ */
+static meas_status_t fat_resolve(meas_fat_t *v, const char *path,
+                                 uint32_t *dir, uint8_t *name) {
+  uint32_t cluster = 0;
+  while (is_sep(*path))
+    path++;
+  for (;;) {
+    size_t len = strcspn(path, "/\\");
+    if (!fat_name(path, len, name))
+      return MEAS_ERROR;
+    const char *rest = path + len;
+    while (is_sep(*rest))
+      rest++;
+    if (*rest == '\0') {
+      *dir = cluster;
+      return MEAS_OK;
+    }
+
+    fat_dir_t d;
+    bool found;
+    if (dir_find(v, cluster, name, &d, &found) != MEAS_OK || !found)
+      return MEAS_ERROR;
+    const uint8_t *e = dir_entry(v, &d, NULL);
+    if (!e || !(e[11] & ATTR_DIRECTORY))
+      return MEAS_ERROR;
+    cluster = entry_cluster(v, e);
+    path = rest;
+  }
+}
+
+// --- Cluster Chains ---
+
+static uint32_t cluster_bytes(const meas_fat_t *v) {
+  return (uint32_t)v->cluster_sectors * SECTOR;
+}
+
+// Remember cluster @p index of the chain (runs only grow from the front)
+static void chain_note(meas_fat_file_t *f, uint32_t index, uint32_t c) {
+  f->cur_index = index;
+  f->cur = c;
+  if (index != f->known)
+    return;
+  meas_fat_run_t *r = f->run_count ? &f->runs[f->run_count - 1] : NULL;
+  if (r && c == r->cluster + r->count) {
+    r->count++;
+  } else if (f->run_count < MEAS_FAT_CHAIN_RUNS) {
+    r = &f->runs[f->run_count++];
+    r->index = index;
+    r->cluster = c;
+    r->count = 1;
+  } else {
+    return;
+  }
+  f->known++;
+}
+
+// Forget clusters from position @p keep on
+static void chain_trim(meas_fat_file_t *f, uint32_t keep) {
+  while (f->run_count && f->runs[f->run_count - 1].index >= keep)
+    f->run_count--;
+  if (f->run_count) {
+    meas_fat_run_t *r = &f->runs[f->run_count - 1];
+    if (r->index + r->count > keep)
+      r->count = keep - r->index;
+  }
+  if (f->known > keep)
+    f->known = keep;
+  if (f->cur_index >= keep)
+    f->cur = 0;
+}
+
+/**
+ * @brief Cluster at position @p index of the file's chain (0 past its end).
+ * Looks at the cursor and the runs first, then walks on from the furthest
+ * known cluster.
+ */
+static meas_status_t file_cluster(meas_fat_t *v, meas_fat_file_t *f,
+                                  uint32_t index, uint32_t *out) {
+  if (f->cur && f->cur_index == index) {
+    *out = f->cur;
+    return MEAS_OK;
+  }
+  for (uint8_t i = 0; i < f->run_count && index < f->known; i++) {
+    const meas_fat_run_t *r = &f->runs[i];
+    if (index - r->index < r->count) {
+      *out = r->cluster + (index - r->index);
+      f->cur_index = index;
+      f->cur = *out;
+      return MEAS_OK;
+    }
+  }
+
+  uint32_t i = 0;
+  uint32_t c = f->first;
+  if (f->known) {
+    const meas_fat_run_t *r = &f->runs[f->run_count - 1];
+    i = f->known - 1;
+    c = r->cluster + r->count - 1;
+  } else if (c) {
+    chain_note(f, 0, c);
+  }
+  if (f->cur && f->cur_index > i && f->cur_index <= index) {
+    i = f->cur_index;
+    c = f->cur;
+  }
+  while (c && i < index) {
+    uint32_t next;
+    if (fat_next(v, c, &next) != MEAS_OK)
+      return MEAS_ERROR;
+    c = next;
+    if (c)
+      chain_note(f, ++i, c);
+  }
+  *out = c;
+  return MEAS_OK;
+}
+
+/**
+ * @brief Free the chain past the file position; the file ends there.
+ */
+static meas_status_t file_truncate(meas_fat_t *v, meas_fat_file_t *f) {
+  uint32_t keep =
+      (uint32_t)(((uint64_t)f->pos + cluster_bytes(v) - 1) / cluster_bytes(v));
+  uint32_t tail = 0;
+  if (keep == 0) {
+    tail = f->first;
+    f->first = 0;
+  } else {
+    uint32_t last;
+    if (file_cluster(v, f, keep - 1, &last) != MEAS_OK || !last ||
+        fat_next(v, last, &tail) != MEAS_OK)
+      return MEAS_ERROR;
+    if (tail && fat_set(v, last, fat_eoc(v)) != MEAS_OK)
+      return MEAS_ERROR;
+  }
+  if (tail && fat_free_chain(v, tail) != MEAS_OK)
+    return MEAS_ERROR;
+  chain_trim(f, keep);
+  f->clusters = keep;
+  f->size = f->pos;
+  f->dirty = true;
+  return MEAS_OK;
+}
+
+static meas_status_t file_grow(meas_fat_t *v, meas_fat_file_t *f,
+                               uint32_t need) {
+  uint32_t last = 0;
+  if (f->clusters < need && f->clusters &&
+      (file_cluster(v, f, f->clusters - 1, &last) != MEAS_OK || !last))
+    return MEAS_ERROR;
+  while (f->clusters < need) {
+    uint32_t c;
+    if (fat_alloc(v, last, &c) != MEAS_OK)
+      return MEAS_ERROR;
+    if (!f->clusters)
+      f->first = c;
+    chain_note(f, f->clusters, c);
+    f->clusters++;
+    f->dirty = true;
+    last = c;
+  }
+  return MEAS_OK;
+}
+
+/**
+ * @brief Consecutive sectors from the file position, at most @p max.
+ */
+static meas_status_t file_span(meas_fat_t *v, meas_fat_file_t *f,
+                               uint32_t max, uint32_t *lba, uint32_t *count) {
+  uint32_t index = f->pos / cluster_bytes(v);
+  uint32_t c;
+  if (file_cluster(v, f, index, &c) != MEAS_OK || !c)
+    return MEAS_ERROR;
+  uint32_t first = (f->pos % cluster_bytes(v)) / SECTOR;
+  *lba = cluster_lba(v, c) + first;
+  uint32_t n = v->cluster_sectors - first;
+  while (n < max) {
+    uint32_t next;
+    if (file_cluster(v, f, ++index, &next) != MEAS_OK)
+      return MEAS_ERROR;
+    if (next != c + 1)
+      break;
+    c = next;
+    n += v->cluster_sectors;
+  }
+  *count = n < max ? n : max;
+  return MEAS_OK;
+}
+
+// Store size and first cluster in the directory entry
+static meas_status_t file_sync(meas_fat_t *v, meas_fat_file_t *f) {
+  if (!f->dirty)
+    return MEAS_OK;
+  meas_fat_sector_t *s = cache_get(v, f->entry_lba, true);
+  if (!s)
+    return MEAS_ERROR;
+  uint8_t *e = &s->data[f->entry_off];
+  entry_set_cluster(e, f->first);
+  wr32(e + 28, f->size);
+  wr16(e + 18, FAT_DATE);
+  wr16(e + 24, FAT_DATE);
+  e[11] |= ATTR_ARCHIVE;
+  s->dirty = true;
+  f->dirty = false;
+  return MEAS_OK;
+}
+
+static meas_fat_file_t *file_at(meas_fat_t *v, const fat_dir_t *d) {
+  for (size_t i = 0; i < MEAS_FAT_MAX_FILES; i++) {
+    meas_fat_file_t *f = &v->files[i];
+    if (f->open && f->entry_lba == d->lba &&
+        f->entry_off == d->entry * ENTRY_SIZE)
+      return f;
+  }
+  return NULL;
+}
+
+// --- meas_fs_api_t ---
+
+static meas_fat_t *fat_volume(meas_object_t *drv) {
+  meas_fat_t *v = (meas_fat_t *)drv;
+  return (v && v->mounted) ? v : NULL;
+}
+
+static meas_fat_file_t *fat_file(meas_file_t *file) {
+  meas_fat_file_t *f = (meas_fat_file_t *)file;
+  return (f && f->open) ? f : NULL;
+}
+
+static bool bpb_valid(const uint8_t *b) {
+  uint8_t spc = b[13];
+  return (b[0] == 0xEB || b[0] == 0xE9) && rd16(b + 510) == 0xAA55 &&
+         rd16(b + 11) == SECTOR && spc && !(spc & (spc - 1)) &&
+         rd16(b + 14) && (b[16] == 1 || b[16] == 2);
+}
+
+static meas_status_t fat_mount(meas_object_t *drv) {
+  meas_fat_t *v = (meas_fat_t *)drv;
+  if (!v || !v->dev || !v->dev->read || !v->dev->write)
+    return MEAS_ERROR;
+  if (v->mounted)
+    return MEAS_OK;
+  for (size_t i = 0; i < MEAS_FAT_CACHE_SECTORS; i++)
+    v->cache[i].valid = false;
+  memset(v->files, 0, sizeof(v->files));
+  v->fat_sectors = 0; // No FAT mirroring while reading the boot sectors
+
+  meas_fat_sector_t *s = cache_get(v, 0, true);
+  if (!s)
+    return MEAS_ERROR;
+  uint32_t start = 0;
+  if (!bpb_valid(s->data)) {
+    // Partitioned: the first FAT partition of the MBR
+    if (rd16(s->data + 510) != 0xAA55)
+      return MEAS_ERROR;
+    for (int i = 0; i < 4 && !start; i++) {
+      const uint8_t *p = &s->data[446 + 16 * i];
+      if (p[4] == 0x04 || p[4] == 0x06 || p[4] == 0x0E || p[4] == 0x0B ||
+          p[4] == 0x0C)
+        start = rd32(p + 8);
+    }
+    if (!start)
+      return MEAS_ERROR;
+    s = cache_get(v, start, true);
+    if (!s || !bpb_valid(s->data))
+      return MEAS_ERROR;
+  }
+
+  const uint8_t *b = s->data;
+  uint32_t reserved = rd16(b + 14);
+  uint32_t root_entries = rd16(b + 17);
+  uint32_t total = rd16(b + 19) ? rd16(b + 19) : rd32(b + 32);
+  uint32_t fat_size = rd16(b + 22) ? rd16(b + 22) : rd32(b + 36);
+  v->cluster_sectors = b[13];
+  v->num_fats = b[16];
+  v->fat_start = start + reserved;
+  v->root_start = v->fat_start + v->num_fats * fat_size;
+  v->root_sectors = (root_entries * ENTRY_SIZE + SECTOR - 1) / SECTOR;
+  v->data_start = v->root_start + v->root_sectors;
+  if (!fat_size || total <= v->data_start - start)
+    return MEAS_ERROR;
+  v->cluster_count = (total - (v->data_start - start)) / v->cluster_sectors;
+
+  // The cluster count alone decides the FAT type
+  uint32_t fsinfo = 0;
+  if (v->cluster_count < 4085) {
+    return MEAS_ERROR; // FAT12
+  } else if (v->cluster_count < 65525) {
+    v->fat_bits = 16;
+    v->root_cluster = 0;
+    if (!v->root_sectors)
+      return MEAS_ERROR;
+  } else {
+    v->fat_bits = 32;
+    v->root_cluster = rd32(b + 44);
+    fsinfo = rd16(b + 48);
+    if (v->root_sectors || !cluster_valid(v, v->root_cluster))
+      return MEAS_ERROR;
+  }
+  if ((uint64_t)(v->cluster_count + 2) * (v->fat_bits / 8U) >
+      (uint64_t)fat_size * SECTOR)
+    return MEAS_ERROR;
+  v->fat_sectors = fat_size;
+
+  // FSInfo: where the last allocation stopped
+  v->next_free = 2;
+  v->fsinfo = 0;
+  if (fsinfo >= 1 && fsinfo < reserved) {
+    s = cache_get(v, start + fsinfo, true);
+    if (s && rd32(s->data) == FSINFO_LEAD &&
+        rd32(s->data + 484) == FSINFO_STRUCT) {
+      v->fsinfo = start + fsinfo;
+      if (cluster_valid(v, rd32(s->data + 492)))
+        v->next_free = rd32(s->data + 492);
+    }
+  }
+
+  v->mounted = true;
+  return MEAS_OK;
+}
+
+static meas_status_t fat_unmount(meas_object_t *drv) {
+  meas_fat_t *v = fat_volume(drv);
+  if (!v)
+    return MEAS_ERROR;
+  meas_status_t res = meas_fat_sync(v);
+  memset(v->files, 0, sizeof(v->files));
+  v->mounted = false;
+  return res;
+}
+
+static meas_status_t fat_open(meas_object_t *drv, const char *path,
+                              meas_file_t **out_file) {
+  meas_fat_t *v = fat_volume(drv);
+  if (!v || !path || !out_file)
+    return MEAS_ERROR;
+  meas_fat_file_t *f = NULL;
+  for (size_t i = 0; i < MEAS_FAT_MAX_FILES && !f; i++) {
+    if (!v->files[i].open)
+      f = &v->files[i];
+  }
+  if (!f)
+    return MEAS_BUSY;
+
+  uint32_t dir;
+  uint8_t name[11];
+  fat_dir_t d;
+  bool found;
+  if (fat_resolve(v, path, &dir, name) != MEAS_OK ||
+      dir_find(v, dir, name, &d, &found) != MEAS_OK)
+    return MEAS_ERROR;
+
+  uint32_t first = 0;
+  uint32_t size = 0;
+  meas_fat_sector_t *s;
+  if (found) {
+    const uint8_t *e = dir_entry(v, &d, NULL);
+    if (!e || (e[11] & ATTR_DIRECTORY))
+      return MEAS_ERROR;
+    if (file_at(v, &d))
+      return MEAS_BUSY;
+    first = entry_cluster(v, e);
+    size = rd32(e + 28);
+  } else {
+    uint8_t *e;
+    if (dir_alloc(v, dir, &d) != MEAS_OK || !(e = dir_entry(v, &d, &s)))
+      return MEAS_ERROR;
+    entry_init(e, name, ATTR_ARCHIVE, 0);
+    s->dirty = true;
+  }
+
+  memset(f, 0, sizeof(*f));
+  f->base.base.impl = v;
+  f->open = true;
+  f->entry_lba = d.lba;
+  f->entry_off = (uint16_t)(d.entry * ENTRY_SIZE);
+  f->first = first;
+  f->size = size;
+  *out_file = &f->base;
+  return MEAS_OK;
+}
+
+static meas_status_t fat_write(meas_file_t *file, const void *data,
+                               size_t size) {
+  meas_fat_file_t *f = fat_file(file);
+  if (!f || (!data && size))
+    return MEAS_ERROR;
+  meas_fat_t *v = (meas_fat_t *)f->base.base.impl;
+  if (size == 0)
+    return MEAS_OK;
+  if ((uint64_t)f->pos + size > 0xFFFFFFFFULL)
+    return MEAS_ERROR; // FAT file size limit
+
+  if (!f->truncated) {
+    if (file_truncate(v, f) != MEAS_OK)
+      return MEAS_ERROR;
+    f->truncated = true;
+  }
+  uint64_t end = (uint64_t)f->pos + size;
+  if (file_grow(v, f,
+                (uint32_t)((end + cluster_bytes(v) - 1) / cluster_bytes(v))) !=
+      MEAS_OK)
+    return MEAS_ERROR;
+
+  const uint8_t *in = (const uint8_t *)data;
+  uint32_t left = (uint32_t)size;
+  while (left) {
+    uint32_t off = f->pos % SECTOR;
+    uint32_t lba, n, chunk;
+    if (off == 0 && left >= SECTOR) {
+      // Whole sectors: one transfer per contiguous run
+      if (file_span(v, f, left / SECTOR, &lba, &n) != MEAS_OK)
+        return MEAS_ERROR;
+      cache_drop(v, lba, n);
+      if (v->dev->write(v->dev_ctx, lba, in, n) != MEAS_OK)
+        return MEAS_ERROR;
+      chunk = n * SECTOR;
+    } else {
+      // Past the end of the file, so nothing to read back at offset 0
+      if (file_span(v, f, 1, &lba, &n) != MEAS_OK)
+        return MEAS_ERROR;
+      meas_fat_sector_t *s = cache_get(v, lba, off != 0);
+      if (!s)
+        return MEAS_ERROR;
+      chunk = SECTOR - off;
+      if (chunk > left)
+        chunk = left;
+      memcpy(&s->data[off], in, chunk);
+      s->dirty = true;
+    }
+    in += chunk;
+    left -= chunk;
+    f->pos += chunk;
+    if (f->pos > f->size)
+      f->size = f->pos;
+  }
+  f->dirty = true;
+  return MEAS_OK;
+}
+
+static meas_status_t fat_read(meas_file_t *file, void *buffer, size_t size,
+                              size_t *read_count) {
+  meas_fat_file_t *f = fat_file(file);
+  if (read_count)
+    *read_count = 0;
+  if (!f || (!buffer && size))
+    return MEAS_ERROR;
+  meas_fat_t *v = (meas_fat_t *)f->base.base.impl;
+
+  uint8_t *out = (uint8_t *)buffer;
+  uint32_t left = f->size - f->pos;
+  if (size < left)
+    left = (uint32_t)size;
+  while (left) {
+    uint32_t off = f->pos % SECTOR;
+    uint32_t lba, n, chunk;
+    if (off == 0 && left >= SECTOR) {
+      if (file_span(v, f, left / SECTOR, &lba, &n) != MEAS_OK ||
+          v->dev->read(v->dev_ctx, lba, out, n) != MEAS_OK)
+        return MEAS_ERROR;
+      cache_overlay(v, lba, n, out);
+      chunk = n * SECTOR;
+    } else {
+      meas_fat_sector_t *s;
+      if (file_span(v, f, 1, &lba, &n) != MEAS_OK ||
+          !(s = cache_get(v, lba, true)))
+        return MEAS_ERROR;
+      chunk = SECTOR - off;
+      if (chunk > left)
+        chunk = left;
+      memcpy(out, &s->data[off], chunk);
+    }
+    out += chunk;
+    left -= chunk;
+    f->pos += chunk;
+    if (read_count)
+      *read_count += chunk;
+  }
+  return MEAS_OK;
+}
+
+static meas_status_t fat_seek(meas_file_t *file, size_t offset) {
+  meas_fat_file_t *f = fat_file(file);
+  if (!f || offset > f->size)
+    return MEAS_ERROR;
+  f->pos = (uint32_t)offset;
+  f->truncated = false;
+  return MEAS_OK;
+}
+
+static meas_status_t fat_tell(meas_file_t *file, size_t *offset) {
+  meas_fat_file_t *f = fat_file(file);
+  if (!f || !offset)
+    return MEAS_ERROR;
+  *offset = f->pos;
+  return MEAS_OK;
+}
+
+static meas_status_t fat_close(meas_file_t *file) {
+  meas_fat_file_t *f = fat_file(file);
+  if (!f)
+    return MEAS_ERROR;
+  meas_fat_t *v = (meas_fat_t *)f->base.base.impl;
+  meas_status_t res = file_sync(v, f);
+  if (cache_flush(v) != MEAS_OK)
+    res = MEAS_ERROR;
+  f->open = false;
+  return res;
+}
+
+static meas_status_t fat_mkdir(meas_object_t *drv, const char *path) {
+  meas_fat_t *v = fat_volume(drv);
+  if (!v || !path)
+    return MEAS_ERROR;
+  uint32_t dir;
+  uint8_t name[11];
+  fat_dir_t d;
+  bool found;
+  if (fat_resolve(v, path, &dir, name) != MEAS_OK ||
+      dir_find(v, dir, name, &d, &found) != MEAS_OK || found ||
+      dir_alloc(v, dir, &d) != MEAS_OK)
+    return MEAS_ERROR;
+
+  // "." and ".." (0 for the root) first, then the entry pointing at them
+  uint32_t c;
+  meas_fat_sector_t *s;
+  if (fat_alloc(v, 0, &c) != MEAS_OK || dir_zero_cluster(v, c) != MEAS_OK ||
+      !(s = cache_get(v, cluster_lba(v, c), true)))
+    return MEAS_ERROR;
+  entry_init(s->data, (const uint8_t *)".          ", ATTR_DIRECTORY, c);
+  entry_init(s->data + ENTRY_SIZE, (const uint8_t *)"..         ",
+             ATTR_DIRECTORY, dir);
+  s->dirty = true;
+
+  uint8_t *e = dir_entry(v, &d, &s);
+  if (!e)
+    return MEAS_ERROR;
+  entry_init(e, name, ATTR_DIRECTORY, c);
+  s->dirty = true;
+  return cache_flush(v);
+}
+
+static meas_status_t fat_remove(meas_object_t *drv, const char *path) {
+  meas_fat_t *v = fat_volume(drv);
+  if (!v || !path)
+    return MEAS_ERROR;
+  uint32_t dir;
+  uint8_t name[11];
+  fat_dir_t d;
+  bool found;
+  if (fat_resolve(v, path, &dir, name) != MEAS_OK ||
+      dir_find(v, dir, name, &d, &found) != MEAS_OK || !found)
+    return MEAS_ERROR;
+  if (file_at(v, &d))
+    return MEAS_BUSY;
+
+  const uint8_t *e = dir_entry(v, &d, NULL);
+  if (!e || (e[11] & ATTR_READ_ONLY))
+    return MEAS_ERROR;
+  uint32_t c = entry_cluster(v, e);
+  if (e[11] & ATTR_DIRECTORY) {
+    bool empty;
+    if (dir_is_empty(v, c, &empty) != MEAS_OK || !empty)
+      return MEAS_ERROR;
+  }
+
+  meas_fat_sector_t *s;
+  uint8_t *entry = dir_entry(v, &d, &s);
+  if (!entry)
+    return MEAS_ERROR;
+  entry[0] = ENTRY_FREE;
+  s->dirty = true;
+  if (c && fat_free_chain(v, c) != MEAS_OK)
+    return MEAS_ERROR;
+  return cache_flush(v);
+}
+
+static meas_status_t fat_stat(meas_object_t *drv, const char *path,
+                              size_t *size) {
+  meas_fat_t *v = fat_volume(drv);
+  if (!v || !path || !size)
+    return MEAS_ERROR;
+  uint32_t dir;
+  uint8_t name[11];
+  fat_dir_t d;
+  bool found;
+  if (fat_resolve(v, path, &dir, name) != MEAS_OK ||
+      dir_find(v, dir, name, &d, &found) != MEAS_OK || !found)
+    return MEAS_ERROR;
+  const meas_fat_file_t *f = file_at(v, &d);
+  if (f) {
+    *size = f->size; // Entry not updated until close
+    return MEAS_OK;
+  }
+  const uint8_t *e = dir_entry(v, &d, NULL);
+  if (!e)
+    return MEAS_ERROR;
+  *size = (e[11] & ATTR_DIRECTORY) ? 0 : rd32(e + 28);
+  return MEAS_OK;
+}
+
+static const char *fat_get_name(meas_object_t *obj) {
+  (void)obj;
+  return "FAT";
+}
+
+static const meas_fs_api_t fat_api = {
+    .base = {.get_name = fat_get_name},
+    .mount = fat_mount,
+    .unmount = fat_unmount,
+    .open = fat_open,
+    .write = fat_write,
+    .read = fat_read,
+    .seek = fat_seek,
+    .tell = fat_tell,
+    .close = fat_close,
+    .mkdir = fat_mkdir,
+    .remove = fat_remove,
+    .stat = fat_stat,
+};
+
+const meas_fs_api_t *meas_fat_get_api(void) { return &fat_api; }
+
+meas_status_t meas_fat_init(meas_fat_t *fat, const meas_hal_storage_api_t *dev,
+                            void *dev_ctx) {
+  if (!fat || !dev)
+    return MEAS_ERROR;
+  memset(fat, 0, sizeof(*fat));
+  fat->base.api = &fat_api.base;
+  fat->dev = dev;
+  fat->dev_ctx = dev_ctx;
+  return MEAS_OK;
+}
+
+meas_status_t meas_fat_sync(meas_fat_t *fat) {
+  if (!fat || !fat->mounted)
+    return MEAS_ERROR;
+  meas_status_t res = MEAS_OK;
+  for (size_t i = 0; i < MEAS_FAT_MAX_FILES; i++) {
+    if (fat->files[i].open && file_sync(fat, &fat->files[i]) != MEAS_OK)
+      res = MEAS_ERROR;
+  }
+  if (cache_flush(fat) != MEAS_OK)
+    res = MEAS_ERROR;
+  return res;
+}
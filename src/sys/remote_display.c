@@ -0,0 +1,251 @@
+/**
+ * @file remote_display.c
+ * @brief Remote Display Mirroring over a Byte Stream (USB CDC).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Messages are assembled in one of two static transmit buffers. A full (or
+ * end-of-tile) buffer is handed to the stream with a zero-copy send; the
+ * previous one is flushed first, so the buffer being filled is never on the
+ * wire.
+ */
+
+#include "measlib/sys/remote_display.h"
+#include "measlib/sys/render_service.h"
+#include <string.h>
+
+#define RD_W MEAS_UI_SCREEN_WIDTH
+#define RD_H MEAS_UI_SCREEN_HEIGHT
+
+#define RD_FRAME_OVERHEAD 6 // Sync (2) + type + len (2) + sum
+#define RD_RLE_MAX_PACKET 128
+// Worst case: an all-literal row
+#define RD_ROW_MSG_MAX                                                         \
+  (RD_FRAME_OVERHEAD + 2 + (RD_W + RD_RLE_MAX_PACKET - 1) / RD_RLE_MAX_PACKET +  \
+   RD_W * 2)
+
+#if MEAS_REMOTE_TX_SIZE < RD_ROW_MSG_MAX
+#error "MEAS_REMOTE_TX_SIZE must hold a full row message"
+#endif
+
+static struct {
+  meas_io_t *io;
+  meas_ui_t *ui;
+  bool active;
+  bool connected;
+  uint32_t row_hash[RD_H];
+  uint32_t row_known[(RD_H + 31) / 32];
+  uint8_t tx[2][MEAS_REMOTE_TX_SIZE];
+  uint16_t tx_len;
+  uint8_t tx_cur;
+  int16_t tx_row_lo; // Rows in the buffer being filled (lo > hi: none)
+  int16_t tx_row_hi;
+  meas_remote_stats_t stats;
+} remote;
+
+static inline const meas_io_api_t *rd_api(void) {
+  return (const meas_io_api_t *)remote.io->base.api;
+}
+
+static bool rd_connected(void) {
+  const meas_io_api_t *api = rd_api();
+  return !api->is_connected || api->is_connected(remote.io);
+}
+
+static void rd_forget_rows(void) {
+  memset(remote.row_known, 0, sizeof(remote.row_known));
+}
+
+// A buffer was lost: forget its rows and have their tiles drawn again, so
+// the next frame sends them
+static void rd_resend_rows(int16_t lo, int16_t hi) {
+  if (lo > hi)
+    return;
+  for (int16_t row = lo; row <= hi; row++)
+    remote.row_known[row >> 5] &= ~(1U << (row & 31));
+  if (remote.ui)
+    meas_ui_invalidate_rect(remote.ui, 0, lo, RD_W, (int16_t)(hi - lo + 1));
+}
+
+// --- Transmit ---
+
+static void rd_send(void) {
+  if (!remote.tx_len)
+    return;
+  const meas_io_api_t *api = rd_api();
+  // Drain the other buffer, then queue this one and switch
+  if (api->flush)
+    api->flush(remote.io);
+  if (api->send(remote.io, remote.tx[remote.tx_cur], remote.tx_len) ==
+      MEAS_OK) {
+    remote.stats.bytes += remote.tx_len;
+  } else {
+    rd_resend_rows(remote.tx_row_lo, remote.tx_row_hi);
+  }
+  remote.tx_cur ^= 1U;
+  remote.tx_len = 0;
+  remote.tx_row_lo = RD_H;
+  remote.tx_row_hi = -1;
+}
+
+static uint8_t *rd_begin(uint8_t type, uint16_t max_len) {
+  if (remote.tx_len + RD_FRAME_OVERHEAD + max_len > MEAS_REMOTE_TX_SIZE)
+    rd_send();
+  uint8_t *p = &remote.tx[remote.tx_cur][remote.tx_len];
+  p[0] = MEAS_REMOTE_SYNC0;
+  p[1] = MEAS_REMOTE_SYNC1;
+  p[2] = type;
+  return &p[5]; // Payload
+}
+
+static void rd_end(uint16_t len) {
+  uint8_t *p = &remote.tx[remote.tx_cur][remote.tx_len];
+  p[3] = (uint8_t)len;
+  p[4] = (uint8_t)(len >> 8);
+  uint8_t sum = 0;
+  for (uint16_t i = 2; i < 5 + len; i++)
+    sum += p[i];
+  p[5 + len] = (uint8_t)-sum;
+  remote.tx_len += (uint16_t)(RD_FRAME_OVERHEAD + len);
+}
+
+static inline void put_u16(uint8_t *p, uint16_t v) {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+}
+
+static void rd_hello(void) {
+  uint8_t *p = rd_begin(MEAS_REMOTE_MSG_HELLO, 5);
+  put_u16(&p[0], RD_W);
+  put_u16(&p[2], RD_H);
+  p[4] = 0; // RGB565
+  rd_end(5);
+}
+
+// --- Rows ---
+
+static uint32_t rd_hash_row(const meas_pixel_t *px) {
+  uint32_t h = 2166136261U; // FNV-1a over 16-bit words
+  for (int16_t i = 0; i < RD_W; i++) {
+    h ^= px[i];
+    h *= 16777619U;
+  }
+  return h;
+}
+
+static uint16_t rd_encode_row(uint8_t *out, const meas_pixel_t *px) {
+  uint16_t n_out = 0;
+  int16_t i = 0;
+  while (i < RD_W) {
+    int16_t n = 1;
+    while (i + n < RD_W && n < RD_RLE_MAX_PACKET && px[i + n] == px[i])
+      n++;
+    if (n >= 2) {
+      out[n_out++] = (uint8_t)(0x80 | (n - 1));
+      put_u16(&out[n_out], px[i]);
+      n_out += 2;
+      i += n;
+      continue;
+    }
+
+    n = 1;
+    while (i + n < RD_W && n < RD_RLE_MAX_PACKET &&
+           !(i + n + 1 < RD_W && px[i + n] == px[i + n + 1]))
+      n++;
+    out[n_out++] = (uint8_t)(n - 1);
+    for (int16_t k = 0; k < n; k++, n_out += 2)
+      put_u16(&out[n_out], px[i + k]);
+    i += n;
+  }
+  return n_out;
+}
+
+static meas_status_t rd_tile(void *user_data, int16_t y,
+                             const meas_pixel_t *pixels, int16_t h) {
+  (void)user_data;
+  if (!remote.active)
+    return MEAS_OK;
+
+  // Nobody listening: send nothing; a reconnect gets a full screen
+  bool connected = rd_connected();
+  if (connected && !remote.connected) {
+    remote.connected = true;
+    meas_remote_display_refresh();
+  }
+  remote.connected = connected;
+  if (!connected)
+    return MEAS_OK;
+
+  for (int16_t r = 0; r < h; r++) {
+    int16_t row = y + r;
+    const meas_pixel_t *px = &pixels[r * RD_W];
+    uint32_t hash = rd_hash_row(px);
+    uint32_t bit = 1U << (row & 31);
+    if ((remote.row_known[row >> 5] & bit) && remote.row_hash[row] == hash) {
+      remote.stats.rows_skipped++;
+      continue;
+    }
+
+    uint8_t *p = rd_begin(MEAS_REMOTE_MSG_ROW, RD_ROW_MSG_MAX -
+                                                   RD_FRAME_OVERHEAD);
+    put_u16(p, (uint16_t)row);
+    rd_end((uint16_t)(2 + rd_encode_row(&p[2], px)));
+    if (row < remote.tx_row_lo)
+      remote.tx_row_lo = row;
+    if (row > remote.tx_row_hi)
+      remote.tx_row_hi = row;
+
+    remote.row_hash[row] = hash;
+    remote.row_known[row >> 5] |= bit;
+    remote.stats.rows_sent++;
+  }
+
+  // Ship what this tile produced (latency of one tile)
+  rd_send();
+  return MEAS_OK;
+}
+
+// --- Public API ---
+
+meas_status_t meas_remote_display_start(meas_io_t *io, meas_ui_t *ui) {
+  if (!io || !io->base.api || !((const meas_io_api_t *)io->base.api)->send)
+    return MEAS_ERROR;
+
+  remote.io = io;
+  remote.ui = ui;
+  remote.tx_len = 0;
+  remote.tx_cur = 0;
+  remote.tx_row_lo = RD_H;
+  remote.tx_row_hi = -1;
+  remote.stats = (meas_remote_stats_t){0};
+  remote.active = true;
+  remote.connected = rd_connected();
+  meas_render_service_set_tile_hook(rd_tile, NULL);
+  meas_remote_display_refresh();
+  return MEAS_OK;
+}
+
+void meas_remote_display_stop(void) {
+  if (!remote.active)
+    return;
+  rd_send();
+  if (rd_api()->flush)
+    rd_api()->flush(remote.io);
+  meas_render_service_set_tile_hook(NULL, NULL);
+  remote.active = false;
+}
+
+void meas_remote_display_refresh(void) {
+  if (!remote.active)
+    return;
+  rd_forget_rows();
+  if (remote.connected) {
+    rd_hello();
+    rd_send();
+  }
+  if (remote.ui)
+    meas_ui_force_redraw(remote.ui);
+}
+
+meas_remote_stats_t meas_remote_display_stats(void) { return remote.stats; }
@@ -6,30 +6,102 @@
  * @copyright (c) 2026 momentics
  *
  * Implements the Rendering Pipeline:
- * 1. Defines a static Tile Buffer (Zero Alloc).
- * 2. Iterates over the screen in tiles (e.g. 320x8).
- * 3. Sets up a Render Context pointing to the Tile.
- * 4. Calls the UI Engine to rasterize into the Tile (using Standard SW
- * Renderer).
- * 5. Flushes the Tile to the Hardware Driver via DMA (Zero Copy).
+ * 1. Defines two static Tile Buffers (Zero Alloc, Ping-Pong), or one when
+ *    RAM is tighter than SPI time (MEAS_RENDER_TILE_BUFFERS).
+ * 2. Records the dynamic stages of the layout once per frame into a Display
+ *    List holding a command list per tile.
+ * 3. Iterates over the screen in tiles (e.g. 320x8).
+ * 4. Initializes the back Tile from the RLE cache of the static stages
+ *    (background, grid), drawing and encoding them only after a layout
+ *    change. Then replays the commands overlapping the tile (using Standard
+ *    SW Renderer). If the frame does not fit the Display List, the layout is
+ *    executed per tile instead.
+ * 5. Flushes the Tile to the Hardware Driver via async DMA (Zero Copy) and
+ *    immediately starts rasterizing the next tile into the other buffer, so
+ *    CPU rendering overlaps the SPI transfer.
+ *
+ * A frame is spread over several superloop passes: each update renders at
+ * most a few tiles (tile count and time budget) and resumes from the next
+ * pending tile on the following call. The dirty map is snapshotted when a
+ * frame starts; invalidations arriving mid-frame accumulate for the next
+ * one, and frames start no faster than the target frame rate.
+ *
+ * Captures (screenshots) reuse a tile buffer to re-render the screen strip by
+ * strip and hand each strip to the caller instead of the LCD.
+ *
+ * With MEAS_UI_INDEXED_COLOR the tiles hold palette indices. Each tile row is
+ * expanded to RGB565 into one of two line buffers right before its DMA, so
+ * the expansion of a row overlaps the transfer of the previous one; strip
+ * callbacks then receive single expanded rows.
  */
 
 #include "measlib/sys/render_service.h"
 #include "drv_lcd.h" // Hardware Bridge
+#include "measlib/drivers/api.h"
+#include "measlib/ui/display_list.h"
+#include "measlib/ui/layer_cache.h"
+#include "measlib/ui/palette.h"
 #include "measlib/ui/render.h"
 #include <string.h>
 
 // UI Instance
 static meas_ui_t main_ui;
 
-// Tile Configuration
-// 320 * 8 * 2 bytes = 5120 bytes
-#define TILE_WIDTH 320
-#define TILE_HEIGHT 8
-#define SCREEN_WIDTH 320
-#define SCREEN_HEIGHT 240
+// Tile Configuration (see ui/core.h)
+// RGB565: 320 * 8 * 2 bytes = 5120 bytes
+// Indexed: 320 * 16 * 1 byte = 5120 bytes
+#define TILE_WIDTH MEAS_UI_SCREEN_WIDTH
+#define TILE_HEIGHT MEAS_UI_TILE_HEIGHT
+#define SCREEN_WIDTH MEAS_UI_SCREEN_WIDTH
+#define SCREEN_HEIGHT MEAS_UI_SCREEN_HEIGHT
+
+// Ping-Pong Tile Buffers (2 x 5120 bytes). Must live in DMA-capable SRAM.
+static meas_tile_pixel_t tile_buffer[MEAS_RENDER_TILE_BUFFERS]
+                                    [TILE_WIDTH * TILE_HEIGHT];
+
+#ifdef MEAS_UI_INDEXED_COLOR
+// Expanded rows for the LCD (2 x 640 bytes, DMA-capable SRAM)
+static meas_pixel_t line_buffer[2][TILE_WIDTH];
+static uint8_t line_back = 0;
+#endif
+
+// LCD Driver Handle (resolved once)
+static void *lcd_handle = NULL;
+
+// Per-frame Display List
+static meas_dl_t frame_dl MEAS_RENDER_POOL_RAM;
+
+// Static Layers (BG + Grid), encoded once per layout change
+static meas_layer_cache_t static_cache MEAS_RENDER_POOL_RAM;
+
+#ifdef MEAS_UI_INDEXED_COLOR
+#define RENDER_DMA_RAM (sizeof(tile_buffer) + sizeof(line_buffer))
+#else
+#define RENDER_DMA_RAM sizeof(tile_buffer)
+#endif
+_Static_assert(RENDER_DMA_RAM <= MEAS_RENDER_DMA_RAM_BUDGET,
+               "Render tile buffers exceed MEAS_RENDER_DMA_RAM_BUDGET");
+_Static_assert(sizeof(frame_dl) + sizeof(static_cache) <=
+                   MEAS_RENDER_POOL_RAM_BUDGET,
+               "Render pools exceed MEAS_RENDER_POOL_RAM_BUDGET");
+
+// Frame Governor / Incremental Frame State
+static struct {
+  uint8_t max_tiles;    // Tiles per update call
+  uint16_t budget_ms;   // Time per update call (0 = tile limit only)
+  uint16_t period_ms;   // Minimum frame start interval (0 = unthrottled)
+  bool started;         // At least one frame has been started
+  bool active;          // Frame in progress
+  bool use_dl;          // Frame replays frame_dl (else draws live)
+  uint32_t frame_map;   // Tiles still to render in this frame
+  uint32_t frame_start; // Start time of the current/last frame
+} frame = {.max_tiles = MEAS_RENDER_TILES_PER_UPDATE,
+           .budget_ms = MEAS_RENDER_BUDGET_MS,
+           .period_ms = 1000U / MEAS_RENDER_TARGET_FPS};
 
-static meas_pixel_t tile_buffer[TILE_WIDTH * TILE_HEIGHT];
+// Tile Observer (remote display)
+static meas_render_strip_cb_t tile_hook = NULL;
+static void *tile_hook_user = NULL;
 
 // Import Standard Software Rasterizer (from ui/render_cell.c)
 extern const meas_render_api_t meas_render_cell_api;
@@ -40,16 +112,133 @@ extern const meas_ui_api_t layout_main_api;
 // --- Service API ---
 
 meas_ui_t *meas_render_service_init(void *display_ctx) {
-  (void)display_ctx; // HAL context managed internally via drv_lcd.h
+  // HAL context managed internally via drv_lcd.h
+  lcd_handle = display_ctx;
 
   // Initialize UI with Main Layout
   main_ui.base.api = (const meas_object_api_t *)&layout_main_api;
+  main_ui.static_dirty = true;
+
+#ifdef MEAS_UI_INDEXED_COLOR
+  meas_palette_init();
+#endif
 
   return &main_ui;
 }
 
+void meas_render_service_set_budget(uint8_t max_tiles, uint16_t budget_ms) {
+  frame.max_tiles = max_tiles ? max_tiles : 1;
+  frame.budget_ms = budget_ms;
+}
+
+void meas_render_service_set_frame_rate(uint8_t fps) {
+  frame.period_ms = fps ? (uint16_t)(1000U / fps) : 0;
+}
+
+bool meas_render_service_busy(void) { return frame.active; }
+
+void meas_render_service_set_tile_hook(meas_render_strip_cb_t cb,
+                                       void *user_data) {
+  tile_hook = cb;
+  tile_hook_user = user_data;
+}
+
+static void render_blit(void *lcd, meas_rect_t rect,
+                        const meas_pixel_t *pixels) {
+  if (meas_drv_lcd_blit_async(lcd, rect, pixels, NULL, NULL) != MEAS_OK) {
+    meas_drv_lcd_blit(lcd, rect, pixels); // Blocking fallback
+  }
+}
+
+/**
+ * @brief Hand a rendered tile to the LCD and the tile observer.
+ * Waits for the previous transfer first; the last transfer of this tile may
+ * still be in flight on return.
+ */
+static void render_flush_tile(void *lcd, int16_t y,
+                              const meas_tile_pixel_t *tile, int16_t h) {
+#ifdef MEAS_UI_INDEXED_COLOR
+  for (int16_t r = 0; r < h; r++) {
+    meas_pixel_t *line = line_buffer[line_back];
+    meas_palette_expand(line, &tile[r * TILE_WIDTH], TILE_WIDTH);
+    meas_drv_lcd_wait(lcd);
+    render_blit(lcd, (meas_rect_t){0, (int16_t)(y + r), TILE_WIDTH, 1}, line);
+    if (tile_hook)
+      tile_hook(tile_hook_user, (int16_t)(y + r), line, 1);
+    line_back ^= 1U;
+  }
+#else
+  meas_drv_lcd_wait(lcd);
+  render_blit(lcd, (meas_rect_t){0, y, TILE_WIDTH, h}, tile);
+
+  // Observer reads the tile while DMA sends it (both only read)
+  if (tile_hook)
+    tile_hook(tile_hook_user, y, tile, h);
+#endif
+}
+
+/**
+ * @brief Hand a captured tile to a strip callback (RGB565).
+ */
+static meas_status_t render_emit_strip(meas_render_strip_cb_t cb,
+                                       void *user_data, int16_t y,
+                                       const meas_tile_pixel_t *tile,
+                                       int16_t h) {
+#ifdef MEAS_UI_INDEXED_COLOR
+  meas_status_t status = MEAS_OK;
+  for (int16_t r = 0; r < h && status == MEAS_OK; r++) {
+    meas_palette_expand(line_buffer[0], &tile[r * TILE_WIDTH], TILE_WIDTH);
+    status = cb(user_data, (int16_t)(y + r), line_buffer[0], 1);
+  }
+  return status;
+#else
+  return cb(user_data, y, tile, h);
+#endif
+}
+
+/**
+ * @brief Drop the cached static runs once the static layers changed.
+ * Checked before every tile: an invalidation can land between two tiles of
+ * a frame, and the remaining tiles must not restore the old runs.
+ */
+static void render_static_sync(void) {
+  if (main_ui.static_dirty) {
+    meas_layer_cache_reset(&static_cache);
+    main_ui.static_dirty = false;
+  }
+}
+
+/**
+ * @brief Start a frame if one is due: snapshot the dirty tiles and record the
+ * dynamic stages.
+ */
+static bool render_frame_begin(const meas_ui_api_t *ui_api, uint32_t now) {
+  if (!main_ui.dirty_map)
+    return false;
+  // Governor: invalidations keep accumulating until the next frame slot
+  if (frame.started && (now - frame.frame_start) < frame.period_ms)
+    return false;
+
+  frame.frame_map = main_ui.dirty_map;
+  main_ui.dirty_map = 0;
+  frame.frame_start = now;
+  frame.started = true;
+  frame.active = true;
+
+  // Record the dynamic stages once; tiles replay their lists from it
+  meas_render_ctx_t rec_ctx;
+  meas_dl_begin(&frame_dl, &rec_ctx);
+  main_ui.stage_skip = MEAS_UI_STATIC_STAGES;
+  ui_api->draw(&main_ui, &rec_ctx, &meas_render_dl_api);
+  frame.use_dl = meas_dl_end(&frame_dl);
+  return true;
+}
+
 void meas_render_service_update(void) {
-  void *lcd = meas_drv_lcd_init(); // Get or Init HW
+  if (!lcd_handle) {
+    lcd_handle = meas_drv_lcd_init(); // Init HW once
+  }
+  void *lcd = lcd_handle;
   if (!lcd)
     return;
 
@@ -67,22 +256,40 @@ void meas_render_service_update(void) {
     first_run = false;
   }
 
-  // Tile Loop (Row Major)
-  for (int16_t y = 0; y < SCREEN_HEIGHT; y += TILE_HEIGHT) {
+  uint32_t call_start = sys_get_tick();
+  if (!frame.active && !render_frame_begin(ui_api, call_start))
+    return;
+
+  // Back buffer index. Only one DMA transfer can be in flight, so once the
+  // previous tile has been handed to the LCD the other buffer is free.
+  uint8_t back = 0;
+  uint8_t rendered = 0;
+
+  // Tile Loop (Row Major), resuming at the first pending tile
+  for (int16_t y = 0; y < SCREEN_HEIGHT && frame.frame_map; y += TILE_HEIGHT) {
     // Dirty Check
     int16_t tile_idx = y / TILE_HEIGHT;
-    if (tile_idx < 32 && !(main_ui.dirty_map & (1U << tile_idx))) {
+    if (!(frame.frame_map & (1U << tile_idx))) {
       continue; // Skip clean tile
     }
 
+    // Budget: leave the rest of the frame to the next superloop pass
+    if (rendered >= frame.max_tiles)
+      break;
+    if (rendered && frame.budget_ms &&
+        (sys_get_tick() - call_start) >= frame.budget_ms)
+      break;
+
     int16_t h = TILE_HEIGHT;
     if (y + h > SCREEN_HEIGHT)
       h = SCREEN_HEIGHT - y;
 
     // 1. Setup Context (Zero Alloc - Static Buffer)
-    // Note: User can optimize by checking dirty regions, but for now we redraw
-    // all.
-    meas_render_ctx_t ctx = {.buffer = tile_buffer,
+    // Rasterizing here overlaps with the DMA of the previous tile.
+#if MEAS_RENDER_TILE_BUFFERS == 1 && !defined(MEAS_UI_INDEXED_COLOR)
+    meas_drv_lcd_wait(lcd); // The only tile buffer may still be on the bus
+#endif
+    meas_render_ctx_t ctx = {.buffer = tile_buffer[back],
                              .width = TILE_WIDTH,
                              .height = h,
                              .x_offset = 0,
@@ -91,17 +298,90 @@ void meas_render_service_update(void) {
                              .bg_color = 0x0000,
                              .clip_rect = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT}};
 
-    // 2. Call UI Draw (Software Rasterizer)
-    // The UI Logic uses the provided API to write into ctx.buffer
-    ui_api->draw(&main_ui, &ctx, &meas_render_cell_api);
+    // 2. Static Layers: decode the cached runs, or draw and encode them
+    render_static_sync();
+    size_t tile_pixels = (size_t)TILE_WIDTH * (size_t)h;
+    if (!meas_layer_cache_restore(&static_cache, (uint16_t)tile_idx,
+                                  ctx.buffer, tile_pixels)) {
+      meas_render_ctx_t static_ctx = ctx;
+      main_ui.stage_skip = (uint8_t)~MEAS_UI_STATIC_STAGES;
+      ui_api->draw(&main_ui, &static_ctx, &meas_render_cell_api);
+      meas_layer_cache_store(&static_cache, (uint16_t)tile_idx, ctx.buffer,
+                             tile_pixels);
+    }
+
+    // 3. Replay the tile's command list (Software Rasterizer)
+    // Fallback: the UI Logic writes into ctx.buffer directly
+    main_ui.stage_skip = MEAS_UI_STATIC_STAGES;
+    if (frame.use_dl) {
+      meas_dl_replay(&frame_dl, &ctx, &meas_render_cell_api);
+    } else {
+      ui_api->draw(&main_ui, &ctx, &meas_render_cell_api);
+    }
+
+    // 4. Flush to Hardware (Zero Copy - DMA)
+    // Wait for the previous tile (front buffer) to leave the bus, then hand
+    // over this one and swap.
+    render_flush_tile(lcd, y, tile_buffer[back], h);
+    back = (uint8_t)((back + 1U) % MEAS_RENDER_TILE_BUFFERS);
+    rendered++;
 
-    // 3. Flush to Hardware (Zero Copy - DMA)
-    meas_rect_t rect = {0, y, TILE_WIDTH, h};
-    meas_drv_lcd_blit(lcd, rect, tile_buffer);
+    // Tile done for this frame
+    frame.frame_map &= ~(1U << tile_idx);
+  }
+
+  if (!frame.frame_map)
+    frame.active = false;
+  main_ui.stage_skip = 0;
+
+  // Drain the last transfer: SPI1 is shared with the SD Card driver, so the
+  // bus must be idle when control returns to the superloop.
+  meas_drv_lcd_wait(lcd);
+}
 
-    // Clear Dirty Bit
-    if (tile_idx < 32) {
-      main_ui.dirty_map &= ~(1U << tile_idx);
+meas_status_t meas_render_service_capture(meas_render_strip_cb_t cb,
+                                          void *user_data) {
+  const meas_ui_api_t *ui_api = (const meas_ui_api_t *)main_ui.base.api;
+  if (!cb || !ui_api || !ui_api->draw)
+    return MEAS_ERROR;
+
+  // Both tile buffers are free once the last LCD transfer is out
+  if (lcd_handle)
+    meas_drv_lcd_wait(lcd_handle);
+
+  meas_status_t status = MEAS_OK;
+  for (int16_t y = 0; y < SCREEN_HEIGHT && status == MEAS_OK;
+       y += TILE_HEIGHT) {
+    int16_t h = TILE_HEIGHT;
+    if (y + h > SCREEN_HEIGHT)
+      h = SCREEN_HEIGHT - y;
+
+    meas_render_ctx_t ctx = {.buffer = tile_buffer[0],
+                             .width = TILE_WIDTH,
+                             .height = h,
+                             .x_offset = 0,
+                             .y_offset = y,
+                             .fg_color = 0xFFFF,
+                             .bg_color = 0x0000,
+                             .clip_rect = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT}};
+
+    // Static layers from the cache while it is current, else drawn live
+    size_t tile_pixels = (size_t)TILE_WIDTH * (size_t)h;
+    if (main_ui.static_dirty ||
+        !meas_layer_cache_restore(&static_cache, (uint16_t)(y / TILE_HEIGHT),
+                                  ctx.buffer, tile_pixels)) {
+      meas_render_ctx_t static_ctx = ctx;
+      main_ui.stage_skip = (uint8_t)~MEAS_UI_STATIC_STAGES;
+      ui_api->draw(&main_ui, &static_ctx, &meas_render_cell_api);
     }
+
+    // Dynamic stages are drawn live: frame_dl may still be replaying
+    main_ui.stage_skip = MEAS_UI_STATIC_STAGES;
+    ui_api->draw(&main_ui, &ctx, &meas_render_cell_api);
+
+    status = render_emit_strip(cb, user_data, y, ctx.buffer, h);
   }
+
+  main_ui.stage_skip = 0;
+  return status;
 }
@@ -0,0 +1,219 @@
+/**
+ * @file scpi_block.c
+ * @brief SCPI Array Responses (IEEE 488.2 Definite-Length Blocks).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/sys/scpi/scpi_block.h"
+#include "measlib/sys/scpi/scpi_core.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// A response in progress (one at a time: input waits while it is pending)
+typedef enum { BLOCK_HEADER, BLOCK_PAYLOAD, BLOCK_DONE } block_phase_t;
+
+static struct {
+  block_phase_t phase;
+  const uint8_t *raw;       // Native payload, sent in place
+  const meas_real_t *reals; // Values to convert (raw == NULL)
+  size_t count;             // Payload bytes (raw) or values (reals)
+  size_t next;              // Next byte / value
+  bool ascii;
+  size_t stage_len; // Staged bytes not yet taken by the link
+  size_t stage_pos;
+  uint8_t stage[SCPI_BLOCK_STAGE_SIZE]; // Header and converted payload
+} block_job;
+
+static bool host_little_endian(void) {
+  const uint16_t probe = 1;
+  uint8_t first;
+  memcpy(&first, &probe, 1);
+  return first == 1;
+}
+
+size_t scpi_format_width(scpi_format_t format) {
+  switch (format) {
+  case SCPI_FORMAT_REAL32:
+  case SCPI_FORMAT_INT32:
+    return 4;
+  case SCPI_FORMAT_REAL64:
+    return 8;
+  default:
+    return 0;
+  }
+}
+
+static size_t block_header(char *out, size_t len) {
+  char digits[12];
+  int n = snprintf(digits, sizeof(digits), "%lu", (unsigned long)len);
+  return (size_t)snprintf(out, 16, "#%d%s", n, digits);
+}
+
+bool scpi_write_block_header(scpi_context_t *ctx, size_t len) {
+  if (!ctx || !ctx->write)
+    return false;
+  char header[16];
+  size_t n = block_header(header, len);
+  return scpi_write(ctx, header, n) == n;
+}
+
+// --- Encoders ---
+
+static uint64_t encode_bits(scpi_format_t format, meas_real_t v) {
+  switch (format) {
+  case SCPI_FORMAT_REAL32: {
+    float f = (float)v;
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+    return u;
+  }
+  case SCPI_FORMAT_REAL64: {
+    double d = (double)v;
+    uint64_t u;
+    memcpy(&u, &d, sizeof(u));
+    return u;
+  }
+  default: {
+    // INTeger,32: rounded, saturated; NaN reads as 0
+    int32_t i = 0;
+    if (v >= 2147483647.0)
+      i = INT32_MAX;
+    else if (v <= -2147483648.0)
+      i = INT32_MIN;
+    else if (v == v)
+      i = (int32_t)lround((double)v);
+    return (uint32_t)i;
+  }
+  }
+}
+
+// Next comma-separated values as text
+static void stage_ascii(void) {
+  size_t used = 0;
+  while (block_job.next < block_job.count) {
+    char text[32];
+    int n = snprintf(text, sizeof(text), "%s%.12g", block_job.next ? "," : "",
+                     (double)block_job.reals[block_job.next]);
+    if (used + (size_t)n > sizeof(block_job.stage))
+      break;
+    memcpy(&block_job.stage[used], text, (size_t)n);
+    used += (size_t)n;
+    block_job.next++;
+  }
+  block_job.stage_len = used;
+}
+
+// Next values in the binary FORMat and byte order
+static void stage_binary(const scpi_context_t *ctx) {
+  size_t width = scpi_format_width(ctx->format);
+  size_t used = 0;
+  while (block_job.next < block_job.count &&
+         used + width <= sizeof(block_job.stage)) {
+    uint64_t bits = encode_bits(ctx->format, block_job.reals[block_job.next]);
+    for (size_t b = 0; b < width; b++) {
+      size_t shift = 8U * (ctx->swapped ? b : (width - 1U - b));
+      block_job.stage[used + b] = (uint8_t)(bits >> shift);
+    }
+    used += width;
+    block_job.next++;
+  }
+  block_job.stage_len = used;
+}
+
+// Refill the stage for the current phase; false when the response is done
+static bool block_advance(scpi_context_t *ctx) {
+  block_job.stage_pos = 0;
+  block_job.stage_len = 0;
+  switch (block_job.phase) {
+  case BLOCK_HEADER:
+    block_job.phase = BLOCK_PAYLOAD;
+    break;
+  case BLOCK_PAYLOAD:
+    if (block_job.raw || block_job.next >= block_job.count) {
+      block_job.phase = BLOCK_DONE;
+      return false;
+    }
+    if (block_job.ascii) {
+      stage_ascii();
+    } else {
+      stage_binary(ctx);
+    }
+    break;
+  default:
+    block_job.phase = BLOCK_DONE;
+    return false;
+  }
+  return true;
+}
+
+static scpi_status_t block_resume(scpi_context_t *ctx) {
+  do {
+    // Native payload goes from the source buffer itself
+    if (block_job.phase == BLOCK_PAYLOAD && block_job.raw) {
+      size_t left = block_job.count - block_job.next;
+      if (left) {
+        block_job.next += scpi_write(
+            ctx, (const char *)block_job.raw + block_job.next, left);
+        if (block_job.next < block_job.count)
+          return SCPI_RES_PENDING;
+      }
+    }
+    size_t left = block_job.stage_len - block_job.stage_pos;
+    if (left) {
+      block_job.stage_pos += scpi_write(
+          ctx, (const char *)block_job.stage + block_job.stage_pos, left);
+      if (block_job.stage_pos < block_job.stage_len)
+        return SCPI_RES_PENDING;
+    }
+  } while (block_advance(ctx));
+  return SCPI_RES_OK;
+}
+
+// Start a response; it continues through ctx->resume if the link fills up
+static scpi_status_t block_start(scpi_context_t *ctx, size_t payload) {
+  block_job.next = 0;
+  block_job.stage_pos = 0;
+  if (block_job.ascii) {
+    block_job.phase = BLOCK_PAYLOAD;
+    stage_ascii();
+    if (block_job.count == 0)
+      scpi_write(ctx, "", 0); // Empty response, still a response
+  } else {
+    block_job.phase = BLOCK_HEADER;
+    block_job.stage_len = block_header((char *)block_job.stage, payload);
+  }
+  return scpi_defer(ctx, block_resume);
+}
+
+scpi_status_t scpi_write_block(scpi_context_t *ctx, const void *data,
+                               size_t len) {
+  if (!ctx || !ctx->write || (!data && len))
+    return SCPI_RES_ERR_EXECUTION;
+  block_job.raw = (const uint8_t *)data;
+  block_job.reals = NULL;
+  block_job.count = len;
+  block_job.ascii = false;
+  return block_start(ctx, len);
+}
+
+scpi_status_t scpi_write_reals(scpi_context_t *ctx, const meas_real_t *values,
+                               size_t count) {
+  if (!ctx || !ctx->write || (!values && count))
+    return SCPI_RES_ERR_EXECUTION;
+
+  size_t width = scpi_format_width(ctx->format);
+  // Native encoding: the source buffer goes to the link as is
+  if (width != 0 && ctx->format != SCPI_FORMAT_INT32 &&
+      width == sizeof(meas_real_t) && ctx->swapped == host_little_endian())
+    return scpi_write_block(ctx, values, count * width);
+
+  block_job.raw = NULL;
+  block_job.reals = values;
+  block_job.count = count;
+  block_job.ascii = (width == 0);
+  return block_start(ctx, count * width);
+}
@@ -7,17 +7,23 @@
  */
 
 #include "measlib/sys/scpi/scpi_core.h"
+#include "measlib/sys/scpi/scpi_hash.h"
+#include "measlib/sys/scpi/scpi_status.h"
 #include "measlib/sys/scpi/scpi_types.h"
+#include "measlib/sys/scpi/scpi_utils.h"
 #include <ctype.h>
+#include <math.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 static const scpi_command_t *scpi_tree_root = NULL;
+static bool scpi_tree_hashed = false; // Compiled into the hash table
 
 // Forward declarations
-static scpi_status_t scpi_parse_line(scpi_context_t *ctx, char *line);
+static void scpi_queue_units(scpi_context_t *ctx);
+static scpi_status_t scpi_unit_done(scpi_context_t *ctx, scpi_status_t res);
 static const scpi_command_t *scpi_find_command(const scpi_command_t *node,
                                                const char *token);
 
@@ -29,94 +35,168 @@ void scpi_init(scpi_context_t *ctx, char *buffer, size_t buffer_len,
     ctx->write_pos = 0;
     ctx->user_context = user_context;
     ctx->write = write_cb;
+    ctx->format = SCPI_FORMAT_ASCII;
+    ctx->swapped = false;
+    ctx->resume = NULL;
+    ctx->next_unit = NULL;
+    ctx->command = NULL;
+    ctx->path = NULL;
+    ctx->path_level = SCPI_HASH_ROOT;
+    ctx->queue_head = 0;
+    ctx->queue_count = 0;
+    ctx->answered = false;
+    ctx->separate = false;
+    ctx->discard = false;
     if (buffer && buffer_len > 0) {
       buffer[0] = '\0';
     }
   }
 }
 
-void scpi_register_tree(const scpi_command_t *root) { scpi_tree_root = root; }
-
-scpi_status_t scpi_process(scpi_context_t *ctx, const char *data, size_t len) {
-  if (!ctx || !ctx->buffer || !data) {
-    return SCPI_RES_ERR_SYNTAX;
+bool scpi_register_tree(const scpi_command_t *root) {
+  if (root != scpi_tree_root || !scpi_tree_hashed) {
+    scpi_tree_root = root;
+    scpi_tree_hashed = scpi_hash_compile(root);
   }
+  return scpi_tree_hashed;
+}
 
-  scpi_status_t last_status = SCPI_RES_OK;
-
-  for (size_t i = 0; i < len; i++) {
-    char c = data[i];
+bool scpi_rebuild_tree(const scpi_command_t *root) {
+  scpi_tree_root = root;
+  scpi_tree_hashed = scpi_hash_compile(root);
+  return scpi_tree_hashed;
+}
 
-    if (ctx->write_pos >= ctx->buffer_len - 1) {
-      // Buffer overflow - reset
-      ctx->write_pos = 0;
-      ctx->buffer[0] = '\0';
-      last_status = SCPI_RES_ERR_SYNTAX; // Mark potential error
+size_t scpi_receive(scpi_context_t *ctx, const char *data, size_t len) {
+  if (!ctx || !ctx->buffer || !data)
+    return 0;
+
+  size_t i = 0;
+  while (i < len) {
+    // A line is queued unit by unit; the rest waits for room
+    if (ctx->next_unit) {
+      scpi_queue_units(ctx);
+      if (ctx->next_unit)
+        break;
     }
 
+    char c = data[i++];
     if (c == '\n' || c == '\r') {
       if (ctx->write_pos > 0) {
         ctx->buffer[ctx->write_pos] = '\0';
-        last_status = scpi_parse_line(ctx, ctx->buffer);
         ctx->write_pos = 0;
+        ctx->next_unit = ctx->buffer;
+        ctx->path = scpi_tree_root;
+        ctx->path_level = SCPI_HASH_ROOT;
+        scpi_queue_units(ctx);
       }
+    } else if (ctx->write_pos >= ctx->buffer_len - 1) {
+      // Line too long: drop it
+      ctx->write_pos = 0;
+      scpi_status_error(SCPI_RES_ERR_SYNTAX);
     } else {
       ctx->buffer[ctx->write_pos++] = c;
     }
   }
-  return last_status;
+  return i;
 }
 
-#include "measlib/sys/scpi/scpi_utils.h"
+scpi_status_t scpi_execute(scpi_context_t *ctx) {
+  if (!ctx)
+    return SCPI_RES_OK;
 
-static bool scpi_match_pattern(const char *pattern, const char *token) {
-  size_t pat_len = strlen(pattern);
-  size_t tok_len = strlen(token);
-
-  // Simple check: token must be shorter or equal to pattern (Long form)
-  // But SCPI allows SHORT form.
-  // E.g. Pattern "MEASure", Token "MEAS" -> Match
-  // Token "MEASURE" -> Match
-  // Token "M" -> No match (unless pattern is M)
-
-  // For now, let's use the utility to check case-insensitive match up to token
-  // length And ensure token length is at least the short length (uppercase
-  // part).
-  // TODO: We need to know the short length. Conventional SCPI parsers store
-  // this or infer it (uppercase). Assuming pattern is "MEASure" (Mixed case).
-
-  // Check if token matches the start of pattern
-  if (!scpi_strncasecmp(pattern, token, tok_len)) {
-    return false;
+  scpi_status_t res = SCPI_RES_OK;
+  if (ctx->resume) {
+    res = ctx->resume(ctx);
+    if (res == SCPI_RES_PENDING)
+      return res;
+    ctx->resume = NULL;
+    res = scpi_unit_done(ctx, res);
   }
 
-  // Now check length constraints.
-  // If token length == pattern length -> Full Match.
-  if (tok_len == pat_len)
-    return true;
-
-  // If token length is less, we need to check if it covers all uppercase
-  // letters. Example: MEASure. Short is MEAS.
-  size_t short_len = 0;
-  for (size_t i = 0; i < pat_len; i++) {
-    if (isupper((unsigned char)pattern[i])) {
-      short_len++;
-    } else {
-      break; // Stop at first lowercase
+  while (ctx->queue_count && !ctx->resume) {
+    scpi_unit_t *unit = &ctx->queue[ctx->queue_head];
+    if (ctx->discard) {
+      scpi_unit_done(ctx, SCPI_RES_OK);
+      continue;
+    }
+    scpi_status_t r = unit->error;
+    if (unit->cmd) {
+      ctx->separate = ctx->answered;
+      ctx->command = unit->cmd;
+      ctx->params = unit->params[0] ? unit->params : NULL;
+      r = unit->cmd->callback(ctx);
+      if (r == SCPI_RES_PENDING)
+        return r; // The unit stays queued until its step completes
     }
+    res = scpi_unit_done(ctx, r);
+  }
+  return ctx->resume ? SCPI_RES_PENDING : res;
+}
+
+size_t scpi_feed(scpi_context_t *ctx, const char *data, size_t len,
+                 scpi_status_t *status) {
+  if (status)
+    *status = SCPI_RES_OK;
+  if (!ctx || !ctx->buffer || !data) {
+    if (status)
+      *status = SCPI_RES_ERR_SYNTAX;
+    return 0;
+  }
+
+  size_t done = 0;
+  scpi_status_t res;
+  do {
+    done += scpi_receive(ctx, data + done, len - done);
+    res = scpi_execute(ctx);
+  } while (done < len && !ctx->resume);
+  if (status)
+    *status = res;
+  return done;
+}
+
+scpi_status_t scpi_process(scpi_context_t *ctx, const char *data, size_t len) {
+  if (!ctx || !ctx->buffer || !data) {
+    return SCPI_RES_ERR_SYNTAX;
   }
 
-  if (tok_len == short_len)
-    return true;
+  scpi_status_t last_status = SCPI_RES_OK;
+  size_t done = 0;
+  do {
+    done += scpi_receive(ctx, data + done, len - done);
+    last_status = scpi_execute(ctx);
+    if (ctx->resume) {
+      // The link refused data: drop the rest of this message
+      ctx->resume = NULL;
+      ctx->answered = false;
+      last_status = scpi_unit_done(ctx, SCPI_RES_ERR_EXECUTION);
+    }
+  } while (done < len || ctx->queue_count);
+  return last_status;
+}
+
+scpi_status_t scpi_resume(scpi_context_t *ctx) { return scpi_execute(ctx); }
 
-  return false;
+size_t scpi_queued(const scpi_context_t *ctx) {
+  return ctx ? ctx->queue_count : 0;
+}
+
+bool scpi_busy(const scpi_context_t *ctx) { return ctx && ctx->resume; }
+
+scpi_status_t scpi_defer(scpi_context_t *ctx, scpi_resume_t step) {
+  ctx->resume = step;
+  scpi_status_t res = step(ctx);
+  if (res != SCPI_RES_PENDING)
+    ctx->resume = NULL;
+  return res;
 }
 
 static const scpi_command_t *scpi_find_command(const scpi_command_t *list,
                                                const char *token) {
   const scpi_command_t *cmd = list;
   while (cmd && cmd->pattern) {
-    if (scpi_match_pattern(cmd->pattern, token)) {
+    if (scpi_header_match(cmd->pattern, token, false) ||
+        scpi_header_match(cmd->pattern, token, true)) {
       return cmd;
     }
     cmd++;
@@ -143,50 +223,109 @@ static char *scpi_next_token(char **str, char delimiter) {
   return start;
 }
 
-static scpi_status_t scpi_parse_line(scpi_context_t *ctx, char *line) {
-  if (!line || !scpi_tree_root)
-    return SCPI_RES_OK;
+// Next message unit: up to a ';' outside quoted strings
+static char *scpi_next_unit(char **str) {
+  char *start = *str;
+  if (!start)
+    return NULL;
 
-  char *remaining = line;
-  char *token;
-  const scpi_command_t *curr_node = scpi_tree_root;
-  const scpi_command_t *cmd = NULL;
+  char quote = 0;
+  for (char *p = start; *p; p++) {
+    if (quote) {
+      if (*p == quote)
+        quote = 0;
+    } else if (*p == '"' || *p == '\'') {
+      quote = *p;
+    } else if (*p == ';') {
+      *p = '\0';
+      *str = p + 1;
+      return start;
+    }
+  }
+  *str = NULL;
+  return start;
+}
 
-  while ((token = scpi_next_token(&remaining, ':')) != NULL) {
-    // Strip leading spaces
-    while (isspace((unsigned char)*token))
-      token++;
+// Header lookup on a level (linear walk if the tree did not compile)
+static const scpi_command_t *scpi_lookup(const scpi_command_t *list,
+                                         uint8_t *level, const char *token) {
+  if (scpi_tree_hashed)
+    return scpi_hash_find(level, token);
+  return scpi_find_command(list, token);
+}
+
+// Whether the first header of @p header exists on a level
+static bool scpi_header_on(const scpi_command_t *list, uint8_t level,
+                           char *header) {
+  char *colon = strchr(header, ':');
+  if (colon)
+    *colon = '\0';
+  bool found = scpi_lookup(list, &level, header) != NULL;
+  if (colon)
+    *colon = ':';
+  return found;
+}
+
+// Resolve a unit's header; the command runs later from the queue
+static scpi_status_t scpi_parse_unit(scpi_context_t *ctx, char *unit,
+                                     scpi_unit_t *out) {
+  out->cmd = NULL;
+  out->params[0] = '\0';
+  while (isspace((unsigned char)*unit))
+    unit++;
+  if (*unit == '\0')
+    return SCPI_RES_OK; // Empty unit (e.g. trailing ';')
+
+  // The header ends at the first space; parameters follow
+  char *param_start = strpbrk(unit, " \t");
+  if (param_start) {
+    *param_start++ = '\0'; // Terminate header
+    while (isspace((unsigned char)*param_start))
+      param_start++;
+    size_t n = strlen(param_start);
+    if (n >= sizeof(out->params))
+      return SCPI_RES_ERR_TOO_MUCH_DATA;
+    memcpy(out->params, param_start, n + 1);
+  }
 
+  // Start level: root for ':' and common commands, else the kept path
+  bool common = (*unit == '*');
+  const scpi_command_t *list = scpi_tree_root;
+  uint8_t level = SCPI_HASH_ROOT;
+  if (*unit == ':') {
+    unit++;
+  } else if (!common && ctx->path && ctx->path != scpi_tree_root &&
+             scpi_header_on(ctx->path, ctx->path_level, unit)) {
+    list = ctx->path;
+    level = ctx->path_level;
+  }
+
+  char *remaining = unit;
+  char *token;
+  while ((token = scpi_next_token(&remaining, ':')) != NULL) {
     // Skip empty tokens (e.g. from consecutive '::')
     if (*token == '\0')
       continue;
 
-    // Check for parameters (space)
-    char *param_start = strpbrk(token, " \t");
-    if (param_start) {
-      *param_start = '\0'; // Terminate header
-      ctx->params = param_start + 1;
-      // Skip leading spaces in params
-      while (isspace((unsigned char)*ctx->params))
-        ctx->params++;
-    } else {
-      ctx->params = NULL;
-    }
-
-    // Find match in current level
-    cmd = scpi_find_command(curr_node, token);
-
+    uint8_t cmd_level = level;
+    const scpi_command_t *cmd = scpi_lookup(list, &level, token);
     if (!cmd) {
       return SCPI_RES_ERR_INVALID_HEADER;
     }
 
-    if (cmd->callback) {
-      // Found a leaf/executable command
-      return cmd->callback(ctx);
+    if (cmd->callback && (!remaining || !cmd->children)) {
+      // Found a leaf/executable command (a node with both descends while
+      // more headers follow, e.g. "FORMat" vs "FORMat:BORDer")
+      if (!common) {
+        ctx->path = list;
+        ctx->path_level = cmd_level;
+      }
+      out->cmd = cmd;
+      return SCPI_RES_OK;
     }
 
     if (cmd->children) {
-      curr_node = cmd->children;
+      list = cmd->children;
     } else {
       return SCPI_RES_ERR_INVALID_HEADER;
     }
@@ -195,6 +334,61 @@ static scpi_status_t scpi_parse_line(scpi_context_t *ctx, char *line) {
   return SCPI_RES_OK;
 }
 
+// Parse units of the received line while the queue has room
+static void scpi_queue_units(scpi_context_t *ctx) {
+  if (!scpi_tree_root) {
+    ctx->next_unit = NULL;
+    return;
+  }
+  while (ctx->next_unit && ctx->queue_count < SCPI_QUEUE_DEPTH) {
+    uint8_t slot = (uint8_t)((ctx->queue_head + ctx->queue_count) %
+                             SCPI_QUEUE_DEPTH);
+    scpi_unit_t *unit = &ctx->queue[slot];
+    char *text = scpi_next_unit(&ctx->next_unit);
+    unit->error = scpi_parse_unit(ctx, text, unit);
+    if (unit->error != SCPI_RES_OK)
+      ctx->next_unit = NULL; // A parse error discards the rest
+    unit->last = (ctx->next_unit == NULL);
+    // Headers without a command only matter as the end of the message
+    if (unit->cmd || unit->error != SCPI_RES_OK || unit->last)
+      ctx->queue_count++;
+  }
+}
+
+// Retire the unit at the head of the queue; ends its message if last
+static scpi_status_t scpi_unit_done(scpi_context_t *ctx, scpi_status_t res) {
+  bool last = ctx->queue[ctx->queue_head].last;
+  ctx->queue_head = (uint8_t)((ctx->queue_head + 1U) % SCPI_QUEUE_DEPTH);
+  ctx->queue_count--;
+
+  if (res < 0) {
+    scpi_status_error(res);
+    ctx->discard = true; // An error discards the rest of the message
+  }
+  if (last) {
+    if (ctx->answered && ctx->write)
+      ctx->write(ctx, "\r\n", 2);
+    ctx->answered = false;
+    ctx->separate = false;
+    ctx->discard = false;
+  }
+  // Room again for a line waiting to be queued
+  scpi_queue_units(ctx);
+  return res;
+}
+
+size_t scpi_write(scpi_context_t *ctx, const char *data, size_t len) {
+  if (!ctx || !ctx->write)
+    return 0;
+  if (ctx->separate) {
+    if (ctx->write(ctx, ";", 1) != 1)
+      return 0;
+    ctx->separate = false;
+  }
+  ctx->answered = true;
+  return ctx->write(ctx, data, len);
+}
+
 scpi_status_t scpi_param_string(scpi_context_t *ctx, char *str, size_t len) {
   if (!ctx || !ctx->params || !str || len == 0)
     return SCPI_RES_ERR_MISSING_PARAM;
@@ -257,3 +451,65 @@ scpi_status_t scpi_param_float(scpi_context_t *ctx, float *val) {
 
   return SCPI_RES_OK;
 }
+
+// Whole suffix equals the unit (any case)
+static bool scpi_suffix_is(const char *suffix, const char *unit) {
+  size_t n = strlen(unit);
+  return strlen(suffix) == n && scpi_strncasecmp(suffix, unit, n);
+}
+
+// IEEE 488.2 suffix multipliers. Suffixes are case-insensitive, so M is
+// milli and MA mega; the two-letter ones are tried first.
+static const struct {
+  const char *prefix;
+  double scale;
+} scpi_multipliers[] = {
+    {"EX", 1e18}, {"PE", 1e15}, {"MA", 1e6},  {"T", 1e12},
+    {"G", 1e9},   {"K", 1e3},   {"M", 1e-3},  {"U", 1e-6},
+    {"N", 1e-9},  {"P", 1e-12}, {"F", 1e-15}, {"A", 1e-18},
+};
+
+// Scale of a multiplier suffix, optionally followed by the unit; 0 if none
+static double scpi_multiplier(const char *suffix, const char *unit) {
+  // SCPI exceptions: MHZ and MOHM are mega, not milli
+  if (unit && (toupper((unsigned char)suffix[0]) == 'M') &&
+      (scpi_suffix_is(unit, "HZ") || scpi_suffix_is(unit, "OHM")) &&
+      scpi_suffix_is(suffix + 1, unit))
+    return 1e6;
+
+  size_t count = sizeof(scpi_multipliers) / sizeof(scpi_multipliers[0]);
+  for (size_t i = 0; i < count; i++) {
+    size_t n = strlen(scpi_multipliers[i].prefix);
+    if (!scpi_strncasecmp(suffix, scpi_multipliers[i].prefix, n))
+      continue;
+    const char *rest = suffix + n;
+    if (!*rest || (unit && scpi_suffix_is(rest, unit)))
+      return scpi_multipliers[i].scale;
+  }
+  return 0;
+}
+
+scpi_status_t scpi_param_number(scpi_context_t *ctx, const char *unit,
+                                double *val) {
+  char buf[32];
+  scpi_status_t res = scpi_param_string(ctx, buf, sizeof(buf));
+  if (res != SCPI_RES_OK)
+    return res;
+
+  char *end;
+  double v = strtod(buf, &end);
+  if (end == buf || !isfinite(v))
+    return SCPI_RES_ERR_DATA_TYPE;
+  while (isspace((unsigned char)*end))
+    end++;
+
+  // Suffix: [multiplier][unit]
+  if (*end && !(unit && scpi_suffix_is(end, unit))) {
+    double scale = scpi_multiplier(end, unit);
+    if (scale == 0)
+      return SCPI_RES_ERR_INVALID_SUFFIX;
+    v *= scale;
+  }
+  *val = v;
+  return SCPI_RES_OK;
+}
@@ -6,31 +6,591 @@
  * @copyright (c) 2026 momentics
  */
 
+#include "measlib/sys/scpi/scpi_def.h"
+#include "measlib/sys/scpi/scpi_block.h"
 #include "measlib/sys/scpi/scpi_core.h"
+#include "measlib/sys/scpi/scpi_prop.h"
+#include "measlib/sys/scpi/scpi_status.h"
+#include "measlib/sys/scpi/scpi_utils.h"
+#include "measlib/sys/screenshot.h"
 #include <stdio.h>
 #include <string.h>
 
+// Traces exposed to remote readout (1-based in the commands)
+static meas_trace_t *scpi_traces[SCPI_DEF_MAX_TRACES];
+
+// Channel swept by INITiate; a running sweep is one pending operation
+static meas_channel_t *scpi_channel;
+static bool scpi_sweeping;
+static uint32_t scpi_sweep_seq; // Sweep whose end completes the operation
+static bool scpi_subscribed;
+
+// MMEMory:STORe:TRACe in progress: one CSV line per point, a chunk per poll.
+// The points are read in place, so no sweep runs while they are written.
+static struct {
+  const meas_fs_api_t *fs;
+  meas_object_t *drv;
+  meas_file_t *file;   // Open while a store is running
+  meas_trace_t *trace; // Until the points are fetched
+  const meas_real_t *x;
+  const meas_real_t *y;
+  size_t count;
+  size_t next;
+  bool complex;
+} scpi_store;
+
+static meas_status_t scpi_store_close(void);
+
 // Forward declarations of handlers
 static scpi_status_t scpi_cmd_idn(scpi_context_t *ctx);
 static scpi_status_t scpi_cmd_rst(scpi_context_t *ctx);
+static scpi_status_t scpi_cmd_hcopy_data(scpi_context_t *ctx);
+static scpi_status_t scpi_cmd_format(scpi_context_t *ctx);
+static scpi_status_t scpi_cmd_format_query(scpi_context_t *ctx);
+static scpi_status_t scpi_cmd_border(scpi_context_t *ctx);
+static scpi_status_t scpi_cmd_border_query(scpi_context_t *ctx);
+static scpi_status_t scpi_cmd_trace_data(scpi_context_t *ctx);
+static scpi_status_t scpi_cmd_trace_stimulus(scpi_context_t *ctx);
+static scpi_status_t scpi_cmd_cls(scpi_context_t *ctx);
+static scpi_status_t scpi_cmd_ese(scpi_context_t *ctx);
+static scpi_status_t scpi_cmd_ese_query(scpi_context_t *ctx);
+static scpi_status_t scpi_cmd_esr_query(scpi_context_t *ctx);
+static scpi_status_t scpi_cmd_sre(scpi_context_t *ctx);
+static scpi_status_t scpi_cmd_sre_query(scpi_context_t *ctx);
+static scpi_status_t scpi_cmd_stb_query(scpi_context_t *ctx);
+static scpi_status_t scpi_cmd_opc(scpi_context_t *ctx);
+static scpi_status_t scpi_cmd_opc_query(scpi_context_t *ctx);
+static scpi_status_t scpi_cmd_wai(scpi_context_t *ctx);
+static scpi_status_t scpi_cmd_init(scpi_context_t *ctx);
+static scpi_status_t scpi_cmd_abort(scpi_context_t *ctx);
+static scpi_status_t scpi_cmd_mmem_store_trace(scpi_context_t *ctx);
+
+// HCOPy:SDUMp subsystem
+static const scpi_command_t scpi_sdump_cmds[] = {
+    {.pattern = "DATA?", .callback = scpi_cmd_hcopy_data, .children = NULL},
+    SCPI_CMD_LIST_END};
+
+static const scpi_command_t scpi_hcopy_cmds[] = {
+    {.pattern = "SDUMp", .callback = NULL, .children = scpi_sdump_cmds},
+    SCPI_CMD_LIST_END};
+
+// FORMat subsystem ("FORMat <type>" is short for "FORMat:DATA <type>")
+static const scpi_command_t scpi_format_cmds[] = {
+    {.pattern = "DATA", .callback = scpi_cmd_format, .children = NULL},
+    {.pattern = "DATA?", .callback = scpi_cmd_format_query, .children = NULL},
+    {.pattern = "BORDer", .callback = scpi_cmd_border, .children = NULL},
+    {.pattern = "BORDer?", .callback = scpi_cmd_border_query, .children = NULL},
+    SCPI_CMD_LIST_END};
 
-// Common commands
-static const scpi_command_t scpi_root_cmds[] = {
+// TRACe subsystem
+static const scpi_command_t scpi_trace_cmds[] = {
+    {.pattern = "DATA?", .callback = scpi_cmd_trace_data, .children = NULL},
+    {.pattern = "STIMulus?",
+     .callback = scpi_cmd_trace_stimulus,
+     .children = NULL},
+    SCPI_CMD_LIST_END};
+
+// INITiate subsystem ("INITiate" is short for "INITiate:IMMediate")
+static const scpi_command_t scpi_init_cmds[] = {
+    {.pattern = "IMMediate", .callback = scpi_cmd_init, .children = NULL},
+    SCPI_CMD_LIST_END};
+
+// MMEMory subsystem
+static const scpi_command_t scpi_mmem_store_cmds[] = {
+    {.pattern = "TRACe", .callback = scpi_cmd_mmem_store_trace,
+     .children = NULL},
+    SCPI_CMD_LIST_END};
+
+static const scpi_command_t scpi_mmem_cmds[] = {
+    {.pattern = "STORe", .callback = NULL, .children = scpi_mmem_store_cmds},
+    SCPI_CMD_LIST_END};
+
+// Fixed root commands (common commands and subsystems)
+static const scpi_command_t scpi_base_cmds[] = {
     {.pattern = "*IDN?", .callback = scpi_cmd_idn, .children = NULL},
     {.pattern = "*RST", .callback = scpi_cmd_rst, .children = NULL},
+    {.pattern = "*CLS", .callback = scpi_cmd_cls, .children = NULL},
+    {.pattern = "*ESE", .callback = scpi_cmd_ese, .children = NULL},
+    {.pattern = "*ESE?", .callback = scpi_cmd_ese_query, .children = NULL},
+    {.pattern = "*ESR?", .callback = scpi_cmd_esr_query, .children = NULL},
+    {.pattern = "*SRE", .callback = scpi_cmd_sre, .children = NULL},
+    {.pattern = "*SRE?", .callback = scpi_cmd_sre_query, .children = NULL},
+    {.pattern = "*STB?", .callback = scpi_cmd_stb_query, .children = NULL},
+    {.pattern = "*OPC", .callback = scpi_cmd_opc, .children = NULL},
+    {.pattern = "*OPC?", .callback = scpi_cmd_opc_query, .children = NULL},
+    {.pattern = "*WAI", .callback = scpi_cmd_wai, .children = NULL},
+    {.pattern = "ABORt", .callback = scpi_cmd_abort, .children = NULL},
+    {.pattern = "FORMat", .callback = scpi_cmd_format,
+     .children = scpi_format_cmds},
+    {.pattern = "FORMat?", .callback = scpi_cmd_format_query, .children = NULL},
+    {.pattern = "HCOPy", .callback = NULL, .children = scpi_hcopy_cmds},
+    {.pattern = "INITiate", .callback = scpi_cmd_init,
+     .children = scpi_init_cmds},
+    {.pattern = "MMEMory", .callback = NULL, .children = scpi_mmem_cmds},
+    {.pattern = "TRACe", .callback = NULL, .children = scpi_trace_cmds},
     SCPI_CMD_LIST_END};
 
-void scpi_def_init(void) { scpi_register_tree(scpi_root_cmds); }
+#define SCPI_BASE_COUNT (sizeof(scpi_base_cmds) / sizeof(scpi_base_cmds[0]) - 1)
+
+// Registered root: the fixed commands, then the subsystems generated from
+// the channel's property descriptors
+static scpi_command_t
+    scpi_root_cmds[SCPI_BASE_COUNT + SCPI_DEF_MAX_PROP_ROOTS + 1];
+
+static void scpi_def_build_tree(void) {
+  scpi_prop_reset();
+  if (scpi_channel)
+    scpi_prop_bind(&scpi_channel->base);
+
+  memcpy(scpi_root_cmds, scpi_base_cmds, sizeof(scpi_base_cmds));
+  size_t n = scpi_prop_build(&scpi_root_cmds[SCPI_BASE_COUNT],
+                             SCPI_DEF_MAX_PROP_ROOTS);
+  scpi_root_cmds[SCPI_BASE_COUNT + n] = (scpi_command_t)SCPI_CMD_LIST_END;
+  scpi_rebuild_tree(scpi_root_cmds);
+}
+
+void scpi_def_init(void) {
+  scpi_def_build_tree();
+  scpi_status_init();
+  scpi_sweeping = false;
+  if (scpi_store.file)
+    scpi_store_close();
+}
+
+void scpi_def_set_trace(uint8_t n, meas_trace_t *trace) {
+  if (n >= 1 && n <= SCPI_DEF_MAX_TRACES)
+    scpi_traces[n - 1] = trace;
+}
+
+// The sweep INITiate started has ended: operation complete. Ends of earlier
+// sweeps (aborted or finished just before INITiate) may still be queued.
+static void scpi_on_channel_event(const meas_event_t *ev, void *user) {
+  (void)user;
+  if (scpi_sweeping && scpi_channel &&
+      ev->source == (meas_object_t *)scpi_channel &&
+      MEAS_CHANNEL_SWEEP_DONE(ev) &&
+      MEAS_CHANNEL_SWEEP_SEQ(ev) == scpi_sweep_seq) {
+    scpi_sweeping = false;
+    scpi_status_op_end();
+  }
+}
+
+void scpi_def_set_channel(meas_channel_t *ch) {
+  scpi_channel = ch;
+  scpi_sweeping = false;
+  if (ch && !scpi_subscribed)
+    scpi_subscribed = (meas_subscribe(NULL, scpi_on_channel_event, NULL) ==
+                       MEAS_OK);
+  scpi_def_build_tree();
+}
 
 static scpi_status_t scpi_cmd_idn(scpi_context_t *ctx) {
   if (ctx && ctx->write) {
-    const char *idn = "MOMENTICS,MeasLib,0,0.1\r\n";
-    ctx->write(ctx, idn, strlen(idn));
+    const char *idn = "MOMENTICS,MeasLib,0,0.1";
+    scpi_write(ctx, idn, strlen(idn));
   }
   return SCPI_RES_OK;
 }
 
 static scpi_status_t scpi_cmd_rst(scpi_context_t *ctx) {
+  scpi_cmd_abort(ctx);
+  // Operations are abandoned: the store ends here, its file cut short
+  if (scpi_store.file) {
+    scpi_store_close();
+    scpi_status_op_end();
+  }
+  scpi_status_op_reset();
+  if (ctx) {
+    ctx->format = SCPI_FORMAT_ASCII;
+    ctx->swapped = false;
+  }
+  return SCPI_RES_OK;
+}
+
+static meas_status_t scpi_block_write(void *user_data, const void *data,
+                                      size_t size) {
+  scpi_context_t *ctx = (scpi_context_t *)user_data;
+  return (scpi_write(ctx, (const char *)data, size) == size) ? MEAS_OK
+                                                            : MEAS_ERROR;
+}
+
+/**
+ * @brief HCOPy:SDUMp:DATA? [BMP|RLE]
+ * Screenshot streamed strip by strip while the screen is re-rendered. BMP
+ * has a fixed size and goes as a definite-length block ("#<n><length>").
+ * The RLE size is only known once the frame is rendered, so it goes as an
+ * indefinite-length block ("#0", ended by the response terminator) and must
+ * be the last query of its message. A failed capture queues an execution
+ * error; the block is then cut short.
+ */
+static scpi_status_t scpi_cmd_hcopy_data(scpi_context_t *ctx) {
+  if (!ctx || !ctx->write)
+    return SCPI_RES_OK;
+
+  meas_screenshot_format_t format = MEAS_SCREENSHOT_BMP;
+  char name[8];
+  if (scpi_param_string(ctx, name, sizeof(name)) == SCPI_RES_OK) {
+    if (strlen(name) == 3 && scpi_strncasecmp(name, "RLE", 3))
+      format = MEAS_SCREENSHOT_RLE;
+    else if (strlen(name) != 3 || !scpi_strncasecmp(name, "BMP", 3))
+      return SCPI_RES_ERR_DATA_TYPE;
+  }
+
+  bool started;
+  if (format == MEAS_SCREENSHOT_BMP)
+    started = scpi_write_block_header(ctx, meas_screenshot_size(format));
+  else
+    started = (scpi_write(ctx, "#0", 2) == 2);
+  if (!started ||
+      meas_screenshot_write(format, scpi_block_write, ctx) != MEAS_OK)
+    return SCPI_RES_ERR_EXECUTION;
+  return SCPI_RES_OK;
+}
+
+// --- FORMat ---
+
+// Keyword parameter in either its short or long form
+static bool scpi_param_is(const char *param, const char *pattern) {
+  return scpi_header_match(pattern, param, false) ||
+         scpi_header_match(pattern, param, true);
+}
+
+/**
+ * @brief FORMat[:DATA] ASCii[,0] | REAL[,32] | REAL,64 | INTeger[,32]
+ */
+static scpi_status_t scpi_cmd_format(scpi_context_t *ctx) {
+  char type[12];
+  if (scpi_param_string(ctx, type, sizeof(type)) != SCPI_RES_OK)
+    return SCPI_RES_ERR_MISSING_PARAM;
+
+  int32_t length = 0;
+  scpi_status_t res = scpi_param_int(ctx, &length);
+  bool has_length = (res == SCPI_RES_OK);
+  if (!has_length && res != SCPI_RES_ERR_MISSING_PARAM)
+    return res;
+
+  if (scpi_param_is(type, "ASCii") && (!has_length || length == 0))
+    ctx->format = SCPI_FORMAT_ASCII;
+  else if (scpi_param_is(type, "REAL") && (!has_length || length == 32))
+    ctx->format = SCPI_FORMAT_REAL32;
+  else if (scpi_param_is(type, "REAL") && length == 64)
+    ctx->format = SCPI_FORMAT_REAL64;
+  else if (scpi_param_is(type, "INTeger") && (!has_length || length == 32))
+    ctx->format = SCPI_FORMAT_INT32;
+  else
+    return SCPI_RES_ERR_DATA_TYPE;
+  return SCPI_RES_OK;
+}
+
+static scpi_status_t scpi_cmd_format_query(scpi_context_t *ctx) {
+  static const char *const names[] = {
+      [SCPI_FORMAT_ASCII] = "ASC,0",
+      [SCPI_FORMAT_REAL32] = "REAL,32",
+      [SCPI_FORMAT_REAL64] = "REAL,64",
+      [SCPI_FORMAT_INT32] = "INT,32"};
+  scpi_write(ctx, names[ctx->format], strlen(names[ctx->format]));
+  return SCPI_RES_OK;
+}
+
+/**
+ * @brief FORMat:BORDer NORMal | SWAPped
+ * NORMal sends the most significant byte first (IEEE 488.2); SWAPped is the
+ * byte order of the instrument, which lets REAL,64 stream without conversion.
+ */
+static scpi_status_t scpi_cmd_border(scpi_context_t *ctx) {
+  char order[12];
+  if (scpi_param_string(ctx, order, sizeof(order)) != SCPI_RES_OK)
+    return SCPI_RES_ERR_MISSING_PARAM;
+  if (scpi_param_is(order, "NORMal"))
+    ctx->swapped = false;
+  else if (scpi_param_is(order, "SWAPped"))
+    ctx->swapped = true;
+  else
+    return SCPI_RES_ERR_DATA_TYPE;
+  return SCPI_RES_OK;
+}
+
+static scpi_status_t scpi_cmd_border_query(scpi_context_t *ctx) {
+  const char *order = ctx->swapped ? "SWAP" : "NORM";
+  scpi_write(ctx, order, strlen(order));
+  return SCPI_RES_OK;
+}
+
+// --- TRACe ---
+
+/**
+ * @brief Send the response (Y) or stimulus (X) values of trace [n] (default
+ * 1) in the current FORMat. Complex traces send interleaved (re, im) pairs.
+ */
+static scpi_status_t scpi_trace_readout(scpi_context_t *ctx, bool stimulus) {
+  int32_t n = 1;
+  scpi_status_t res = scpi_param_int(ctx, &n);
+  if (res != SCPI_RES_OK && res != SCPI_RES_ERR_MISSING_PARAM)
+    return res;
+  if (n < 1 || n > SCPI_DEF_MAX_TRACES || !scpi_traces[n - 1])
+    return SCPI_RES_ERR_EXECUTION;
+
+  meas_trace_t *trace = scpi_traces[n - 1];
+  const meas_real_t *x = NULL;
+  const meas_real_t *y = NULL;
+  size_t count = 0;
+  if (meas_trace_get_data(trace, &x, &y, &count) != MEAS_OK)
+    return SCPI_RES_ERR_EXECUTION;
+
+  const meas_real_t *values = stimulus ? x : y;
+  if (!stimulus && meas_trace_get_format(trace) == TRACE_FMT_COMPLEX)
+    count *= 2;
+  if (!values && count)
+    return SCPI_RES_ERR_EXECUTION;
+  return scpi_write_reals(ctx, values, count);
+}
+
+static scpi_status_t scpi_cmd_trace_data(scpi_context_t *ctx) {
+  return scpi_trace_readout(ctx, false);
+}
+
+static scpi_status_t scpi_cmd_trace_stimulus(scpi_context_t *ctx) {
+  return scpi_trace_readout(ctx, true);
+}
+
+// --- Status Model (IEEE 488.2) ---
+
+static scpi_status_t scpi_write_uint(scpi_context_t *ctx, unsigned value) {
+  char text[12];
+  int n = snprintf(text, sizeof(text), "%u", value);
+  scpi_write(ctx, text, (size_t)n);
+  return SCPI_RES_OK;
+}
+
+static scpi_status_t scpi_param_mask(scpi_context_t *ctx, uint8_t *mask) {
+  int32_t value;
+  scpi_status_t res = scpi_param_int(ctx, &value);
+  if (res != SCPI_RES_OK)
+    return res;
+  if (value < 0 || value > 255)
+    return SCPI_RES_ERR_DATA_TYPE;
+  *mask = (uint8_t)value;
+  return SCPI_RES_OK;
+}
+
+static scpi_status_t scpi_cmd_cls(scpi_context_t *ctx) {
+  (void)ctx;
+  scpi_status_clear();
+  return SCPI_RES_OK;
+}
+
+static scpi_status_t scpi_cmd_ese(scpi_context_t *ctx) {
+  uint8_t mask;
+  scpi_status_t res = scpi_param_mask(ctx, &mask);
+  if (res == SCPI_RES_OK)
+    scpi_status_set_ese(mask);
+  return res;
+}
+
+static scpi_status_t scpi_cmd_ese_query(scpi_context_t *ctx) {
+  return scpi_write_uint(ctx, scpi_status_ese());
+}
+
+static scpi_status_t scpi_cmd_esr_query(scpi_context_t *ctx) {
+  return scpi_write_uint(ctx, scpi_status_read_esr());
+}
+
+static scpi_status_t scpi_cmd_sre(scpi_context_t *ctx) {
+  uint8_t mask;
+  scpi_status_t res = scpi_param_mask(ctx, &mask);
+  if (res == SCPI_RES_OK)
+    scpi_status_set_sre(mask);
+  return res;
+}
+
+static scpi_status_t scpi_cmd_sre_query(scpi_context_t *ctx) {
+  return scpi_write_uint(ctx, scpi_status_sre());
+}
+
+static scpi_status_t scpi_cmd_stb_query(scpi_context_t *ctx) {
+  return scpi_write_uint(ctx, scpi_status_byte());
+}
+
+static scpi_status_t scpi_cmd_opc(scpi_context_t *ctx) {
   (void)ctx;
+  scpi_status_opc();
+  return SCPI_RES_OK;
+}
+
+// Answers "1" once no operation is pending; input waits until then
+static scpi_status_t scpi_opc_query_step(scpi_context_t *ctx) {
+  if (scpi_status_op_pending())
+    return SCPI_RES_PENDING;
+  if (ctx->write && scpi_write(ctx, "1", 1) != 1)
+    return SCPI_RES_PENDING;
+  return SCPI_RES_OK;
+}
+
+static scpi_status_t scpi_cmd_opc_query(scpi_context_t *ctx) {
+  return scpi_defer(ctx, scpi_opc_query_step);
+}
+
+static scpi_status_t scpi_wai_step(scpi_context_t *ctx) {
+  (void)ctx;
+  return scpi_status_op_pending() ? SCPI_RES_PENDING : SCPI_RES_OK;
+}
+
+static scpi_status_t scpi_cmd_wai(scpi_context_t *ctx) {
+  return scpi_defer(ctx, scpi_wai_step);
+}
+
+// --- INITiate / ABORt ---
+
+// A running store reads the trace in place: the sweep waits for it
+static scpi_status_t scpi_init_step(scpi_context_t *ctx) {
+  (void)ctx;
+  if (scpi_store.file)
+    return SCPI_RES_PENDING;
+  if (!scpi_channel || meas_channel_start_sweep(scpi_channel) != MEAS_OK)
+    return SCPI_RES_ERR_EXECUTION;
+  scpi_sweep_seq = scpi_channel->sweep_seq;
+  if (!scpi_sweeping) {
+    scpi_sweeping = true;
+    scpi_status_op_begin();
+  }
+  return SCPI_RES_OK;
+}
+
+/**
+ * @brief INITiate[:IMMediate]: start a sweep (overlapped; see *OPC?)
+ */
+static scpi_status_t scpi_cmd_init(scpi_context_t *ctx) {
+  return scpi_defer(ctx, scpi_init_step);
+}
+
+static scpi_status_t scpi_cmd_abort(scpi_context_t *ctx) {
+  (void)ctx;
+  if (scpi_sweeping) {
+    scpi_sweeping = false;
+    meas_channel_abort_sweep(scpi_channel);
+    scpi_status_op_end();
+  }
+  return SCPI_RES_OK;
+}
+
+// --- MMEMory ---
+
+void scpi_def_set_storage(const meas_fs_api_t *fs, meas_object_t *drv) {
+  if (scpi_store.file)
+    return; // Not while a store is writing
+  scpi_store.fs = fs;
+  scpi_store.drv = drv;
+}
+
+// Close the file of the running store
+static meas_status_t scpi_store_close(void) {
+  meas_status_t st = MEAS_OK;
+  if (scpi_store.fs->close)
+    st = scpi_store.fs->close(scpi_store.file);
+  scpi_store.file = NULL;
+  return st;
+}
+
+static void scpi_store_finish(bool ok) {
+  if (scpi_store_close() != MEAS_OK)
+    ok = false;
+  if (!ok)
+    scpi_status_event(SCPI_ESR_DDE);
+  scpi_status_op_end();
+}
+
+void scpi_def_poll(void) {
+  if (!scpi_store.file)
+    return;
+  if (scpi_store.trace) {
+    // Rows of one sweep only: fetch once the sweep INITiate started ends
+    if (scpi_sweeping)
+      return;
+    meas_status_t st = meas_trace_get_data(scpi_store.trace, &scpi_store.x,
+                                           &scpi_store.y, &scpi_store.count);
+    if (st != MEAS_OK ||
+        (scpi_store.count && (!scpi_store.x || !scpi_store.y))) {
+      scpi_store_finish(false);
+      return;
+    }
+    scpi_store.complex =
+        (meas_trace_get_format(scpi_store.trace) == TRACE_FMT_COMPLEX);
+    scpi_store.trace = NULL;
+  }
+
+  char chunk[SCPI_DEF_STORE_CHUNK];
+  size_t used = 0;
+  while (scpi_store.next < scpi_store.count) {
+    size_t i = scpi_store.next;
+    char line[80];
+    int n;
+    if (scpi_store.complex)
+      n = snprintf(line, sizeof(line), "%.12g,%.12g,%.12g\n",
+                   (double)scpi_store.x[i], (double)scpi_store.y[2 * i],
+                   (double)scpi_store.y[2 * i + 1]);
+    else
+      n = snprintf(line, sizeof(line), "%.12g,%.12g\n",
+                   (double)scpi_store.x[i], (double)scpi_store.y[i]);
+    if (used + (size_t)n > sizeof(chunk))
+      break;
+    memcpy(&chunk[used], line, (size_t)n);
+    used += (size_t)n;
+    scpi_store.next++;
+  }
+
+  if (used && scpi_store.fs->write(scpi_store.file, chunk, used) != MEAS_OK) {
+    scpi_store_finish(false);
+    return;
+  }
+  if (scpi_store.next >= scpi_store.count)
+    scpi_store_finish(true);
+}
+
+// Quoted string parameter ("..." or '...')
+static scpi_status_t scpi_param_quoted(scpi_context_t *ctx, char *str,
+                                       size_t len) {
+  scpi_status_t res = scpi_param_string(ctx, str, len);
+  if (res != SCPI_RES_OK)
+    return res;
+  size_t n = strlen(str);
+  if (n < 2 || (str[0] != '"' && str[0] != '\'') || str[n - 1] != str[0])
+    return SCPI_RES_ERR_DATA_TYPE;
+  memmove(str, str + 1, n - 2);
+  str[n - 2] = '\0';
+  return SCPI_RES_OK;
+}
+
+/**
+ * @brief MMEMory:STORe:TRACe <n>,"<file>"
+ * Saves trace n as CSV lines "stimulus,value" ("stimulus,re,im" for complex
+ * traces). Overlapped: the file is written from scpi_def_poll() while input
+ * is still processed; *OPC? / *WAI wait for it, a failed write latches DDE.
+ * The points are taken after a running sweep ends, and INITiate waits for
+ * the store, so a file never mixes two sweeps. *RST cuts the store short.
+ */
+static scpi_status_t scpi_cmd_mmem_store_trace(scpi_context_t *ctx) {
+  int32_t n;
+  char path[32];
+  scpi_status_t res = scpi_param_int(ctx, &n);
+  if (res == SCPI_RES_OK)
+    res = scpi_param_quoted(ctx, path, sizeof(path));
+  if (res != SCPI_RES_OK)
+    return res;
+  if (n < 1 || n > SCPI_DEF_MAX_TRACES || !scpi_traces[n - 1] ||
+      scpi_store.file || !scpi_store.fs || !scpi_store.fs->open ||
+      !scpi_store.fs->write)
+    return SCPI_RES_ERR_EXECUTION;
+
+  scpi_store.trace = scpi_traces[n - 1];
+  scpi_store.count = 0;
+  scpi_store.next = 0;
+
+  if (scpi_store.fs->open(scpi_store.drv, path, &scpi_store.file) !=
+          MEAS_OK ||
+      !scpi_store.file) {
+    scpi_store.file = NULL;
+    return SCPI_RES_ERR_EXECUTION;
+  }
+  scpi_status_op_begin();
   return SCPI_RES_OK;
 }
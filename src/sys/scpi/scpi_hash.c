@@ -0,0 +1,232 @@
+/**
+ * @file scpi_hash.c
+ * @brief SCPI Command Tree Compiler (Perfect Hash).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Key hash: FNV-1a over the level id and the uppercased header. The low bits
+ * select the bucket; a finalizer mix of the hash gives the base slot and an
+ * odd stride, so displacement d probes (base + d * stride) mod SLOTS and
+ * reaches every slot for d < SLOTS.
+ */
+
+#include "measlib/sys/scpi/scpi_hash.h"
+#include "measlib/sys/scpi/scpi_utils.h"
+#include <ctype.h>
+#include <stddef.h>
+#include <string.h>
+
+#define SCPI_HASH_BUCKETS (SCPI_HASH_SLOTS / 4)
+#define SCPI_HASH_EMPTY 0xFFU
+#define SCPI_HASH_MAX_BUCKET 8 // Keys per bucket
+#define SCPI_HASH_MAX_DISP (4U * SCPI_HASH_SLOTS)
+
+typedef struct {
+  const scpi_command_t *cmd;
+  uint8_t level;     // Level the header belongs to
+  uint8_t child;     // Level of the children (SCPI_HASH_EMPTY if none)
+  uint8_t short_len; // Header lengths, checked before comparing
+  uint8_t long_len;
+} scpi_hash_entry_t;
+
+static scpi_hash_entry_t entries[SCPI_HASH_MAX_COMMANDS];
+static uint8_t entry_count = 0;
+
+static const scpi_command_t *levels[SCPI_HASH_MAX_LEVELS];
+static uint8_t level_count = 0;
+
+static uint16_t disp[SCPI_HASH_BUCKETS];
+static uint8_t slots[SCPI_HASH_SLOTS];
+
+// --- Hashing ---
+
+static inline uint32_t hash_step(uint32_t h, char c) {
+  return (h ^ (uint8_t)toupper((unsigned char)c)) * 16777619UL;
+}
+
+static inline uint32_t hash_begin(uint8_t level) {
+  return hash_step(2166136261UL, (char)level);
+}
+
+static inline uint32_t hash_mix(uint32_t h) {
+  h ^= h >> 16;
+  h *= 0x85EBCA6BUL;
+  h ^= h >> 13;
+  h *= 0xC2B2AE35UL;
+  return h ^ (h >> 16);
+}
+
+static inline uint32_t hash_slot(uint32_t mix, uint32_t d) {
+  return (mix + d * ((mix >> 16) | 1U)) & (SCPI_HASH_SLOTS - 1U);
+}
+
+// Hash of one form of a pattern; false if too long for the entry
+static bool hash_form(uint8_t level, const char *pattern, bool short_form,
+                      uint32_t *hash, uint8_t *len) {
+  uint32_t h = hash_begin(level);
+  size_t n = 0;
+  for (; *pattern; pattern++) {
+    if (short_form && islower((unsigned char)*pattern))
+      continue;
+    h = hash_step(h, *pattern);
+    n++;
+  }
+  if (n > UINT8_MAX)
+    return false;
+  *hash = h;
+  *len = (uint8_t)n;
+  return true;
+}
+
+// --- Compiler ---
+
+static uint8_t level_add(const scpi_command_t *list) {
+  for (uint8_t i = 0; i < level_count; i++) {
+    if (levels[i] == list)
+      return i; // Shared list, or a cycle back up the tree
+  }
+  if (level_count >= SCPI_HASH_MAX_LEVELS)
+    return SCPI_HASH_EMPTY;
+  levels[level_count] = list;
+  return level_count++;
+}
+
+// Hash of key k: entry k / 2, long form if k is even, short form if odd
+static bool key_hash(uint16_t k, uint32_t *hash) {
+  const scpi_hash_entry_t *e = &entries[k / 2];
+  if ((k & 1U) && e->short_len == e->long_len)
+    return false; // No separate short form
+  uint8_t len;
+  return hash_form(e->level, e->cmd->pattern, k & 1U, hash, &len);
+}
+
+static bool place_bucket(uint16_t b, uint8_t size) {
+  uint32_t mix[SCPI_HASH_MAX_BUCKET];
+  uint32_t hash[SCPI_HASH_MAX_BUCKET];
+  uint8_t owner[SCPI_HASH_MAX_BUCKET];
+  uint8_t n = 0;
+
+  for (uint16_t k = 0; k < 2U * entry_count && n < size; k++) {
+    uint32_t h;
+    if (!key_hash(k, &h) || (h & (SCPI_HASH_BUCKETS - 1U)) != b)
+      continue;
+    for (uint8_t i = 0; i < n; i++) {
+      if (hash[i] == h)
+        return false; // Duplicate header: no displacement separates it
+    }
+    hash[n] = h;
+    mix[n] = hash_mix(h);
+    owner[n] = (uint8_t)(k / 2);
+    n++;
+  }
+
+  for (uint32_t d = 0; d < SCPI_HASH_MAX_DISP; d++) {
+    uint8_t i = 0;
+    for (; i < n; i++) {
+      uint32_t s = hash_slot(mix[i], d);
+      if (slots[s] != SCPI_HASH_EMPTY)
+        break;
+      slots[s] = owner[i];
+    }
+    if (i == n) {
+      disp[b] = (uint16_t)d;
+      return true;
+    }
+    while (i--)
+      slots[hash_slot(mix[i], d)] = SCPI_HASH_EMPTY;
+  }
+  return false;
+}
+
+static void hash_reset(void) {
+  entry_count = 0;
+  level_count = 0;
+  memset(slots, SCPI_HASH_EMPTY, sizeof(slots));
+  memset(disp, 0, sizeof(disp));
+}
+
+// Levels breadth-first; each command becomes one entry
+static bool hash_collect(const scpi_command_t *root) {
+  level_add(root);
+  for (uint8_t l = 0; l < level_count; l++) {
+    for (const scpi_command_t *cmd = levels[l]; cmd->pattern; cmd++) {
+      if (entry_count >= SCPI_HASH_MAX_COMMANDS)
+        return false;
+      scpi_hash_entry_t *e = &entries[entry_count];
+      uint32_t h;
+      e->cmd = cmd;
+      e->level = l;
+      e->child = SCPI_HASH_EMPTY;
+      if (!hash_form(l, cmd->pattern, false, &h, &e->long_len) ||
+          !hash_form(l, cmd->pattern, true, &h, &e->short_len))
+        return false;
+      if (cmd->children) {
+        e->child = level_add(cmd->children);
+        if (e->child == SCPI_HASH_EMPTY)
+          return false;
+      }
+      entry_count++;
+    }
+  }
+  return true;
+}
+
+// Bucket sizes, then the fullest buckets are placed first
+static bool hash_place(void) {
+  uint8_t counts[SCPI_HASH_BUCKETS] = {0};
+  for (uint16_t k = 0; k < 2U * entry_count; k++) {
+    uint32_t h;
+    if (!key_hash(k, &h))
+      continue;
+    uint16_t b = (uint16_t)(h & (SCPI_HASH_BUCKETS - 1U));
+    if (++counts[b] > SCPI_HASH_MAX_BUCKET)
+      return false;
+  }
+  for (uint8_t size = SCPI_HASH_MAX_BUCKET; size > 0; size--) {
+    for (uint16_t b = 0; b < SCPI_HASH_BUCKETS; b++) {
+      if (counts[b] == size && !place_bucket(b, size))
+        return false;
+    }
+  }
+  return true;
+}
+
+bool scpi_hash_compile(const scpi_command_t *root) {
+  hash_reset();
+  if (!root)
+    return false;
+  if (hash_collect(root) && hash_place())
+    return true;
+  hash_reset();
+  return false;
+}
+
+// --- Lookup ---
+
+const scpi_command_t *scpi_hash_find(uint8_t *level, const char *token) {
+  if (!level || !token || entry_count == 0)
+    return NULL;
+
+  uint32_t h = hash_begin(*level);
+  size_t len = 0;
+  for (const char *p = token; *p; p++, len++)
+    h = hash_step(h, *p);
+
+  uint32_t b = h & (SCPI_HASH_BUCKETS - 1U);
+  uint8_t idx = slots[hash_slot(hash_mix(h), disp[b])];
+  if (idx == SCPI_HASH_EMPTY)
+    return NULL;
+
+  // The slot holds the only candidate; confirm it is this header
+  const scpi_hash_entry_t *e = &entries[idx];
+  if (e->level != *level)
+    return NULL;
+  const char *pattern = e->cmd->pattern;
+  if (!(len == e->long_len && scpi_header_match(pattern, token, false)) &&
+      !(len == e->short_len && scpi_header_match(pattern, token, true)))
+    return NULL;
+
+  *level = e->child;
+  return e->cmd;
+}
@@ -0,0 +1,274 @@
+/**
+ * @file scpi_prop.c
+ * @brief SCPI Commands Generated from Property Descriptors.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/sys/scpi/scpi_prop.h"
+#include "measlib/sys/scpi/scpi_core.h"
+#include "measlib/sys/scpi/scpi_utils.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// A bound property: the user_data of its generated commands
+typedef struct {
+  meas_object_t *obj;
+  const meas_prop_desc_t *desc;
+} scpi_prop_binding_t;
+
+static scpi_prop_binding_t bindings[SCPI_PROP_MAX_BINDINGS];
+static size_t binding_count;
+
+// Generated lists and their header patterns
+static scpi_command_t nodes[SCPI_PROP_MAX_NODES];
+static size_t node_count;
+static char text[SCPI_PROP_TEXT_SIZE];
+static size_t text_used;
+
+void scpi_prop_reset(void) {
+  binding_count = 0;
+  node_count = 0;
+  text_used = 0;
+}
+
+bool scpi_prop_bind(meas_object_t *obj) {
+  size_t count = 0;
+  const meas_prop_desc_t *props = meas_object_get_props(obj, &count);
+  for (size_t i = 0; props && i < count; i++) {
+    const meas_prop_desc_t *d = &props[i];
+    if (!d->scpi || !*d->scpi ||
+        (d->type != PROP_TYPE_INT64 && d->type != PROP_TYPE_REAL &&
+         d->type != PROP_TYPE_BOOL))
+      continue;
+    if (binding_count >= SCPI_PROP_MAX_BINDINGS)
+      return false;
+    bindings[binding_count].obj = obj;
+    bindings[binding_count].desc = d;
+    binding_count++;
+  }
+  return true;
+}
+
+// --- Set / Query ---
+
+// MINimum / MAXimum of the range, or a number with the property's unit
+static scpi_status_t scpi_prop_param(scpi_context_t *ctx,
+                                     const meas_prop_desc_t *d, double *v) {
+  char *params = ctx->params;
+  char word[12];
+  if (d->min != d->max &&
+      scpi_param_string(ctx, word, sizeof(word)) == SCPI_RES_OK) {
+    if (scpi_header_match("MINimum", word, false) ||
+        scpi_header_match("MINimum", word, true)) {
+      *v = d->min;
+      return SCPI_RES_OK;
+    }
+    if (scpi_header_match("MAXimum", word, false) ||
+        scpi_header_match("MAXimum", word, true)) {
+      *v = d->max;
+      return SCPI_RES_OK;
+    }
+  }
+  ctx->params = params;
+  return scpi_param_number(ctx, d->unit, v);
+}
+
+static scpi_status_t scpi_prop_set(scpi_context_t *ctx) {
+  const scpi_prop_binding_t *b =
+      (const scpi_prop_binding_t *)ctx->command->user_data;
+  const meas_prop_desc_t *d = b->desc;
+  meas_variant_t val = {.type = d->type};
+
+  if (d->type == PROP_TYPE_BOOL) {
+    char word[8];
+    scpi_status_t res = scpi_param_string(ctx, word, sizeof(word));
+    if (res != SCPI_RES_OK)
+      return res;
+    if (strcmp(word, "1") == 0 || scpi_header_match("ON", word, false))
+      val.b_val = true;
+    else if (strcmp(word, "0") == 0 || scpi_header_match("OFF", word, false))
+      val.b_val = false;
+    else
+      return SCPI_RES_ERR_DATA_TYPE;
+  } else {
+    double v;
+    scpi_status_t res = scpi_prop_param(ctx, d, &v);
+    if (res != SCPI_RES_OK)
+      return res;
+    if (d->min != d->max && (v < d->min || v > d->max))
+      return SCPI_RES_ERR_OUT_OF_RANGE;
+    if (d->type == PROP_TYPE_INT64) {
+      if (fabs(v) >= 9.2e18)
+        return SCPI_RES_ERR_OUT_OF_RANGE;
+      val.i_val = (int64_t)llround(v);
+    } else {
+      val.r_val = (meas_real_t)v;
+    }
+  }
+
+  if (meas_object_set_prop(b->obj, d->key, val) != MEAS_OK)
+    return SCPI_RES_ERR_EXECUTION;
+  return SCPI_RES_OK;
+}
+
+static scpi_status_t scpi_prop_query(scpi_context_t *ctx) {
+  const scpi_prop_binding_t *b =
+      (const scpi_prop_binding_t *)ctx->command->user_data;
+  meas_variant_t val;
+  if (meas_object_get_prop(b->obj, b->desc->key, &val) != MEAS_OK)
+    return SCPI_RES_ERR_EXECUTION;
+
+  char out[32];
+  int n;
+  switch (val.type) {
+  case PROP_TYPE_INT64:
+    n = snprintf(out, sizeof(out), "%lld", (long long)val.i_val);
+    break;
+  case PROP_TYPE_REAL:
+    n = snprintf(out, sizeof(out), "%.12g", (double)val.r_val);
+    break;
+  case PROP_TYPE_BOOL:
+    n = snprintf(out, sizeof(out), "%d", val.b_val ? 1 : 0);
+    break;
+  default:
+    return SCPI_RES_ERR_EXECUTION;
+  }
+  scpi_write(ctx, out, (size_t)n);
+  return SCPI_RES_OK;
+}
+
+// --- Tree Generation ---
+
+// Header token @p depth of a path ("A:B:C", depth 1 -> "B"); NULL past the
+// end
+static const char *path_token(const char *path, size_t depth, size_t *len) {
+  const char *p = path;
+  for (size_t d = 0; d < depth; d++) {
+    p = strchr(p, ':');
+    if (!p)
+      return NULL;
+    p++;
+  }
+  const char *colon = strchr(p, ':');
+  *len = colon ? (size_t)(colon - p) : strlen(p);
+  return p;
+}
+
+static bool path_is_leaf(uint8_t b, size_t depth) {
+  size_t len;
+  return path_token(bindings[b].desc->scpi, depth + 1, &len) == NULL;
+}
+
+static bool same_token(uint8_t b, size_t depth, const char *tok,
+                       size_t len) {
+  size_t n;
+  const char *t = path_token(bindings[b].desc->scpi, depth, &n);
+  return n == len && memcmp(t, tok, len) == 0;
+}
+
+static const char *intern(const char *tok, size_t len, bool query) {
+  size_t need = len + (query ? 2U : 1U);
+  if (text_used + need > sizeof(text))
+    return NULL;
+  char *out = &text[text_used];
+  memcpy(out, tok, len);
+  if (query)
+    out[len++] = '?';
+  out[len] = '\0';
+  text_used += need;
+  return out;
+}
+
+// Entries of one level: a node per distinct token, plus a query per leaf
+static size_t list_size(const uint8_t *members, size_t n, size_t depth) {
+  size_t size = 0;
+  for (size_t i = 0; i < n; i++) {
+    size_t len;
+    const char *tok = path_token(bindings[members[i]].desc->scpi, depth, &len);
+    bool seen = false;
+    for (size_t j = 0; j < i && !seen; j++)
+      seen = same_token(members[j], depth, tok, len);
+    if (!seen)
+      size++;
+    if (path_is_leaf(members[i], depth))
+      size++;
+  }
+  return size;
+}
+
+// Fill @p out with the level of the members sharing @p depth tokens
+static bool build_list(const uint8_t *members, size_t n, size_t depth,
+                       scpi_command_t *out) {
+  size_t used = 0;
+  for (size_t i = 0; i < n; i++) {
+    size_t len;
+    const char *tok = path_token(bindings[members[i]].desc->scpi, depth, &len);
+    bool seen = false;
+    for (size_t j = 0; j < i && !seen; j++)
+      seen = same_token(members[j], depth, tok, len);
+    if (seen)
+      continue;
+
+    // The property ending here, and those continuing below
+    uint8_t sub[SCPI_PROP_MAX_BINDINGS];
+    size_t sub_n = 0;
+    int leaf = -1;
+    for (size_t j = i; j < n; j++) {
+      if (!same_token(members[j], depth, tok, len))
+        continue;
+      if (!path_is_leaf(members[j], depth))
+        sub[sub_n++] = members[j];
+      else if (leaf >= 0)
+        return false; // Two properties on one header
+      else
+        leaf = members[j];
+    }
+
+    scpi_command_t *children = NULL;
+    if (sub_n) {
+      size_t size = list_size(sub, sub_n, depth + 1);
+      if (node_count + size + 1 > SCPI_PROP_MAX_NODES)
+        return false;
+      children = &nodes[node_count];
+      node_count += size + 1;
+      if (!build_list(sub, sub_n, depth + 1, children))
+        return false;
+      children[size] = (scpi_command_t)SCPI_CMD_LIST_END;
+    }
+
+    scpi_command_t *node = &out[used++];
+    *node = (scpi_command_t){.pattern = intern(tok, len, false),
+                             .children = children};
+    if (!node->pattern)
+      return false;
+    if (leaf >= 0) {
+      node->callback = scpi_prop_set;
+      node->user_data = &bindings[leaf];
+      out[used++] = (scpi_command_t){.pattern = intern(tok, len, true),
+                                     .callback = scpi_prop_query,
+                                     .user_data = &bindings[leaf]};
+      if (!out[used - 1].pattern)
+        return false;
+    }
+  }
+  return true;
+}
+
+size_t scpi_prop_build(scpi_command_t *list, size_t cap) {
+  node_count = 0;
+  text_used = 0;
+  if (!list || binding_count == 0)
+    return 0;
+
+  uint8_t all[SCPI_PROP_MAX_BINDINGS];
+  for (size_t i = 0; i < binding_count; i++)
+    all[i] = (uint8_t)i;
+  size_t size = list_size(all, binding_count, 0);
+  if (size > cap || !build_list(all, binding_count, 0, list))
+    return 0;
+  return size;
+}
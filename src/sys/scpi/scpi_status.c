@@ -0,0 +1,118 @@
+/**
+ * @file scpi_status.c
+ * @brief SCPI Status Model (IEEE 488.2 Status Byte / Event Status).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/sys/scpi/scpi_status.h"
+#include <stddef.h>
+#include <string.h>
+
+static struct {
+  uint8_t esr; // Latched standard events
+  uint8_t ese; // ESR bits summarized in ESB
+  uint8_t sre; // STB bits that request service
+  bool mss;    // Last summary, to report rising edges only
+  uint16_t pending; // Overlapped operations in progress
+  bool opc_armed;   // *OPC received, waiting for the operations
+  scpi_srq_cb_t srq;
+  void *srq_user;
+} status;
+
+// Recompute the summary and request service on its rising edge
+static void status_update(void) {
+  uint8_t stb = scpi_status_byte();
+  bool mss = (stb & SCPI_STB_MSS) != 0;
+  if (mss && !status.mss && status.srq)
+    status.srq(status.srq_user, stb);
+  status.mss = mss;
+}
+
+void scpi_status_init(void) {
+  scpi_srq_cb_t srq = status.srq;
+  void *user = status.srq_user;
+  memset(&status, 0, sizeof(status));
+  status.srq = srq;
+  status.srq_user = user;
+  status.esr = SCPI_ESR_PON;
+}
+
+void scpi_status_set_srq_handler(scpi_srq_cb_t cb, void *user) {
+  status.srq = cb;
+  status.srq_user = user;
+}
+
+void scpi_status_event(uint8_t bits) {
+  status.esr |= bits;
+  status_update();
+}
+
+void scpi_status_error(scpi_status_t res) {
+  if (res <= -100 && res > -200)
+    scpi_status_event(SCPI_ESR_CME);
+  else if (res <= -200 && res > -300)
+    scpi_status_event(SCPI_ESR_EXE);
+}
+
+uint8_t scpi_status_byte(void) {
+  uint8_t stb = (status.esr & status.ese) ? SCPI_STB_ESB : 0;
+  if (stb & status.sre & (uint8_t)~SCPI_STB_MSS)
+    stb |= SCPI_STB_MSS;
+  return stb;
+}
+
+uint8_t scpi_status_read_esr(void) {
+  uint8_t esr = status.esr;
+  status.esr = 0;
+  status_update();
+  return esr;
+}
+
+void scpi_status_set_ese(uint8_t mask) {
+  status.ese = mask;
+  status_update();
+}
+
+void scpi_status_set_sre(uint8_t mask) {
+  status.sre = mask & (uint8_t)~SCPI_STB_MSS; // Bit 6 cannot be enabled
+  status_update();
+}
+
+uint8_t scpi_status_ese(void) { return status.ese; }
+
+uint8_t scpi_status_sre(void) { return status.sre; }
+
+void scpi_status_clear(void) {
+  status.esr = 0;
+  status.opc_armed = false;
+  status_update();
+}
+
+void scpi_status_op_begin(void) {
+  if (status.pending < UINT16_MAX)
+    status.pending++;
+}
+
+void scpi_status_op_end(void) {
+  if (status.pending)
+    status.pending--;
+  if (!status.pending && status.opc_armed) {
+    status.opc_armed = false;
+    scpi_status_event(SCPI_ESR_OPC);
+  }
+}
+
+bool scpi_status_op_pending(void) { return status.pending != 0; }
+
+void scpi_status_opc(void) {
+  status.opc_armed = true;
+  if (!status.pending)
+    scpi_status_op_end();
+}
+
+void scpi_status_op_reset(void) {
+  status.pending = 0;
+  status.opc_armed = false;
+}
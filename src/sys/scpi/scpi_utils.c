@@ -33,3 +33,17 @@ bool scpi_is_separator(char c) { return c == ':' || c == ' ' || c == '\t'; }
 
 // Helper to check for message terminator
 bool scpi_is_terminator(char c) { return c == '\n' || c == '\r' || c == ';'; }
+
+bool scpi_header_match(const char *pattern, const char *token,
+                       bool short_form) {
+  for (;; pattern++) {
+    // Short form: the lowercase letters of the pattern are left out
+    if (short_form && islower((unsigned char)*pattern))
+      continue;
+    if (toupper((unsigned char)*pattern) != toupper((unsigned char)*token))
+      return false;
+    if (!*pattern)
+      return true;
+    token++;
+  }
+}
@@ -0,0 +1,215 @@
+/**
+ * @file screenshot.c
+ * @brief Streaming Screenshot Export.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Pixel data is written straight from the tile buffer (the target is
+ * little-endian, so RGB565 words already have file byte order). RLE packet
+ * headers and runs go through a small staging buffer to keep the number of
+ * sink calls down.
+ */
+
+#include "measlib/sys/screenshot.h"
+#include "measlib/sys/render_service.h"
+#include <string.h>
+
+#define SHOT_W MEAS_UI_SCREEN_WIDTH
+#define SHOT_H MEAS_UI_SCREEN_HEIGHT
+
+#define BMP_HEADER_SIZE 66 // File (14) + Info (40) + RGB masks (12)
+#define BMP_ROW_BYTES (SHOT_W * 2) // Already a multiple of 4
+#define BMP_FILE_SIZE (BMP_HEADER_SIZE + (size_t)BMP_ROW_BYTES * SHOT_H)
+
+#define RLE_MAX_PACKET 128
+#define STAGE_SIZE 64
+
+typedef struct {
+  meas_screenshot_format_t format;
+  meas_screenshot_write_t write; // NULL: count only
+  void *user_data;
+  meas_status_t status;
+  size_t total;
+  uint8_t fill;
+  uint8_t stage[STAGE_SIZE];
+} shot_out_t;
+
+// --- Output ---
+
+static void shot_flush(shot_out_t *out) {
+  if (out->fill && out->write && out->status == MEAS_OK)
+    out->status = out->write(out->user_data, out->stage, out->fill);
+  out->fill = 0;
+}
+
+// Small pieces (packets): staged
+static void shot_stage(shot_out_t *out, const void *data, size_t size) {
+  out->total += size;
+  if (!out->write)
+    return;
+  if (out->fill + size > STAGE_SIZE)
+    shot_flush(out);
+  memcpy(&out->stage[out->fill], data, size);
+  out->fill += (uint8_t)size;
+}
+
+// Headers and pixel data: passed through
+static void shot_direct(shot_out_t *out, const void *data, size_t size) {
+  out->total += size;
+  if (!out->write)
+    return;
+  shot_flush(out);
+  if (out->status == MEAS_OK)
+    out->status = out->write(out->user_data, data, size);
+}
+
+static inline void put_u16(uint8_t *p, uint16_t v) {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+}
+
+static inline void put_u32(uint8_t *p, uint32_t v) {
+  put_u16(p, (uint16_t)v);
+  put_u16(p + 2, (uint16_t)(v >> 16));
+}
+
+// --- Formats ---
+
+static void bmp_header(shot_out_t *out) {
+  uint8_t h[BMP_HEADER_SIZE] = {'B', 'M'};
+  put_u32(&h[2], (uint32_t)BMP_FILE_SIZE);
+  put_u32(&h[10], BMP_HEADER_SIZE);                  // Pixel data offset
+  put_u32(&h[14], 40);                               // BITMAPINFOHEADER
+  put_u32(&h[18], SHOT_W);
+  put_u32(&h[22], (uint32_t)-(int32_t)SHOT_H);       // Top-down
+  put_u16(&h[26], 1);                                // Planes
+  put_u16(&h[28], 16);                               // Bits per pixel
+  put_u32(&h[30], 3);                                // BI_BITFIELDS
+  put_u32(&h[34], (uint32_t)BMP_ROW_BYTES * SHOT_H); // Image size
+  put_u32(&h[38], 2835);                             // 72 DPI
+  put_u32(&h[42], 2835);
+  put_u32(&h[54], 0xF800); // Red mask
+  put_u32(&h[58], 0x07E0); // Green mask
+  put_u32(&h[62], 0x001F); // Blue mask
+  shot_direct(out, h, sizeof(h));
+}
+
+static void rle_header(shot_out_t *out) {
+  uint8_t h[8] = {'M', 'R', 'L', 'E'};
+  put_u16(&h[4], SHOT_W);
+  put_u16(&h[6], SHOT_H);
+  shot_direct(out, h, sizeof(h));
+}
+
+static void rle_row(shot_out_t *out, const meas_pixel_t *px) {
+  int16_t i = 0;
+  while (i < SHOT_W) {
+    // Run of equal pixels
+    int16_t n = 1;
+    while (i + n < SHOT_W && n < RLE_MAX_PACKET && px[i + n] == px[i])
+      n++;
+    if (n >= 2) {
+      uint8_t p[3] = {(uint8_t)(0x80 | (n - 1))};
+      put_u16(&p[1], px[i]);
+      shot_stage(out, p, sizeof(p));
+      i += n;
+      continue;
+    }
+
+    // Literal up to the next pair of equal pixels
+    n = 1;
+    while (i + n < SHOT_W && n < RLE_MAX_PACKET &&
+           !(i + n + 1 < SHOT_W && px[i + n] == px[i + n + 1]))
+      n++;
+    uint8_t hdr = (uint8_t)(n - 1);
+    shot_stage(out, &hdr, 1);
+    shot_direct(out, &px[i], (size_t)n * sizeof(meas_pixel_t));
+    i += n;
+  }
+}
+
+static meas_status_t shot_strip(void *user_data, int16_t y,
+                                const meas_pixel_t *pixels, int16_t h) {
+  shot_out_t *out = (shot_out_t *)user_data;
+  (void)y;
+  if (out->format == MEAS_SCREENSHOT_BMP) {
+    shot_direct(out, pixels, (size_t)BMP_ROW_BYTES * (size_t)h);
+  } else {
+    for (int16_t r = 0; r < h; r++)
+      rle_row(out, &pixels[r * SHOT_W]);
+  }
+  return out->status;
+}
+
+static meas_status_t shot_run(shot_out_t *out) {
+  if (out->format == MEAS_SCREENSHOT_BMP)
+    bmp_header(out);
+  else if (out->format == MEAS_SCREENSHOT_RLE)
+    rle_header(out);
+  else
+    return MEAS_ERROR;
+
+  meas_status_t res = meas_render_service_capture(shot_strip, out);
+  shot_flush(out);
+  return (res == MEAS_OK) ? out->status : res;
+}
+
+// --- Public API ---
+
+meas_status_t meas_screenshot_write(meas_screenshot_format_t format,
+                                    meas_screenshot_write_t write,
+                                    void *user_data) {
+  if (!write)
+    return MEAS_ERROR;
+  shot_out_t out = {.format = format,
+                    .write = write,
+                    .user_data = user_data,
+                    .status = MEAS_OK};
+  return shot_run(&out);
+}
+
+size_t meas_screenshot_size(meas_screenshot_format_t format) {
+  if (format == MEAS_SCREENSHOT_BMP)
+    return BMP_FILE_SIZE;
+  shot_out_t out = {.format = format, .status = MEAS_OK};
+  return (shot_run(&out) == MEAS_OK) ? out.total : 0;
+}
+
+static meas_status_t shot_io_write(void *user_data, const void *data,
+                                   size_t size) {
+  meas_io_t *io = (meas_io_t *)user_data;
+  const meas_io_api_t *api = (const meas_io_api_t *)io->base.api;
+  meas_status_t res = api->send(io, data, size);
+  // send() queues the buffer without copying: drain before it is reused
+  if (res == MEAS_OK && api->flush)
+    res = api->flush(io);
+  return res;
+}
+
+meas_status_t meas_screenshot_to_io(meas_io_t *io,
+                                    meas_screenshot_format_t format) {
+  if (!io || !io->base.api || !((const meas_io_api_t *)io->base.api)->send)
+    return MEAS_ERROR;
+  return meas_screenshot_write(format, shot_io_write, io);
+}
+
+typedef struct {
+  const meas_fs_api_t *fs;
+  meas_file_t *file;
+} shot_file_t;
+
+static meas_status_t shot_file_write(void *user_data, const void *data,
+                                     size_t size) {
+  shot_file_t *f = (shot_file_t *)user_data;
+  return f->fs->write(f->file, data, size);
+}
+
+meas_status_t meas_screenshot_to_file(const meas_fs_api_t *fs,
+                                      meas_file_t *file,
+                                      meas_screenshot_format_t format) {
+  if (!fs || !fs->write || !file)
+    return MEAS_ERROR;
+  shot_file_t f = {.fs = fs, .file = file};
+  return meas_screenshot_write(format, shot_file_write, &f);
+}
@@ -9,11 +9,11 @@
 #include "measlib/sys/shell_service.h"
 #include "measlib/drivers/hal.h"
 #include "measlib/sys/scpi/scpi_core.h"
+#include "measlib/sys/scpi/scpi_def.h"
 #include <stddef.h>
 #include <string.h>
 
-// Extern declaration for command tree initialization
-void scpi_def_init(void);
+#define TX_MASK ((uint16_t)(MEAS_SHELL_TX_SIZE - 1U))
 
 static struct {
   const meas_hal_link_api_t *link;
@@ -22,22 +22,99 @@ static struct {
   scpi_context_t scpi_ctx;
   char scpi_line_buf[128];
   char rx_buf[64];
+  size_t rx_len; // Bytes received
+  size_t rx_pos; // Bytes fed to SCPI
+  // Transmit ring: SCPI writes at head, the link completes at tail
+  uint8_t tx_buf[MEAS_SHELL_TX_SIZE];
+  volatile uint16_t tx_head; // Free-running indices
+  volatile uint16_t tx_tail;
+  volatile bool tx_busy; // Transfer in flight
+  volatile bool tx_flush; // Responses complete: send partial packets too
 } shell_ctx;
 
+// --- Transmit Ring ---
+
+static size_t shell_tx_used(void) {
+  return (uint16_t)(shell_ctx.tx_head - shell_ctx.tx_tail);
+}
+
+static size_t shell_tx_put(const char *data, size_t len) {
+  size_t room = MEAS_SHELL_TX_SIZE - shell_tx_used();
+  if (len > room)
+    len = room;
+  size_t off = shell_ctx.tx_head & TX_MASK;
+  size_t first = MEAS_SHELL_TX_SIZE - off;
+  if (first > len)
+    first = len;
+  memcpy(&shell_ctx.tx_buf[off], data, first);
+  memcpy(shell_ctx.tx_buf, data + first, len - first);
+  shell_ctx.tx_head = (uint16_t)(shell_ctx.tx_head + len);
+  return len;
+}
+
+static void shell_tx_kick(void);
+
+// Endpoint-complete interrupt (or inline, for links that finish at once)
+static void shell_tx_done(void *user, size_t sent) {
+  (void)user;
+  shell_ctx.tx_tail = (uint16_t)(shell_ctx.tx_tail + sent);
+  shell_ctx.tx_busy = false;
+  shell_tx_kick(); // Chain the next packet without waiting for the poll
+}
+
+// Start the next transfer: full packets, or whatever is left once flushed
+static void shell_tx_kick(void) {
+  const meas_hal_link_api_t *link = shell_ctx.link;
+  while (!shell_ctx.tx_busy) {
+    size_t used = shell_tx_used();
+    if (used == 0 || (used < MEAS_SHELL_TX_WATERMARK && !shell_ctx.tx_flush))
+      return;
+    size_t off = shell_ctx.tx_tail & TX_MASK;
+    size_t n = MEAS_SHELL_TX_SIZE - off; // Contiguous part
+    if (n > used)
+      n = used;
+    if (n > MEAS_SHELL_TX_CHUNK)
+      n = MEAS_SHELL_TX_CHUNK;
+
+    if (link->send_async) {
+      shell_ctx.tx_busy = true;
+      if (link->send_async(shell_ctx.ctx, &shell_ctx.tx_buf[off], n,
+                           shell_tx_done, NULL) != MEAS_OK)
+        shell_ctx.tx_busy = false;
+      return;
+    }
+    // Synchronous link: send from the poll loop
+    if (!link->send ||
+        link->send(shell_ctx.ctx, &shell_ctx.tx_buf[off], n) != MEAS_OK)
+      return;
+    shell_ctx.tx_tail = (uint16_t)(shell_ctx.tx_tail + n);
+  }
+}
+
+// Wait until the link took some data; false if it made no progress
+static bool shell_tx_wait(void) {
+  uint16_t tail = shell_ctx.tx_tail;
+  bool flush = shell_ctx.tx_flush;
+  shell_ctx.tx_flush = true;
+  shell_tx_kick();
+  while (shell_ctx.tx_busy) {
+    // The completion interrupt frees the packet
+  }
+  shell_ctx.tx_flush = flush;
+  return shell_ctx.tx_tail != tail;
+}
+
 static size_t shell_scpi_write(scpi_context_t *ctx, const char *data,
                                size_t len) {
-  if (!ctx || !ctx->user_context)
+  if (!ctx || !shell_ctx.link)
     return 0;
 
-  // ctx->user_context is the link_api pointer passed to scpi_init
-  const meas_hal_link_api_t *link_api =
-      (const meas_hal_link_api_t *)ctx->user_context;
-
-  if (link_api && link_api->send) {
-    // We need the link context (shell_ctx.ctx) for the send function
-    return link_api->send(shell_ctx.ctx, (const uint8_t *)data, len);
-  }
-  return 0;
+  size_t done = shell_tx_put(data, len);
+  // Resumable responses take the backpressure; other writers wait for room
+  while (done < len && !ctx->resume && shell_tx_wait())
+    done += shell_tx_put(data + done, len - done);
+  shell_tx_kick();
+  return done;
 }
 
 meas_status_t meas_shell_service_init(const void *link_api, void *ctx) {
@@ -45,6 +122,7 @@ meas_status_t meas_shell_service_init(const void *link_api, void *ctx) {
     return MEAS_ERROR;
   }
 
+  memset(&shell_ctx, 0, sizeof(shell_ctx));
   shell_ctx.link = (const meas_hal_link_api_t *)link_api;
   shell_ctx.ctx = ctx;
 
@@ -59,15 +137,41 @@ meas_status_t meas_shell_service_init(const void *link_api, void *ctx) {
 }
 
 void meas_shell_service_poll(void) {
-  if (!shell_ctx.link || !shell_ctx.link->recv)
+  if (!shell_ctx.link)
     return;
+  scpi_context_t *scpi = &shell_ctx.scpi_ctx;
+  shell_ctx.tx_flush = false;
 
-  size_t read_len = 0;
-  meas_status_t status = shell_ctx.link->recv(
-      shell_ctx.ctx, shell_ctx.rx_buf, sizeof(shell_ctx.rx_buf), &read_len);
+  // Overlapped operations (file stores) advance in the background
+  scpi_def_poll();
 
-  if (status == MEAS_OK && read_len > 0) {
-    // Process through SCPI
-    scpi_process(&shell_ctx.scpi_ctx, shell_ctx.rx_buf, read_len);
+  // Read more input once the previous chunk is queued
+  if (shell_ctx.rx_pos == shell_ctx.rx_len && shell_ctx.link->recv) {
+    size_t read_len = 0;
+    shell_ctx.rx_pos = 0;
+    shell_ctx.rx_len = 0;
+    if (shell_ctx.link->recv(shell_ctx.ctx, shell_ctx.rx_buf,
+                             sizeof(shell_ctx.rx_buf),
+                             &read_len) == MEAS_OK &&
+        read_len <= sizeof(shell_ctx.rx_buf))
+      shell_ctx.rx_len = read_len;
   }
+
+  // Parse input even while a unit is pending; only a full queue stops it
+  if (shell_ctx.rx_pos < shell_ctx.rx_len)
+    shell_ctx.rx_pos +=
+        scpi_receive(scpi, shell_ctx.rx_buf + shell_ctx.rx_pos,
+                     shell_ctx.rx_len - shell_ctx.rx_pos);
+
+  // Continue a pending unit; start new ones while the ring has room for a
+  // short reply
+  if (scpi_busy(scpi) ||
+      MEAS_SHELL_TX_SIZE - shell_tx_used() >= MEAS_SHELL_TX_CHUNK)
+    scpi_execute(scpi);
+
+  // Finished responses go out now; a pending one waits for full packets
+  shell_ctx.tx_flush = !scpi_busy(scpi);
+  shell_tx_kick();
 }
+
+size_t meas_shell_service_tx_pending(void) { return shell_tx_used(); }
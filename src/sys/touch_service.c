@@ -4,53 +4,83 @@
  *
  * @author Architected by momentics <momentics@gmail.com>
  * @copyright (c) 2026 momentics
+ *
+ * Samples the panel once per poll and runs the gesture recognizer. Movement
+ * steps are coalesced in the event queue, so a slow consumer sees one summed
+ * delta instead of a backlog.
  */
 
 #include "measlib/sys/touch_service.h"
 #include "measlib/core/event.h"
+#include "measlib/drivers/api.h"
+#include "measlib/ui/gesture.h"
 #include <stddef.h>
 
 static struct {
   const meas_hal_touch_api_t *api;
   void *ctx;
-  bool was_pressed;
+  meas_gesture_t gesture;
 } touch_srv;
 
+static bool touch_is_step(meas_gesture_kind_t kind) {
+  return kind == MEAS_GESTURE_DRAG || kind == MEAS_GESTURE_ZOOM ||
+         kind == MEAS_GESTURE_SCROLL;
+}
+
+static int16_t touch_sat_add(int16_t a, int16_t b) {
+  int32_t s = (int32_t)a + b;
+  if (s > INT16_MAX)
+    return INT16_MAX;
+  if (s < INT16_MIN)
+    return INT16_MIN;
+  return (int16_t)s;
+}
+
+// Fold a movement step into a pending step of the same kind
+static bool touch_merge(meas_event_t *queued, const meas_event_t *ev) {
+  if (queued->type != EVENT_INPUT_GESTURE || ev->type != EVENT_INPUT_GESTURE)
+    return false;
+
+  meas_gesture_event_t a, b;
+  meas_gesture_unpack(queued->payload.i_val, &a);
+  meas_gesture_unpack(ev->payload.i_val, &b);
+  if (a.kind != b.kind || !touch_is_step(b.kind))
+    return false;
+
+  b.dx = touch_sat_add(a.dx, b.dx);
+  b.dy = touch_sat_add(a.dy, b.dy);
+  queued->payload.i_val = meas_gesture_pack(&b);
+  return true;
+}
+
+static void touch_sink(const meas_gesture_event_t *gev, void *user_data) {
+  (void)user_data;
+  meas_event_t ev = {.type = EVENT_INPUT_GESTURE,
+                     .source = NULL,
+                     .payload = {.type = PROP_TYPE_INT64,
+                                 .i_val = meas_gesture_pack(gev)}};
+  if (touch_is_step(gev->kind))
+    meas_event_publish_coalesced(ev, touch_merge);
+  else
+    meas_event_publish(ev);
+}
+
 void meas_touch_service_init(const meas_hal_touch_api_t *api, void *ctx) {
   touch_srv.api = api;
   touch_srv.ctx = ctx;
-  touch_srv.was_pressed = false;
+  meas_gesture_init(&touch_srv.gesture, NULL, touch_sink, NULL);
 }
 
 void meas_touch_service_poll(void) {
   if (!touch_srv.api || !touch_srv.api->read_point)
     return;
 
+  uint32_t now = sys_get_tick();
+
   meas_point_t pt = {0};
   // read_point returns MEAS_OK if touched/valid
   meas_status_t status = touch_srv.api->read_point(touch_srv.ctx, &pt);
 
-  if (status == MEAS_OK) {
-    // Touch Detected
-    // Pack coordinates: X (low 16), Y (high 16)
-    // Using int64 i_val
-    int64_t payload = ((int64_t)pt.y << 16) | (pt.x & 0xFFFF);
-
-    meas_event_t ev = {.type = EVENT_INPUT_TOUCH,
-                       .source = NULL,
-                       .payload = {.i_val = payload}};
-    meas_event_publish(ev);
-    touch_srv.was_pressed = true;
-  } else {
-    // Release (Optional: Dispatch Release event?)
-    // For now, UI handles Move/Down. Release inferred by absence or specific
-    // event? If we want drag, we need continuous events. If status != MEAS_OK,
-    // it means no touch.
-    if (touch_srv.was_pressed) {
-      // Send special "Release" coordinate? Or separate event type?
-      // current event type is generic.
-      // Simple: Just stop sending. UI handles timeout or loss.
-      touch_srv.was_pressed = false;
-    }
-  }
+  meas_gesture_feed(&touch_srv.gesture, (status == MEAS_OK) ? &pt : NULL, now);
+  meas_gesture_tick(&touch_srv.gesture, now);
 }
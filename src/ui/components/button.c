@@ -0,0 +1,89 @@
+/**
+ * @file button.c
+ * @brief Push Button Widget.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/ui/components/button.h"
+#include "measlib/ui/colors.h"
+#include <stddef.h>
+
+#define BUTTON_RADIUS 4
+
+static void button_draw(const meas_widget_t *w, meas_render_ctx_t *ctx,
+                        const meas_render_api_t *api) {
+  const meas_button_t *b = (const meas_button_t *)w;
+  bool pressed = (w->flags & MEAS_WIDGET_PRESSED) != 0;
+
+  ctx->fg_color =
+      pressed ? meas_ui_theme_default[MEAS_UI_COLOR_MENU_ACTIVE] : w->bg_color;
+  api->fill_round_rect(ctx, w->bounds, BUTTON_RADIUS, MEAS_ALPHA_OPAQUE);
+  ctx->fg_color = meas_ui_theme_default[pressed ? MEAS_UI_COLOR_FALLEN_EDGE
+                                                : MEAS_UI_COLOR_RISE_EDGE];
+  api->draw_round_rect(ctx, w->bounds, BUTTON_RADIUS, MEAS_ALPHA_OPAQUE);
+
+  if (b->text) {
+    ctx->fg_color = w->fg_color;
+    api->draw_text_rect(ctx, w->bounds, b->text,
+                        MEAS_ALIGN_CENTER | MEAS_ALIGN_VCENTER,
+                        MEAS_ALPHA_OPAQUE);
+  }
+}
+
+static void button_set_pressed(meas_button_t *b, bool pressed) {
+  if (pressed == !!(b->base.flags & MEAS_WIDGET_PRESSED))
+    return;
+  if (pressed)
+    b->base.flags |= MEAS_WIDGET_PRESSED;
+  else
+    b->base.flags &= (uint8_t)~MEAS_WIDGET_PRESSED;
+  meas_widget_invalidate(&b->base);
+}
+
+static bool button_on_gesture(meas_widget_t *w,
+                              const meas_gesture_event_t *ev) {
+  meas_button_t *b = (meas_button_t *)w;
+  switch (ev->kind) {
+  case MEAS_GESTURE_PRESS:
+    button_set_pressed(b, true);
+    return true;
+  case MEAS_GESTURE_RELEASE:
+    button_set_pressed(b, false);
+    return true;
+  case MEAS_GESTURE_TAP:
+    if (b->on_click)
+      b->on_click(b->user_data);
+    return true;
+  case MEAS_GESTURE_DRAG:
+  case MEAS_GESTURE_ZOOM:
+    // Finger slid off: cancel the visual press, let the parent scroll
+    button_set_pressed(b, false);
+    return false;
+  default:
+    return false;
+  }
+}
+
+static const meas_widget_api_t button_api = {.draw = button_draw,
+                                             .on_gesture = button_on_gesture};
+
+void meas_button_init(meas_button_t *b, meas_rect_t bounds, const char *text,
+                      void (*on_click)(void *user_data), void *user_data) {
+  if (!b)
+    return;
+  meas_widget_init(&b->base, &button_api, bounds);
+  b->base.fg_color = meas_ui_theme_default[MEAS_UI_COLOR_MENU_TEXT];
+  b->base.bg_color = meas_ui_theme_default[MEAS_UI_COLOR_MENU];
+  b->text = text;
+  b->on_click = on_click;
+  b->user_data = user_data;
+}
+
+void meas_button_set_text(meas_button_t *b, const char *text) {
+  if (!b || b->text == text)
+    return;
+  b->text = text;
+  meas_widget_invalidate(&b->base);
+}
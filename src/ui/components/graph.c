@@ -0,0 +1,69 @@
+/**
+ * @file graph.c
+ * @brief Trace Graph Widget.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/ui/components/graph.h"
+#include <stddef.h>
+
+static void graph_draw(const meas_widget_t *w, meas_render_ctx_t *ctx,
+                       const meas_render_api_t *api) {
+  const meas_graph_t *g = (const meas_graph_t *)w;
+
+  ctx->fg_color = w->bg_color;
+  api->fill_rect(ctx, w->bounds.x, w->bounds.y, w->bounds.w, w->bounds.h,
+                 MEAS_ALPHA_OPAQUE);
+  if (g->points && g->count > 1) {
+    ctx->fg_color = g->trace_color;
+    api->draw_polyline_aa(ctx, g->points, g->count, MEAS_ALPHA_OPAQUE);
+  }
+}
+
+static bool graph_on_gesture(meas_widget_t *w, const meas_gesture_event_t *ev) {
+  meas_graph_t *g = (meas_graph_t *)w;
+  switch (ev->kind) {
+  case MEAS_GESTURE_PRESS:
+  case MEAS_GESTURE_RELEASE:
+  case MEAS_GESTURE_FLING:
+    return true; // Keep the sequence; movement follows as DRAG/SCROLL
+  case MEAS_GESTURE_DRAG:
+  case MEAS_GESTURE_SCROLL:
+    if (g->on_pan)
+      g->on_pan(g->user_data, ev->dx, ev->dy);
+    return g->on_pan != NULL;
+  case MEAS_GESTURE_ZOOM:
+    if (g->on_zoom)
+      g->on_zoom(g->user_data, ev->dx, ev->dy);
+    return g->on_zoom != NULL;
+  default:
+    return false;
+  }
+}
+
+static const meas_widget_api_t graph_api = {.draw = graph_draw,
+                                            .on_gesture = graph_on_gesture};
+
+void meas_graph_init(meas_graph_t *g, meas_rect_t bounds,
+                     meas_pixel_t trace_color) {
+  if (!g)
+    return;
+  meas_widget_init(&g->base, &graph_api, bounds);
+  g->points = NULL;
+  g->count = 0;
+  g->trace_color = trace_color;
+  g->on_pan = NULL;
+  g->on_zoom = NULL;
+  g->user_data = NULL;
+}
+
+void meas_graph_set_trace(meas_graph_t *g, const meas_point_t *points,
+                          uint16_t count) {
+  if (!g)
+    return;
+  g->points = points;
+  g->count = count;
+  meas_widget_invalidate(&g->base);
+}
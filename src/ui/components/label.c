@@ -0,0 +1,84 @@
+/**
+ * @file label.c
+ * @brief Text Label and Numeric Readout Widgets.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/ui/components/label.h"
+#include <stddef.h>
+#include <string.h>
+
+// --- Label ---
+
+static void label_draw(const meas_widget_t *w, meas_render_ctx_t *ctx,
+                       const meas_render_api_t *api) {
+  const meas_label_t *l = (const meas_label_t *)w;
+  if (!l->text)
+    return;
+  ctx->fg_color = w->fg_color;
+  api->draw_text_rect(ctx, w->bounds, l->text, l->align, MEAS_ALPHA_OPAQUE);
+}
+
+static const meas_widget_api_t label_api = {.draw = label_draw,
+                                            .on_gesture = NULL};
+
+void meas_label_init(meas_label_t *l, meas_rect_t bounds, const char *text,
+                     uint8_t align) {
+  if (!l)
+    return;
+  meas_widget_init(&l->base, &label_api, bounds);
+  l->base.flags &= (uint8_t)~MEAS_WIDGET_ENABLED; // Passive
+  l->text = text;
+  l->align = align;
+}
+
+void meas_label_set_text(meas_label_t *l, const char *text) {
+  if (!l || l->text == text)
+    return;
+  bool same = l->text && text && strcmp(l->text, text) == 0;
+  l->text = text;
+  if (!same)
+    meas_widget_invalidate(&l->base);
+}
+
+// --- Readout ---
+
+static void readout_draw(const meas_widget_t *w, meas_render_ctx_t *ctx,
+                         const meas_render_api_t *api) {
+  const meas_readout_t *r = (const meas_readout_t *)w;
+  ctx->fg_color = w->fg_color;
+
+  // Number left, unit right: digits never shift as the unit width varies
+  api->draw_number(ctx, w->bounds.x, w->bounds.y, r->value, r->decimals,
+                   MEAS_ALPHA_OPAQUE);
+  if (r->unit) {
+    int16_t unit_w = api->get_text_width(ctx, r->unit);
+    api->draw_text(ctx, w->bounds.x + w->bounds.w - unit_w, w->bounds.y,
+                   r->unit, MEAS_ALPHA_OPAQUE);
+  }
+}
+
+static const meas_widget_api_t readout_api = {.draw = readout_draw,
+                                              .on_gesture = NULL};
+
+void meas_readout_init(meas_readout_t *r, meas_rect_t bounds,
+                       uint8_t decimals, const char *unit) {
+  if (!r)
+    return;
+  meas_widget_init(&r->base, &readout_api, bounds);
+  r->base.flags &= (uint8_t)~MEAS_WIDGET_ENABLED; // Passive
+  r->value = 0;
+  r->decimals =
+      (decimals > MEAS_NUMBER_MAX_DECIMALS) ? MEAS_NUMBER_MAX_DECIMALS
+                                            : decimals;
+  r->unit = unit;
+}
+
+void meas_readout_set_value(meas_readout_t *r, int32_t value) {
+  if (!r || r->value == value)
+    return;
+  r->value = value;
+  meas_widget_invalidate(&r->base);
+}
@@ -0,0 +1,172 @@
+/**
+ * @file menu_view.c
+ * @brief Menu List Widget.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/ui/components/menu_view.h"
+#include "measlib/ui/colors.h"
+#include <stddef.h>
+
+#define MENU_TEXT_PAD 4
+
+static uint8_t menu_count(const meas_menu_item_t *items) {
+  uint8_t n = 0;
+  while (items && items[n].label && n < UINT8_MAX)
+    n++;
+  return n;
+}
+
+static meas_rect_t menu_row_rect(const meas_menu_view_t *m, uint8_t row) {
+  return (meas_rect_t){m->base.bounds.x,
+                       (int16_t)(m->base.bounds.y + row * m->item_h),
+                       m->base.bounds.w, m->item_h};
+}
+
+static void menu_draw(const meas_widget_t *w, meas_render_ctx_t *ctx,
+                      const meas_render_api_t *api) {
+  const meas_menu_view_t *m = (const meas_menu_view_t *)w;
+  if (m->item_h <= 0)
+    return;
+
+  // Rows reachable in this pass (tile band within the clip)
+  meas_rect_t clip = api->get_clip_rect(ctx);
+  int16_t y0 = (clip.y > ctx->y_offset) ? clip.y : ctx->y_offset;
+  int16_t y1 = clip.y + clip.h;
+  if (y1 > ctx->y_offset + ctx->height)
+    y1 = ctx->y_offset + ctx->height;
+  int16_t first = (y0 - w->bounds.y) / m->item_h;
+  int16_t last = (y1 - 1 - w->bounds.y) / m->item_h;
+  if (first < 0)
+    first = 0;
+  if (last >= m->count)
+    last = (int16_t)m->count - 1;
+
+  for (int16_t row = first; row <= last; row++) {
+    const meas_menu_item_t *item = &m->items[row];
+    meas_rect_t r = menu_row_rect(m, (uint8_t)row);
+
+    ctx->fg_color = (row == m->selected)
+                        ? meas_ui_theme_default[MEAS_UI_COLOR_MENU_ACTIVE]
+                        : w->bg_color;
+    api->fill_rect(ctx, r.x, r.y, r.w, r.h, MEAS_ALPHA_OPAQUE);
+    ctx->fg_color = meas_ui_theme_default[MEAS_UI_COLOR_FALLEN_EDGE];
+    api->fill_rect(ctx, r.x, r.y + r.h - 1, r.w, 1, MEAS_ALPHA_OPAQUE);
+
+    meas_rect_t text = {r.x + MENU_TEXT_PAD, r.y, r.w - 2 * MENU_TEXT_PAD,
+                        r.h};
+    ctx->fg_color = w->fg_color;
+    api->draw_text_rect(ctx, text, item->label, MEAS_ALIGN_VCENTER,
+                        MEAS_ALPHA_OPAQUE);
+
+    const char *hint = NULL;
+    if (item->type == MENU_ITEM_SUBMENU)
+      hint = ">";
+    else if (item->type == MENU_ITEM_TOGGLE && item->toggle.check_target)
+      hint = *item->toggle.check_target ? "[x]" : "[ ]";
+    if (hint) {
+      ctx->fg_color = meas_ui_theme_default[MEAS_UI_COLOR_LINK];
+      api->draw_text_rect(ctx, text, hint,
+                          MEAS_ALIGN_RIGHT | MEAS_ALIGN_VCENTER,
+                          MEAS_ALPHA_OPAQUE);
+    }
+  }
+}
+
+static void menu_enter(meas_menu_view_t *m, const meas_menu_item_t *items,
+                       uint8_t selected) {
+  m->items = items;
+  m->count = menu_count(items);
+  m->selected = (selected < m->count) ? selected : 0;
+  meas_widget_invalidate(&m->base);
+}
+
+void meas_menu_view_set_selected(meas_menu_view_t *m, uint8_t index) {
+  if (!m || index >= m->count || index == m->selected)
+    return;
+  meas_widget_invalidate_rect(&m->base, menu_row_rect(m, m->selected));
+  m->selected = index;
+  meas_widget_invalidate_rect(&m->base, menu_row_rect(m, index));
+}
+
+void meas_menu_view_activate(meas_menu_view_t *m) {
+  if (!m || m->selected >= m->count)
+    return;
+  const meas_menu_item_t *item = &m->items[m->selected];
+
+  switch (item->type) {
+  case MENU_ITEM_ACTION:
+    if (item->action)
+      item->action(m->user_data);
+    break;
+  case MENU_ITEM_TOGGLE:
+    if (item->toggle.check_target) {
+      *item->toggle.check_target = !*item->toggle.check_target;
+      meas_widget_invalidate_rect(&m->base, menu_row_rect(m, m->selected));
+    }
+    break;
+  case MENU_ITEM_SUBMENU:
+    if (item->submenu && m->depth < MEAS_MENU_VIEW_DEPTH) {
+      m->stack[m->depth] = m->items;
+      m->stack_sel[m->depth] = m->selected;
+      m->depth++;
+      menu_enter(m, item->submenu, 0);
+    }
+    break;
+  case MENU_ITEM_EDIT_NUM:
+    if (m->on_edit)
+      m->on_edit(m->user_data, item);
+    break;
+  }
+}
+
+bool meas_menu_view_back(meas_menu_view_t *m) {
+  if (!m || m->depth == 0)
+    return false;
+  m->depth--;
+  menu_enter(m, m->stack[m->depth], m->stack_sel[m->depth]);
+  return true;
+}
+
+static bool menu_on_gesture(meas_widget_t *w, const meas_gesture_event_t *ev) {
+  meas_menu_view_t *m = (meas_menu_view_t *)w;
+  switch (ev->kind) {
+  case MEAS_GESTURE_TAP: {
+    int16_t row = (ev->y - w->bounds.y) / m->item_h;
+    if (row < 0 || row >= m->count)
+      return true;
+    meas_menu_view_set_selected(m, (uint8_t)row);
+    meas_menu_view_activate(m);
+    return true;
+  }
+  case MEAS_GESTURE_LONG_PRESS:
+    meas_menu_view_back(m);
+    return true;
+  case MEAS_GESTURE_PRESS:
+  case MEAS_GESTURE_RELEASE:
+    return true;
+  default:
+    return false;
+  }
+}
+
+static const meas_widget_api_t menu_view_api = {.draw = menu_draw,
+                                                .on_gesture = menu_on_gesture};
+
+void meas_menu_view_init(meas_menu_view_t *m, meas_rect_t bounds,
+                         const meas_menu_item_t *items, int16_t item_h) {
+  if (!m)
+    return;
+  meas_widget_init(&m->base, &menu_view_api, bounds);
+  m->base.fg_color = meas_ui_theme_default[MEAS_UI_COLOR_MENU_TEXT];
+  m->base.bg_color = meas_ui_theme_default[MEAS_UI_COLOR_MENU];
+  m->depth = 0;
+  m->item_h = (item_h > 0) ? item_h : 1;
+  m->user_data = NULL;
+  m->on_edit = NULL;
+  m->items = items;
+  m->count = menu_count(items);
+  m->selected = 0;
+}
@@ -0,0 +1,279 @@
+/**
+ * @file widget.c
+ * @brief Retained Widget Tree.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/ui/components/widget.h"
+#include <stddef.h>
+
+// --- Geometry ---
+
+static inline bool rect_contains(const meas_rect_t *r, int16_t x, int16_t y) {
+  return x >= r->x && y >= r->y && x < r->x + r->w && y < r->y + r->h;
+}
+
+static inline bool rect_overlaps(const meas_rect_t *a, const meas_rect_t *b) {
+  return a->x < b->x + b->w && b->x < a->x + a->w && a->y < b->y + b->h &&
+         b->y < a->y + a->h;
+}
+
+// --- Built-in Containers ---
+
+static void panel_draw(const meas_widget_t *w, meas_render_ctx_t *ctx,
+                       const meas_render_api_t *api) {
+  ctx->fg_color = w->bg_color;
+  api->fill_rect(ctx, w->bounds.x, w->bounds.y, w->bounds.w, w->bounds.h,
+                 MEAS_ALPHA_OPAQUE);
+}
+
+const meas_widget_api_t meas_widget_container_api = {.draw = NULL,
+                                                     .on_gesture = NULL};
+
+const meas_widget_api_t meas_widget_panel_api = {.draw = panel_draw,
+                                                 .on_gesture = NULL};
+
+// --- Nodes ---
+
+void meas_widget_init(meas_widget_t *w, const meas_widget_api_t *api,
+                      meas_rect_t bounds) {
+  if (!w)
+    return;
+  *w = (meas_widget_t){0};
+  w->api = api;
+  w->bounds = bounds;
+  w->flags = MEAS_WIDGET_VISIBLE | MEAS_WIDGET_ENABLED;
+  w->fg_color = 0xFFFF;
+  w->bg_color = 0x0000;
+}
+
+bool meas_widget_is_shown(const meas_widget_t *w) {
+  for (; w; w = w->parent) {
+    if (!(w->flags & MEAS_WIDGET_VISIBLE))
+      return false;
+  }
+  return true;
+}
+
+void meas_widget_invalidate_rect(const meas_widget_t *w, meas_rect_t rect) {
+  if (!w || !w->tree || !w->tree->ui || !meas_widget_is_shown(w))
+    return;
+
+  // Clip to the widget: a part never dirties more than the whole
+  int16_t x0 = (rect.x > w->bounds.x) ? rect.x : w->bounds.x;
+  int16_t y0 = (rect.y > w->bounds.y) ? rect.y : w->bounds.y;
+  int16_t x1 = rect.x + rect.w;
+  int16_t y1 = rect.y + rect.h;
+  if (x1 > w->bounds.x + w->bounds.w)
+    x1 = w->bounds.x + w->bounds.w;
+  if (y1 > w->bounds.y + w->bounds.h)
+    y1 = w->bounds.y + w->bounds.h;
+  if (x0 >= x1 || y0 >= y1)
+    return;
+  meas_ui_invalidate_rect(w->tree->ui, x0, y0, x1 - x0, y1 - y0);
+}
+
+void meas_widget_invalidate(const meas_widget_t *w) {
+  if (w)
+    meas_widget_invalidate_rect(w, w->bounds);
+}
+
+static void widget_set_tree(meas_widget_t *w, meas_widget_tree_t *tree) {
+  w->tree = tree;
+  for (meas_widget_t *c = w->first_child; c; c = c->next)
+    widget_set_tree(c, tree);
+}
+
+static bool widget_is_ancestor(const meas_widget_t *a, const meas_widget_t *w) {
+  for (; w; w = w->parent) {
+    if (w == a)
+      return true;
+  }
+  return false;
+}
+
+void meas_widget_remove(meas_widget_t *w) {
+  if (!w || !w->parent)
+    return;
+  meas_widget_invalidate(w);
+
+  meas_widget_t *p = w->parent;
+  if (w->prev)
+    w->prev->next = w->next;
+  else
+    p->first_child = w->next;
+  if (w->next)
+    w->next->prev = w->prev;
+  else
+    p->last_child = w->prev;
+
+  if (w->tree && w->tree->capture && widget_is_ancestor(w, w->tree->capture))
+    w->tree->capture = NULL;
+
+  w->parent = NULL;
+  w->prev = NULL;
+  w->next = NULL;
+  widget_set_tree(w, NULL);
+}
+
+void meas_widget_add(meas_widget_t *parent, meas_widget_t *child) {
+  if (!parent || !child || child == parent)
+    return;
+  meas_widget_remove(child);
+
+  child->parent = parent;
+  child->prev = parent->last_child;
+  child->next = NULL;
+  if (parent->last_child)
+    parent->last_child->next = child;
+  else
+    parent->first_child = child;
+  parent->last_child = child;
+
+  widget_set_tree(child, parent->tree);
+  meas_widget_invalidate(child);
+}
+
+void meas_widget_set_bounds(meas_widget_t *w, meas_rect_t bounds) {
+  if (!w)
+    return;
+  if (w->bounds.x == bounds.x && w->bounds.y == bounds.y &&
+      w->bounds.w == bounds.w && w->bounds.h == bounds.h)
+    return;
+  meas_widget_invalidate(w); // Old area
+  w->bounds = bounds;
+  meas_widget_invalidate(w); // New area
+}
+
+void meas_widget_set_visible(meas_widget_t *w, bool visible) {
+  if (!w || visible == !!(w->flags & MEAS_WIDGET_VISIBLE))
+    return;
+  if (visible) {
+    w->flags |= MEAS_WIDGET_VISIBLE;
+    meas_widget_invalidate(w);
+  } else {
+    meas_widget_invalidate(w);
+    w->flags &= (uint8_t)~MEAS_WIDGET_VISIBLE;
+  }
+}
+
+void meas_widget_set_enabled(meas_widget_t *w, bool enabled) {
+  if (!w || enabled == !!(w->flags & MEAS_WIDGET_ENABLED))
+    return;
+  if (enabled)
+    w->flags |= MEAS_WIDGET_ENABLED;
+  else
+    w->flags &= (uint8_t)~(MEAS_WIDGET_ENABLED | MEAS_WIDGET_PRESSED);
+  meas_widget_invalidate(w);
+}
+
+void meas_widget_set_colors(meas_widget_t *w, meas_pixel_t fg,
+                            meas_pixel_t bg) {
+  if (!w || (w->fg_color == fg && w->bg_color == bg))
+    return;
+  w->fg_color = fg;
+  w->bg_color = bg;
+  meas_widget_invalidate(w);
+}
+
+// --- Tree ---
+
+void meas_widget_tree_init(meas_widget_tree_t *tree, meas_ui_t *ui) {
+  if (!tree)
+    return;
+  meas_widget_init(&tree->root, &meas_widget_container_api,
+                   (meas_rect_t){0, 0, MEAS_UI_SCREEN_WIDTH,
+                                 MEAS_UI_SCREEN_HEIGHT});
+  tree->root.tree = tree;
+  tree->ui = ui;
+  tree->capture = NULL;
+  if (ui)
+    ui->widgets = tree;
+}
+
+static void widget_draw(const meas_widget_t *w, meas_render_ctx_t *ctx,
+                        const meas_render_api_t *api,
+                        const meas_rect_t *area) {
+  if (!(w->flags & MEAS_WIDGET_VISIBLE) || !rect_overlaps(&w->bounds, area))
+    return;
+
+  if (w->api && w->api->draw) {
+    const meas_font_t *font = ctx->font;
+    meas_pixel_t fg = ctx->fg_color;
+    meas_pixel_t bg = ctx->bg_color;
+    if (w->font)
+      ctx->font = w->font;
+    ctx->bg_color = w->bg_color;
+
+    api->push_clip_rect(ctx, w->bounds);
+    w->api->draw(w, ctx, api);
+    api->pop_clip_rect(ctx);
+
+    ctx->font = font;
+    ctx->fg_color = fg;
+    ctx->bg_color = bg;
+  }
+
+  for (const meas_widget_t *c = w->first_child; c; c = c->next)
+    widget_draw(c, ctx, api, area);
+}
+
+void meas_widget_tree_draw(const meas_widget_tree_t *tree,
+                           meas_render_ctx_t *ctx,
+                           const meas_render_api_t *api) {
+  if (!tree || !ctx || !api)
+    return;
+
+  // Area reachable in this pass: the tile rows within the clip
+  meas_rect_t area = ctx->clip_rect;
+  int16_t y0 = ctx->y_offset;
+  int16_t y1 = ctx->y_offset + ctx->height;
+  if (area.y < y0) {
+    area.h -= y0 - area.y;
+    area.y = y0;
+  }
+  if (area.y + area.h > y1)
+    area.h = y1 - area.y;
+  if (area.w <= 0 || area.h <= 0)
+    return;
+
+  widget_draw(&tree->root, ctx, api, &area);
+}
+
+meas_widget_t *meas_widget_hit_test(meas_widget_t *root, int16_t x,
+                                    int16_t y) {
+  if (!root || !(root->flags & MEAS_WIDGET_VISIBLE) ||
+      !rect_contains(&root->bounds, x, y))
+    return NULL;
+
+  // Top of the z-order first; children lie within their parent
+  for (meas_widget_t *c = root->last_child; c; c = c->prev) {
+    meas_widget_t *hit = meas_widget_hit_test(c, x, y);
+    if (hit)
+      return hit;
+  }
+  return (root->flags & MEAS_WIDGET_ENABLED) ? root : NULL;
+}
+
+static bool widget_deliver(meas_widget_t *w, const meas_gesture_event_t *ev) {
+  for (; w; w = w->parent) {
+    if ((w->flags & MEAS_WIDGET_ENABLED) && w->api && w->api->on_gesture &&
+        w->api->on_gesture(w, ev))
+      return true;
+  }
+  return false;
+}
+
+bool meas_widget_tree_dispatch(meas_widget_tree_t *tree,
+                               const meas_gesture_event_t *ev) {
+  if (!tree || !ev)
+    return false;
+
+  // The touched widget keeps the sequence, including inertia after release
+  if (ev->kind == MEAS_GESTURE_PRESS)
+    tree->capture = meas_widget_hit_test(&tree->root, ev->x, ev->y);
+
+  return widget_deliver(tree->capture, ev);
+}
@@ -8,11 +8,9 @@
 
 #include "measlib/ui/core.h"
 
-// Define Tile Height locally or import?
-// Ideally should be shared config. For now using static const or #define to
-// match render_service.
-#define UI_TILE_HEIGHT 8
-#define UI_SCREEN_HEIGHT 240
+// Screen geometry shared with the Render Service (see core.h)
+#define UI_TILE_HEIGHT MEAS_UI_TILE_HEIGHT
+#define UI_SCREEN_HEIGHT MEAS_UI_SCREEN_HEIGHT
 
 void meas_ui_tick(meas_ui_t *ui) {
   if (!ui)
@@ -46,14 +44,20 @@ void meas_ui_invalidate_rect(meas_ui_t *ui, int16_t x, int16_t y, int16_t w,
 
   // 3. Set Bits
   for (int16_t i = start_tile; i <= end_tile; i++) {
-    if (i < 32) { // Safety for 32-bit mask
-      ui->dirty_map |= (1U << i);
-    }
+    ui->dirty_map |= (1U << i);
   }
 }
 
 void meas_ui_force_redraw(meas_ui_t *ui) {
   if (ui) {
-    ui->dirty_map = 0xFFFFFFFF;
+    // Only real tiles; stray high bits would never be cleared by the renderer
+    ui->dirty_map = 0xFFFFFFFFU >> (32 - MEAS_UI_TILE_COUNT);
+  }
+}
+
+void meas_ui_invalidate_static(meas_ui_t *ui) {
+  if (ui) {
+    ui->static_dirty = true;
+    meas_ui_force_redraw(ui);
   }
 }
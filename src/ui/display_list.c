@@ -0,0 +1,811 @@
+/**
+ * @file display_list.c
+ * @brief Display List Recording, Binning and Replay.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Implements `meas_render_dl_api`: each primitive becomes one fixed-size
+ * command tagged with the screen rows it can touch (already intersected with
+ * the clip rect). Primitives that fall fully outside the screen or the clip
+ * are culled at record time. meas_dl_end() sorts the commands into per-tile
+ * lists; replay restores the captured state and forwards the call to the real
+ * rasterizer.
+ */
+
+#include "measlib/ui/display_list.h"
+#include <string.h>
+
+// Software rasterizer (metrics and clip stack helpers are state-only)
+extern const meas_render_api_t meas_render_cell_api;
+
+// --- Opcodes ---
+
+typedef enum {
+  DL_OP_PIXEL,
+  DL_OP_LINE,
+  DL_OP_POLYLINE,
+  DL_OP_FILL_RECT,
+  DL_OP_FILL_POLYGON,
+  DL_OP_BLIT,
+  DL_OP_TEXT,
+  DL_OP_GRADIENT_V,
+  DL_OP_GRADIENT_H,
+  DL_OP_DRAW_RECT,
+  DL_OP_DRAW_CIRCLE,
+  DL_OP_FILL_CIRCLE,
+  DL_OP_DRAW_ROUND_RECT,
+  DL_OP_FILL_ROUND_RECT,
+  DL_OP_TEXT_ROTATED,
+  DL_OP_TEXT_ALIGNED,
+  DL_OP_TEXT_RECT,
+  DL_OP_INVERT_RECT,
+  DL_OP_LINE_PATT,
+  DL_OP_LINE_THICK,
+  DL_OP_FILL_TRIANGLE,
+  DL_OP_DRAW_TRIANGLE,
+  DL_OP_ARC,
+  DL_OP_PIE,
+  DL_OP_MINMAX_V,
+  DL_OP_POLYLINE_AA,
+  DL_OP_NUMBER
+} meas_dl_op_t;
+
+// Active recording target (one frame is recorded at a time)
+static meas_dl_t *rec_dl = NULL;
+
+// --- Recording Helpers ---
+
+static inline int16_t dl_min(int16_t a, int16_t b) { return (a < b) ? a : b; }
+static inline int16_t dl_max(int16_t a, int16_t b) { return (a > b) ? a : b; }
+
+/**
+ * @brief Allocate a command covering rows [y_min, y_max].
+ * @return Command slot, or NULL if culled or out of capacity.
+ */
+static meas_dl_cmd_t *dl_emit(meas_render_ctx_t *ctx, uint8_t op,
+                              int16_t y_min, int16_t y_max, uint8_t alpha) {
+  if (!rec_dl || !ctx || rec_dl->overflow)
+    return NULL;
+
+  // Cull against clip rect and screen
+  const meas_rect_t *clip = &ctx->clip_rect;
+  if (clip->w <= 0 || clip->h <= 0)
+    return NULL;
+  int16_t lo = dl_max(y_min, dl_max(clip->y, 0));
+  int16_t hi = dl_min(y_max, dl_min(clip->y + clip->h - 1, ctx->height - 1));
+  if (lo > hi)
+    return NULL;
+
+  if (rec_dl->cmd_count >= MEAS_DL_MAX_CMDS) {
+    rec_dl->overflow = true;
+    return NULL;
+  }
+
+  meas_dl_cmd_t *cmd = &rec_dl->cmds[rec_dl->cmd_count++];
+  memset(cmd, 0, sizeof(*cmd));
+  cmd->op = op;
+  cmd->alpha = alpha;
+  cmd->y_min = lo;
+  cmd->y_max = hi;
+  cmd->fg_color = ctx->fg_color;
+  cmd->bg_color = ctx->bg_color;
+  cmd->clip_rect = ctx->clip_rect;
+  cmd->font = ctx->font;
+  return cmd;
+}
+
+/**
+ * @brief Copy caller data into the arena (4-byte aligned).
+ * @return Arena copy, or NULL (and overflow flagged) if it does not fit.
+ */
+static const void *dl_copy(const void *src, size_t size) {
+  size_t offset = (rec_dl->arena_used + 3U) & ~(size_t)3U;
+  if (offset + size > MEAS_DL_ARENA_SIZE) {
+    rec_dl->overflow = true;
+    return NULL;
+  }
+  memcpy(&rec_dl->arena[offset], src, size);
+  rec_dl->arena_used = (uint16_t)(offset + size);
+  return &rec_dl->arena[offset];
+}
+
+// Short point lists are copied (often on the caller's stack); long ones are
+// traces owned by the caller and kept by reference
+static const meas_point_t *dl_points(const meas_point_t *points,
+                                     uint16_t count) {
+  if (count > MEAS_DL_INLINE_POINTS)
+    return points;
+  return (const meas_point_t *)dl_copy(points, count * sizeof(meas_point_t));
+}
+
+static void dl_points_range(const meas_point_t *points, uint16_t count,
+                            int16_t *y_min, int16_t *y_max) {
+  *y_min = points[0].y;
+  *y_max = points[0].y;
+  for (uint16_t i = 1; i < count; i++) {
+    *y_min = dl_min(*y_min, points[i].y);
+    *y_max = dl_max(*y_max, points[i].y);
+  }
+}
+
+// Glyph rows touched by a single text line (5x7 glyphs occupy an 8-row cell)
+static int16_t dl_text_height(const meas_render_ctx_t *ctx) {
+  return (ctx->font->height > 8) ? ctx->font->height : 8;
+}
+
+// --- Recording Primitives ---
+
+static void dl_draw_pixel(meas_render_ctx_t *ctx, int16_t x, int16_t y,
+                          uint8_t alpha) {
+  meas_dl_cmd_t *cmd = dl_emit(ctx, DL_OP_PIXEL, y, y, alpha);
+  if (cmd) {
+    cmd->args[0] = x;
+    cmd->args[1] = y;
+  }
+}
+
+static meas_pixel_t dl_get_pixel(meas_render_ctx_t *ctx, int16_t x,
+                                 int16_t y) {
+  (void)x;
+  (void)y;
+  // Target is not materialized while recording
+  return ctx ? ctx->bg_color : 0;
+}
+
+static void dl_record_line(meas_render_ctx_t *ctx, uint8_t op, int16_t x0,
+                           int16_t y0, int16_t x1, int16_t y1, int16_t grow,
+                           uint16_t extra, uint8_t alpha) {
+  meas_dl_cmd_t *cmd = dl_emit(ctx, op, dl_min(y0, y1) - grow,
+                               dl_max(y0, y1) + grow, alpha);
+  if (cmd) {
+    cmd->args[0] = x0;
+    cmd->args[1] = y0;
+    cmd->args[2] = x1;
+    cmd->args[3] = y1;
+    cmd->count = extra;
+  }
+}
+
+static void dl_draw_line(meas_render_ctx_t *ctx, int16_t x0, int16_t y0,
+                         int16_t x1, int16_t y1, uint8_t alpha) {
+  dl_record_line(ctx, DL_OP_LINE, x0, y0, x1, y1, 0, 0, alpha);
+}
+
+static void dl_record_points(meas_render_ctx_t *ctx, uint8_t op,
+                             const meas_point_t *points, uint16_t count,
+                             uint8_t alpha) {
+  if (!points || count == 0)
+    return;
+  int16_t y_min, y_max;
+  dl_points_range(points, count, &y_min, &y_max);
+  meas_dl_cmd_t *cmd = dl_emit(ctx, op, y_min, y_max, alpha);
+  if (cmd) {
+    cmd->count = count;
+    cmd->data = dl_points(points, count);
+  }
+}
+
+static void dl_record_polyline(meas_render_ctx_t *ctx, uint8_t op,
+                               const meas_point_t *points, uint16_t count,
+                               uint8_t alpha) {
+  if (count < 2)
+    return;
+  // One command; meas_dl_end() finds the segments crossing each tile
+  dl_record_points(ctx, op, points, count, alpha);
+}
+
+static void dl_draw_polyline(meas_render_ctx_t *ctx,
+                             const meas_point_t *points, uint16_t count,
+                             uint8_t alpha) {
+  dl_record_polyline(ctx, DL_OP_POLYLINE, points, count, alpha);
+}
+
+static void dl_draw_polyline_aa(meas_render_ctx_t *ctx,
+                                const meas_point_t *points, uint16_t count,
+                                uint8_t alpha) {
+  dl_record_polyline(ctx, DL_OP_POLYLINE_AA, points, count, alpha);
+}
+
+static void dl_record_rect(meas_render_ctx_t *ctx, uint8_t op, int16_t x,
+                           int16_t y, int16_t w, int16_t h, uint8_t alpha) {
+  if (w <= 0 || h <= 0)
+    return;
+  meas_dl_cmd_t *cmd = dl_emit(ctx, op, y, y + h - 1, alpha);
+  if (cmd) {
+    cmd->args[0] = x;
+    cmd->args[1] = y;
+    cmd->args[2] = w;
+    cmd->args[3] = h;
+  }
+}
+
+static void dl_fill_rect(meas_render_ctx_t *ctx, int16_t x, int16_t y,
+                         int16_t w, int16_t h, uint8_t alpha) {
+  if (alpha == MEAS_ALPHA_TRANSPARENT)
+    return;
+  dl_record_rect(ctx, DL_OP_FILL_RECT, x, y, w, h, alpha);
+}
+
+static void dl_fill_polygon(meas_render_ctx_t *ctx,
+                            const meas_point_t *points, uint16_t count,
+                            uint8_t alpha) {
+  if (count < 3)
+    return;
+  dl_record_points(ctx, DL_OP_FILL_POLYGON, points, count, alpha);
+}
+
+static void dl_blit(meas_render_ctx_t *ctx, int16_t x, int16_t y, int16_t w,
+                    int16_t h, const void *img, uint8_t alpha) {
+  if (!img || w <= 0 || h <= 0)
+    return;
+  meas_dl_cmd_t *cmd = dl_emit(ctx, DL_OP_BLIT, y, y + h - 1, alpha);
+  if (cmd) {
+    cmd->args[0] = x;
+    cmd->args[1] = y;
+    cmd->args[2] = w;
+    cmd->args[3] = h;
+    cmd->data = img; // By reference
+  }
+}
+
+static void dl_record_text(meas_render_ctx_t *ctx, uint8_t op, int16_t y_min,
+                           int16_t y_max, const char *text, int16_t a0,
+                           int16_t a1, int16_t a2, uint8_t alpha) {
+  meas_dl_cmd_t *cmd = dl_emit(ctx, op, y_min, y_max, alpha);
+  if (cmd) {
+    cmd->args[0] = a0;
+    cmd->args[1] = a1;
+    cmd->args[2] = a2;
+    cmd->data = dl_copy(text, strlen(text) + 1);
+  }
+}
+
+static void dl_draw_text(meas_render_ctx_t *ctx, int16_t x, int16_t y,
+                         const char *text, uint8_t alpha) {
+  if (!ctx || !ctx->font || !text)
+    return;
+  dl_record_text(ctx, DL_OP_TEXT, y, y + dl_text_height(ctx) - 1, text, x, y,
+                 0, alpha);
+}
+
+static void dl_draw_number(meas_render_ctx_t *ctx, int16_t x, int16_t y,
+                           int32_t value, uint8_t decimals, uint8_t alpha) {
+  if (!ctx || !ctx->font)
+    return;
+  // The value rides in the argument slots: no arena copy per readout
+  meas_dl_cmd_t *cmd =
+      dl_emit(ctx, DL_OP_NUMBER, y, y + dl_text_height(ctx) - 1, alpha);
+  if (cmd) {
+    cmd->args[0] = x;
+    cmd->args[1] = y;
+    cmd->args[2] = (int16_t)((uint32_t)value & 0xFFFFU);
+    cmd->args[3] = (int16_t)((uint32_t)value >> 16);
+    cmd->count = decimals;
+  }
+}
+
+static void dl_record_gradient(meas_render_ctx_t *ctx, uint8_t op, int16_t x,
+                               int16_t y, int16_t w, int16_t h,
+                               meas_pixel_t c1, meas_pixel_t c2,
+                               uint8_t alpha) {
+  if (w <= 0 || h <= 0)
+    return;
+  meas_dl_cmd_t *cmd = dl_emit(ctx, op, y, y + h - 1, alpha);
+  if (cmd) {
+    cmd->args[0] = x;
+    cmd->args[1] = y;
+    cmd->args[2] = w;
+    cmd->args[3] = h;
+    cmd->args[4] = (int16_t)c1;
+    cmd->args[5] = (int16_t)c2;
+  }
+}
+
+static void dl_fill_gradient_v(meas_render_ctx_t *ctx, int16_t x, int16_t y,
+                               int16_t w, int16_t h, meas_pixel_t c1,
+                               meas_pixel_t c2, uint8_t alpha) {
+  dl_record_gradient(ctx, DL_OP_GRADIENT_V, x, y, w, h, c1, c2, alpha);
+}
+
+static void dl_fill_gradient_h(meas_render_ctx_t *ctx, int16_t x, int16_t y,
+                               int16_t w, int16_t h, meas_pixel_t c1,
+                               meas_pixel_t c2, uint8_t alpha) {
+  dl_record_gradient(ctx, DL_OP_GRADIENT_H, x, y, w, h, c1, c2, alpha);
+}
+
+static void dl_get_dims(meas_render_ctx_t *ctx, int16_t *w, int16_t *h) {
+  if (!ctx)
+    return;
+  if (w)
+    *w = ctx->width;
+  if (h)
+    *h = ctx->height;
+}
+
+static void dl_draw_rect(meas_render_ctx_t *ctx, meas_rect_t rect,
+                         uint8_t alpha) {
+  dl_record_rect(ctx, DL_OP_DRAW_RECT, rect.x, rect.y, rect.w, rect.h, alpha);
+}
+
+static void dl_record_circle(meas_render_ctx_t *ctx, uint8_t op, int16_t x,
+                             int16_t y, int16_t r, int16_t a3, int16_t a4,
+                             uint8_t alpha) {
+  if (r < 0)
+    return;
+  meas_dl_cmd_t *cmd = dl_emit(ctx, op, y - r, y + r, alpha);
+  if (cmd) {
+    cmd->args[0] = x;
+    cmd->args[1] = y;
+    cmd->args[2] = r;
+    cmd->args[3] = a3;
+    cmd->args[4] = a4;
+  }
+}
+
+static void dl_draw_circle(meas_render_ctx_t *ctx, int16_t x, int16_t y,
+                           int16_t radius, uint8_t alpha) {
+  dl_record_circle(ctx, DL_OP_DRAW_CIRCLE, x, y, radius, 0, 0, alpha);
+}
+
+static void dl_fill_circle(meas_render_ctx_t *ctx, int16_t x, int16_t y,
+                           int16_t radius, uint8_t alpha) {
+  dl_record_circle(ctx, DL_OP_FILL_CIRCLE, x, y, radius, 0, 0, alpha);
+}
+
+static void dl_record_round_rect(meas_render_ctx_t *ctx, uint8_t op,
+                                 meas_rect_t rect, int16_t r, uint8_t alpha) {
+  if (rect.w <= 0 || rect.h <= 0)
+    return;
+  meas_dl_cmd_t *cmd = dl_emit(ctx, op, rect.y, rect.y + rect.h - 1, alpha);
+  if (cmd) {
+    cmd->args[0] = rect.x;
+    cmd->args[1] = rect.y;
+    cmd->args[2] = rect.w;
+    cmd->args[3] = rect.h;
+    cmd->args[4] = r;
+  }
+}
+
+static void dl_draw_round_rect(meas_render_ctx_t *ctx, meas_rect_t rect,
+                               int16_t r, uint8_t alpha) {
+  dl_record_round_rect(ctx, DL_OP_DRAW_ROUND_RECT, rect, r, alpha);
+}
+
+static void dl_fill_round_rect(meas_render_ctx_t *ctx, meas_rect_t rect,
+                               int16_t r, uint8_t alpha) {
+  dl_record_round_rect(ctx, DL_OP_FILL_ROUND_RECT, rect, r, alpha);
+}
+
+// --- State & Metrics (executed immediately) ---
+
+static void dl_set_font(meas_render_ctx_t *ctx, const meas_font_t *font) {
+  if (ctx)
+    ctx->font = font;
+}
+
+static int16_t dl_get_text_width(meas_render_ctx_t *ctx, const char *text) {
+  return meas_render_cell_api.get_text_width(ctx, text);
+}
+
+static int16_t dl_get_text_height(meas_render_ctx_t *ctx, const char *text) {
+  return meas_render_cell_api.get_text_height(ctx, text);
+}
+
+static void dl_measure_text(meas_render_ctx_t *ctx, const char *text,
+                            meas_text_metrics_t *out_metrics) {
+  meas_render_cell_api.measure_text(ctx, text, out_metrics);
+}
+
+static meas_rect_t dl_get_clip_rect(meas_render_ctx_t *ctx) {
+  return meas_render_cell_api.get_clip_rect(ctx);
+}
+
+static void dl_push_clip_rect(meas_render_ctx_t *ctx, meas_rect_t rect) {
+  meas_render_cell_api.push_clip_rect(ctx, rect);
+}
+
+static meas_rect_t dl_pop_clip_rect(meas_render_ctx_t *ctx) {
+  return meas_render_cell_api.pop_clip_rect(ctx);
+}
+
+// --- Extended Primitives ---
+
+static void dl_draw_text_rotated(meas_render_ctx_t *ctx, int16_t x, int16_t y,
+                                 const char *text, int16_t angle,
+                                 uint8_t alpha) {
+  if (!ctx || !ctx->font || !text)
+    return;
+  // Any rotation stays within the text length (plus one line) of the origin
+  int16_t reach = dl_get_text_width(ctx, text) + dl_text_height(ctx);
+  dl_record_text(ctx, DL_OP_TEXT_ROTATED, y - reach, y + reach, text, x, y,
+                 angle, alpha);
+}
+
+static void dl_draw_text_aligned(meas_render_ctx_t *ctx, int16_t x, int16_t y,
+                                 const char *text, uint8_t align,
+                                 uint8_t alpha) {
+  if (!ctx || !ctx->font || !text)
+    return;
+  int16_t h = dl_text_height(ctx);
+  dl_record_text(ctx, DL_OP_TEXT_ALIGNED, y - h, y + h - 1, text, x, y, align,
+                 alpha);
+}
+
+static void dl_draw_text_rect(meas_render_ctx_t *ctx, meas_rect_t rect,
+                              const char *text, uint8_t align, uint8_t alpha) {
+  if (!ctx || !ctx->font || !text || rect.w <= 0 || rect.h <= 0)
+    return;
+  meas_dl_cmd_t *cmd = dl_emit(ctx, DL_OP_TEXT_RECT, rect.y,
+                               rect.y + rect.h - 1, alpha);
+  if (cmd) {
+    cmd->args[0] = rect.x;
+    cmd->args[1] = rect.y;
+    cmd->args[2] = rect.w;
+    cmd->args[3] = rect.h;
+    cmd->count = align;
+    cmd->data = dl_copy(text, strlen(text) + 1);
+  }
+}
+
+static void dl_invert_rect(meas_render_ctx_t *ctx, int16_t x, int16_t y,
+                           int16_t w, int16_t h) {
+  dl_record_rect(ctx, DL_OP_INVERT_RECT, x, y, w, h, MEAS_ALPHA_OPAQUE);
+}
+
+static void dl_draw_line_patt(meas_render_ctx_t *ctx, int16_t x0, int16_t y0,
+                              int16_t x1, int16_t y1, uint8_t pattern,
+                              uint8_t alpha) {
+  dl_record_line(ctx, DL_OP_LINE_PATT, x0, y0, x1, y1, 0, pattern, alpha);
+}
+
+static void dl_draw_line_thick(meas_render_ctx_t *ctx, int16_t x0, int16_t y0,
+                               int16_t x1, int16_t y1, uint8_t width,
+                               uint8_t alpha) {
+  dl_record_line(ctx, DL_OP_LINE_THICK, x0, y0, x1, y1, (width + 1) / 2 + 1,
+                 width, alpha);
+}
+
+static void dl_record_triangle(meas_render_ctx_t *ctx, uint8_t op, int16_t x0,
+                               int16_t y0, int16_t x1, int16_t y1, int16_t x2,
+                               int16_t y2, uint8_t alpha) {
+  meas_dl_cmd_t *cmd = dl_emit(ctx, op, dl_min(y0, dl_min(y1, y2)),
+                               dl_max(y0, dl_max(y1, y2)), alpha);
+  if (cmd) {
+    cmd->args[0] = x0;
+    cmd->args[1] = y0;
+    cmd->args[2] = x1;
+    cmd->args[3] = y1;
+    cmd->args[4] = x2;
+    cmd->args[5] = y2;
+  }
+}
+
+static void dl_fill_triangle(meas_render_ctx_t *ctx, int16_t x0, int16_t y0,
+                             int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                             uint8_t alpha) {
+  dl_record_triangle(ctx, DL_OP_FILL_TRIANGLE, x0, y0, x1, y1, x2, y2, alpha);
+}
+
+static void dl_draw_triangle(meas_render_ctx_t *ctx, int16_t x0, int16_t y0,
+                             int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                             uint8_t alpha) {
+  dl_record_triangle(ctx, DL_OP_DRAW_TRIANGLE, x0, y0, x1, y1, x2, y2, alpha);
+}
+
+static void dl_draw_arc(meas_render_ctx_t *ctx, int16_t x, int16_t y,
+                        int16_t r, int16_t start_angle, int16_t end_angle,
+                        uint8_t alpha) {
+  dl_record_circle(ctx, DL_OP_ARC, x, y, r, start_angle, end_angle, alpha);
+}
+
+static void dl_fill_pie(meas_render_ctx_t *ctx, int16_t x, int16_t y,
+                        int16_t r, int16_t start_angle, int16_t end_angle,
+                        uint8_t alpha) {
+  dl_record_circle(ctx, DL_OP_PIE, x, y, r, start_angle, end_angle, alpha);
+}
+
+static void dl_draw_minmax_v(meas_render_ctx_t *ctx, int16_t x, int16_t y,
+                             int16_t w, int16_t h, const int16_t *data,
+                             size_t count, uint8_t alpha) {
+  if (!data || count == 0 || w <= 0 || h <= 0)
+    return;
+
+  // Column extents come from the data itself (offsets relative to y)
+  int16_t d_min = data[0];
+  int16_t d_max = data[0];
+  for (size_t i = 1; i < count; i++) {
+    d_min = dl_min(d_min, data[i]);
+    d_max = dl_max(d_max, data[i]);
+  }
+
+  meas_dl_cmd_t *cmd =
+      dl_emit(ctx, DL_OP_MINMAX_V, y + d_min, y + d_max, alpha);
+  if (cmd) {
+    cmd->args[0] = x;
+    cmd->args[1] = y;
+    cmd->args[2] = w;
+    cmd->args[3] = h;
+    cmd->args[4] = (int16_t)(count & 0xFFFFU);
+    cmd->args[5] = (int16_t)((count >> 16) & 0xFFFFU);
+    cmd->data = data; // By reference
+  }
+}
+
+const meas_render_api_t meas_render_dl_api = {
+    .draw_pixel = dl_draw_pixel,
+    .get_pixel = dl_get_pixel,
+    .draw_line = dl_draw_line,
+    .draw_polyline = dl_draw_polyline,
+    .draw_polyline_aa = dl_draw_polyline_aa,
+    .fill_rect = dl_fill_rect,
+    .fill_polygon = dl_fill_polygon,
+    .blit = dl_blit,
+    .draw_text = dl_draw_text,
+    .draw_number = dl_draw_number,
+    .fill_gradient_v = dl_fill_gradient_v,
+    .fill_gradient_h = dl_fill_gradient_h,
+    .get_dims = dl_get_dims,
+    .draw_rect = dl_draw_rect,
+    .draw_circle = dl_draw_circle,
+    .fill_circle = dl_fill_circle,
+    .draw_round_rect = dl_draw_round_rect,
+    .fill_round_rect = dl_fill_round_rect,
+    .set_font = dl_set_font,
+    .get_text_width = dl_get_text_width,
+    .get_text_height = dl_get_text_height,
+    .draw_text_aligned = dl_draw_text_aligned,
+    .draw_text_rect = dl_draw_text_rect,
+    .invert_rect = dl_invert_rect,
+    .get_clip_rect = dl_get_clip_rect,
+    .draw_line_patt = dl_draw_line_patt,
+    .draw_line_thick = dl_draw_line_thick,
+    .push_clip_rect = dl_push_clip_rect,
+    .pop_clip_rect = dl_pop_clip_rect,
+    .fill_triangle = dl_fill_triangle,
+    .draw_triangle = dl_draw_triangle,
+    .draw_arc = dl_draw_arc,
+    .fill_pie = dl_fill_pie,
+    .measure_text = dl_measure_text,
+    .draw_text_rotated = dl_draw_text_rotated,
+    .draw_minmax_v = dl_draw_minmax_v};
+
+// --- Frame Control ---
+
+void meas_dl_begin(meas_dl_t *dl, meas_render_ctx_t *ctx) {
+  if (!dl || !ctx)
+    return;
+
+  dl->cmd_count = 0;
+  dl->arena_used = 0;
+  dl->overflow = false;
+
+  memset(ctx, 0, sizeof(*ctx));
+  ctx->buffer = NULL; // Nothing is rasterized while recording
+  ctx->width = MEAS_UI_SCREEN_WIDTH;
+  ctx->height = MEAS_UI_SCREEN_HEIGHT;
+  ctx->fg_color = 0xFFFF;
+  ctx->bg_color = 0x0000;
+  ctx->clip_rect =
+      (meas_rect_t){0, 0, MEAS_UI_SCREEN_WIDTH, MEAS_UI_SCREEN_HEIGHT};
+
+  rec_dl = dl;
+}
+
+static bool dl_is_polyline(const meas_dl_cmd_t *cmd) {
+  return cmd->op == DL_OP_POLYLINE || cmd->op == DL_OP_POLYLINE_AA;
+}
+
+/**
+ * @brief Segments of a polyline crossing each tile.
+ * first[t] > last[t] if none does. Only the rows the command may touch
+ * count, as the rasterizer rejects the rest against the tile anyway.
+ */
+static void dl_polyline_spans(const meas_dl_cmd_t *cmd, uint16_t *first,
+                              uint16_t *last) {
+  for (uint16_t t = 0; t < MEAS_UI_TILE_COUNT; t++) {
+    first[t] = UINT16_MAX;
+    last[t] = 0;
+  }
+  const meas_point_t *p = (const meas_point_t *)cmd->data;
+  for (uint16_t i = 0; i + 1 < cmd->count; i++) {
+    int16_t lo = dl_max(dl_min(p[i].y, p[i + 1].y), cmd->y_min);
+    int16_t hi = dl_min(dl_max(p[i].y, p[i + 1].y), cmd->y_max);
+    for (int16_t t = lo / MEAS_UI_TILE_HEIGHT;
+         lo <= hi && t <= hi / MEAS_UI_TILE_HEIGHT; t++) {
+      if (first[t] == UINT16_MAX)
+        first[t] = i;
+      last[t] = i;
+    }
+  }
+}
+
+bool meas_dl_end(meas_dl_t *dl) {
+  if (!dl)
+    return false;
+  if (rec_dl == dl)
+    rec_dl = NULL;
+
+  // Tile lists: count the entries of each tile, then place them. Commands
+  // are visited in recording order, so every list keeps the z-order.
+  uint16_t next[MEAS_UI_TILE_COUNT];
+  uint16_t first[MEAS_UI_TILE_COUNT];
+  uint16_t last[MEAS_UI_TILE_COUNT];
+  memset(dl->tile_refs, 0, sizeof(dl->tile_refs));
+
+  for (uint8_t pass = 0; pass < 2 && !dl->overflow; pass++) {
+    for (uint16_t i = 0; i < dl->cmd_count; i++) {
+      const meas_dl_cmd_t *cmd = &dl->cmds[i];
+      bool spans = dl_is_polyline(cmd);
+      if (spans)
+        dl_polyline_spans(cmd, first, last);
+
+      uint16_t t0 = (uint16_t)(cmd->y_min / MEAS_UI_TILE_HEIGHT);
+      uint16_t t1 = (uint16_t)(cmd->y_max / MEAS_UI_TILE_HEIGHT);
+      for (uint16_t t = t0; t <= t1 && t < MEAS_UI_TILE_COUNT; t++) {
+        if (spans && first[t] > last[t])
+          continue;
+        if (pass == 0) {
+          dl->tile_refs[t + 1]++;
+          continue;
+        }
+        meas_dl_ref_t *ref = &dl->refs[next[t]++];
+        ref->cmd = (uint8_t)i;
+        ref->first = spans ? first[t] : 0;
+        ref->count = spans ? (uint16_t)(last[t] - first[t] + 2U) : 0;
+      }
+    }
+
+    if (pass == 0) {
+      for (uint16_t t = 0; t < MEAS_UI_TILE_COUNT; t++) {
+        dl->tile_refs[t + 1] += dl->tile_refs[t];
+        next[t] = dl->tile_refs[t];
+      }
+      if (dl->tile_refs[MEAS_UI_TILE_COUNT] > MEAS_DL_MAX_REFS)
+        dl->overflow = true;
+    }
+  }
+
+  return !dl->overflow;
+}
+
+// --- Replay ---
+
+static void dl_execute(const meas_dl_cmd_t *cmd, const meas_dl_ref_t *ref,
+                       meas_render_ctx_t *ctx, const meas_render_api_t *api) {
+  const int16_t *a = cmd->args;
+  const meas_point_t *points = (const meas_point_t *)cmd->data;
+
+  switch ((meas_dl_op_t)cmd->op) {
+  case DL_OP_PIXEL:
+    api->draw_pixel(ctx, a[0], a[1], cmd->alpha);
+    break;
+  case DL_OP_LINE:
+    api->draw_line(ctx, a[0], a[1], a[2], a[3], cmd->alpha);
+    break;
+  case DL_OP_POLYLINE:
+    api->draw_polyline(ctx, &points[ref->first], ref->count, cmd->alpha);
+    break;
+  case DL_OP_FILL_RECT:
+    api->fill_rect(ctx, a[0], a[1], a[2], a[3], cmd->alpha);
+    break;
+  case DL_OP_FILL_POLYGON:
+    api->fill_polygon(ctx, points, cmd->count, cmd->alpha);
+    break;
+  case DL_OP_BLIT:
+    api->blit(ctx, a[0], a[1], a[2], a[3], cmd->data, cmd->alpha);
+    break;
+  case DL_OP_TEXT:
+    api->draw_text(ctx, a[0], a[1], (const char *)cmd->data, cmd->alpha);
+    break;
+  case DL_OP_NUMBER:
+    api->draw_number(ctx, a[0], a[1],
+                     (int32_t)((uint32_t)(uint16_t)a[2] |
+                               ((uint32_t)(uint16_t)a[3] << 16)),
+                     (uint8_t)cmd->count, cmd->alpha);
+    break;
+  case DL_OP_GRADIENT_V:
+    api->fill_gradient_v(ctx, a[0], a[1], a[2], a[3], (meas_pixel_t)a[4],
+                         (meas_pixel_t)a[5], cmd->alpha);
+    break;
+  case DL_OP_GRADIENT_H:
+    api->fill_gradient_h(ctx, a[0], a[1], a[2], a[3], (meas_pixel_t)a[4],
+                         (meas_pixel_t)a[5], cmd->alpha);
+    break;
+  case DL_OP_DRAW_RECT:
+    api->draw_rect(ctx, (meas_rect_t){a[0], a[1], a[2], a[3]}, cmd->alpha);
+    break;
+  case DL_OP_DRAW_CIRCLE:
+    api->draw_circle(ctx, a[0], a[1], a[2], cmd->alpha);
+    break;
+  case DL_OP_FILL_CIRCLE:
+    api->fill_circle(ctx, a[0], a[1], a[2], cmd->alpha);
+    break;
+  case DL_OP_DRAW_ROUND_RECT:
+    api->draw_round_rect(ctx, (meas_rect_t){a[0], a[1], a[2], a[3]}, a[4],
+                         cmd->alpha);
+    break;
+  case DL_OP_FILL_ROUND_RECT:
+    api->fill_round_rect(ctx, (meas_rect_t){a[0], a[1], a[2], a[3]}, a[4],
+                         cmd->alpha);
+    break;
+  case DL_OP_TEXT_ROTATED:
+    api->draw_text_rotated(ctx, a[0], a[1], (const char *)cmd->data, a[2],
+                           cmd->alpha);
+    break;
+  case DL_OP_TEXT_ALIGNED:
+    api->draw_text_aligned(ctx, a[0], a[1], (const char *)cmd->data,
+                           (uint8_t)a[2], cmd->alpha);
+    break;
+  case DL_OP_TEXT_RECT:
+    api->draw_text_rect(ctx, (meas_rect_t){a[0], a[1], a[2], a[3]},
+                        (const char *)cmd->data, (uint8_t)cmd->count,
+                        cmd->alpha);
+    break;
+  case DL_OP_INVERT_RECT:
+    api->invert_rect(ctx, a[0], a[1], a[2], a[3]);
+    break;
+  case DL_OP_LINE_PATT:
+    api->draw_line_patt(ctx, a[0], a[1], a[2], a[3], (uint8_t)cmd->count,
+                        cmd->alpha);
+    break;
+  case DL_OP_LINE_THICK:
+    api->draw_line_thick(ctx, a[0], a[1], a[2], a[3], (uint8_t)cmd->count,
+                         cmd->alpha);
+    break;
+  case DL_OP_FILL_TRIANGLE:
+    api->fill_triangle(ctx, a[0], a[1], a[2], a[3], a[4], a[5], cmd->alpha);
+    break;
+  case DL_OP_DRAW_TRIANGLE:
+    api->draw_triangle(ctx, a[0], a[1], a[2], a[3], a[4], a[5], cmd->alpha);
+    break;
+  case DL_OP_ARC:
+    api->draw_arc(ctx, a[0], a[1], a[2], a[3], a[4], cmd->alpha);
+    break;
+  case DL_OP_PIE:
+    api->fill_pie(ctx, a[0], a[1], a[2], a[3], a[4], cmd->alpha);
+    break;
+  case DL_OP_MINMAX_V: {
+    size_t count = (size_t)(uint16_t)a[4] | ((size_t)(uint16_t)a[5] << 16);
+    api->draw_minmax_v(ctx, a[0], a[1], a[2], a[3], (const int16_t *)cmd->data,
+                       count, cmd->alpha);
+    break;
+  }
+  case DL_OP_POLYLINE_AA:
+    api->draw_polyline_aa(ctx, &points[ref->first], ref->count, cmd->alpha);
+    break;
+  default:
+    break;
+  }
+}
+
+void meas_dl_replay(const meas_dl_t *dl, meas_render_ctx_t *ctx,
+                    const meas_render_api_t *api) {
+  if (!dl || !ctx || !api || dl->overflow || ctx->height <= 0)
+    return;
+
+  int16_t y0 = dl_max(ctx->y_offset, 0);
+  int16_t y1 =
+      dl_min(ctx->y_offset + ctx->height - 1, MEAS_UI_SCREEN_HEIGHT - 1);
+
+  // Each tile band of the context replays its list; commands carry their own
+  // state, so they run on a copy and the caller's context is left untouched
+  for (int16_t t = y0 / MEAS_UI_TILE_HEIGHT; y0 <= y1; t++) {
+    int16_t band_end = dl_min((t + 1) * MEAS_UI_TILE_HEIGHT - 1, y1);
+    meas_render_ctx_t band = *ctx;
+    band.buffer = &ctx->buffer[(y0 - ctx->y_offset) * ctx->width];
+    band.y_offset = y0;
+    band.height = band_end - y0 + 1;
+
+    for (uint16_t r = dl->tile_refs[t]; r < dl->tile_refs[t + 1]; r++) {
+      const meas_dl_ref_t *ref = &dl->refs[r];
+      const meas_dl_cmd_t *cmd = &dl->cmds[ref->cmd];
+      band.fg_color = cmd->fg_color;
+      band.bg_color = cmd->bg_color;
+      band.clip_rect = cmd->clip_rect;
+      band.font = cmd->font;
+      dl_execute(cmd, ref, &band, api);
+    }
+    y0 = band_end + 1;
+  }
+}
@@ -6,6 +6,7 @@
  * @copyright (c) 2026 momentics
  */
 
+#include "measlib/ui/font_atlas.h"
 #include "measlib/ui/fonts.h"
 #include <stddef.h>
 #include <stdint.h>
@@ -1766,9 +1767,9 @@ static const uint8_t *font_11x14_get_glyph(const uint8_t *font_data, char c,
       &font_data[(index - wFONT_START_CHAR) * wFONT_GET_HEIGHT * 2];
 
   if (w_out) {
-    // Low byte of first word contains inverted width
-    // Ref: #define wFONT_GET_WIDTH(ch) (14 - (bitmap[... + 1] & 0x7))
-    *w_out = 14 - (glyph[1] & 0x07);
+    // Low bits of the first row word contain the inverted width
+    // Ref: #define wFONT_GET_WIDTH(ch) (14 - (bitmap[...] & 0x7))
+    *w_out = 14 - (*(const uint16_t *)glyph & 0x07);
   }
 
   if (h_out)
@@ -1784,4 +1785,5 @@ const meas_font_t font_11x14 = {
     .start_char = wFONT_START_CHAR,
     .end_char = 126,
     .get_glyph = font_11x14_get_glyph,
+    .atlas = MEAS_FONT_ATLAS(font_11x14),
 };
@@ -6,6 +6,7 @@
  * @copyright (c) 2026 momentics
  */
 
+#include "measlib/ui/font_atlas.h"
 #include "measlib/ui/fonts.h"
 #include <stddef.h>
 
@@ -46,9 +47,10 @@
  * @brief Font Bitmap Data (5x7 pixels).
  *
  * Storage Format: `uint8_t` array.
- * - Each character consists of 7 bytes of column data.
- * - The first byte of each character block contains encoded width information.
- * - Format is column-major: Each byte represents a vertical column of pixels.
+ * - Each character consists of 7 bytes of row data.
+ * - The low bits of the first byte of each character block contain the
+ *   encoded width.
+ * - Format is row-major: Each byte represents a horizontal row (MSB = left).
  */
 static const uint8_t x5x7_bits[] = {
     // Char 0x16 (SYNC) width = 8
@@ -1027,4 +1029,5 @@ const meas_font_t font_5x7 = {
     .start_char = FONT_START_CHAR,
     .end_char = 126,
     .get_glyph = font_5x7_get_glyph,
+    .atlas = MEAS_FONT_ATLAS(font_5x7),
 };
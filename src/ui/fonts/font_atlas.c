@@ -0,0 +1,944 @@
+/**
+ * @file font_atlas.c
+ * @brief Run-Encoded Font Atlases.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * GENERATED by tools/fontgen from the bitmap fonts - do not edit.
+ * Regenerate with the `font_atlas` target of the host build.
+ */
+
+#include "measlib/ui/font_atlas.h"
+#include <stddef.h>
+
+// --- font_5x7 ---
+
+static const uint8_t font_5x7_runs[] = {
+    // 0x16
+    0x01, 0x51, 0x01, 0x51, 0x02, 0x10, 0x51, 0x01, 0x06, 0x01, 0x06, 0x01,
+    0x10,
+    // 0x17
+    0x01, 0x20, 0x01, 0x20, 0x02, 0x10, 0x30, 0x02, 0x10, 0x30, 0x02, 0x00,
+    0x40, 0x01, 0x04,
+    // 0x18
+    0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x03, 0x01, 0x02, 0x01, 0x01,
+    0x01, 0x00,
+    // 0x19
+    0x02, 0x11, 0x41, 0x03, 0x00, 0x21, 0x60, 0x03, 0x00, 0x30, 0x60, 0x03,
+    0x00, 0x31, 0x60, 0x02, 0x11, 0x41,
+    // 0x1A
+    0x01, 0x20, 0x01, 0x10, 0x01, 0x04, 0x01, 0x10, 0x01, 0x20,
+    // 0x1B
+    0x01, 0x20, 0x01, 0x30, 0x01, 0x04, 0x01, 0x30, 0x01, 0x20,
+    // 0x1C
+    0x01, 0x04, 0x02, 0x10, 0x30, 0x02, 0x10, 0x30, 0x02, 0x10, 0x30, 0x02,
+    0x10, 0x30, 0x02, 0x00, 0x31,
+    // 0x1D
+    0x02, 0x00, 0x40, 0x02, 0x00, 0x40, 0x02, 0x01, 0x31, 0x03, 0x00, 0x20,
+    0x40, 0x01, 0x00,
+    // 0x1E
+    0x01, 0x12, 0x02, 0x00, 0x40, 0x02, 0x00, 0x40, 0x02, 0x00, 0x40, 0x02,
+    0x10, 0x30, 0x02, 0x10, 0x30, 0x02, 0x01, 0x31,
+    // 0x1F
+    0x01, 0x11, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x01, 0x11,
+    // '!'
+    0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x00, 0x01,
+    0x10,
+    // '"'
+    0x02, 0x10, 0x30, 0x02, 0x10, 0x30, 0x02, 0x10, 0x30,
+    // '#'
+    0x02, 0x10, 0x30, 0x02, 0x10, 0x30, 0x01, 0x04, 0x02, 0x10, 0x30, 0x01,
+    0x04, 0x02, 0x10, 0x30, 0x02, 0x10, 0x30,
+    // '$'
+    0x01, 0x20, 0x01, 0x13, 0x02, 0x00, 0x20, 0x01, 0x12, 0x02, 0x20, 0x40,
+    0x01, 0x03, 0x01, 0x20,
+    // '%'
+    0x01, 0x01, 0x02, 0x01, 0x40, 0x01, 0x30, 0x01, 0x20, 0x01, 0x10, 0x02,
+    0x00, 0x31, 0x01, 0x31,
+    // '&'
+    0x01, 0x20, 0x02, 0x10, 0x30, 0x01, 0x11, 0x03, 0x00, 0x20, 0x40, 0x02,
+    0x00, 0x30, 0x02, 0x11, 0x40,
+    // '\''
+    0x01, 0x11, 0x01, 0x10, 0x01, 0x00,
+    // '('
+    0x01, 0x20, 0x01, 0x10, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x10,
+    0x01, 0x20,
+    // ')'
+    0x01, 0x00, 0x01, 0x10, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x10,
+    0x01, 0x00,
+    // '*'
+    0x01, 0x20, 0x03, 0x00, 0x20, 0x40, 0x01, 0x12, 0x03, 0x00, 0x20, 0x40,
+    0x01, 0x20,
+    // '+'
+    0x01, 0x20, 0x01, 0x20, 0x01, 0x04, 0x01, 0x20, 0x01, 0x20,
+    // ','
+    0x01, 0x01, 0x01, 0x10, 0x01, 0x00,
+    // '-'
+    0x01, 0x03,
+    // '.'
+    0x01, 0x01, 0x01, 0x01,
+    // '/'
+    0x01, 0x20, 0x01, 0x20, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x00,
+    0x01, 0x00,
+    // '0'
+    0x01, 0x11, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02,
+    0x00, 0x30, 0x02, 0x00, 0x30, 0x01, 0x11,
+    // '1'
+    0x01, 0x20, 0x01, 0x11, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20,
+    0x01, 0x12,
+    // '2'
+    0x01, 0x11, 0x02, 0x00, 0x30, 0x01, 0x30, 0x01, 0x20, 0x01, 0x10, 0x01,
+    0x00, 0x01, 0x03,
+    // '3'
+    0x01, 0x11, 0x02, 0x00, 0x30, 0x01, 0x30, 0x01, 0x11, 0x01, 0x30, 0x02,
+    0x00, 0x30, 0x01, 0x11,
+    // '4'
+    0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30,
+    0x01, 0x03, 0x01, 0x30, 0x01, 0x30,
+    // '5'
+    0x01, 0x03, 0x01, 0x00, 0x01, 0x02, 0x01, 0x30, 0x01, 0x30, 0x02, 0x00,
+    0x30, 0x01, 0x11,
+    // '6'
+    0x01, 0x11, 0x02, 0x00, 0x30, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x30,
+    0x02, 0x00, 0x30, 0x01, 0x11,
+    // '7'
+    0x01, 0x03, 0x01, 0x30, 0x01, 0x20, 0x01, 0x20, 0x01, 0x10, 0x01, 0x10,
+    0x01, 0x10,
+    // '8'
+    0x01, 0x11, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x01, 0x11, 0x02, 0x00,
+    0x30, 0x02, 0x00, 0x30, 0x01, 0x11,
+    // '9'
+    0x01, 0x11, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x01, 0x12, 0x01, 0x30,
+    0x02, 0x00, 0x30, 0x01, 0x11,
+    // ':'
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01,
+    // ';'
+    0x01, 0x11, 0x01, 0x11, 0x00, 0x01, 0x11, 0x01, 0x10, 0x01, 0x00,
+    // '<'
+    0x01, 0x20, 0x01, 0x10, 0x01, 0x00, 0x01, 0x10, 0x01, 0x20,
+    // '='
+    0x01, 0x03, 0x00, 0x01, 0x03,
+    // '>'
+    0x01, 0x00, 0x01, 0x10, 0x01, 0x20, 0x01, 0x10, 0x01, 0x00,
+    // '?'
+    0x01, 0x11, 0x02, 0x00, 0x30, 0x01, 0x30, 0x01, 0x20, 0x01, 0x10, 0x00,
+    0x01, 0x10,
+    // '@'
+    0x01, 0x11, 0x02, 0x00, 0x30, 0x02, 0x00, 0x21, 0x02, 0x00, 0x21, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x12,
+    // 'A'
+    0x01, 0x11, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x01,
+    0x03, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30,
+    // 'B'
+    0x01, 0x02, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x01, 0x02, 0x02, 0x00,
+    0x30, 0x02, 0x00, 0x30, 0x01, 0x02,
+    // 'C'
+    0x01, 0x11, 0x02, 0x00, 0x30, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02,
+    0x00, 0x30, 0x01, 0x11,
+    // 'D'
+    0x01, 0x02, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02,
+    0x00, 0x30, 0x02, 0x00, 0x30, 0x01, 0x02,
+    // 'E'
+    0x01, 0x03, 0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x03,
+    // 'F'
+    0x01, 0x03, 0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x00,
+    // 'G'
+    0x01, 0x11, 0x02, 0x00, 0x30, 0x01, 0x00, 0x02, 0x00, 0x21, 0x02, 0x00,
+    0x30, 0x02, 0x00, 0x30, 0x01, 0x12,
+    // 'H'
+    0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x01, 0x03, 0x02,
+    0x00, 0x30, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30,
+    // 'I'
+    0x01, 0x02, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
+    0x01, 0x02,
+    // 'J'
+    0x01, 0x12, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x02, 0x00,
+    0x30, 0x01, 0x11,
+    // 'K'
+    0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x01, 0x02, 0x02,
+    0x00, 0x30, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30,
+    // 'L'
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x03,
+    // 'M'
+    0x02, 0x00, 0x40, 0x02, 0x01, 0x31, 0x03, 0x00, 0x20, 0x40, 0x03, 0x00,
+    0x20, 0x40, 0x03, 0x00, 0x20, 0x40, 0x02, 0x00, 0x40, 0x02, 0x00, 0x40,
+    // 'N'
+    0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02, 0x01, 0x30, 0x02, 0x00, 0x21,
+    0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30,
+    // 'O'
+    0x01, 0x11, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02,
+    0x00, 0x30, 0x02, 0x00, 0x30, 0x01, 0x11,
+    // 'P'
+    0x01, 0x02, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x01, 0x02, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x00,
+    // 'Q'
+    0x01, 0x11, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02,
+    0x00, 0x30, 0x02, 0x00, 0x20, 0x02, 0x10, 0x30,
+    // 'R'
+    0x01, 0x02, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x01, 0x02, 0x02, 0x00,
+    0x20, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30,
+    // 'S'
+    0x01, 0x12, 0x01, 0x00, 0x01, 0x02, 0x01, 0x30, 0x02, 0x00, 0x30, 0x01,
+    0x11,
+    // 'T'
+    0x01, 0x04, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20,
+    0x01, 0x20,
+    // 'U'
+    0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30,
+    0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x01, 0x11,
+    // 'V'
+    0x02, 0x00, 0x40, 0x02, 0x00, 0x40, 0x02, 0x00, 0x40, 0x02, 0x00, 0x40,
+    0x02, 0x10, 0x30, 0x02, 0x10, 0x30, 0x01, 0x20,
+    // 'W'
+    0x02, 0x00, 0x40, 0x02, 0x00, 0x40, 0x02, 0x00, 0x40, 0x03, 0x00, 0x20,
+    0x40, 0x03, 0x00, 0x20, 0x40, 0x03, 0x00, 0x20, 0x40, 0x02, 0x10, 0x30,
+    // 'X'
+    0x02, 0x00, 0x40, 0x02, 0x00, 0x40, 0x02, 0x10, 0x30, 0x01, 0x20, 0x02,
+    0x10, 0x30, 0x02, 0x00, 0x40, 0x02, 0x00, 0x40,
+    // 'Y'
+    0x02, 0x00, 0x40, 0x02, 0x00, 0x40, 0x02, 0x10, 0x30, 0x01, 0x20, 0x01,
+    0x20, 0x01, 0x20, 0x01, 0x20,
+    // 'Z'
+    0x01, 0x04, 0x01, 0x40, 0x01, 0x30, 0x01, 0x20, 0x01, 0x10, 0x01, 0x00,
+    0x01, 0x04,
+    // '['
+    0x01, 0x21, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20,
+    0x01, 0x21,
+    // '\\'
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x20,
+    0x01, 0x20,
+    // ']'
+    0x01, 0x02, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20,
+    0x01, 0x02,
+    // '^'
+    0x01, 0x20, 0x02, 0x10, 0x30,
+    // '_'
+    0x01, 0x04,
+    // '`'
+    0x01, 0x00, 0x01, 0x10,
+    // 'a'
+    0x01, 0x12, 0x02, 0x00, 0x40, 0x02, 0x00, 0x40, 0x02, 0x00, 0x40, 0x01,
+    0x13,
+    // 'b'
+    0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x21, 0x02, 0x01, 0x40, 0x02, 0x00,
+    0x40, 0x02, 0x00, 0x40, 0x01, 0x03,
+    // 'c'
+    0x01, 0x12, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x12,
+    // 'd'
+    0x01, 0x40, 0x01, 0x40, 0x02, 0x11, 0x40, 0x02, 0x00, 0x31, 0x02, 0x00,
+    0x40, 0x02, 0x00, 0x40, 0x01, 0x13,
+    // 'e'
+    0x01, 0x11, 0x02, 0x00, 0x30, 0x01, 0x03, 0x01, 0x00, 0x01, 0x12,
+    // 'f'
+    0x01, 0x21, 0x01, 0x10, 0x01, 0x02, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
+    0x01, 0x10,
+    // 'g'
+    0x01, 0x13, 0x02, 0x00, 0x40, 0x02, 0x00, 0x40, 0x01, 0x13, 0x01, 0x40,
+    // 'h'
+    0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x21, 0x02, 0x01, 0x40, 0x02, 0x00,
+    0x40, 0x02, 0x00, 0x40, 0x02, 0x00, 0x40,
+    // 'i'
+    0x01, 0x20, 0x00, 0x01, 0x11, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01,
+    0x11,
+    // 'j'
+    0x01, 0x30, 0x00, 0x01, 0x21, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x02,
+    0x00, 0x30,
+    // 'k'
+    0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x30, 0x02, 0x00, 0x20, 0x01, 0x02,
+    0x02, 0x00, 0x20, 0x02, 0x00, 0x30,
+    // 'l'
+    0x01, 0x11, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20,
+    0x01, 0x11,
+    // 'm'
+    0x02, 0x01, 0x30, 0x03, 0x00, 0x20, 0x40, 0x03, 0x00, 0x20, 0x40, 0x03,
+    0x00, 0x20, 0x40, 0x03, 0x00, 0x20, 0x40,
+    // 'n'
+    0x01, 0x02, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02,
+    0x00, 0x30,
+    // 'o'
+    0x01, 0x11, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x01,
+    0x11,
+    // 'p'
+    0x01, 0x03, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x01, 0x03, 0x01, 0x00,
+    // 'q'
+    0x01, 0x13, 0x02, 0x00, 0x40, 0x02, 0x00, 0x40, 0x01, 0x13, 0x01, 0x40,
+    // 'r'
+    0x02, 0x00, 0x21, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+    // 's'
+    0x01, 0x12, 0x01, 0x00, 0x01, 0x12, 0x01, 0x30, 0x01, 0x02,
+    // 't'
+    0x01, 0x10, 0x01, 0x10, 0x01, 0x02, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
+    0x01, 0x21,
+    // 'u'
+    0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30, 0x02, 0x00, 0x30,
+    0x01, 0x12,
+    // 'v'
+    0x02, 0x00, 0x40, 0x02, 0x00, 0x40, 0x02, 0x10, 0x30, 0x01, 0x20, 0x01,
+    0x20,
+    // 'w'
+    0x02, 0x00, 0x40, 0x02, 0x00, 0x40, 0x03, 0x00, 0x20, 0x40, 0x03, 0x00,
+    0x20, 0x40, 0x02, 0x10, 0x30,
+    // 'x'
+    0x02, 0x00, 0x40, 0x02, 0x10, 0x30, 0x01, 0x20, 0x02, 0x10, 0x30, 0x02,
+    0x00, 0x40,
+    // 'y'
+    0x02, 0x00, 0x40, 0x02, 0x00, 0x40, 0x02, 0x00, 0x40, 0x01, 0x13, 0x01,
+    0x40,
+    // 'z'
+    0x01, 0x03, 0x01, 0x30, 0x01, 0x20, 0x01, 0x10, 0x01, 0x03,
+    // '{'
+    0x01, 0x30, 0x01, 0x20, 0x01, 0x20, 0x01, 0x10, 0x01, 0x20, 0x01, 0x20,
+    0x01, 0x30,
+    // '|'
+    0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20,
+    0x01, 0x20,
+    // '}'
+    0x01, 0x01, 0x01, 0x10, 0x01, 0x10, 0x01, 0x20, 0x01, 0x10, 0x01, 0x10,
+    0x01, 0x01,
+    // '~'
+    0x01, 0x10, 0x02, 0x00, 0x20,
+};
+
+static const meas_atlas_glyph_t font_5x7_glyphs[] = {
+    {0, 8, 1, 6},      // 0x16
+    {13, 6, 1, 6},     // 0x17
+    {28, 4, 0, 7},     // 0x18
+    {42, 8, 1, 5},     // 0x19
+    {60, 6, 1, 5},     // 0x1A
+    {70, 6, 1, 5},     // 0x1B
+    {80, 6, 1, 6},     // 0x1C
+    {97, 6, 2, 5},     // 0x1D
+    {112, 6, 0, 7},    // 0x1E
+    {132, 5, 0, 4},    // 0x1F
+    {142, 4, 0, 0},    // ' '
+    {142, 3, 0, 7},    // '!'
+    {155, 8, 0, 3},    // '"'
+    {164, 6, 0, 7},    // '#'
+    {183, 6, 0, 7},    // '$'
+    {199, 6, 0, 7},    // '%'
+    {215, 6, 1, 6},    // '&'
+    {232, 4, 0, 3},    // '\''
+    {238, 4, 0, 7},    // '('
+    {252, 4, 0, 7},    // ')'
+    {266, 6, 1, 5},    // '*'
+    {280, 6, 1, 5},    // '+'
+    {290, 3, 4, 3},    // ','
+    {296, 5, 3, 1},    // '-'
+    {298, 3, 5, 2},    // '.'
+    {302, 4, 0, 7},    // '/'
+    {316, 5, 0, 7},    // '0'
+    {335, 5, 0, 7},    // '1'
+    {349, 5, 0, 7},    // '2'
+    {364, 5, 0, 7},    // '3'
+    {380, 5, 0, 7},    // '4'
+    {398, 5, 0, 7},    // '5'
+    {413, 5, 0, 7},    // '6'
+    {430, 5, 0, 7},    // '7'
+    {444, 5, 0, 7},    // '8'
+    {462, 5, 0, 7},    // '9'
+    {479, 4, 1, 5},    // ':'
+    {488, 4, 1, 6},    // ';'
+    {499, 5, 1, 5},    // '<'
+    {509, 5, 2, 3},    // '='
+    {514, 5, 1, 5},    // '>'
+    {524, 5, 0, 7},    // '?'
+    {538, 5, 0, 7},    // '@'
+    {555, 5, 0, 7},    // 'A'
+    {574, 5, 0, 7},    // 'B'
+    {592, 5, 0, 7},    // 'C'
+    {608, 5, 0, 7},    // 'D'
+    {627, 5, 0, 7},    // 'E'
+    {641, 5, 0, 7},    // 'F'
+    {655, 5, 0, 7},    // 'G'
+    {673, 5, 0, 7},    // 'H'
+    {693, 4, 0, 7},    // 'I'
+    {707, 5, 0, 7},    // 'J'
+    {722, 5, 0, 7},    // 'K'
+    {742, 5, 0, 7},    // 'L'
+    {756, 6, 0, 7},    // 'M'
+    {780, 5, 0, 7},    // 'N'
+    {801, 5, 0, 7},    // 'O'
+    {820, 5, 0, 7},    // 'P'
+    {836, 5, 0, 7},    // 'Q'
+    {856, 5, 0, 7},    // 'R'
+    {875, 5, 0, 6},    // 'S'
+    {888, 5, 0, 7},    // 'T'
+    {902, 5, 0, 7},    // 'U'
+    {922, 5, 0, 7},    // 'V'
+    {942, 5, 0, 7},    // 'W'
+    {966, 5, 0, 7},    // 'X'
+    {986, 5, 0, 7},    // 'Y'
+    {1003, 5, 0, 7},   // 'Z'
+    {1017, 4, 0, 7},   // '['
+    {1031, 4, 0, 7},   // '\\'
+    {1045, 4, 0, 7},   // ']'
+    {1059, 5, 0, 2},   // '^'
+    {1064, 5, 6, 1},   // '_'
+    {1066, 4, 0, 2},   // '`'
+    {1070, 5, 2, 5},   // 'a'
+    {1083, 5, 0, 7},   // 'b'
+    {1101, 5, 2, 5},   // 'c'
+    {1111, 5, 0, 7},   // 'd'
+    {1129, 5, 2, 5},   // 'e'
+    {1140, 4, 0, 7},   // 'f'
+    {1154, 5, 2, 5},   // 'g'
+    {1166, 5, 0, 7},   // 'h'
+    {1185, 3, 0, 7},   // 'i'
+    {1198, 4, 0, 7},   // 'j'
+    {1212, 5, 0, 7},   // 'k'
+    {1230, 3, 0, 7},   // 'l'
+    {1244, 5, 2, 5},   // 'm'
+    {1263, 5, 2, 5},   // 'n'
+    {1277, 5, 2, 5},   // 'o'
+    {1290, 5, 2, 5},   // 'p'
+    {1302, 5, 2, 5},   // 'q'
+    {1314, 5, 2, 5},   // 'r'
+    {1325, 5, 2, 5},   // 's'
+    {1335, 4, 0, 7},   // 't'
+    {1349, 5, 2, 5},   // 'u'
+    {1363, 5, 2, 5},   // 'v'
+    {1376, 5, 2, 5},   // 'w'
+    {1393, 5, 2, 5},   // 'x'
+    {1407, 5, 2, 5},   // 'y'
+    {1420, 5, 2, 5},   // 'z'
+    {1430, 4, 0, 7},   // '{'
+    {1444, 3, 0, 7},   // '|'
+    {1458, 4, 0, 7},   // '}'
+    {1472, 5, 1, 2},   // '~'
+};
+
+const meas_font_atlas_t font_5x7_atlas = {
+    .first_char = 0x16,
+    .last_char = 0x7E,
+    .fallback = ' ',
+    .glyphs = font_5x7_glyphs,
+    .runs = font_5x7_runs,
+    .kern = NULL,
+    .kern_count = 0,
+};
+
+// --- font_11x14 ---
+
+static const uint8_t font_11x14_runs[] = {
+    // 0x16
+    0x01, 0x92, 0x01, 0x92, 0x01, 0x92, 0x01, 0x92, 0x01, 0x92, 0x01, 0x92,
+    0x02, 0x30, 0x92, 0x02, 0x21, 0x92, 0x01, 0x1A, 0x01, 0x0B, 0x01, 0x1A,
+    0x01, 0x21, 0x01, 0x30,
+    // 0x17
+    0x01, 0x51, 0x01, 0x51, 0x01, 0x43, 0x01, 0x43, 0x01, 0x43, 0x02, 0x31,
+    0x62, 0x02, 0x31, 0x62, 0x02, 0x21, 0x72, 0x02, 0x21, 0x72, 0x02, 0x11,
+    0x82, 0x02, 0x11, 0x82, 0x02, 0x11, 0x82, 0x01, 0x0B,
+    // 0x18
+    0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x03, 0x01, 0x04, 0x01, 0x05,
+    0x01, 0x06, 0x01, 0x05, 0x01, 0x04, 0x01, 0x03, 0x01, 0x02, 0x01, 0x01,
+    0x01, 0x00,
+    // 0x19
+    0x02, 0x22, 0x72, 0x01, 0x19, 0x03, 0x02, 0x42, 0x92, 0x03, 0x01, 0x42,
+    0xA1, 0x03, 0x01, 0x51, 0xA1, 0x03, 0x01, 0x52, 0xA1, 0x03, 0x02, 0x52,
+    0x92, 0x01, 0x19, 0x02, 0x22, 0x72,
+    // 0x1A
+    0x01, 0x30, 0x01, 0x21, 0x01, 0x12, 0x01, 0x07, 0x01, 0x07, 0x01, 0x12,
+    0x01, 0x21, 0x01, 0x30,
+    // 0x1B
+    0x01, 0x40, 0x01, 0x41, 0x01, 0x42, 0x01, 0x07, 0x01, 0x07, 0x01, 0x42,
+    0x01, 0x41, 0x01, 0x40,
+    // 0x1C
+    0x01, 0x19, 0x01, 0x0A, 0x03, 0x00, 0x21, 0x71, 0x02, 0x21, 0x71, 0x02,
+    0x21, 0x71, 0x02, 0x21, 0x71, 0x02, 0x21, 0x71, 0x02, 0x21, 0x71, 0x02,
+    0x02, 0x74, 0x02, 0x02, 0x73,
+    // 0x1D
+    0x02, 0x12, 0x72, 0x02, 0x12, 0x72, 0x02, 0x12, 0x72, 0x02, 0x12, 0x72,
+    0x02, 0x12, 0x72, 0x03, 0x12, 0x63, 0xB0, 0x02, 0x15, 0x82, 0x01, 0x11,
+    0x01, 0x02, 0x01, 0x02,
+    // 0x1E
+    0x01, 0x43, 0x01, 0x27, 0x02, 0x12, 0x82, 0x02, 0x02, 0x92, 0x02, 0x02,
+    0x92, 0x02, 0x02, 0x92, 0x02, 0x02, 0x92, 0x02, 0x02, 0x92, 0x02, 0x02,
+    0x92, 0x02, 0x12, 0x82, 0x02, 0x22, 0x72, 0x04, 0x00, 0x31, 0x71, 0xB0,
+    0x02, 0x04, 0x74, 0x02, 0x04, 0x74,
+    // 0x1F
+    0x01, 0x32, 0x01, 0x24, 0x02, 0x11, 0x61, 0x02, 0x11, 0x61, 0x02, 0x11,
+    0x61, 0x01, 0x24, 0x01, 0x32,
+    // '!'
+    0x01, 0x21, 0x01, 0x21, 0x01, 0x13, 0x01, 0x13, 0x01, 0x13, 0x01, 0x13,
+    0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x00, 0x01, 0x21, 0x01,
+    0x13, 0x01, 0x21,
+    // '"'
+    0x02, 0x11, 0x51, 0x02, 0x11, 0x51, 0x02, 0x11, 0x51, 0x02, 0x11, 0x51,
+    0x02, 0x10, 0x50,
+    // '#'
+    0x02, 0x21, 0x61, 0x02, 0x21, 0x61, 0x02, 0x21, 0x61, 0x01, 0x09, 0x01,
+    0x09, 0x02, 0x21, 0x61, 0x02, 0x21, 0x61, 0x01, 0x09, 0x01, 0x09, 0x02,
+    0x21, 0x61, 0x02, 0x21, 0x61, 0x02, 0x21, 0x61,
+    // '$'
+    0x01, 0x24, 0x03, 0x11, 0x40, 0x61, 0x03, 0x01, 0x40, 0x70, 0x03, 0x01,
+    0x40, 0x70, 0x02, 0x02, 0x40, 0x01, 0x13, 0x01, 0x23, 0x01, 0x42, 0x02,
+    0x40, 0x61, 0x02, 0x40, 0x71, 0x03, 0x00, 0x40, 0x71, 0x03, 0x00, 0x40,
+    0x71, 0x03, 0x01, 0x40, 0x61, 0x01, 0x15,
+    // '%'
+    0x02, 0x12, 0xB0, 0x03, 0x00, 0x40, 0xA1, 0x03, 0x00, 0x40, 0x91, 0x03,
+    0x00, 0x40, 0x81, 0x03, 0x00, 0x40, 0x71, 0x02, 0x12, 0x61, 0x01, 0x51,
+    0x02, 0x41, 0x82, 0x03, 0x31, 0x70, 0xB0, 0x03, 0x21, 0x70, 0xB0, 0x03,
+    0x11, 0x70, 0xB0, 0x03, 0x01, 0x70, 0xB0, 0x02, 0x00, 0x82,
+    // '&'
+    0x01, 0x33, 0x02, 0x21, 0x70, 0x02, 0x21, 0x70, 0x02, 0x21, 0x70, 0x02,
+    0x21, 0x60, 0x02, 0x32, 0x83, 0x02, 0x31, 0x91, 0x03, 0x20, 0x41, 0x90,
+    0x03, 0x10, 0x42, 0x80, 0x02, 0x01, 0x52, 0x02, 0x01, 0x61, 0x03, 0x01,
+    0x62, 0xB0, 0x03, 0x02, 0x50, 0x74, 0x02, 0x13, 0x91,
+    // '\''
+    0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22,
+    // '('
+    0x01, 0x31, 0x01, 0x21, 0x01, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x01, 0x21, 0x01, 0x31,
+    // ')'
+    0x01, 0x01, 0x01, 0x11, 0x01, 0x21, 0x01, 0x31, 0x01, 0x31, 0x01, 0x31,
+    0x01, 0x31, 0x01, 0x31, 0x01, 0x21, 0x01, 0x11, 0x01, 0x01,
+    // '*'
+    0x01, 0x30, 0x03, 0x01, 0x30, 0x51, 0x03, 0x01, 0x30, 0x51, 0x01, 0x22,
+    0x03, 0x01, 0x30, 0x51, 0x03, 0x01, 0x30, 0x51, 0x01, 0x30,
+    // '+'
+    0x01, 0x31, 0x01, 0x31, 0x01, 0x31, 0x01, 0x07, 0x01, 0x07, 0x01, 0x31,
+    0x01, 0x31, 0x01, 0x31,
+    // ','
+    0x01, 0x11, 0x01, 0x03, 0x01, 0x12, 0x01, 0x02,
+    // '-'
+    0x01, 0x07, 0x01, 0x07,
+    // '.'
+    0x01, 0x11, 0x01, 0x03, 0x01, 0x11,
+    // '/'
+    0x01, 0x70, 0x01, 0x61, 0x01, 0x51, 0x01, 0x31, 0x01, 0x31, 0x01, 0x21,
+    0x01, 0x11, 0x01, 0x01, 0x01, 0x00,
+    // '0'
+    0x01, 0x25, 0x01, 0x17, 0x02, 0x03, 0x63, 0x02, 0x02, 0x72, 0x02, 0x02,
+    0x63, 0x02, 0x02, 0x54, 0x03, 0x02, 0x41, 0x72, 0x03, 0x02, 0x41, 0x72,
+    0x02, 0x04, 0x72, 0x02, 0x03, 0x72, 0x02, 0x02, 0x72, 0x02, 0x03, 0x63,
+    0x01, 0x17, 0x01, 0x25,
+    // '1'
+    0x01, 0x22, 0x01, 0x13, 0x01, 0x04, 0x01, 0x04, 0x01, 0x22, 0x01, 0x22,
+    0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22,
+    0x01, 0x06, 0x01, 0x06,
+    // '2'
+    0x01, 0x25, 0x01, 0x17, 0x02, 0x03, 0x63, 0x02, 0x02, 0x72, 0x01, 0x72,
+    0x01, 0x63, 0x01, 0x53, 0x01, 0x43, 0x01, 0x23, 0x01, 0x13, 0x01, 0x03,
+    0x01, 0x03, 0x01, 0x09, 0x01, 0x09,
+    // '3'
+    0x01, 0x25, 0x01, 0x17, 0x02, 0x03, 0x63, 0x02, 0x02, 0x72, 0x01, 0x72,
+    0x01, 0x63, 0x01, 0x35, 0x01, 0x35, 0x01, 0x63, 0x01, 0x72, 0x02, 0x02,
+    0x72, 0x02, 0x03, 0x63, 0x01, 0x17, 0x01, 0x25,
+    // '4'
+    0x02, 0x02, 0x62, 0x02, 0x02, 0x62, 0x02, 0x02, 0x62, 0x02, 0x02, 0x62,
+    0x02, 0x02, 0x62, 0x02, 0x02, 0x62, 0x02, 0x02, 0x62, 0x02, 0x02, 0x62,
+    0x02, 0x02, 0x62, 0x01, 0x09, 0x01, 0x09, 0x01, 0x62, 0x01, 0x62, 0x01,
+    0x62,
+    // '5'
+    0x01, 0x09, 0x01, 0x09, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x07,
+    0x01, 0x08, 0x02, 0x02, 0x63, 0x01, 0x72, 0x01, 0x72, 0x02, 0x02, 0x72,
+    0x02, 0x03, 0x63, 0x01, 0x17, 0x01, 0x25,
+    // '6'
+    0x01, 0x25, 0x01, 0x17, 0x02, 0x03, 0x63, 0x02, 0x02, 0x72, 0x01, 0x02,
+    0x02, 0x02, 0x43, 0x01, 0x08, 0x02, 0x03, 0x63, 0x02, 0x02, 0x72, 0x02,
+    0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x03, 0x63, 0x01, 0x17, 0x01, 0x25,
+    // '7'
+    0x01, 0x09, 0x01, 0x09, 0x02, 0x02, 0x72, 0x01, 0x72, 0x01, 0x72, 0x01,
+    0x63, 0x01, 0x53, 0x01, 0x43, 0x01, 0x33, 0x01, 0x32, 0x01, 0x32, 0x01,
+    0x32, 0x01, 0x32, 0x01, 0x32,
+    // '8'
+    0x01, 0x25, 0x01, 0x17, 0x02, 0x03, 0x63, 0x02, 0x02, 0x72, 0x02, 0x02,
+    0x72, 0x02, 0x03, 0x63, 0x01, 0x17, 0x01, 0x17, 0x02, 0x03, 0x63, 0x02,
+    0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x03, 0x63, 0x01, 0x17, 0x01, 0x25,
+    // '9'
+    0x01, 0x25, 0x01, 0x17, 0x02, 0x03, 0x63, 0x02, 0x02, 0x72, 0x02, 0x02,
+    0x72, 0x02, 0x02, 0x72, 0x02, 0x03, 0x63, 0x01, 0x18, 0x02, 0x23, 0x72,
+    0x01, 0x72, 0x02, 0x02, 0x72, 0x02, 0x03, 0x63, 0x01, 0x17, 0x01, 0x25,
+    // ':'
+    0x01, 0x11, 0x01, 0x03, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11,
+    0x01, 0x03, 0x01, 0x11,
+    // ';'
+    0x01, 0x11, 0x01, 0x03, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11,
+    0x01, 0x03, 0x01, 0x21, 0x01, 0x11,
+    // '<'
+    0x01, 0x81, 0x01, 0x62, 0x01, 0x42, 0x01, 0x22, 0x01, 0x02, 0x01, 0x02,
+    0x01, 0x22, 0x01, 0x42, 0x01, 0x62, 0x01, 0x81,
+    // '='
+    0x01, 0x09, 0x01, 0x09, 0x00, 0x00, 0x01, 0x09, 0x01, 0x09,
+    // '>'
+    0x01, 0x01, 0x01, 0x12, 0x01, 0x32, 0x01, 0x52, 0x01, 0x72, 0x01, 0x72,
+    0x01, 0x52, 0x01, 0x32, 0x01, 0x12, 0x01, 0x01,
+    // '?'
+    0x01, 0x25, 0x01, 0x17, 0x02, 0x03, 0x63, 0x02, 0x02, 0x72, 0x01, 0x72,
+    0x01, 0x72, 0x01, 0x62, 0x01, 0x52, 0x01, 0x42, 0x01, 0x32, 0x01, 0x32,
+    0x00, 0x01, 0x32, 0x01, 0x32,
+    // '@'
+    0x01, 0x43, 0x02, 0x21, 0x81, 0x02, 0x10, 0xA0, 0x04, 0x00, 0x51, 0x80,
+    0xB0, 0x04, 0x00, 0x40, 0x71, 0xB0, 0x04, 0x00, 0x30, 0x80, 0xB0, 0x04,
+    0x00, 0x30, 0x80, 0xB0, 0x04, 0x00, 0x30, 0x80, 0xB0, 0x04, 0x00, 0x30,
+    0x80, 0xB0, 0x04, 0x00, 0x40, 0x71, 0xB0, 0x03, 0x00, 0x51, 0x82, 0x01,
+    0x10, 0x01, 0x21, 0x01, 0x43,
+    // 'A'
+    0x01, 0x41, 0x01, 0x33, 0x01, 0x25, 0x01, 0x17, 0x02, 0x03, 0x63, 0x02,
+    0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x01, 0x09, 0x01, 0x09,
+    0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72,
+    // 'B'
+    0x01, 0x07, 0x01, 0x08, 0x02, 0x02, 0x63, 0x02, 0x02, 0x72, 0x02, 0x02,
+    0x72, 0x02, 0x02, 0x63, 0x01, 0x08, 0x01, 0x08, 0x02, 0x02, 0x63, 0x02,
+    0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x63, 0x01, 0x08, 0x01, 0x07,
+    // 'C'
+    0x01, 0x25, 0x01, 0x17, 0x02, 0x03, 0x63, 0x02, 0x02, 0x72, 0x01, 0x02,
+    0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02,
+    0x72, 0x02, 0x03, 0x63, 0x01, 0x17, 0x01, 0x25,
+    // 'D'
+    0x01, 0x07, 0x01, 0x08, 0x02, 0x02, 0x63, 0x02, 0x02, 0x72, 0x02, 0x02,
+    0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02,
+    0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x63, 0x01, 0x08,
+    0x01, 0x07,
+    // 'E'
+    0x01, 0x09, 0x01, 0x09, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+    0x01, 0x07, 0x01, 0x07, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+    0x01, 0x09, 0x01, 0x09,
+    // 'F'
+    0x01, 0x09, 0x01, 0x09, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+    0x01, 0x07, 0x01, 0x07, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+    0x01, 0x02, 0x01, 0x02,
+    // 'G'
+    0x01, 0x25, 0x01, 0x17, 0x02, 0x03, 0x63, 0x02, 0x02, 0x72, 0x01, 0x02,
+    0x01, 0x02, 0x02, 0x02, 0x54, 0x02, 0x02, 0x54, 0x02, 0x02, 0x72, 0x02,
+    0x02, 0x72, 0x02, 0x02, 0x63, 0x02, 0x03, 0x54, 0x02, 0x15, 0x81, 0x02,
+    0x23, 0x81,
+    // 'H'
+    0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72,
+    0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x01, 0x09, 0x01, 0x09, 0x02, 0x02,
+    0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02,
+    0x72, 0x02, 0x02, 0x72,
+    // 'I'
+    0x01, 0x06, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22,
+    0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22,
+    0x01, 0x22, 0x01, 0x06,
+    // 'J'
+    0x01, 0x36, 0x01, 0x36, 0x01, 0x62, 0x01, 0x62, 0x01, 0x62, 0x01, 0x62,
+    0x01, 0x62, 0x01, 0x62, 0x01, 0x62, 0x02, 0x02, 0x62, 0x02, 0x02, 0x62,
+    0x02, 0x03, 0x53, 0x01, 0x16, 0x01, 0x24,
+    // 'K'
+    0x02, 0x02, 0x82, 0x02, 0x02, 0x73, 0x02, 0x02, 0x63, 0x02, 0x02, 0x53,
+    0x02, 0x02, 0x43, 0x01, 0x06, 0x01, 0x05, 0x01, 0x05, 0x01, 0x06, 0x02,
+    0x02, 0x43, 0x02, 0x02, 0x53, 0x02, 0x02, 0x63, 0x02, 0x02, 0x73, 0x02,
+    0x02, 0x82,
+    // 'L'
+    0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+    0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+    0x01, 0x09, 0x01, 0x09,
+    // 'M'
+    0x02, 0x02, 0x82, 0x02, 0x02, 0x82, 0x02, 0x03, 0x73, 0x02, 0x04, 0x64,
+    0x01, 0x0A, 0x01, 0x0A, 0x01, 0x0A, 0x03, 0x02, 0x42, 0x82, 0x03, 0x02,
+    0x42, 0x82, 0x03, 0x02, 0x50, 0x82, 0x02, 0x02, 0x82, 0x02, 0x02, 0x82,
+    0x02, 0x02, 0x82, 0x02, 0x02, 0x82,
+    // 'N'
+    0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x03, 0x72,
+    0x02, 0x04, 0x72, 0x02, 0x05, 0x72, 0x01, 0x09, 0x02, 0x02, 0x45, 0x02,
+    0x02, 0x54, 0x02, 0x02, 0x63, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02,
+    0x02, 0x72, 0x02, 0x02, 0x72,
+    // 'O'
+    0x01, 0x25, 0x01, 0x17, 0x02, 0x03, 0x63, 0x02, 0x02, 0x72, 0x02, 0x02,
+    0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02,
+    0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x03, 0x63, 0x01, 0x17,
+    0x01, 0x25,
+    // 'P'
+    0x01, 0x07, 0x01, 0x08, 0x02, 0x02, 0x63, 0x02, 0x02, 0x72, 0x02, 0x02,
+    0x72, 0x02, 0x02, 0x63, 0x01, 0x08, 0x01, 0x07, 0x01, 0x02, 0x01, 0x02,
+    0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+    // 'Q'
+    0x01, 0x26, 0x01, 0x18, 0x02, 0x03, 0x73, 0x02, 0x02, 0x82, 0x02, 0x02,
+    0x82, 0x02, 0x02, 0x82, 0x02, 0x02, 0x82, 0x02, 0x02, 0x82, 0x03, 0x02,
+    0x42, 0x82, 0x02, 0x02, 0x46, 0x02, 0x02, 0x53, 0x02, 0x03, 0x63, 0x01,
+    0x19, 0x02, 0x24, 0x82,
+    // 'R'
+    0x01, 0x07, 0x01, 0x08, 0x02, 0x02, 0x63, 0x02, 0x02, 0x72, 0x02, 0x02,
+    0x72, 0x02, 0x02, 0x63, 0x01, 0x08, 0x01, 0x07, 0x01, 0x08, 0x02, 0x02,
+    0x63, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02,
+    0x72,
+    // 'S'
+    0x01, 0x25, 0x01, 0x17, 0x02, 0x03, 0x63, 0x02, 0x02, 0x72, 0x01, 0x02,
+    0x01, 0x03, 0x01, 0x16, 0x01, 0x26, 0x01, 0x63, 0x01, 0x72, 0x02, 0x02,
+    0x72, 0x02, 0x03, 0x63, 0x01, 0x17, 0x01, 0x25,
+    // 'T'
+    0x01, 0x0A, 0x01, 0x0A, 0x03, 0x00, 0x42, 0xA0, 0x01, 0x42, 0x01, 0x42,
+    0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42,
+    0x01, 0x42, 0x01, 0x42, 0x01, 0x42,
+    // 'U'
+    0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72,
+    0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72,
+    0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x03, 0x63,
+    0x01, 0x17, 0x01, 0x25,
+    // 'V'
+    0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72,
+    0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72,
+    0x02, 0x02, 0x72, 0x02, 0x03, 0x63, 0x01, 0x17, 0x01, 0x25, 0x01, 0x33,
+    0x01, 0x41,
+    // 'W'
+    0x02, 0x02, 0x82, 0x02, 0x02, 0x82, 0x02, 0x02, 0x82, 0x02, 0x02, 0x82,
+    0x02, 0x02, 0x82, 0x03, 0x02, 0x42, 0x82, 0x03, 0x02, 0x42, 0x82, 0x03,
+    0x02, 0x42, 0x82, 0x03, 0x02, 0x42, 0x82, 0x03, 0x02, 0x42, 0x82, 0x01,
+    0x0A, 0x01, 0x0A, 0x02, 0x13, 0x63, 0x02, 0x21, 0x71,
+    // 'X'
+    0x02, 0x02, 0x82, 0x02, 0x02, 0x82, 0x02, 0x02, 0x82, 0x02, 0x03, 0x73,
+    0x02, 0x13, 0x63, 0x01, 0x26, 0x01, 0x34, 0x01, 0x34, 0x01, 0x26, 0x02,
+    0x13, 0x63, 0x02, 0x03, 0x73, 0x02, 0x02, 0x82, 0x02, 0x02, 0x82, 0x02,
+    0x02, 0x82,
+    // 'Y'
+    0x02, 0x02, 0x82, 0x02, 0x02, 0x82, 0x02, 0x02, 0x82, 0x02, 0x03, 0x73,
+    0x02, 0x13, 0x63, 0x01, 0x26, 0x01, 0x34, 0x01, 0x42, 0x01, 0x42, 0x01,
+    0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42,
+    // 'Z'
+    0x01, 0x0A, 0x01, 0x0A, 0x01, 0x82, 0x01, 0x73, 0x01, 0x63, 0x01, 0x53,
+    0x01, 0x43, 0x01, 0x33, 0x01, 0x23, 0x01, 0x13, 0x01, 0x03, 0x01, 0x02,
+    0x01, 0x0A, 0x01, 0x0A,
+    // '['
+    0x01, 0x04, 0x01, 0x04, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+    0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+    0x01, 0x04, 0x01, 0x04,
+    // '\\'
+    0x01, 0x00, 0x01, 0x01, 0x01, 0x11, 0x01, 0x11, 0x01, 0x31, 0x01, 0x41,
+    0x01, 0x51, 0x01, 0x61, 0x01, 0x70,
+    // ']'
+    0x01, 0x04, 0x01, 0x04, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22,
+    0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22,
+    0x01, 0x04, 0x01, 0x04,
+    // '^'
+    0x01, 0x40, 0x01, 0x32, 0x02, 0x21, 0x51, 0x02, 0x11, 0x61, 0x02, 0x01,
+    0x71,
+    // '_'
+    0x01, 0x0A, 0x01, 0x0A,
+    // '`'
+    0x01, 0x11, 0x01, 0x21, 0x01, 0x31,
+    // 'a'
+    0x01, 0x17, 0x01, 0x09, 0x02, 0x02, 0x72, 0x01, 0x72, 0x01, 0x18, 0x01,
+    0x09, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x01, 0x0A, 0x02, 0x16, 0x91,
+    // 'b'
+    0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x43, 0x01,
+    0x08, 0x02, 0x03, 0x63, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02,
+    0x72, 0x02, 0x02, 0x72, 0x02, 0x03, 0x63, 0x01, 0x08, 0x02, 0x01, 0x34,
+    // 'c'
+    0x01, 0x25, 0x01, 0x17, 0x02, 0x03, 0x63, 0x02, 0x02, 0x72, 0x01, 0x02,
+    0x01, 0x02, 0x02, 0x02, 0x72, 0x02, 0x03, 0x63, 0x01, 0x17, 0x01, 0x25,
+    // 'd'
+    0x01, 0x72, 0x01, 0x72, 0x01, 0x72, 0x01, 0x72, 0x02, 0x23, 0x72, 0x01,
+    0x18, 0x02, 0x03, 0x63, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02,
+    0x72, 0x02, 0x02, 0x72, 0x02, 0x03, 0x72, 0x01, 0x18, 0x02, 0x24, 0x81,
+    // 'e'
+    0x01, 0x25, 0x01, 0x17, 0x02, 0x03, 0x63, 0x02, 0x02, 0x72, 0x01, 0x09,
+    0x01, 0x09, 0x01, 0x02, 0x02, 0x03, 0x81, 0x01, 0x18, 0x01, 0x26,
+    // 'f'
+    0x01, 0x45, 0x01, 0x36, 0x01, 0x32, 0x01, 0x32, 0x01, 0x08, 0x01, 0x08,
+    0x01, 0x32, 0x01, 0x32, 0x01, 0x32, 0x01, 0x32, 0x01, 0x32, 0x01, 0x32,
+    0x01, 0x32, 0x01, 0x32,
+    // 'g'
+    0x02, 0x24, 0x81, 0x01, 0x18, 0x02, 0x03, 0x72, 0x02, 0x02, 0x72, 0x02,
+    0x02, 0x72, 0x02, 0x03, 0x63, 0x01, 0x18, 0x01, 0x27, 0x01, 0x72, 0x01,
+    0x17,
+    // 'h'
+    0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x43, 0x01,
+    0x08, 0x02, 0x03, 0x63, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02,
+    0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02,
+    0x72,
+    // 'i'
+    0x01, 0x22, 0x01, 0x22, 0x00, 0x00, 0x01, 0x04, 0x01, 0x22, 0x01, 0x22,
+    0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22,
+    0x01, 0x06,
+    // 'j'
+    0x01, 0x52, 0x01, 0x52, 0x00, 0x00, 0x01, 0x34, 0x01, 0x52, 0x01, 0x52,
+    0x01, 0x52, 0x01, 0x52, 0x01, 0x52, 0x01, 0x52, 0x01, 0x52, 0x02, 0x02,
+    0x52, 0x01, 0x15,
+    // 'k'
+    0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x82, 0x02,
+    0x02, 0x73, 0x02, 0x02, 0x63, 0x02, 0x02, 0x53, 0x01, 0x07, 0x01, 0x07,
+    0x02, 0x02, 0x53, 0x02, 0x02, 0x63, 0x02, 0x02, 0x73, 0x02, 0x02, 0x82,
+    // 'l'
+    0x01, 0x04, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22,
+    0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22,
+    0x01, 0x22, 0x01, 0x06,
+    // 'm'
+    0x03, 0x01, 0x31, 0x62, 0x01, 0x09, 0x01, 0x0A, 0x03, 0x02, 0x42, 0x82,
+    0x03, 0x02, 0x42, 0x82, 0x03, 0x02, 0x42, 0x82, 0x03, 0x02, 0x42, 0x82,
+    0x03, 0x02, 0x42, 0x82, 0x03, 0x02, 0x42, 0x82, 0x03, 0x02, 0x42, 0x82,
+    // 'n'
+    0x02, 0x01, 0x34, 0x01, 0x08, 0x02, 0x03, 0x63, 0x02, 0x02, 0x72, 0x02,
+    0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02,
+    0x02, 0x72, 0x02, 0x02, 0x72,
+    // 'o'
+    0x01, 0x25, 0x01, 0x17, 0x02, 0x03, 0x63, 0x02, 0x02, 0x72, 0x02, 0x02,
+    0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x03, 0x63, 0x01, 0x17,
+    0x01, 0x25,
+    // 'p'
+    0x02, 0x01, 0x35, 0x01, 0x09, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02,
+    0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x01, 0x09, 0x01, 0x08,
+    0x01, 0x02,
+    // 'q'
+    0x02, 0x24, 0x82, 0x01, 0x18, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02,
+    0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x01, 0x18, 0x01, 0x27,
+    0x01, 0x72,
+    // 'r'
+    0x02, 0x01, 0x35, 0x01, 0x09, 0x02, 0x03, 0x72, 0x02, 0x02, 0x72, 0x01,
+    0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+    // 's'
+    0x01, 0x17, 0x01, 0x09, 0x02, 0x02, 0x72, 0x01, 0x02, 0x01, 0x08, 0x01,
+    0x18, 0x01, 0x72, 0x02, 0x02, 0x72, 0x01, 0x09, 0x01, 0x17,
+    // 't'
+    0x01, 0x32, 0x01, 0x32, 0x01, 0x32, 0x01, 0x32, 0x01, 0x08, 0x01, 0x08,
+    0x01, 0x32, 0x01, 0x32, 0x01, 0x32, 0x01, 0x32, 0x01, 0x32, 0x02, 0x32,
+    0x72, 0x01, 0x36, 0x01, 0x44,
+    // 'u'
+    0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72,
+    0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x03, 0x63,
+    0x01, 0x18, 0x02, 0x24, 0x81,
+    // 'v'
+    0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72,
+    0x02, 0x02, 0x72, 0x02, 0x03, 0x63, 0x01, 0x17, 0x01, 0x25, 0x01, 0x33,
+    0x01, 0x41,
+    // 'w'
+    0x02, 0x02, 0x82, 0x02, 0x02, 0x82, 0x03, 0x02, 0x42, 0x82, 0x03, 0x02,
+    0x42, 0x82, 0x03, 0x02, 0x42, 0x82, 0x03, 0x02, 0x42, 0x82, 0x03, 0x02,
+    0x42, 0x82, 0x01, 0x0A, 0x01, 0x18, 0x02, 0x22, 0x62,
+    // 'x'
+    0x02, 0x02, 0x82, 0x02, 0x03, 0x73, 0x02, 0x13, 0x63, 0x01, 0x26, 0x01,
+    0x34, 0x01, 0x34, 0x01, 0x26, 0x02, 0x13, 0x63, 0x02, 0x03, 0x73, 0x02,
+    0x02, 0x82,
+    // 'y'
+    0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72, 0x02, 0x02, 0x72,
+    0x02, 0x03, 0x72, 0x01, 0x18, 0x02, 0x32, 0x72, 0x01, 0x72, 0x02, 0x02,
+    0x72, 0x01, 0x17,
+    // 'z'
+    0x01, 0x09, 0x01, 0x09, 0x01, 0x62, 0x01, 0x52, 0x01, 0x42, 0x01, 0x32,
+    0x01, 0x22, 0x01, 0x12, 0x01, 0x09, 0x01, 0x09,
+    // '{'
+    0x01, 0x22, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x01,
+    0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x22,
+    // '|'
+    0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21,
+    0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21,
+    0x01, 0x21, 0x01, 0x21,
+    // '}'
+    0x01, 0x02, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x31,
+    0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x21, 0x01, 0x02,
+    // '~'
+    0x02, 0x22, 0x81, 0x03, 0x11, 0x41, 0x71, 0x02, 0x01, 0x52,
+};
+
+static const meas_atlas_glyph_t font_11x14_glyphs[] = {
+    {0, 14, 1, 13},    // 0x16
+    {28, 14, 1, 13},   // 0x17
+    {61, 9, 1, 13},    // 0x18
+    {87, 14, 2, 9},    // 0x19
+    {117, 10, 4, 8},   // 0x1A
+    {133, 10, 4, 8},   // 0x1B
+    {149, 13, 4, 10},  // 0x1C
+    {178, 14, 4, 10},  // 0x1D
+    {206, 14, 0, 14},  // 0x1E
+    {248, 10, 0, 7},   // 0x1F
+    {265, 7, 0, 0},    // ' '
+    {265, 7, 0, 14},   // '!'
+    {292, 9, 0, 5},    // '"'
+    {307, 12, 1, 12},  // '#'
+    {339, 11, 0, 14},  // '$'
+    {382, 14, 0, 13},  // '%'
+    {428, 14, 0, 14},  // '&'
+    {473, 7, 0, 4},    // '\''
+    {481, 7, 2, 11},   // '('
+    {503, 7, 2, 11},   // ')'
+    {525, 10, 3, 7},   // '*'
+    {547, 10, 3, 8},   // '+'
+    {563, 7, 10, 4},   // ','
+    {571, 10, 6, 2},   // '-'
+    {575, 7, 11, 3},   // '.'
+    {581, 10, 3, 9},   // '/'
+    {599, 12, 0, 14},  // '0'
+    {639, 9, 0, 14},   // '1'
+    {667, 12, 0, 14},  // '2'
+    {697, 12, 0, 14},  // '3'
+    {729, 12, 0, 14},  // '4'
+    {766, 12, 0, 14},  // '5'
+    {797, 12, 0, 14},  // '6'
+    {833, 12, 0, 14},  // '7'
+    {862, 12, 0, 14},  // '8'
+    {898, 12, 0, 14},  // '9'
+    {934, 7, 2, 10},   // ':'
+    {950, 7, 2, 11},   // ';'
+    {968, 12, 2, 10},  // '<'
+    {988, 12, 4, 6},   // '='
+    {998, 12, 2, 10},  // '>'
+    {1018, 12, 0, 14}, // '?'
+    {1047, 14, 0, 14}, // '@'
+    {1100, 12, 0, 14}, // 'A'
+    {1136, 12, 0, 14}, // 'B'
+    {1172, 12, 0, 14}, // 'C'
+    {1204, 12, 0, 14}, // 'D'
+    {1242, 12, 0, 14}, // 'E'
+    {1270, 12, 0, 14}, // 'F'
+    {1298, 12, 0, 14}, // 'G'
+    {1336, 12, 0, 14}, // 'H'
+    {1376, 9, 0, 14},  // 'I'
+    {1404, 12, 0, 14}, // 'J'
+    {1435, 13, 0, 14}, // 'K'
+    {1473, 12, 0, 14}, // 'L'
+    {1501, 13, 0, 14}, // 'M'
+    {1543, 12, 0, 14}, // 'N'
+    {1584, 12, 0, 14}, // 'O'
+    {1622, 12, 0, 14}, // 'P'
+    {1654, 13, 0, 14}, // 'Q'
+    {1694, 12, 0, 14}, // 'R'
+    {1731, 12, 0, 14}, // 'S'
+    {1763, 13, 0, 14}, // 'T'
+    {1793, 12, 0, 14}, // 'U'
+    {1833, 12, 0, 14}, // 'V'
+    {1871, 13, 0, 14}, // 'W'
+    {1916, 13, 0, 14}, // 'X'
+    {1954, 13, 0, 14}, // 'Y'
+    {1987, 13, 0, 14}, // 'Z'
+    {2015, 7, 0, 14},  // '['
+    {2043, 10, 3, 9},  // '\\'
+    {2061, 7, 0, 14},  // ']'
+    {2089, 11, 0, 5},  // '^'
+    {2102, 13, 12, 2}, // '_'
+    {2106, 7, 0, 3},   // '`'
+    {2112, 13, 4, 10}, // 'a'
+    {2136, 12, 0, 14}, // 'b'
+    {2172, 12, 4, 10}, // 'c'
+    {2196, 12, 0, 14}, // 'd'
+    {2232, 12, 4, 10}, // 'e'
+    {2255, 12, 0, 14}, // 'f'
+    {2283, 12, 4, 10}, // 'g'
+    {2308, 12, 0, 14}, // 'h'
+    {2345, 9, 0, 14},  // 'i'
+    {2371, 10, 0, 14}, // 'j'
+    {2398, 13, 0, 14}, // 'k'
+    {2434, 9, 0, 14},  // 'l'
+    {2462, 13, 4, 10}, // 'm'
+    {2498, 12, 4, 10}, // 'n'
+    {2527, 12, 4, 10}, // 'o'
+    {2553, 12, 4, 10}, // 'p'
+    {2579, 13, 4, 10}, // 'q'
+    {2605, 12, 4, 10}, // 'r'
+    {2628, 12, 4, 10}, // 's'
+    {2650, 12, 0, 14}, // 't'
+    {2679, 12, 4, 10}, // 'u'
+    {2708, 12, 4, 10}, // 'v'
+    {2734, 13, 4, 10}, // 'w'
+    {2767, 13, 4, 10}, // 'x'
+    {2793, 12, 4, 10}, // 'y'
+    {2820, 12, 4, 10}, // 'z'
+    {2840, 7, 2, 11},  // '{'
+    {2862, 7, 0, 14},  // '|'
+    {2890, 7, 2, 11},  // '}'
+    {2912, 11, 4, 3},  // '~'
+};
+
+const meas_font_atlas_t font_11x14_atlas = {
+    .first_char = 0x16,
+    .last_char = 0x7E,
+    .fallback = ' ',
+    .glyphs = font_11x14_glyphs,
+    .runs = font_11x14_runs,
+    .kern = NULL,
+    .kern_count = 0,
+};
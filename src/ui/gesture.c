@@ -0,0 +1,258 @@
+/**
+ * @file gesture.c
+ * @brief Touch Gesture Recognizer.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Fixed-point throughout: positions are smoothed in 1/16 px, velocities are
+ * kept in 1/256 px per MEAS_GESTURE_TICK_MS step so inertia is a plain
+ * add-and-decay per step.
+ */
+
+#include "measlib/ui/gesture.h"
+#include <stddef.h>
+
+typedef enum {
+  GESTURE_IDLE = 0,
+  GESTURE_PENDING, // Down, within slop, long press not reached
+  GESTURE_HOLD,    // Long press reported, still within slop
+  GESTURE_MOVE,    // Dragging (pan or zoom)
+  GESTURE_INERTIA, // Released with speed, coasting
+} gesture_state_t;
+
+// Finger stopped this long before lifting: no fling
+#define GESTURE_STALE_MS (3 * MEAS_GESTURE_TICK_MS)
+
+// Coasting ends below a quarter pixel per step
+#define GESTURE_STOP_Q8 64
+
+// Catch-up limit when tick() was not called for a while
+#define GESTURE_MAX_STEPS 8
+
+static inline int16_t median3(int16_t a, int16_t b, int16_t c) {
+  int16_t lo = (a < b) ? a : b;
+  int16_t hi = (a < b) ? b : a;
+  if (c < lo)
+    return lo;
+  return (c > hi) ? hi : c;
+}
+
+static inline int32_t abs32(int32_t v) { return (v < 0) ? -v : v; }
+
+static void gesture_emit(meas_gesture_t *g, meas_gesture_kind_t kind,
+                         int16_t x, int16_t y, int16_t dx, int16_t dy) {
+  if (!g->sink)
+    return;
+  meas_gesture_event_t ev = {
+      .kind = kind, .x = x, .y = y, .dx = dx, .dy = dy};
+  g->sink(&ev, g->user_data);
+}
+
+static inline int16_t pos_x(const meas_gesture_t *g) {
+  return (int16_t)((g->fx_q4 + 8) >> 4);
+}
+
+static inline int16_t pos_y(const meas_gesture_t *g) {
+  return (int16_t)((g->fy_q4 + 8) >> 4);
+}
+
+void meas_gesture_init(meas_gesture_t *g, const meas_gesture_config_t *cfg,
+                       meas_gesture_sink_t sink, void *user_data) {
+  if (!g)
+    return;
+  static const meas_gesture_config_t defaults = MEAS_GESTURE_CONFIG_DEFAULT;
+  *g = (meas_gesture_t){0};
+  g->cfg = cfg ? *cfg : defaults;
+  g->sink = sink;
+  g->user_data = user_data;
+  g->state = GESTURE_IDLE;
+}
+
+static void gesture_down(meas_gesture_t *g, const meas_point_t *pt,
+                         uint32_t now_ms) {
+  g->state = GESTURE_PENDING;
+  g->zoom = false;
+  g->hist_count = 1;
+  g->hist_x[0] = pt->x;
+  g->hist_y[0] = pt->y;
+  g->fx_q4 = (int32_t)pt->x << 4;
+  g->fy_q4 = (int32_t)pt->y << 4;
+  g->down_x = g->last_x = pt->x;
+  g->down_y = g->last_y = pt->y;
+  g->down_ms = now_ms;
+  g->sample_ms = now_ms;
+  g->vx_q8 = g->vy_q8 = 0;
+  gesture_emit(g, MEAS_GESTURE_PRESS, pt->x, pt->y, 0, 0);
+}
+
+static void gesture_move(meas_gesture_t *g, const meas_point_t *pt,
+                         uint32_t now_ms) {
+  // De-spike: median of the last three raw samples
+  g->hist_x[2] = g->hist_x[1];
+  g->hist_x[1] = g->hist_x[0];
+  g->hist_x[0] = pt->x;
+  g->hist_y[2] = g->hist_y[1];
+  g->hist_y[1] = g->hist_y[0];
+  g->hist_y[0] = pt->y;
+  int16_t mx = pt->x;
+  int16_t my = pt->y;
+  if (g->hist_count < 3) {
+    g->hist_count++;
+  } else {
+    mx = median3(g->hist_x[0], g->hist_x[1], g->hist_x[2]);
+    my = median3(g->hist_y[0], g->hist_y[1], g->hist_y[2]);
+  }
+
+  // Smooth: first-order IIR, half weight on the new sample
+  int32_t old_fx = g->fx_q4;
+  int32_t old_fy = g->fy_q4;
+  g->fx_q4 += (((int32_t)mx << 4) - g->fx_q4) / 2;
+  g->fy_q4 += (((int32_t)my << 4) - g->fy_q4) / 2;
+
+  // Velocity per step, averaged with the previous estimate
+  uint32_t dt = now_ms - g->sample_ms;
+  if (dt > 0) {
+    int32_t ivx = (g->fx_q4 - old_fx) * 16 * MEAS_GESTURE_TICK_MS / (int32_t)dt;
+    int32_t ivy = (g->fy_q4 - old_fy) * 16 * MEAS_GESTURE_TICK_MS / (int32_t)dt;
+    g->vx_q8 = (g->vx_q8 + ivx) / 2;
+    g->vy_q8 = (g->vy_q8 + ivy) / 2;
+    g->sample_ms = now_ms;
+  }
+
+  int16_t x = pos_x(g);
+  int16_t y = pos_y(g);
+
+  if (g->state == GESTURE_PENDING || g->state == GESTURE_HOLD) {
+    int32_t ddx = x - g->down_x;
+    int32_t ddy = y - g->down_y;
+    int32_t slop = g->cfg.slop_px;
+    if (ddx * ddx + ddy * ddy <= slop * slop)
+      return;
+    g->zoom = (g->state == GESTURE_HOLD);
+    g->state = GESTURE_MOVE;
+  }
+
+  if (x == g->last_x && y == g->last_y)
+    return;
+  gesture_emit(g, g->zoom ? MEAS_GESTURE_ZOOM : MEAS_GESTURE_DRAG, x, y,
+               (int16_t)(x - g->last_x), (int16_t)(y - g->last_y));
+  g->last_x = x;
+  g->last_y = y;
+}
+
+static void gesture_up(meas_gesture_t *g, uint32_t now_ms) {
+  int16_t x = pos_x(g);
+  int16_t y = pos_y(g);
+
+  if (g->state == GESTURE_PENDING)
+    gesture_emit(g, MEAS_GESTURE_TAP, g->down_x, g->down_y, 0, 0);
+  gesture_emit(g, MEAS_GESTURE_RELEASE, x, y, 0, 0);
+
+  if (g->state != GESTURE_MOVE || now_ms - g->sample_ms > GESTURE_STALE_MS) {
+    g->state = GESTURE_IDLE;
+    return;
+  }
+
+  // Speed in px/s; the larger axis decides whether this is a fling
+  int32_t sx = g->vx_q8 * 1000 / (256 * MEAS_GESTURE_TICK_MS);
+  int32_t sy = g->vy_q8 * 1000 / (256 * MEAS_GESTURE_TICK_MS);
+  int32_t speed = (abs32(sx) > abs32(sy)) ? abs32(sx) : abs32(sy);
+  if (speed < g->cfg.fling_min_px_s) {
+    g->state = GESTURE_IDLE;
+    return;
+  }
+
+  gesture_emit(g, MEAS_GESTURE_FLING, x, y, (int16_t)sx, (int16_t)sy);
+  g->state = GESTURE_INERTIA;
+  g->ix_q8 = 0;
+  g->iy_q8 = 0;
+  g->next_step_ms = now_ms + MEAS_GESTURE_TICK_MS;
+}
+
+void meas_gesture_feed(meas_gesture_t *g, const meas_point_t *pt,
+                       uint32_t now_ms) {
+  if (!g)
+    return;
+
+  if (!pt) {
+    if (g->state != GESTURE_IDLE && g->state != GESTURE_INERTIA)
+      gesture_up(g, now_ms);
+    return;
+  }
+
+  // A new touch also stops coasting
+  if (g->state == GESTURE_IDLE || g->state == GESTURE_INERTIA)
+    gesture_down(g, pt, now_ms);
+  else
+    gesture_move(g, pt, now_ms);
+}
+
+void meas_gesture_tick(meas_gesture_t *g, uint32_t now_ms) {
+  if (!g)
+    return;
+
+  if (g->state == GESTURE_PENDING) {
+    if (now_ms - g->down_ms >= g->cfg.long_press_ms) {
+      g->state = GESTURE_HOLD;
+      gesture_emit(g, MEAS_GESTURE_LONG_PRESS, g->down_x, g->down_y, 0, 0);
+    }
+    return;
+  }
+
+  if (g->state != GESTURE_INERTIA)
+    return;
+
+  // Fixed-rate integration; all steps due now are reported as one event
+  uint8_t steps = 0;
+  while ((int32_t)(now_ms - g->next_step_ms) >= 0) {
+    g->ix_q8 += g->vx_q8;
+    g->iy_q8 += g->vy_q8;
+    g->vx_q8 = g->vx_q8 * g->cfg.friction_q8 / 256;
+    g->vy_q8 = g->vy_q8 * g->cfg.friction_q8 / 256;
+    g->next_step_ms += MEAS_GESTURE_TICK_MS;
+
+    if (abs32(g->vx_q8) < GESTURE_STOP_Q8 &&
+        abs32(g->vy_q8) < GESTURE_STOP_Q8) {
+      g->state = GESTURE_IDLE;
+      break;
+    }
+    if (++steps >= GESTURE_MAX_STEPS) {
+      g->next_step_ms = now_ms + MEAS_GESTURE_TICK_MS;
+      break;
+    }
+  }
+
+  int16_t dx = (int16_t)(g->ix_q8 / 256);
+  int16_t dy = (int16_t)(g->iy_q8 / 256);
+  if (dx == 0 && dy == 0)
+    return;
+  g->ix_q8 -= (int32_t)dx * 256;
+  g->iy_q8 -= (int32_t)dy * 256;
+  g->last_x += dx;
+  g->last_y += dy;
+  gesture_emit(g, g->zoom ? MEAS_GESTURE_ZOOM : MEAS_GESTURE_SCROLL, g->last_x,
+               g->last_y, dx, dy);
+}
+
+bool meas_gesture_active(const meas_gesture_t *g) {
+  return g && g->state != GESTURE_IDLE;
+}
+
+int64_t meas_gesture_pack(const meas_gesture_event_t *ev) {
+  uint16_t x = (ev->x < 0) ? 0 : (ev->x > 0xFFF) ? 0xFFF : (uint16_t)ev->x;
+  uint16_t y = (ev->y < 0) ? 0 : (ev->y > 0xFFF) ? 0xFFF : (uint16_t)ev->y;
+  uint64_t p = (uint64_t)(uint16_t)ev->dx | ((uint64_t)(uint16_t)ev->dy << 16) |
+               ((uint64_t)x << 32) | ((uint64_t)y << 44) |
+               ((uint64_t)(uint8_t)ev->kind << 56);
+  return (int64_t)p;
+}
+
+void meas_gesture_unpack(int64_t payload, meas_gesture_event_t *ev) {
+  uint64_t p = (uint64_t)payload;
+  ev->dx = (int16_t)(uint16_t)(p & 0xFFFFU);
+  ev->dy = (int16_t)(uint16_t)((p >> 16) & 0xFFFFU);
+  ev->x = (int16_t)((p >> 32) & 0xFFFU);
+  ev->y = (int16_t)((p >> 44) & 0xFFFU);
+  ev->kind = (meas_gesture_kind_t)((p >> 56) & 0xFFU);
+}
@@ -0,0 +1,81 @@
+/**
+ * @file layer_cache.c
+ * @brief Static Layer Cache (RLE Tiles).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Background gradients and graticules are long horizontal runs of one color,
+ * so a tile typically collapses to a few runs per row.
+ */
+
+#include "measlib/ui/layer_cache.h"
+
+void meas_layer_cache_reset(meas_layer_cache_t *cache) {
+  if (!cache)
+    return;
+  cache->runs_used = 0;
+  cache->valid_map = 0;
+  cache->full = false;
+}
+
+meas_status_t meas_layer_cache_store(meas_layer_cache_t *cache, uint16_t tile,
+                                     const meas_tile_pixel_t *pixels,
+                                     size_t count) {
+  if (!cache || !pixels || count == 0 || tile >= MEAS_UI_TILE_COUNT)
+    return MEAS_ERROR;
+  if (cache->full)
+    return MEAS_ERROR;
+
+  cache->valid_map &= ~(1UL << tile);
+
+  uint16_t first = cache->runs_used;
+  uint16_t n = first;
+  size_t i = 0;
+  while (i < count) {
+    if (n >= MEAS_LAYER_CACHE_RUNS) {
+      // Discard the partial encoding; later tiles would not fit either
+      cache->full = true;
+      return MEAS_ERROR;
+    }
+    meas_tile_pixel_t color = pixels[i];
+    size_t start = i;
+    while (i < count && pixels[i] == color && (i - start) < UINT16_MAX) {
+      i++;
+    }
+    cache->runs[n].length = (uint16_t)(i - start);
+    cache->runs[n].color = color;
+    n++;
+  }
+
+  cache->tile_first[tile] = first;
+  cache->tile_runs[tile] = (uint16_t)(n - first);
+  cache->runs_used = n;
+  cache->valid_map |= (1UL << tile);
+  return MEAS_OK;
+}
+
+bool meas_layer_cache_restore(const meas_layer_cache_t *cache, uint16_t tile,
+                              meas_tile_pixel_t *pixels, size_t count) {
+  if (!cache || !pixels || tile >= MEAS_UI_TILE_COUNT)
+    return false;
+  if (!(cache->valid_map & (1UL << tile)))
+    return false;
+
+  const meas_rle_run_t *run = &cache->runs[cache->tile_first[tile]];
+  const meas_rle_run_t *end = run + cache->tile_runs[tile];
+  meas_tile_pixel_t *dst = pixels;
+  meas_tile_pixel_t *dst_end = pixels + count;
+
+  for (; run < end; run++) {
+    uint16_t len = run->length;
+    if ((size_t)(dst_end - dst) < len)
+      return false; // Tile geometry changed since encoding
+    meas_tile_pixel_t c = run->color;
+    for (uint16_t k = 0; k < len; k++) {
+      dst[k] = c;
+    }
+    dst += len;
+  }
+  return dst == dst_end;
+}
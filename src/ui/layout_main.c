@@ -6,7 +6,10 @@
  * @copyright (c) 2026 momentics
  */
 
+#include "measlib/ui/components/widget.h"
 #include "measlib/ui/core.h"
+#include "measlib/ui/gesture.h"
+#include "measlib/ui/smith.h"
 #include <stddef.h>
 
 // --- Pipeline Steps ---
@@ -29,6 +32,17 @@ static void step_draw_grid(const meas_ui_t *ui, meas_render_ctx_t *ctx,
   api->draw_line(ctx, 0, 120, 320, 120, MEAS_ALPHA_OPAQUE);
 }
 
+static bool has_chart(const meas_ui_t *ui) { return ui && ui->chart; }
+
+static bool has_no_chart(const meas_ui_t *ui) { return !has_chart(ui); }
+
+static void step_draw_chart(const meas_ui_t *ui, meas_render_ctx_t *ctx,
+                            const meas_render_api_t *api) {
+  // Layer 1: Smith / polar graticule (replaces the rectangular grid)
+  ctx->fg_color = 0x07E0; // Green
+  meas_smith_draw(ui->chart, ctx, api, MEAS_ALPHA_OPAQUE);
+}
+
 static void step_draw_traces(const meas_ui_t *ui, meas_render_ctx_t *ctx,
                              const meas_render_api_t *api) {
   (void)ui;
@@ -69,14 +83,26 @@ static void step_draw_overlay(const meas_ui_t *ui, meas_render_ctx_t *ctx,
   api->draw_round_rect(ctx, rr, 10, MEAS_ALPHA_OPAQUE);
 }
 
+static bool has_widgets(const meas_ui_t *ui) {
+  return ui && ui->widgets;
+}
+
+static void step_draw_widgets(const meas_ui_t *ui, meas_render_ctx_t *ctx,
+                              const meas_render_api_t *api) {
+  // Retained widgets sit on top of the overlay
+  meas_widget_tree_draw(ui->widgets, ctx, api);
+}
+
 // --- Pipeline Definition ---
 
 static const meas_render_step_t render_pipeline[] = {
     {RENDER_STAGE_BG, NULL, step_draw_bg},
-    {RENDER_STAGE_GRID, NULL, step_draw_grid},
+    {RENDER_STAGE_GRID, has_no_chart, step_draw_grid},
+    {RENDER_STAGE_GRID, has_chart, step_draw_chart},
     {RENDER_STAGE_TRACE, NULL, step_draw_traces},
     {RENDER_STAGE_MARKER, NULL, NULL}, // No markers yet
-    {RENDER_STAGE_OVERLAY, NULL, step_draw_overlay}};
+    {RENDER_STAGE_OVERLAY, NULL, step_draw_overlay},
+    {RENDER_STAGE_OVERLAY, has_widgets, step_draw_widgets}};
 
 static const size_t PIPELINE_STEPS =
     sizeof(render_pipeline) / sizeof(render_pipeline[0]);
@@ -89,9 +115,16 @@ static meas_status_t layout_main_update(meas_ui_t *ui) {
 }
 
 static meas_status_t layout_main_handle_input(meas_ui_t *ui,
-                                              meas_variant_t input) {
-  (void)ui;
-  (void)input;
+                                              const meas_event_t *input) {
+  if (!ui || !input)
+    return MEAS_ERROR;
+
+  // Gestures go to the widget tree; key codes are INT64 payloads too
+  if (ui->widgets && input->type == EVENT_INPUT_GESTURE) {
+    meas_gesture_event_t ev;
+    meas_gesture_unpack(input->payload.i_val, &ev);
+    meas_widget_tree_dispatch(ui->widgets, &ev);
+  }
   return MEAS_OK;
 }
 
@@ -107,6 +140,11 @@ static meas_status_t layout_main_draw(meas_ui_t *ui, meas_render_ctx_t *ctx,
   for (size_t i = 0; i < PIPELINE_STEPS; i++) {
     const meas_render_step_t *step = &render_pipeline[i];
 
+    // Stage masked by the renderer (e.g. served from the static cache)
+    if (ui && (ui->stage_skip & (1U << step->stage))) {
+      continue;
+    }
+
     // Check Condition
     if (step->condition && !step->condition(ui)) {
       continue;
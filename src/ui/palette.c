@@ -0,0 +1,153 @@
+/**
+ * @file palette.c
+ * @brief Indexed Color Palette (8-bit tiles).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * The inverse table is rebuilt on every palette load (512 cells x 256
+ * entries); lookups afterwards are a single table read. Lookups before the
+ * first load bring in the default palette.
+ */
+
+#include "measlib/ui/palette.h"
+#include "measlib/ui/colors.h"
+#include <stdbool.h>
+
+meas_pixel_t meas_palette_lut[MEAS_PALETTE_SIZE];
+uint8_t meas_palette_inverse[MEAS_PALETTE_INVERSE_SIZE];
+bool meas_palette_ready = false;
+
+// Memo for meas_palette_match(), direct mapped
+#define PALETTE_MEMO_SIZE 8
+
+static struct {
+  meas_pixel_t color;
+  uint8_t index;
+  bool valid;
+} palette_memo[PALETTE_MEMO_SIZE];
+
+// --- Color Distance ---
+
+/*
+ * Components are compared on the 6-bit green scale (red and blue doubled)
+ * with weights 3:4:2, which keeps greens and reds apart better than a plain
+ * RGB distance at no extra cost.
+ */
+static uint32_t color_distance(meas_pixel_t a, meas_pixel_t b) {
+  int32_t dr = ((int32_t)(a >> 11) - (int32_t)(b >> 11)) * 2;
+  int32_t dg = (int32_t)((a >> 5) & 0x3FU) - (int32_t)((b >> 5) & 0x3FU);
+  int32_t db = ((int32_t)(a & 0x1FU) - (int32_t)(b & 0x1FU)) * 2;
+  return (uint32_t)(3 * dr * dr + 4 * dg * dg + 2 * db * db);
+}
+
+static uint8_t palette_nearest(meas_pixel_t color) {
+  uint8_t best = 0;
+  uint32_t best_d = UINT32_MAX;
+  for (uint16_t i = 0; i < MEAS_PALETTE_SIZE && best_d; i++) {
+    uint32_t d = color_distance(color, meas_palette_lut[i]);
+    if (d < best_d) {
+      best_d = d;
+      best = (uint8_t)i;
+    }
+  }
+  return best;
+}
+
+static void palette_build_inverse(void) {
+  // Each cell maps its center to the nearest entry
+  for (uint32_t cell = 0; cell < MEAS_PALETTE_INVERSE_SIZE; cell++) {
+    uint32_t r = ((cell >> 6) << 2) | 2U;
+    uint32_t g = (((cell >> 3) & 0x7U) << 3) | 4U;
+    uint32_t b = ((cell & 0x7U) << 2) | 2U;
+    meas_palette_inverse[cell] =
+        palette_nearest((meas_pixel_t)((r << 11) | (g << 5) | b));
+  }
+
+  for (uint8_t i = 0; i < PALETTE_MEMO_SIZE; i++)
+    palette_memo[i].valid = false;
+  meas_palette_ready = true;
+}
+
+// --- Palette Loading ---
+
+static uint16_t palette_add(uint16_t n, meas_pixel_t color) {
+  if (n >= MEAS_PALETTE_SIZE)
+    return n;
+  for (uint16_t i = 0; i < n; i++) {
+    if (meas_palette_lut[i] == color)
+      return n;
+  }
+  meas_palette_lut[n] = color;
+  return (uint16_t)(n + 1);
+}
+
+static meas_pixel_t rgb565(uint32_t r8, uint32_t g8, uint32_t b8) {
+  return (meas_pixel_t)(((r8 >> 3) << 11) | ((g8 >> 2) << 5) | (b8 >> 3));
+}
+
+void meas_palette_init(void) {
+  uint16_t n = 0;
+  for (uint16_t i = 0; i < MEAS_UI_COLOR_MAX; i++)
+    n = palette_add(n, meas_ui_theme_default[i]);
+
+  for (uint32_t r = 0; r < 6; r++) {
+    for (uint32_t g = 0; g < 6; g++) {
+      for (uint32_t b = 0; b < 6; b++)
+        n = palette_add(n, rgb565(r * 51U, g * 51U, b * 51U));
+    }
+  }
+
+  // Gray ramp in the remaining slots (odd steps miss the cube's grays)
+  for (uint32_t v = 8; n < MEAS_PALETTE_SIZE && v < 256; v += 16)
+    n = palette_add(n, rgb565(v, v, v));
+  for (; n < MEAS_PALETTE_SIZE; n++)
+    meas_palette_lut[n] = meas_palette_lut[n - 1];
+
+  palette_build_inverse();
+}
+
+meas_status_t meas_palette_load(const meas_pixel_t *colors, uint16_t count) {
+  if (!colors || count == 0 || count > MEAS_PALETTE_SIZE)
+    return MEAS_ERROR;
+
+  for (uint16_t i = 0; i < MEAS_PALETTE_SIZE; i++)
+    meas_palette_lut[i] = colors[(i < count) ? i : count - 1];
+
+  palette_build_inverse();
+  return MEAS_OK;
+}
+
+// --- Lookup ---
+
+uint8_t meas_palette_match(meas_pixel_t color) {
+  if (!meas_palette_ready)
+    meas_palette_init();
+
+  uint8_t slot = (uint8_t)((color ^ (color >> 5) ^ (color >> 11)) &
+                           (PALETTE_MEMO_SIZE - 1));
+  if (palette_memo[slot].valid && palette_memo[slot].color == color)
+    return palette_memo[slot].index;
+
+  uint8_t index = palette_nearest(color);
+  palette_memo[slot].color = color;
+  palette_memo[slot].index = index;
+  palette_memo[slot].valid = true;
+  return index;
+}
+
+void meas_palette_expand(meas_pixel_t *dst, const uint8_t *src, size_t n) {
+  if (!dst || !src)
+    return;
+  if (!meas_palette_ready)
+    meas_palette_init();
+  const meas_pixel_t *lut = meas_palette_lut;
+  for (; n >= 4; n -= 4, dst += 4, src += 4) {
+    dst[0] = lut[src[0]];
+    dst[1] = lut[src[1]];
+    dst[2] = lut[src[2]];
+    dst[3] = lut[src[3]];
+  }
+  while (n--)
+    *dst++ = lut[*src++];
+}
@@ -9,9 +9,11 @@
  * directly on a meas_render_ctx_t buffer (Tile/Framebuffer).
  */
 
+#include "measlib/ui/font_atlas.h"
+#include "measlib/ui/palette.h"
 #include "measlib/ui/render.h"
 #include <stdlib.h> // abs
-#include <string.h> // memcpy
+#include <string.h> // memcpy, memset
 
 // --- Primitives (Cell/Tile Operations) ---
 
@@ -70,6 +72,35 @@ static meas_rect_t cell_pop_clip_rect(meas_render_ctx_t *ctx) {
 
 // --- Helpers ---
 
+/*
+ * RGB565 blending works on the "split" layout 0x07E0F81F: green moves to the
+ * upper half-word while red and blue stay in the lower one, so every field is
+ * followed by at least 5 zero bits. A 5-bit alpha multiply and the sum of the
+ * two weighted terms then fit without carries between fields:
+ *   out = (fg * a + bg * (32 - a)) >> 5,  a = 0..32
+ * A 32-bit word holding two pixels [p1:p0] yields two split words at once:
+ *   lo = w & MASK          -> p0.RB, p1.G
+ *   hi = ror16(w) & MASK   -> p1.RB, p0.G
+ * both blended with a single multiply each, and recombined as
+ * lo | ror16(hi). The order of the pixels in the word does not matter.
+ */
+#define RGB565_SPLIT_MASK 0x07E0F81FUL
+
+static inline uint32_t rgb565_split(meas_pixel_t c) {
+  return ((uint32_t)c | ((uint32_t)c << 16)) & RGB565_SPLIT_MASK;
+}
+
+static inline meas_pixel_t rgb565_join(uint32_t v) {
+  return (meas_pixel_t)((v >> 16) | v);
+}
+
+static inline uint32_t ror16(uint32_t v) { return (v >> 16) | (v << 16); }
+
+// 8-bit opacity to the 0..32 blend weight
+static inline uint32_t alpha_weight(uint8_t alpha) {
+  return ((uint32_t)alpha + 4U) >> 3;
+}
+
 static inline meas_pixel_t alpha_blend(meas_pixel_t bg, meas_pixel_t fg,
                                        uint8_t alpha) {
   if (alpha == MEAS_ALPHA_TRANSPARENT)
@@ -77,24 +108,253 @@ static inline meas_pixel_t alpha_blend(meas_pixel_t bg, meas_pixel_t fg,
   if (alpha == MEAS_ALPHA_OPAQUE)
     return fg;
 
-  // Extract RGB (RGB565)
-  uint32_t r_bg = (bg >> 11) & 0x1F;
-  uint32_t g_bg = (bg >> 5) & 0x3F;
-  uint32_t b_bg = bg & 0x1F;
+  uint32_t a = alpha_weight(alpha);
+  uint32_t v = (rgb565_split(fg) * a + rgb565_split(bg) * (32U - a)) >> 5;
+  return rgb565_join(v & RGB565_SPLIT_MASK);
+}
+
+/**
+ * @brief Precomputed blend of a fixed foreground over varying backgrounds.
+ * Produces exactly the same result as alpha_blend().
+ */
+typedef struct {
+  uint32_t fg;  // Split FG pre-multiplied by the weight
+  uint32_t inv; // 32 - weight
+} blend_pen_t;
+
+static inline void blend_pen_init_weight(blend_pen_t *pen, meas_pixel_t fg,
+                                         uint32_t weight) {
+  pen->fg = rgb565_split(fg) * weight;
+  pen->inv = 32U - weight;
+}
+
+static inline void blend_pen_init(blend_pen_t *pen, meas_pixel_t fg,
+                                  uint8_t alpha) {
+  blend_pen_init_weight(pen, fg, alpha_weight(alpha));
+}
+
+static inline meas_pixel_t blend_pen_apply(const blend_pen_t *pen,
+                                           meas_pixel_t bg) {
+  uint32_t v = (pen->fg + rgb565_split(bg) * pen->inv) >> 5;
+  return rgb565_join(v & RGB565_SPLIT_MASK);
+}
+
+// Two pixels per word; both halves of the pen are the same color
+static inline uint32_t blend_pen_apply2(const blend_pen_t *pen, uint32_t w) {
+  uint32_t lo = ((pen->fg + (w & RGB565_SPLIT_MASK) * pen->inv) >> 5) &
+                RGB565_SPLIT_MASK;
+  uint32_t hi = ((pen->fg + (ror16(w) & RGB565_SPLIT_MASK) * pen->inv) >> 5) &
+                RGB565_SPLIT_MASK;
+  return lo | ror16(hi);
+}
+
+// --- Tile Pixel Access ---
 
-  uint32_t r_fg = (fg >> 11) & 0x1F;
-  uint32_t g_fg = (fg >> 5) & 0x3F;
-  uint32_t b_fg = fg & 0x1F;
+/*
+ * Tiles hold RGB565 pixels or, with MEAS_UI_INDEXED_COLOR, palette indices.
+ * Color math is always RGB565: indexed pixels are expanded through the
+ * palette, and results are mapped back to an index when stored. The solid
+ * color of a primitive gets its exact palette entry (px_solid), per-pixel
+ * results the nearest one from the inverse table (px_mix).
+ */
+#ifdef MEAS_UI_INDEXED_COLOR
+
+static inline meas_pixel_t px_load(meas_tile_pixel_t p) {
+  return meas_palette_color(p);
+}
 
-  // Mix: Result = (FG * Alpha + BG * (255 - Alpha)) / 255
-  // Approx: >> 8 (divide by 256)
-  uint32_t inv_alpha = 256 - alpha;
+static inline meas_tile_pixel_t px_solid(meas_pixel_t c) {
+  return meas_palette_match(c);
+}
+
+static inline meas_tile_pixel_t px_mix(meas_pixel_t c) {
+  return meas_palette_quantize(c);
+}
+
+#else
+
+static inline meas_pixel_t px_load(meas_tile_pixel_t p) { return p; }
+static inline meas_tile_pixel_t px_solid(meas_pixel_t c) { return c; }
+static inline meas_tile_pixel_t px_mix(meas_pixel_t c) { return c; }
+
+#endif
+
+static inline meas_tile_pixel_t px_blend(const blend_pen_t *pen,
+                                         meas_tile_pixel_t p) {
+  return px_mix(blend_pen_apply(pen, px_load(p)));
+}
 
-  uint32_t r = (r_fg * alpha + r_bg * inv_alpha) >> 8;
-  uint32_t g = (g_fg * alpha + g_bg * inv_alpha) >> 8;
-  uint32_t b = (b_fg * alpha + b_bg * inv_alpha) >> 8; // Typo fix: b_fg
+// --- Span Helpers ---
+
+#ifdef MEAS_UI_INDEXED_COLOR
+
+/**
+ * @brief Fill @p n pixels with a solid color (one index per byte).
+ */
+static void span_fill(meas_tile_pixel_t *dst, int16_t n, meas_pixel_t color) {
+  if (n > 0)
+    memset(dst, px_solid(color), (size_t)n);
+}
+
+/**
+ * @brief Blend a pen over @p n pixels.
+ * Backgrounds come in runs (fills, gradients quantized to few entries), so
+ * the result for the previous index is reused until the index changes.
+ */
+static void span_blend(meas_tile_pixel_t *dst, int16_t n,
+                       const blend_pen_t *pen) {
+  if (n <= 0)
+    return;
+  meas_tile_pixel_t in = dst[0];
+  meas_tile_pixel_t out = px_blend(pen, in);
+  for (int16_t i = 0; i < n; i++) {
+    if (dst[i] != in) {
+      in = dst[i];
+      out = px_blend(pen, in);
+    }
+    dst[i] = out;
+  }
+}
+
+/**
+ * @brief Blend @p n source pixels over the destination (per-pixel color).
+ */
+static void span_blend_src(meas_tile_pixel_t *dst, const meas_pixel_t *src,
+                           int16_t n, uint8_t alpha) {
+  for (int16_t i = 0; i < n; i++)
+    dst[i] = px_mix(alpha_blend(px_load(dst[i]), src[i], alpha));
+}
+
+/**
+ * @brief Copy @p n source pixels (opaque image rows).
+ */
+static inline void span_copy_src(meas_tile_pixel_t *dst,
+                                 const meas_pixel_t *src, int16_t n) {
+  for (int16_t i = 0; i < n; i++)
+    dst[i] = px_mix(src[i]);
+}
+
+#else
+
+/**
+ * @brief Fill @p n pixels with a solid color (32-bit stores).
+ */
+static void span_fill(meas_tile_pixel_t *dst, int16_t n, meas_pixel_t color) {
+  if (n <= 0)
+    return;
+  if ((uintptr_t)dst & 2U) {
+    *dst++ = color;
+    n--;
+  }
+  uint32_t pair = (uint32_t)color | ((uint32_t)color << 16);
+  for (; n >= 2; n -= 2, dst += 2) {
+    memcpy(dst, &pair, sizeof(pair));
+  }
+  if (n)
+    *dst = color;
+}
+
+/**
+ * @brief Blend a pen over @p n pixels, two pixels per 32-bit word.
+ */
+static void span_blend(meas_tile_pixel_t *dst, int16_t n,
+                       const blend_pen_t *pen) {
+  if (n <= 0)
+    return;
+  if ((uintptr_t)dst & 2U) {
+    *dst = blend_pen_apply(pen, *dst);
+    dst++;
+    n--;
+  }
+  for (; n >= 2; n -= 2, dst += 2) {
+    uint32_t w;
+    memcpy(&w, dst, sizeof(w));
+    w = blend_pen_apply2(pen, w);
+    memcpy(dst, &w, sizeof(w));
+  }
+  if (n)
+    *dst = blend_pen_apply(pen, *dst);
+}
+
+/**
+ * @brief Blend @p n source pixels over the destination (per-pixel color).
+ */
+static void span_blend_src(meas_tile_pixel_t *dst, const meas_pixel_t *src,
+                           int16_t n, uint8_t alpha) {
+  if (n <= 0)
+    return;
+  uint32_t a = alpha_weight(alpha);
+  uint32_t inv = 32U - a;
+  if ((uintptr_t)dst & 2U) {
+    *dst = alpha_blend(*dst, *src++, alpha);
+    dst++;
+    n--;
+  }
+  for (; n >= 2; n -= 2, dst += 2, src += 2) {
+    uint32_t d, f;
+    memcpy(&d, dst, sizeof(d));
+    memcpy(&f, src, sizeof(f)); // Source may be unaligned
+    uint32_t lo = (((f & RGB565_SPLIT_MASK) * a +
+                    (d & RGB565_SPLIT_MASK) * inv) >>
+                   5) &
+                  RGB565_SPLIT_MASK;
+    uint32_t hi = (((ror16(f) & RGB565_SPLIT_MASK) * a +
+                    (ror16(d) & RGB565_SPLIT_MASK) * inv) >>
+                   5) &
+                  RGB565_SPLIT_MASK;
+    d = lo | ror16(hi);
+    memcpy(dst, &d, sizeof(d));
+  }
+  if (n)
+    *dst = alpha_blend(*dst, *src, alpha);
+}
+
+/**
+ * @brief Copy @p n source pixels (opaque image rows).
+ */
+static inline void span_copy_src(meas_tile_pixel_t *dst,
+                                 const meas_pixel_t *src, int16_t n) {
+  if (n > 0)
+    memcpy(dst, src, (size_t)n * sizeof(meas_pixel_t));
+}
+
+#endif
+
+/**
+ * @brief Paint a span with a pen (opaque fill or SWAR blend).
+ */
+static inline void span_paint(meas_tile_pixel_t *dst, int16_t n,
+                              meas_pixel_t color, const blend_pen_t *pen) {
+  if (pen->inv == 0) {
+    span_fill(dst, n, color);
+  } else {
+    span_blend(dst, n, pen);
+  }
+}
 
-  return (meas_pixel_t)((r << 11) | (g << 5) | b);
+/**
+ * @brief Visible area of the context: clip rect intersected with the tile.
+ *
+ * @param ctx Render context.
+ * @param[out] out Visible rectangle (global coordinates).
+ * @return false if nothing of the context is visible.
+ */
+static bool cell_visible_rect(const meas_render_ctx_t *ctx, meas_rect_t *out) {
+  int16_t x0 = ctx->clip_rect.x;
+  int16_t y0 = ctx->clip_rect.y;
+  int16_t x1 = ctx->clip_rect.x + ctx->clip_rect.w;
+  int16_t y1 = ctx->clip_rect.y + ctx->clip_rect.h;
+  if (x0 < ctx->x_offset)
+    x0 = ctx->x_offset;
+  if (y0 < ctx->y_offset)
+    y0 = ctx->y_offset;
+  if (x1 > ctx->x_offset + ctx->width)
+    x1 = ctx->x_offset + ctx->width;
+  if (y1 > ctx->y_offset + ctx->height)
+    y1 = ctx->y_offset + ctx->height;
+
+  *out = (meas_rect_t){x0, y0, x1 - x0, y1 - y0};
+  return (out->w > 0 && out->h > 0);
 }
 
 static void cell_draw_pixel(meas_render_ctx_t *ctx, int16_t x, int16_t y,
@@ -113,10 +373,11 @@ static void cell_draw_pixel(meas_render_ctx_t *ctx, int16_t x, int16_t y,
 
   if (lx >= 0 && lx < ctx->width && ly >= 0 && ly < ctx->height) {
     if (alpha == MEAS_ALPHA_OPAQUE) {
-      ctx->buffer[ly * ctx->width + lx] = ctx->fg_color;
+      ctx->buffer[ly * ctx->width + lx] = px_solid(ctx->fg_color);
     } else {
-      meas_pixel_t bg = ctx->buffer[ly * ctx->width + lx];
-      ctx->buffer[ly * ctx->width + lx] = alpha_blend(bg, ctx->fg_color, alpha);
+      meas_pixel_t bg = px_load(ctx->buffer[ly * ctx->width + lx]);
+      ctx->buffer[ly * ctx->width + lx] =
+          px_mix(alpha_blend(bg, ctx->fg_color, alpha));
     }
   }
 }
@@ -134,44 +395,147 @@ static meas_pixel_t cell_get_pixel(meas_render_ctx_t *ctx, int16_t x,
   int16_t ly = y - ctx->y_offset;
 
   if (lx >= 0 && lx < ctx->width && ly >= 0 && ly < ctx->height) {
-    return ctx->buffer[ly * ctx->width + lx];
+    return px_load(ctx->buffer[ly * ctx->width + lx]);
   }
   return 0;
 }
 
-static void cell_draw_line(meas_render_ctx_t *ctx, int16_t x0, int16_t y0,
-                           int16_t x1, int16_t y1, uint8_t alpha) {
-  if (!ctx || !ctx->buffer)
+// --- Line Rasterizer ---
+
+/**
+ * @brief Bresenham line restricted to a visible rectangle.
+ *
+ * Produces exactly the pixels of the classic all-octant Bresenham walk from
+ * (x0,y0) to (x1,y1), but only visits the part inside @p vis. Along the major
+ * axis, step j plots minor offset n(j) = ceil((j*d_min - e) / d_maj) with
+ * e = d_maj / 2, so the entry step and its error term are computed directly
+ * instead of walking the clipped-away part (Liang-Barsky style parametric
+ * clipping on the integer lattice).
+ *
+ * @param pattern 8-bit dash pattern indexed by step (MSB first).
+ */
+static void cell_raster_line(meas_render_ctx_t *ctx, const meas_rect_t *vis,
+                             int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                             uint8_t pattern, uint8_t alpha) {
+  // Trivial reject (Cohen-Sutherland outcodes on the bounding box)
+  int16_t vx1 = vis->x + vis->w - 1;
+  int16_t vy1 = vis->y + vis->h - 1;
+  if ((x0 < vis->x && x1 < vis->x) || (x0 > vx1 && x1 > vx1) ||
+      (y0 < vis->y && y1 < vis->y) || (y0 > vy1 && y1 > vy1))
     return;
 
-  // Optimization: Trivial Rejection against Clip Rect?
-  // Using Cohen-Sutherland ideas or just pixel check for now.
-  // Pixel check is safest for robust implementation in short time.
+  int32_t dx = abs(x1 - x0);
+  int32_t dy = abs(y1 - y0);
+  int32_t sx = (x0 < x1) ? 1 : -1;
+  int32_t sy = (y0 < y1) ? 1 : -1;
+
+  // Major / minor axis setup
+  bool x_major = (dx > dy);
+  int32_t d_maj = x_major ? dx : dy;
+  int32_t d_min = x_major ? dy : dx;
+  int32_t s_maj = x_major ? sx : sy;
+  int32_t s_min = x_major ? sy : sx;
+  int32_t maj0 = x_major ? x0 : y0;
+  int32_t min0 = x_major ? y0 : x0;
+  int32_t maj_lo = x_major ? vis->x : vis->y;
+  int32_t maj_hi = x_major ? vx1 : vy1;
+  int32_t min_lo = x_major ? vis->y : vis->x;
+  int32_t min_hi = x_major ? vy1 : vx1;
+  int32_t e = d_maj / 2;
+
+  // Step range from the major axis (linear)
+  int32_t j_lo, j_hi;
+  if (s_maj > 0) {
+    j_lo = maj_lo - maj0;
+    j_hi = maj_hi - maj0;
+  } else {
+    j_lo = maj0 - maj_hi;
+    j_hi = maj0 - maj_lo;
+  }
 
-  // Bresenham
-  int16_t dx = abs(x1 - x0);
-  int16_t dy = abs(y1 - y0);
-  int16_t sx = (x0 < x1) ? 1 : -1;
-  int16_t sy = (y0 < y1) ? 1 : -1;
-  int16_t err = (dx > dy ? dx : -dy) / 2;
-  int16_t e2;
+  // Step range from the minor axis: n(j) must stay in [a, b]
+  int32_t a = (s_min > 0) ? (min_lo - min0) : (min0 - min_hi);
+  int32_t b = (s_min > 0) ? (min_hi - min0) : (min0 - min_lo);
+  if (b < 0)
+    return;
+  if (d_min == 0) {
+    if (a > 0)
+      return;
+  } else {
+    // n never exceeds d_min: clamping keeps the products within 32 bits
+    if (a > d_min)
+      return;
+    if (b > d_min)
+      b = d_min;
+    if (a > 0) {
+      uint32_t q = ((uint32_t)(a - 1) * (uint32_t)d_maj + (uint32_t)e) /
+                   (uint32_t)d_min;
+      if ((int32_t)q + 1 > j_lo)
+        j_lo = (int32_t)q + 1;
+    }
+    uint32_t q =
+        ((uint32_t)b * (uint32_t)d_maj + (uint32_t)e) / (uint32_t)d_min;
+    if ((int32_t)q < j_hi)
+      j_hi = (int32_t)q;
+  }
 
-  while (1) {
-    cell_draw_pixel(ctx, x0, y0, alpha);
-    if (x0 == x1 && y0 == y1)
-      break;
-    e2 = err;
-    if (e2 > -dx) {
-      err -= dy;
-      x0 += sx;
+  if (j_lo < 0)
+    j_lo = 0;
+  if (j_hi > d_maj)
+    j_hi = d_maj;
+  if (j_lo > j_hi)
+    return;
+
+  // Walker state at the entry step (j_lo <= d_maj: unsigned 32-bit products)
+  uint32_t num = (uint32_t)j_lo * (uint32_t)d_min;
+  int32_t n = (num <= (uint32_t)e || d_maj == 0)
+                  ? 0
+                  : (int32_t)((num - (uint32_t)e + (uint32_t)d_maj - 1U) /
+                              (uint32_t)d_maj);
+  int32_t r = (int32_t)((uint32_t)(j_lo + 1) * (uint32_t)d_min -
+                        (uint32_t)e - (uint32_t)n * (uint32_t)d_maj);
+
+  int32_t px = x_major ? (maj0 + s_maj * j_lo) : (min0 + s_min * n);
+  int32_t py = x_major ? (min0 + s_min * n) : (maj0 + s_maj * j_lo);
+  meas_tile_pixel_t *p = &ctx->buffer[(py - ctx->y_offset) * ctx->width +
+                                      (px - ctx->x_offset)];
+
+  // Pointer steps in the tile buffer
+  int32_t step_maj = x_major ? s_maj : s_maj * ctx->width;
+  int32_t step_min = x_major ? s_min * ctx->width : s_min;
+
+  blend_pen_t pen;
+  if (alpha != MEAS_ALPHA_OPAQUE)
+    blend_pen_init(&pen, ctx->fg_color, alpha);
+  const meas_tile_pixel_t fg = px_solid(ctx->fg_color);
+
+  for (int32_t j = j_lo; j <= j_hi; j++) {
+    if (pattern & (0x80U >> (j & 7))) {
+      *p = (alpha == MEAS_ALPHA_OPAQUE) ? fg : px_blend(&pen, *p);
     }
-    if (e2 < dy) {
-      err += dx;
-      y0 += sy;
+    if (r > 0) {
+      r -= d_maj;
+      p += step_min;
     }
+    r += d_min;
+    p += step_maj;
   }
 }
 
+static void cell_draw_line(meas_render_ctx_t *ctx, int16_t x0, int16_t y0,
+                           int16_t x1, int16_t y1, uint8_t alpha) {
+  if (!ctx || !ctx->buffer)
+    return;
+  if (alpha == MEAS_ALPHA_TRANSPARENT)
+    return;
+
+  meas_rect_t vis;
+  if (!cell_visible_rect(ctx, &vis))
+    return;
+
+  cell_raster_line(ctx, &vis, x0, y0, x1, y1, MEAS_PATTERN_SOLID, alpha);
+}
+
 static void cell_draw_rect(meas_render_ctx_t *ctx, meas_rect_t rect,
                            uint8_t alpha) {
   int16_t x = rect.x;
@@ -238,21 +602,12 @@ static void cell_fill_rect(meas_render_ctx_t *ctx, int16_t x, int16_t y,
   if (w <= 0 || h <= 0)
     return;
 
-  meas_pixel_t *row = &ctx->buffer[ly * ctx->width + lx];
-  meas_pixel_t color = ctx->fg_color;
+  meas_tile_pixel_t *row = &ctx->buffer[ly * ctx->width + lx];
+  blend_pen_t pen;
+  blend_pen_init(&pen, ctx->fg_color, alpha);
 
   for (int16_t i = 0; i < h; i++) {
-    if (alpha == MEAS_ALPHA_OPAQUE) {
-      // Fast Path
-      for (int16_t j = 0; j < w; j++) {
-        row[j] = color;
-      }
-    } else {
-      // Blend Path
-      for (int16_t j = 0; j < w; j++) {
-        row[j] = alpha_blend(row[j], color, alpha);
-      }
-    }
+    span_paint(row, w, ctx->fg_color, &pen);
     row += ctx->width;
   }
 }
@@ -297,27 +652,14 @@ static void cell_draw_circle(meas_render_ctx_t *ctx, int16_t x0, int16_t y0,
   }
 }
 
+static void cell_fill_round_rect(meas_render_ctx_t *ctx, meas_rect_t rect,
+                                 int16_t r, uint8_t alpha);
+
 static void cell_fill_circle(meas_render_ctx_t *ctx, int16_t x0, int16_t y0,
                              int16_t r, uint8_t alpha) {
-  int16_t x = 0;
-  int16_t y = r;
-  int16_t d = 3 - 2 * r;
-
-  while (y >= x) {
-    // Scanlines
-    cell_fill_rect(ctx, x0 - x, y0 - y, 2 * x + 1, 1, alpha);
-    cell_fill_rect(ctx, x0 - x, y0 + y, 2 * x + 1, 1, alpha);
-    cell_fill_rect(ctx, x0 - y, y0 - x, 2 * y + 1, 1, alpha);
-    cell_fill_rect(ctx, x0 - y, y0 + x, 2 * y + 1, 1, alpha);
-
-    x++;
-    if (d > 0) {
-      y--;
-      d = d + 4 * (x - y) + 10;
-    } else {
-      d = d + 4 * x + 6;
-    }
-  }
+  // A disc is a rounded square whose corners meet: one span per row
+  meas_rect_t box = {x0 - r, y0 - r, 2 * r + 1, 2 * r + 1};
+  cell_fill_round_rect(ctx, box, r, alpha);
 }
 
 static void cell_blit(meas_render_ctx_t *ctx, int16_t x, int16_t y, int16_t w,
@@ -359,15 +701,13 @@ static void cell_blit(meas_render_ctx_t *ctx, int16_t x, int16_t y, int16_t w,
     return;
 
   for (int16_t i = ly_start; i < ly_end; i++) {
-    meas_pixel_t *dst = &ctx->buffer[i * ctx->width + lx_start];
+    meas_tile_pixel_t *dst = &ctx->buffer[i * ctx->width + lx_start];
     const uint16_t *src_line = src + src_x_offset;
 
     if (alpha == MEAS_ALPHA_OPAQUE) {
-      memcpy(dst, src_line, copy_w * sizeof(meas_pixel_t));
+      span_copy_src(dst, src_line, copy_w);
     } else {
-      for (int16_t j = 0; j < copy_w; j++) {
-        dst[j] = alpha_blend(dst[j], src_line[j], alpha);
-      }
+      span_blend_src(dst, src_line, copy_w, alpha);
     }
     src += w; // Next source line
   }
@@ -454,14 +794,11 @@ static void cell_fill_gradient_v(meas_render_ctx_t *ctx, int16_t x, int16_t y,
     uint8_t ratio = (relative_y * 255) / (orig_h - 1 > 0 ? orig_h - 1 : 1);
     meas_pixel_t grad_col = lerp_color(c1, c2, ratio);
 
-    meas_pixel_t *row = &ctx->buffer[i * ctx->width];
-    for (int16_t rx = lx_start; rx < lx_end; rx++) {
-      if (alpha == MEAS_ALPHA_OPAQUE) {
-        row[rx] = grad_col;
-      } else {
-        row[rx] = alpha_blend(row[rx], grad_col, alpha);
-      }
-    }
+    // One color per row: a single span
+    blend_pen_t pen;
+    blend_pen_init(&pen, grad_col, alpha);
+    span_paint(&ctx->buffer[i * ctx->width + lx_start], lx_end - lx_start,
+               grad_col, &pen);
   }
 }
 
@@ -517,7 +854,7 @@ static void cell_fill_gradient_h(meas_render_ctx_t *ctx, int16_t x, int16_t y,
     return;
 
   for (int16_t i = ly_start; i < ly_end; i++) {
-    meas_pixel_t *row = &ctx->buffer[i * ctx->width];
+    meas_tile_pixel_t *row = &ctx->buffer[i * ctx->width];
     for (int16_t rx = lx_start; rx < lx_end; rx++) {
       int16_t global_cur_x = ctx->x_offset + rx;
       int16_t relative_x = global_cur_x - orig_x;
@@ -525,9 +862,9 @@ static void cell_fill_gradient_h(meas_render_ctx_t *ctx, int16_t x, int16_t y,
       meas_pixel_t grad_col = lerp_color(c1, c2, ratio);
 
       if (alpha == MEAS_ALPHA_OPAQUE) {
-        row[rx] = grad_col;
+        row[rx] = px_mix(grad_col);
       } else {
-        row[rx] = alpha_blend(row[rx], grad_col, alpha);
+        row[rx] = px_mix(alpha_blend(px_load(row[rx]), grad_col, alpha));
       }
     }
   }
@@ -545,21 +882,297 @@ static void cell_get_dims(meas_render_ctx_t *ctx, int16_t *w, int16_t *h) {
 static void cell_draw_polyline(meas_render_ctx_t *ctx,
                                const meas_point_t *points, uint16_t count,
                                uint8_t alpha) {
-  if (!ctx || !points || count < 2)
+  if (!ctx || !ctx->buffer || !points || count < 2)
+    return;
+  if (alpha == MEAS_ALPHA_TRANSPARENT)
     return;
 
+  meas_rect_t vis;
+  if (!cell_visible_rect(ctx, &vis))
+    return;
+  int16_t vy1 = vis.y + vis.h - 1;
+
   for (uint16_t i = 0; i < count - 1; i++) {
-    cell_draw_line(ctx, points[i].x, points[i].y, points[i + 1].x,
-                   points[i + 1].y, alpha);
+    // Y-range rejection: only segments crossing the tile rows are rasterized
+    int16_t ya = points[i].y;
+    int16_t yb = points[i + 1].y;
+    if ((ya < vis.y && yb < vis.y) || (ya > vy1 && yb > vy1))
+      continue;
+    cell_raster_line(ctx, &vis, points[i].x, ya, points[i + 1].x, yb,
+                     MEAS_PATTERN_SOLID, alpha);
   }
 }
 
-// Comparison function for qsort
-static int compare_nodes(const void *a, const void *b) {
-  return (*(int16_t *)a - *(int16_t *)b);
+// --- Anti-Aliased Lines ---
+
+#define AA_LEVELS 16 // Coverage quantization (4 bits)
+
+/**
+ * @brief Pens for each coverage level of one trace color.
+ * Level k blends with weight (a * k) / 15; level 0 is never painted.
+ */
+typedef struct {
+  blend_pen_t level[AA_LEVELS];
+} blend_lut_t;
+
+static void blend_lut_init(blend_lut_t *lut, meas_pixel_t fg, uint8_t alpha) {
+  uint32_t a = alpha_weight(alpha);
+  for (uint32_t k = 0; k < AA_LEVELS; k++) {
+    blend_pen_init_weight(&lut->level[k], fg,
+                          (a * k + (AA_LEVELS - 1) / 2) / (AA_LEVELS - 1));
+  }
 }
 
-// Scanline Polygon Fill
+/**
+ * @brief Wu line restricted to a visible rectangle.
+ *
+ * Each major-axis step covers two minor-axis pixels whose coverages (4-bit,
+ * summing to full) come from a 16.16 accumulator: step j sits at minor
+ * offset (j * adj) / 65536 with adj = (d_min << 16) / d_maj. As in
+ * cell_raster_line(), the step range is clipped against @p vis up front and
+ * the accumulator is computed at the entry step in closed form, so every
+ * tile reproduces the pixels of a full-screen walk.
+ *
+ * @param skip_start Leave the (x0, y0) pixel alone (polyline joints).
+ */
+static void cell_raster_line_aa(meas_render_ctx_t *ctx, const meas_rect_t *vis,
+                                int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                                const blend_lut_t *lut, bool skip_start) {
+  int16_t vx1 = vis->x + vis->w - 1;
+  int16_t vy1 = vis->y + vis->h - 1;
+  if ((x0 < vis->x && x1 < vis->x) || (x0 > vx1 && x1 > vx1) ||
+      (y0 < vis->y && y1 < vis->y) || (y0 > vy1 && y1 > vy1))
+    return;
+
+  bool x_major = abs(x1 - x0) >= abs(y1 - y0);
+  int32_t maj0 = x_major ? x0 : y0;
+  int32_t maj1 = x_major ? x1 : y1;
+  int32_t min0 = x_major ? y0 : x0;
+  int32_t min1 = x_major ? y1 : x1;
+  int32_t skip_maj = skip_start ? maj0 : INT32_MIN;
+
+  // Always walk the major axis upwards
+  if (maj1 < maj0) {
+    int32_t t = maj0;
+    maj0 = maj1;
+    maj1 = t;
+    t = min0;
+    min0 = min1;
+    min1 = t;
+  }
+
+  int32_t d_maj = maj1 - maj0;
+  int32_t d_min = (min1 > min0) ? min1 - min0 : min0 - min1;
+  int32_t s_min = (min1 >= min0) ? 1 : -1;
+  int32_t maj_lo = x_major ? vis->x : vis->y;
+  int32_t maj_hi = x_major ? vx1 : vy1;
+  int32_t min_lo = x_major ? vis->y : vis->x;
+  int32_t min_hi = x_major ? vy1 : vx1;
+
+  // Step range from the major axis
+  int32_t j_lo = maj_lo - maj0;
+  int32_t j_hi = maj_hi - maj0;
+
+  // Step range from the minor axis. Step j sits at offset n(j) ~
+  // j * d_min / d_maj and also touches n + 1, so n must lie in [A, B]. The
+  // range is widened by one step for the truncated accumulator; pixels are
+  // bounds-checked anyway.
+  int32_t A = (s_min > 0) ? (min_lo - 1 - min0) : (min0 - min_hi - 1);
+  int32_t B = (s_min > 0) ? (min_hi - min0) : (min0 - min_lo);
+  if (B < 0)
+    return;
+  if (d_min == 0) {
+    if (A > 0)
+      return;
+  } else {
+    // n never exceeds d_min: clamping keeps the products within 32 bits
+    if (A > d_min + 1)
+      return;
+    if (B > d_min)
+      B = d_min;
+    if (A > 0) {
+      uint32_t q = ((uint32_t)A * (uint32_t)d_maj + (uint32_t)d_min - 1U) /
+                   (uint32_t)d_min;
+      if ((int32_t)q - 1 > j_lo)
+        j_lo = (int32_t)q - 1;
+    }
+    uint32_t q = ((uint32_t)(B + 1) * (uint32_t)d_maj - 1U) / (uint32_t)d_min;
+    if ((int32_t)q + 1 < j_hi)
+      j_hi = (int32_t)q + 1;
+  }
+  if (j_lo < 0)
+    j_lo = 0;
+  if (j_hi > d_maj)
+    j_hi = d_maj;
+  if (j_lo > j_hi)
+    return;
+
+  // Accumulator at the entry step: n whole pixels plus a 16-bit fraction
+  uint32_t adj = (d_maj > 0) ? ((uint32_t)d_min << 16) / (uint32_t)d_maj : 0;
+  uint32_t t = (uint32_t)j_lo * adj;
+  uint32_t acc = t & 0xFFFFU;
+  int32_t mi = min0 + s_min * (int32_t)(t >> 16);
+  int32_t m = maj0 + j_lo;
+
+  // Buffer index of the near pixel (may sit one row/column off the tile
+  // while its far neighbour is inside; only checked pixels are touched)
+  int32_t width = ctx->width;
+  int32_t step_maj = x_major ? 1 : width;
+  int32_t step_min = x_major ? s_min * width : s_min;
+  int32_t px = x_major ? m : mi;
+  int32_t py = x_major ? mi : m;
+  int32_t idx = (py - ctx->y_offset) * width + (px - ctx->x_offset);
+  meas_tile_pixel_t *buf = ctx->buffer;
+  const meas_tile_pixel_t fg = px_solid(ctx->fg_color);
+
+  for (int32_t j = j_lo; j <= j_hi; j++, m++) {
+    if (m != skip_maj) {
+      uint32_t f = acc >> 12; // Coverage of the far pixel (0..15)
+      uint32_t near = (AA_LEVELS - 1) - f;
+      if (near && mi >= min_lo && mi <= min_hi) {
+        const blend_pen_t *pen = &lut->level[near];
+        buf[idx] = pen->inv ? px_blend(pen, buf[idx]) : fg;
+      }
+      int32_t mf = mi + s_min;
+      if (f && mf >= min_lo && mf <= min_hi) {
+        int32_t k = idx + step_min;
+        buf[k] = px_blend(&lut->level[f], buf[k]);
+      }
+    }
+
+    idx += step_maj;
+    acc += adj;
+    if (acc >= 0x10000U) {
+      acc -= 0x10000U;
+      mi += s_min;
+      idx += step_min;
+    }
+  }
+}
+
+static void cell_draw_polyline_aa(meas_render_ctx_t *ctx,
+                                  const meas_point_t *points, uint16_t count,
+                                  uint8_t alpha) {
+  if (!ctx || !ctx->buffer || !points || count < 2)
+    return;
+  if (alpha == MEAS_ALPHA_TRANSPARENT)
+    return;
+
+  meas_rect_t vis;
+  if (!cell_visible_rect(ctx, &vis))
+    return;
+  int16_t vy1 = vis.y + vis.h - 1;
+
+  blend_lut_t lut;
+  blend_lut_init(&lut, ctx->fg_color, alpha);
+
+  for (uint16_t i = 0; i < count - 1; i++) {
+    int16_t ya = points[i].y;
+    int16_t yb = points[i + 1].y;
+    if ((ya < vis.y && yb < vis.y) || (ya > vy1 && yb > vy1))
+      continue;
+    // Joints are painted once, by the segment ending there
+    cell_raster_line_aa(ctx, &vis, points[i].x, ya, points[i + 1].x, yb, &lut,
+                        i > 0);
+  }
+}
+
+// Polygon edge (active-edge-table filler)
+typedef struct {
+  int16_t y_first; // First scanline crossed (top + 1: edges are (top, bottom])
+  int16_t y_last;  // Last scanline crossed (bottom)
+  int32_t x_q16;   // X at the current scanline (16.16, rounding bias included)
+  int32_t dxdy_q16; // X step per scanline (16.16)
+} poly_edge_t;
+
+// Edge from @p top to @p bot, positioned at scanline @p y
+static poly_edge_t poly_edge_make(const meas_point_t *top,
+                                  const meas_point_t *bot, int16_t y) {
+  int32_t dy = bot->y - top->y;
+  int64_t dxdy = ((int64_t)(bot->x - top->x) << 16) / dy;
+  return (poly_edge_t){
+      .y_first = y,
+      .y_last = bot->y,
+      .x_q16 =
+          (int32_t)(((int64_t)top->x << 16) + 0x8000 + dxdy * (y - top->y)),
+      .dxdy_q16 = (int32_t)dxdy};
+}
+
+// Crossings toggled per parity window (one bit per pixel)
+#define POLY_PARITY_WORDS 10
+
+/**
+ * @brief Even-odd fill of rows [y0, y1) for any number of edges.
+ * Each crossing toggles a bit at its x; reading the bits back as a running
+ * parity paints exactly the pairs of the sorted crossings, with no edge
+ * table to outgrow. Used when a tile is reached by more edges than the
+ * active edge table holds.
+ */
+static void poly_fill_parity(meas_render_ctx_t *ctx,
+                             const meas_point_t *points, uint16_t count,
+                             int16_t y0, int16_t y1, const blend_pen_t *pen) {
+  int16_t x_lo = ctx->clip_rect.x;
+  int16_t x_hi = ctx->clip_rect.x + ctx->clip_rect.w; // Exclusive
+  if (x_lo < ctx->x_offset)
+    x_lo = ctx->x_offset;
+  if (x_hi > ctx->x_offset + ctx->width)
+    x_hi = ctx->x_offset + ctx->width;
+
+  uint32_t bits[POLY_PARITY_WORDS];
+  for (int16_t y = y0; y < y1; y++) {
+    meas_tile_pixel_t *row = &ctx->buffer[(y - ctx->y_offset) * ctx->width];
+    for (int16_t wx = x_lo; wx < x_hi; wx += POLY_PARITY_WORDS * 32) {
+      int16_t wend = wx + POLY_PARITY_WORDS * 32;
+      if (wend > x_hi)
+        wend = x_hi;
+
+      // Crossings left of the window still count: they toggle its first bit
+      memset(bits, 0, sizeof(bits));
+      uint16_t j = count - 1;
+      for (uint16_t i = 0; i < count; j = i++) {
+        const meas_point_t *top = &points[j];
+        const meas_point_t *bot = &points[i];
+        if (top->y > bot->y) {
+          top = &points[i];
+          bot = &points[j];
+        }
+        if (top->y >= y || bot->y < y)
+          continue; // Edges cross rows (top, bottom]
+        int16_t x = (int16_t)(poly_edge_make(top, bot, y).x_q16 >> 16);
+        if (x >= wend)
+          continue;
+        if (x < wx)
+          x = wx;
+        bits[(x - wx) >> 5] ^= 1UL << ((x - wx) & 31);
+      }
+
+      bool inside = false;
+      int16_t start = wx;
+      for (int16_t x = wx; x < wend; x++) {
+        uint32_t word = bits[(x - wx) >> 5];
+        if (!word) {
+          x = (int16_t)(wx + ((x - wx) | 31)); // Nothing toggles in this word
+          continue;
+        }
+        if (word & (1UL << ((x - wx) & 31))) {
+          if (inside)
+            span_paint(&row[start - ctx->x_offset], x - start, ctx->fg_color,
+                       pen);
+          inside = !inside;
+          start = x;
+        }
+      }
+      if (inside)
+        span_paint(&row[start - ctx->x_offset], wend - start, ctx->fg_color,
+                   pen);
+    }
+  }
+}
+
+// Scanline Polygon Fill (even-odd)
+// Edges are bucketed by their first scanline once per call; the active list
+// stays sorted by x with an insertion pass per row (nearly sorted, so O(n)),
+// and x advances by a fixed-point step instead of a division per crossing.
 static void cell_fill_polygon(meas_render_ctx_t *ctx,
                               const meas_point_t *points, uint16_t count,
                               uint8_t alpha) {
@@ -569,79 +1182,104 @@ static void cell_fill_polygon(meas_render_ctx_t *ctx,
     return;
 
   // Global Y range for this Tile AND Clip Rect
-  int16_t global_y_start = ctx->y_offset;
-  int16_t global_y_end = ctx->y_offset + ctx->height;
-
-  if (global_y_start < ctx->clip_rect.y)
-    global_y_start = ctx->clip_rect.y;
-  if (global_y_end > ctx->clip_rect.y + ctx->clip_rect.h)
-    global_y_end = ctx->clip_rect.y + ctx->clip_rect.h;
+  int16_t start_y = ctx->y_offset;
+  int16_t end_y = ctx->y_offset + ctx->height;
+  if (start_y < ctx->clip_rect.y)
+    start_y = ctx->clip_rect.y;
+  if (end_y > ctx->clip_rect.y + ctx->clip_rect.h)
+    end_y = ctx->clip_rect.y + ctx->clip_rect.h;
+  if (start_y >= end_y)
+    return;
 
-  // Limits for polygon (Bounding Box check could optimize)
-  int16_t poly_min_y = points[0].y;
-  int16_t poly_max_y = points[0].y;
-  for (uint16_t i = 1; i < count; i++) {
-    if (points[i].y < poly_min_y)
-      poly_min_y = points[i].y;
-    if (points[i].y > poly_max_y)
-      poly_max_y = points[i].y;
-  }
+  blend_pen_t pen;
+  blend_pen_init(&pen, ctx->fg_color, alpha);
+
+  // Edge table: edges reaching this tile, ordered by first row
+  poly_edge_t edges[MEAS_MAX_POLYGON_EDGES];
+  uint8_t edge_cnt = 0;
+  uint16_t j = count - 1;
+  for (uint16_t i = 0; i < count; j = i++) {
+    const meas_point_t *top = &points[j];
+    const meas_point_t *bot = &points[i];
+    if (top->y == bot->y)
+      continue; // Horizontal: no crossings
+    if (top->y > bot->y) {
+      top = &points[i];
+      bot = &points[j];
+    }
+    int16_t first = top->y + 1;
+    if (bot->y < start_y || first >= end_y)
+      continue;
+    if (edge_cnt >= MEAS_MAX_POLYGON_EDGES) {
+      poly_fill_parity(ctx, points, count, start_y, end_y, &pen);
+      return;
+    }
 
-  // Intersect Y Loop ranges
-  int16_t start_y = (global_y_start > poly_min_y) ? global_y_start : poly_min_y;
-  int16_t end_y =
-      (global_y_end < poly_max_y + 1) ? global_y_end : poly_max_y + 1;
+    // Start directly at the first visible row
+    poly_edge_t e =
+        poly_edge_make(top, bot, (first > start_y) ? first : start_y);
 
-  if (start_y >= end_y)
+    uint8_t k = edge_cnt++;
+    while (k > 0 && edges[k - 1].y_first > e.y_first) {
+      edges[k] = edges[k - 1];
+      k--;
+    }
+    edges[k] = e;
+  }
+  if (edge_cnt < 2)
     return;
 
-  // Node buffer (Stack allocated)
-  // Max nodes per scanline for simple UI polygons usually small.
-  // 16 is sufficient for simple convex/concave shapes.
-#define MAX_POLY_NODES 16
-  int16_t nodes[MAX_POLY_NODES];
-
-  for (int16_t y = start_y; y < end_y; y++) {
-    int node_cnt = 0;
-    uint16_t j = count - 1;
-
-    // Build Nodes
-    for (uint16_t i = 0; i < count; i++) {
-      int16_t y1 = points[i].y;
-      int16_t y2 = points[j].y;
-      int16_t x1 = points[i].x;
-      int16_t x2 = points[j].x;
-
-      if ((y1 < y && y2 >= y) || (y2 < y && y1 >= y)) {
-        if (node_cnt < MAX_POLY_NODES) {
-          // X intersection
-          // x = x1 + (y - y1) * (x2 - x1) / (y2 - y1)
-          // Use long for intermediate calc to avoid overflow
-          nodes[node_cnt++] =
-              (int16_t)(x1 + ((int32_t)(y - y1) * (x2 - x1)) / (y2 - y1));
-        }
+  meas_pixel_t color = ctx->fg_color;
+  int16_t width = ctx->width;
+
+  // Global Clip Range for X
+  int16_t clip_x_min = ctx->clip_rect.x;
+  int16_t clip_x_max = ctx->clip_rect.x + ctx->clip_rect.w; // Exclusive
+
+  poly_edge_t *active[MEAS_MAX_POLYGON_EDGES];
+  uint8_t active_cnt = 0;
+  uint8_t next_edge = 0;
+  int16_t y = edges[0].y_first;
+
+  while (y < end_y && (active_cnt > 0 || next_edge < edge_cnt)) {
+    // Nothing active: skip straight to the next edge's first row
+    if (active_cnt == 0 && edges[next_edge].y_first > y)
+      y = edges[next_edge].y_first;
+    if (y >= end_y)
+      break;
+
+    // Drop finished edges, advance the rest
+    uint8_t n = 0;
+    for (uint8_t k = 0; k < active_cnt; k++) {
+      poly_edge_t *e = active[k];
+      if (e->y_last < y)
+        continue;
+      if (e->y_first < y)
+        e->x_q16 += e->dxdy_q16;
+      active[n++] = e;
+    }
+    active_cnt = n;
+
+    // Add edges starting on this row
+    while (next_edge < edge_cnt && edges[next_edge].y_first == y)
+      active[active_cnt++] = &edges[next_edge++];
+
+    // Keep x order (insertion pass: edges rarely swap between rows)
+    for (uint8_t k = 1; k < active_cnt; k++) {
+      poly_edge_t *e = active[k];
+      uint8_t m = k;
+      while (m > 0 && active[m - 1]->x_q16 > e->x_q16) {
+        active[m] = active[m - 1];
+        m--;
       }
-      j = i;
+      active[m] = e;
     }
 
-    // Sort Nodes
-    qsort(nodes, node_cnt, sizeof(int16_t), compare_nodes);
-
     // Fill Pairs with Clipping
-    int16_t tile_y = y - ctx->y_offset;
-    meas_pixel_t *row = &ctx->buffer[tile_y * ctx->width];
-    meas_pixel_t color = ctx->fg_color;
-    int16_t width = ctx->width;
-
-    // Global Clip Range for X
-    int16_t clip_x_min = ctx->clip_rect.x;
-    int16_t clip_x_max = ctx->clip_rect.x + ctx->clip_rect.w; // Exclusive
-
-    for (int k = 0; k < node_cnt; k += 2) {
-      if (k + 1 >= node_cnt)
-        break;
-      int16_t x_start = nodes[k];
-      int16_t x_end = nodes[k + 1];
+    meas_tile_pixel_t *row = &ctx->buffer[(y - ctx->y_offset) * width];
+    for (uint8_t k = 0; k + 1 < active_cnt; k += 2) {
+      int16_t x_start = (int16_t)(active[k]->x_q16 >> 16);
+      int16_t x_end = (int16_t)(active[k + 1]->x_q16 >> 16);
 
       // Clip to logical clip rect
       if (x_start < clip_x_min)
@@ -654,25 +1292,16 @@ static void cell_fill_polygon(meas_render_ctx_t *ctx,
       // Clip to Tile relative X
       int16_t lx_start = x_start - ctx->x_offset;
       int16_t lx_end = x_end - ctx->x_offset;
-
-      if (lx_start >= width)
-        continue;
-      if (lx_end <= 0)
+      if (lx_start >= width || lx_end <= 0)
         continue;
-
       if (lx_start < 0)
         lx_start = 0;
       if (lx_end > width)
         lx_end = width;
 
-      for (int16_t x = lx_start; x < lx_end; x++) {
-        if (alpha == MEAS_ALPHA_OPAQUE) {
-          row[x] = color;
-        } else {
-          row[x] = alpha_blend(row[x], color, alpha);
-        }
-      }
+      span_paint(&row[lx_start], lx_end - lx_start, color, &pen);
     }
+    y++;
   }
 }
 
@@ -721,6 +1350,9 @@ static void cell_fill_triangle(meas_render_ctx_t *ctx, int16_t x0, int16_t y0,
   if (total_height == 0)
     return;
 
+  blend_pen_t pen;
+  blend_pen_init(&pen, ctx->fg_color, alpha);
+
   int16_t y;
   for (y = y0; y <= y2; y++) {
     // Skip if off-screen Y
@@ -791,17 +1423,9 @@ static void cell_fill_triangle(meas_render_ctx_t *ctx, int16_t x0, int16_t y0,
       continue;
 
     // Draw Span
-    meas_pixel_t *row = &ctx->buffer[ly * ctx->width + lx_start];
+    meas_tile_pixel_t *row = &ctx->buffer[ly * ctx->width + lx_start];
     int16_t w = lx_end - lx_start;
-    meas_pixel_t color = ctx->fg_color;
-
-    if (alpha == MEAS_ALPHA_OPAQUE) {
-      for (int k = 0; k < w; k++)
-        row[k] = color;
-    } else {
-      for (int k = 0; k < w; k++)
-        row[k] = alpha_blend(row[k], color, alpha);
-    }
+    span_paint(row, w, ctx->fg_color, &pen);
   }
 }
 
@@ -890,13 +1514,35 @@ static void cell_draw_round_rect(meas_render_ctx_t *ctx, meas_rect_t rect,
   }
 }
 
+// Corner rows at offset dy from the straight body, spanning +/- half
+static void round_rect_rows(meas_render_ctx_t *ctx, int16_t xtl, int16_t xtr,
+                            int16_t ytl, int16_t ybl, int16_t dy, int16_t half,
+                            uint8_t alpha) {
+  int16_t sx = xtl - half;
+  int16_t sw = (xtr + half) - sx + 1;
+  cell_fill_rect(ctx, sx, ytl - dy, sw, 1, alpha);
+  cell_fill_rect(ctx, sx, ybl + dy, sw, 1, alpha);
+}
+
+/**
+ * @brief Fill a rounded rectangle as one span per row.
+ * Corner rows follow the midpoint circle; each row is emitted once (with its
+ * widest extent) so translucent fills blend uniformly.
+ */
 static void cell_fill_round_rect(meas_render_ctx_t *ctx, meas_rect_t rect,
                                  int16_t r, uint8_t alpha) {
+  if (!ctx || !ctx->buffer)
+    return;
+
   int16_t x = rect.x;
   int16_t y = rect.y;
   int16_t w = rect.w;
   int16_t h = rect.h;
 
+  // Outside the tile rows: nothing to do
+  if (y >= ctx->y_offset + ctx->height || y + h <= ctx->y_offset)
+    return;
+
   // Clamp radius
   int16_t min_side = (w < h) ? w : h;
   if (r > min_side / 2)
@@ -909,83 +1555,36 @@ static void cell_fill_round_rect(meas_render_ctx_t *ctx, meas_rect_t rect,
     return;
   }
 
-  // 1. Fill Central Body
-  // From y+r to y+h-r-1 (Inclusive height is h
-  // - 2r)
+  // 1. Central Body (rows ytl..ybl)
   cell_fill_rect(ctx, x, y + r, w, h - 2 * r, alpha);
 
-  // 2. Fill Top/Bottom Strips + Corners using
-  // Bresenham
-
-  // Centers
+  // 2. Corner Rows
   int16_t xtl = x + r;
   int16_t ytl = y + r;
   int16_t xtr = x + w - 1 - r;
   int16_t ybl = y + h - 1 - r;
 
-  // Draw helper for scanlines
-  // We need to fill for each Y step.
-  // The standard bresenham iterates `cx` (x
-  // offset) and `cy` (y offset). We mirror for
-  // top and bottom.
-
-  // Initial strip at offset `r` (should be
-  // covered by central body if exact, but
-  // let's effectively do rows `ytl - cy` and
-  // `ybl + cy` as cy goes from r down to 0...
-  // wait bresenham goes 0 to r? cx goes
-  // 0..~0.7r. cy goes r..~0.7r.
-
-  // We need to cover all Y offsets from 1 to
-  // `r`. Standard "Fill Circle" approach
-  // iterates Y.
-
-  int16_t current_y = r;
-  int16_t current_x = 0;
+  // Octant walk: (cx, cy) gives the row at offset cx with half-width cy, and
+  // the row at offset cy with half-width cx. The latter repeats while cy is
+  // unchanged; only its widest instance (just before cy steps) is painted,
+  // and it is skipped on the diagonal where the former already covers it.
+  int16_t cx = 0;
+  int16_t cy = r;
   int16_t d = 3 - 2 * r;
 
-  while (current_y >= current_x) {
-    // Scanline 1: Offset Y = current_y
-    // Rows: ytl - current_y AND ybl +
-    // current_y Width span: from (xtl -
-    // current_x) to (xtr + current_x) Note:
-    // xtr is `x + w - 1 - r`. Span width =
-    // (xtr + current_x) - (xtl - current_x) +
-    // 1
-    //            = (x + w - 1 - r + x) - (x +
-    //            r - x) + 1 = w - 2r + 2x - 1
-    //            + 1 = w - 2r + 2x
-    // Wait, let's use calc:
-    // Start X = xtl - current_x
-    // Width = (xtr + current_x) - (xtl -
-    // current_x) + 1
-
-    int16_t span_w_narrow = (xtr + current_x) - (xtl - current_x) + 1;
-    int16_t span_w_wide = (xtr + current_y) - (xtl - current_y) + 1;
-
-    // Top Bounds
-    // Row (ytl - current_y): Wide Span
-    if (current_x > 0) { // Avoid overlapping central rect
-                         // (offset 0)
-      cell_fill_rect(ctx, xtl - current_y, ytl - current_x, span_w_wide, 1,
-                     alpha);
-      cell_fill_rect(ctx, xtl - current_y, ybl + current_x, span_w_wide, 1,
-                     alpha);
-    }
-
-    if (current_x != current_y) {
-      cell_fill_rect(ctx, xtl - current_x, ytl - current_y, span_w_narrow, 1,
-                     alpha);
-      cell_fill_rect(ctx, xtl - current_x, ybl + current_y, span_w_narrow, 1,
-                     alpha);
-    }
+  while (cy >= cx) {
+    if (cx > 0)
+      round_rect_rows(ctx, xtl, xtr, ytl, ybl, cx, cy, alpha);
 
-    current_x++;
     if (d > 0) {
-      current_y--;
-      d = d + 4 * (current_x - current_y) + 10;
+      if (cx != cy)
+        round_rect_rows(ctx, xtl, xtr, ytl, ybl, cy, cx, alpha);
+      cx++;
+      cy--;
+      d = d + 4 * (cx - cy) + 10;
     } else {
-      d = d + 4 * current_x + 6;
+      cx++;
+      d = d + 4 * cx + 6;
     }
   }
 }
@@ -1005,6 +1604,17 @@ int16_t cell_get_text_width(meas_render_ctx_t *ctx, const char *text) {
   int16_t width = 0;
   const meas_font_t *f = ctx->font;
 
+  if (f->atlas) {
+    const meas_font_atlas_t *atlas = f->atlas;
+    while (*text) {
+      width += meas_font_atlas_glyph(atlas, *text)->advance;
+      if (text[1] && atlas->kern_count)
+        width += meas_font_atlas_kern(atlas, text[0], text[1]);
+      text++;
+    }
+    return width;
+  }
+
   while (*text) {
     uint8_t w, h;
     f->get_glyph(f->bitmap, *text, &w, &h);
@@ -1021,56 +1631,226 @@ int16_t cell_get_text_height(meas_render_ctx_t *ctx, const char *text) {
   return ctx->font->height;
 }
 
+// --- Glyph Blitter ---
+
+/**
+ * @brief Decode one glyph row into a left-aligned mask (bit 15 = column 0).
+ *
+ * Both built-in fonts are row-major: 11x14 stores one uint16 per row, 5x7
+ * one byte per row (MSB = leftmost). The low bits of row 0 carry the encoded
+ * width and are never inside the drawn columns.
+ */
+static inline uint16_t glyph_row_bits(const meas_font_t *f,
+                                      const uint8_t *glyph, int16_t row) {
+  if (f->height > 8) {
+    return ((const uint16_t *)glyph)[row];
+  }
+  return (uint16_t)((uint16_t)glyph[row] << 8);
+}
+
+/**
+ * @brief Render a glyph as horizontal runs.
+ *
+ * The glyph box is clipped once against @p bounds (clip rect intersected with
+ * the tile, global coordinates); each visible row is then scanned for runs of
+ * set bits which are written straight into the tile buffer.
+ */
+static void cell_draw_glyph(meas_render_ctx_t *ctx, const meas_rect_t *bounds,
+                            const meas_font_t *f, const uint8_t *glyph,
+                            int16_t x, int16_t y, uint8_t gw, uint8_t gh,
+                            const blend_pen_t *pen) {
+  if (gw > 16)
+    gw = 16;
+
+  int16_t x0 = (x > bounds->x) ? x : bounds->x;
+  int16_t y0 = (y > bounds->y) ? y : bounds->y;
+  int16_t x1 = x + gw;
+  int16_t y1 = y + gh;
+  if (x1 > bounds->x + bounds->w)
+    x1 = bounds->x + bounds->w;
+  if (y1 > bounds->y + bounds->h)
+    y1 = bounds->y + bounds->h;
+  if (x0 >= x1 || y0 >= y1)
+    return;
+
+  // Visible columns [c0, c1) as a left-aligned mask
+  int16_t c0 = x0 - x;
+  int16_t c1 = x1 - x;
+  uint16_t col_mask =
+      (uint16_t)((0xFFFFU >> c0) & ~(0xFFFFU >> c1) & 0xFFFFU);
+
+  const meas_pixel_t fg = ctx->fg_color;
+
+  for (int16_t gy = y0; gy < y1; gy++) {
+    uint16_t bits = glyph_row_bits(f, glyph, gy - y) & col_mask;
+    if (!bits)
+      continue;
+
+    meas_tile_pixel_t *row =
+        &ctx->buffer[(gy - ctx->y_offset) * ctx->width + (x - ctx->x_offset)];
+    int16_t c = c0;
+    while (c < c1) {
+      // Skip clear bits
+      while (c < c1 && !(bits & (0x8000U >> c)))
+        c++;
+      int16_t run = c;
+      while (c < c1 && (bits & (0x8000U >> c)))
+        c++;
+
+      span_paint(&row[run], c - run, fg, pen);
+    }
+  }
+}
+
+/**
+ * @brief Render an atlas glyph from its pre-encoded row runs.
+ *
+ * Rows above the visible band are stepped over by their count byte; each run
+ * is clipped horizontally and painted as one span.
+ */
+static void cell_draw_atlas_glyph(meas_render_ctx_t *ctx,
+                                  const meas_rect_t *bounds,
+                                  const meas_font_atlas_t *atlas,
+                                  const meas_atlas_glyph_t *g, int16_t x,
+                                  int16_t y, const blend_pen_t *pen) {
+  int16_t gy = y + g->top;
+  int16_t gy_end = gy + g->rows;
+  int16_t by1 = bounds->y + bounds->h;
+  if (gy_end > by1)
+    gy_end = by1;
+
+  const uint8_t *p = &atlas->runs[g->offset];
+  for (; gy < bounds->y && gy < gy_end; gy++)
+    p += 1U + *p;
+
+  int16_t bx0 = bounds->x;
+  int16_t bx1 = bounds->x + bounds->w;
+  const meas_pixel_t fg = ctx->fg_color;
+
+  for (; gy < gy_end; gy++) {
+    uint8_t n = *p++;
+    meas_tile_pixel_t *row = &ctx->buffer[(gy - ctx->y_offset) * ctx->width];
+    for (uint8_t i = 0; i < n; i++) {
+      int16_t rx0 = x + MEAS_ATLAS_RUN_X(p[i]);
+      int16_t rx1 = rx0 + MEAS_ATLAS_RUN_LEN(p[i]);
+      if (rx0 < bx0)
+        rx0 = bx0;
+      if (rx1 > bx1)
+        rx1 = bx1;
+      if (rx0 < rx1)
+        span_paint(&row[rx0 - ctx->x_offset], rx1 - rx0, fg, pen);
+    }
+    p += n;
+  }
+}
+
+/**
+ * @brief Atlas text path: glyphs are run-encoded and kerned pairs adjust the
+ * pen, so no bit scanning happens per pixel.
+ */
+static void cell_draw_text_atlas(meas_render_ctx_t *ctx,
+                                 const meas_rect_t *bounds,
+                                 const meas_font_atlas_t *atlas, int16_t x,
+                                 int16_t y, const char *text,
+                                 const blend_pen_t *pen) {
+  int16_t bx1 = bounds->x + bounds->w;
+  int16_t cur_x = x;
+
+  while (*text) {
+    if (cur_x >= bx1)
+      break; // Remaining glyphs are right of the visible area
+
+    const meas_atlas_glyph_t *g = meas_font_atlas_glyph(atlas, *text);
+    if (g->rows && cur_x + g->advance > bounds->x)
+      cell_draw_atlas_glyph(ctx, bounds, atlas, g, cur_x, y, pen);
+
+    cur_x += g->advance;
+    if (text[1] && atlas->kern_count)
+      cur_x += meas_font_atlas_kern(atlas, text[0], text[1]);
+    text++;
+  }
+}
+
 void cell_draw_text(meas_render_ctx_t *ctx, int16_t x, int16_t y,
                     const char *text, uint8_t alpha) {
-  if (!ctx || !ctx->font || !text)
+  if (!ctx || !ctx->buffer || !ctx->font || !text)
+    return;
+  if (alpha == MEAS_ALPHA_TRANSPARENT)
     return;
 
   const meas_font_t *f = ctx->font;
+
+  // Visible area: clip rect intersected with the tile (global coordinates)
+  meas_rect_t bounds;
+  if (!cell_visible_rect(ctx, &bounds))
+    return;
+  int16_t bx1 = bounds.x + bounds.w;
+
+  // Whole line outside the tile rows: nothing to do
+  if (y >= bounds.y + bounds.h || y + f->height <= bounds.y)
+    return;
+
+  blend_pen_t pen;
+  blend_pen_init(&pen, ctx->fg_color, alpha);
+
+  if (f->atlas) {
+    cell_draw_text_atlas(ctx, &bounds, f->atlas, x, y, text, &pen);
+    return;
+  }
+
   int16_t cur_x = x;
-  int16_t cur_y = y;
 
   while (*text) {
-    char c = *text;
+    if (cur_x >= bx1)
+      break; // Remaining glyphs are right of the visible area
+
     uint8_t gw, gh;
-    const uint8_t *glyph_data = f->get_glyph(f->bitmap, c, &gw, &gh);
+    const uint8_t *glyph_data = f->get_glyph(f->bitmap, *text, &gw, &gh);
 
-    if (glyph_data) {
-      if (f->height > 8) {
-        // Large Font (Native 16-bit)
-        // Ensure aligned access if possible,
-        // or use memcpy safe read if
-        // architecture strict Since we
-        // controls fonts, we assume 16-bit
-        // alignment.
-        const uint16_t *u16_data = (const uint16_t *)glyph_data;
-        for (int r = 0; r < gh; r++) {
-          uint16_t row_bits = u16_data[r];
-          // Row width is typically 11-16
-          // pixels.
-          for (int cx = 0; cx < 16; cx++) {
-            if (row_bits & (0x8000 >> cx)) {
-              cell_draw_pixel(ctx, cur_x + cx, cur_y + r, alpha);
-            }
-          }
-        }
-      } else {
-        // Small Font (Column Major)
-        for (int col = 0; col < gw; col++) {
-          uint8_t stripe = glyph_data[col + 1]; // Skip header
-          for (int row = 0; row < 8; row++) {
-            if (stripe & (1 << row)) {
-              cell_draw_pixel(ctx, cur_x + col, cur_y + row, alpha);
-            }
-          }
-        }
-      }
+    if (glyph_data && cur_x + gw > bounds.x) {
+      cell_draw_glyph(ctx, &bounds, f, glyph_data, cur_x, y, gw, gh, &pen);
     }
     cur_x += gw;
     text++;
   }
 }
 
+/**
+ * @brief Format a fixed-point value without printf.
+ * @return Number of characters written (excluding the terminator).
+ */
+static uint8_t format_fixed(char *out, int32_t value, uint8_t decimals) {
+  char digits[12];
+  uint8_t n = 0;
+  uint32_t mag = (value < 0) ? 0U - (uint32_t)value : (uint32_t)value;
+
+  // Least significant digit first; enough digits for "0.000ddd"
+  do {
+    digits[n++] = (char)('0' + mag % 10U);
+    mag /= 10U;
+  } while (mag || n <= decimals);
+
+  uint8_t len = 0;
+  if (value < 0)
+    out[len++] = '-';
+  while (n) {
+    if (n == decimals)
+      out[len++] = '.';
+    out[len++] = digits[--n];
+  }
+  out[len] = '\0';
+  return len;
+}
+
+static void cell_draw_number(meas_render_ctx_t *ctx, int16_t x, int16_t y,
+                             int32_t value, uint8_t decimals, uint8_t alpha) {
+  if (decimals > MEAS_NUMBER_MAX_DECIMALS)
+    decimals = MEAS_NUMBER_MAX_DECIMALS;
+  char buf[MEAS_NUMBER_MAX_CHARS];
+  format_fixed(buf, value, decimals);
+  cell_draw_text(ctx, x, y, buf, alpha);
+}
+
 // --- API Definition ---
 
 // --- Extended Primitives ---
@@ -1159,11 +1939,11 @@ static void cell_invert_rect(meas_render_ctx_t *ctx, int16_t x, int16_t y,
   if (w <= 0 || h <= 0)
     return;
 
-  meas_pixel_t *row = &ctx->buffer[ly * ctx->width + lx];
+  meas_tile_pixel_t *row = &ctx->buffer[ly * ctx->width + lx];
 
   for (int16_t i = 0; i < h; i++) {
     for (int16_t j = 0; j < w; j++) {
-      row[j] = ~row[j];
+      row[j] = px_mix((meas_pixel_t)~px_load(row[j]));
     }
     row += ctx->width;
   }
@@ -1172,44 +1952,17 @@ static void cell_invert_rect(meas_render_ctx_t *ctx, int16_t x, int16_t y,
 static void cell_draw_line_patt(meas_render_ctx_t *ctx, int16_t x0, int16_t y0,
                                 int16_t x1, int16_t y1, uint8_t pattern,
                                 uint8_t alpha) {
-  if (pattern == MEAS_PATTERN_SOLID) {
-    cell_draw_line(ctx, x0, y0, x1, y1, alpha);
+  if (!ctx || !ctx->buffer)
+    return;
+  if (alpha == MEAS_ALPHA_TRANSPARENT)
     return;
-  }
-
-  // Bresenham with Pattern
-  // Logic duplicated to avoid function call
-  // overhead in tight loop or complexity of
-  // generic callback
-  int16_t dx = abs(x1 - x0);
-  int16_t dy = abs(y1 - y0);
-  int16_t sx = (x0 < x1) ? 1 : -1;
-  int16_t sy = (y0 < y1) ? 1 : -1;
-  int16_t err = (dx > dy ? dx : -dy) / 2;
-  int16_t e2;
-
-  uint8_t bit_counter = 0;
 
-  while (1) {
-    // Check pattern: MSB first (0x80) rotated
-    // by bit_counter
-    if (pattern & (0x80 >> (bit_counter & 7))) {
-      cell_draw_pixel(ctx, x0, y0, alpha);
-    }
-    bit_counter++;
+  meas_rect_t vis;
+  if (!cell_visible_rect(ctx, &vis))
+    return;
 
-    if (x0 == x1 && y0 == y1)
-      break;
-    e2 = err;
-    if (e2 > -dx) {
-      err -= dy;
-      x0 += sx;
-    }
-    if (e2 < dy) {
-      err += dx;
-      y0 += sy;
-    }
-  }
+  // Pattern is indexed by step from (x0,y0), MSB first
+  cell_raster_line(ctx, &vis, x0, y0, x1, y1, pattern, alpha);
 }
 
 // --- Arcs and Sectors ---
@@ -1347,9 +2100,10 @@ static void cell_fill_pie(meas_render_ctx_t *ctx, int16_t x, int16_t y,
     return;
 
   int32_t r2 = r * r;
+  const meas_tile_pixel_t fg = px_solid(ctx->fg_color);
 
   for (int16_t cy = ty0; cy <= ty1; cy++) {
-    meas_pixel_t *row = &ctx->buffer[cy * ctx->width];
+    meas_tile_pixel_t *row = &ctx->buffer[cy * ctx->width];
     int16_t gy = cy + ctx->y_offset;
     int32_t dy = gy - y;
     int32_t dy2 = dy * dy;
@@ -1377,9 +2131,10 @@ static void cell_fill_pie(meas_render_ctx_t *ctx, int16_t x, int16_t y,
 
         if (visible) {
           if (alpha == MEAS_ALPHA_OPAQUE) {
-            row[cx] = ctx->fg_color;
+            row[cx] = fg;
           } else {
-            row[cx] = alpha_blend(row[cx], ctx->fg_color, alpha);
+            row[cx] =
+                px_mix(alpha_blend(px_load(row[cx]), ctx->fg_color, alpha));
           }
         }
       }
@@ -1527,29 +2282,14 @@ static void cell_draw_text_rotated(meas_render_ctx_t *ctx, int16_t x, int16_t y,
     const uint8_t *glyph_data = f->get_glyph(f->bitmap, ch, &gw, &gh);
 
     if (glyph_data) {
-      if (f->height > 8) {
-        const uint16_t *u16_data = (const uint16_t *)glyph_data;
-        for (int r = 0; r < gh; r++) {
-          uint16_t row_bits = u16_data[r];
-          for (int k = 0; k < 16; k++) {
-            if (row_bits & (0x8000 >> k)) {
-              meas_real_t rx = (meas_real_t)k * c - (meas_real_t)r * s;
-              meas_real_t ry = (meas_real_t)k * s + (meas_real_t)r * c;
-              cell_draw_pixel(ctx, (int16_t)(cur_x + rx), (int16_t)(cur_y + ry),
-                              alpha);
-            }
-          }
-        }
-      } else {
-        for (int col = 0; col < gw; col++) {
-          uint8_t stripe = glyph_data[col + 1];
-          for (int row = 0; row < 8; row++) {
-            if (stripe & (1 << row)) {
-              meas_real_t rx = (meas_real_t)col * c - (meas_real_t)row * s;
-              meas_real_t ry = (meas_real_t)col * s + (meas_real_t)row * c;
-              cell_draw_pixel(ctx, (int16_t)(cur_x + rx), (int16_t)(cur_y + ry),
-                              alpha);
-            }
+      for (int16_t r = 0; r < gh; r++) {
+        uint16_t row_bits = glyph_row_bits(f, glyph_data, r);
+        for (int16_t k = 0; k < gw && k < 16; k++) {
+          if (row_bits & (0x8000U >> k)) {
+            meas_real_t rx = (meas_real_t)k * c - (meas_real_t)r * s;
+            meas_real_t ry = (meas_real_t)k * s + (meas_real_t)r * c;
+            cell_draw_pixel(ctx, (int16_t)(cur_x + rx), (int16_t)(cur_y + ry),
+                            alpha);
           }
         }
       }
@@ -1620,10 +2360,12 @@ const meas_render_api_t meas_render_cell_api = {
     .get_pixel = cell_get_pixel,
     .draw_line = cell_draw_line,
     .draw_polyline = cell_draw_polyline,
+    .draw_polyline_aa = cell_draw_polyline_aa,
     .fill_rect = cell_fill_rect,
     .fill_polygon = cell_fill_polygon,
     .blit = cell_blit,
     .draw_text = cell_draw_text,
+    .draw_number = cell_draw_number,
     .fill_gradient_v = cell_fill_gradient_v,
     .fill_gradient_h = cell_fill_gradient_h,
     .get_dims = cell_get_dims,
@@ -0,0 +1,324 @@
+/**
+ * @file smith.c
+ * @brief Smith Chart / Polar Graticule (Precomputed Span Tables).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Build is two-pass: the generators first count spans per row, the counts
+ * become row offsets, and the same generators then fill the pool. Spans of a
+ * row are finally sorted and merged so crossings are blended only once.
+ * All geometry is integer (rational circle parameters, Q14 radials).
+ */
+
+#include "measlib/ui/smith.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// Constant-R / constant-X values as num/den (0.2, 0.5, 1, 2, 5)
+static const uint8_t smith_values[][2] = {
+    {1, 5}, {1, 2}, {1, 1}, {2, 1}, {5, 1}};
+#define SMITH_VALUE_COUNT (sizeof(smith_values) / sizeof(smith_values[0]))
+
+// Polar chart: |Gamma| circles (in fifths) and radials every 30 degrees
+#define POLAR_CIRCLES 5
+#define POLAR_RADIALS 12
+static const int16_t polar_cos_q14[POLAR_RADIALS] = {
+    16384, 14189, 8192, 0, -8192, -14189, -16384, -14189, -8192, 0, 8192,
+    14189};
+
+typedef struct {
+  meas_smith_t *chart;
+  bool fill;      /**< false: count pass, true: fill pass */
+  uint32_t total; /**< Spans counted */
+} span_builder_t;
+
+// --- Integer Geometry ---
+
+static int32_t isqrt_round(int32_t n) {
+  if (n <= 0)
+    return 0;
+  // Bitwise integer square root (floor)
+  uint32_t v = (uint32_t)n;
+  uint32_t res = 0;
+  uint32_t bit = 1UL << 30;
+  while (bit > v)
+    bit >>= 2;
+  while (bit) {
+    if (v >= res + bit) {
+      v -= res + bit;
+      res = (res >> 1) + bit;
+    } else {
+      res >>= 1;
+    }
+    bit >>= 2;
+  }
+  // Round to nearest: n - a^2 > a  <=>  sqrt(n) > a + 0.5
+  return ((uint32_t)n - res * res > res) ? (int32_t)res + 1 : (int32_t)res;
+}
+
+// Half-width of a circle of radius r at vertical offset dy (-1 if outside)
+static int32_t circle_half(int32_t r, int32_t dy) {
+  if (dy < 0)
+    dy = -dy;
+  if (dy > r)
+    return -1;
+  return isqrt_round(r * r - dy * dy);
+}
+
+static int32_t div_round(int32_t num, int32_t den) {
+  return (2 * num + den) / (2 * den);
+}
+
+// --- Span Generators ---
+
+static void span_add(span_builder_t *b, int32_t y, int32_t x0, int32_t x1,
+                     bool clip) {
+  meas_smith_t *c = b->chart;
+  int32_t r = y - c->y_top;
+  if (r < 0 || r >= (int32_t)c->rows)
+    return;
+
+  // Keep only the part inside the |Gamma| = 1 disk
+  if (clip) {
+    int32_t a = circle_half(c->radius, y - c->cy);
+    if (a < 0)
+      return;
+    if (x0 < c->cx - a)
+      x0 = c->cx - a;
+    if (x1 > c->cx + a)
+      x1 = c->cx + a;
+  }
+  // Table columns are relative to the chart box
+  int32_t left = c->cx - c->radius;
+  if (x0 < left)
+    x0 = left;
+  if (x1 > left + 2 * c->radius)
+    x1 = left + 2 * c->radius;
+  if (x0 > x1)
+    return;
+
+  if (!b->fill) {
+    c->row_first[r + 1]++;
+    b->total++;
+    return;
+  }
+  meas_span_t *s = &c->spans[c->row_first[r]++];
+  s->x0 = (uint8_t)(x0 - left);
+  s->x1 = (uint8_t)(x1 - left);
+}
+
+/**
+ * @brief Circle outline as at most two spans per row.
+ * Each row covers the half-widths between its own and the next outer row's,
+ * so the outline stays 8-connected near the poles.
+ */
+static void gen_circle(span_builder_t *b, int32_t xc, int32_t yc, int32_t r,
+                       bool clip) {
+  if (r <= 0)
+    return;
+  for (int32_t dy = -r; dy <= r; dy++) {
+    int32_t a = circle_half(r, dy);
+    int32_t outer = circle_half(r, (dy < 0 ? -dy : dy) + 1);
+    int32_t lo = (outer + 1 < a) ? outer + 1 : a;
+    int32_t y = yc + dy;
+    if (lo == 0) {
+      span_add(b, y, xc - a, xc + a, clip);
+    } else {
+      span_add(b, y, xc - a, xc - lo, clip);
+      span_add(b, y, xc + lo, xc + a, clip);
+    }
+  }
+}
+
+// Bresenham line, consecutive pixels of a row merged into one span
+static void gen_line(span_builder_t *b, int32_t x0, int32_t y0, int32_t x1,
+                     int32_t y1) {
+  int32_t dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+  int32_t dy = (y1 > y0) ? y0 - y1 : y1 - y0;
+  int32_t sx = (x0 < x1) ? 1 : -1;
+  int32_t sy = (y0 < y1) ? 1 : -1;
+  int32_t err = dx + dy;
+
+  int32_t run_y = y0;
+  int32_t run_lo = x0;
+  int32_t run_hi = x0;
+  for (;;) {
+    if (y0 != run_y) {
+      span_add(b, run_y, run_lo, run_hi, false);
+      run_y = y0;
+      run_lo = run_hi = x0;
+    } else if (x0 < run_lo) {
+      run_lo = x0;
+    } else if (x0 > run_hi) {
+      run_hi = x0;
+    }
+    if (x0 == x1 && y0 == y1)
+      break;
+    int32_t e2 = 2 * err;
+    if (e2 >= dy) {
+      err += dy;
+      x0 += sx;
+    }
+    if (e2 <= dx) {
+      err += dx;
+      y0 += sy;
+    }
+  }
+  span_add(b, run_y, run_lo, run_hi, false);
+}
+
+static void gen_impedance(span_builder_t *b) {
+  const meas_smith_t *c = b->chart;
+  int32_t R = c->radius;
+
+  gen_circle(b, c->cx, c->cy, R, false);          // r = 0
+  span_add(b, c->cy, c->cx - R, c->cx + R, false); // x = 0
+
+  for (size_t i = 0; i < SMITH_VALUE_COUNT; i++) {
+    int32_t num = smith_values[i][0];
+    int32_t den = smith_values[i][1];
+
+    // Constant R: radius R/(1+r), tangent at Gamma = 1
+    int32_t rr = div_round(R * den, den + num);
+    gen_circle(b, c->cx + R - rr, c->cy, rr, false);
+
+    // Constant +/-X: radius R/|x| centered on the Gamma = 1 tangent line
+    int32_t rx = div_round(R * den, num);
+    gen_circle(b, c->cx + R, c->cy - rx, rx, true);
+    gen_circle(b, c->cx + R, c->cy + rx, rx, true);
+  }
+}
+
+static void gen_polar(span_builder_t *b) {
+  const meas_smith_t *c = b->chart;
+  int32_t R = c->radius;
+
+  for (int32_t k = 1; k <= POLAR_CIRCLES; k++) {
+    gen_circle(b, c->cx, c->cy, div_round(R * k, POLAR_CIRCLES), false);
+  }
+  for (int32_t k = 0; k < POLAR_RADIALS; k++) {
+    // sin(a) = cos(a - 90 deg)
+    int32_t co = polar_cos_q14[k];
+    int32_t si = polar_cos_q14[(k + POLAR_RADIALS - 3) % POLAR_RADIALS];
+    int32_t ex = c->cx + (R * co + (co >= 0 ? 8192 : -8192)) / 16384;
+    int32_t ey = c->cy - (R * si + (si >= 0 ? 8192 : -8192)) / 16384;
+    gen_line(b, c->cx, c->cy, ex, ey);
+  }
+}
+
+static void gen_chart(span_builder_t *b, meas_smith_style_t style) {
+  if (style == MEAS_SMITH_POLAR) {
+    gen_polar(b);
+  } else {
+    gen_impedance(b);
+  }
+}
+
+// Sort the spans of each row by x0 and merge overlapping / touching ones
+static void compact_rows(meas_smith_t *c) {
+  uint16_t w = 0;
+  for (uint16_t r = 0; r < c->rows; r++) {
+    uint16_t first = c->row_first[r];
+    uint16_t last = c->row_first[r + 1];
+    c->row_first[r] = w;
+
+    for (uint16_t i = first + 1; i < last; i++) {
+      meas_span_t key = c->spans[i];
+      uint16_t j = i;
+      while (j > first && c->spans[j - 1].x0 > key.x0) {
+        c->spans[j] = c->spans[j - 1];
+        j--;
+      }
+      c->spans[j] = key;
+    }
+
+    uint16_t row_start = w;
+    for (uint16_t i = first; i < last; i++) {
+      meas_span_t s = c->spans[i];
+      if (w > row_start && s.x0 <= c->spans[w - 1].x1 + 1) {
+        if (s.x1 > c->spans[w - 1].x1)
+          c->spans[w - 1].x1 = s.x1;
+      } else {
+        c->spans[w++] = s;
+      }
+    }
+  }
+  c->row_first[c->rows] = w;
+  c->span_count = w;
+}
+
+// --- Public API ---
+
+meas_status_t meas_smith_build(meas_smith_t *chart, meas_smith_style_t style,
+                               int16_t cx, int16_t cy, int16_t radius) {
+  if (!chart)
+    return MEAS_ERROR;
+
+  chart->rows = 0;
+  chart->span_count = 0;
+  chart->row_first[0] = 0;
+  if (radius <= 0 || 2 * radius + 1 > MEAS_UI_SCREEN_HEIGHT)
+    return MEAS_ERROR;
+
+  chart->cx = cx;
+  chart->cy = cy;
+  chart->radius = radius;
+  chart->y_top = (int16_t)(cy - radius);
+  chart->rows = (uint16_t)(2 * radius + 1);
+
+  // Pass 1: count spans per row
+  span_builder_t b = {.chart = chart, .fill = false, .total = 0};
+  for (uint16_t r = 0; r <= chart->rows; r++) {
+    chart->row_first[r] = 0;
+  }
+  gen_chart(&b, style);
+  if (b.total > MEAS_SMITH_MAX_SPANS) {
+    chart->rows = 0;
+    return MEAS_ERROR;
+  }
+
+  // Counts -> row start offsets
+  for (uint16_t r = 0; r < chart->rows; r++) {
+    chart->row_first[r + 1] += chart->row_first[r];
+  }
+
+  // Pass 2: fill (row_first[r] advances to the end of row r)
+  b.fill = true;
+  gen_chart(&b, style);
+  for (uint16_t r = chart->rows; r > 0; r--) {
+    chart->row_first[r] = chart->row_first[r - 1];
+  }
+  chart->row_first[0] = 0;
+
+  compact_rows(chart);
+  return MEAS_OK;
+}
+
+void meas_smith_draw(const meas_smith_t *chart, meas_render_ctx_t *ctx,
+                     const meas_render_api_t *api, uint8_t alpha) {
+  if (!chart || !ctx || !api || !api->fill_rect || chart->rows == 0)
+    return;
+
+  // Rows of the table intersecting the tile and the clip rect
+  int32_t y_lo = chart->y_top;
+  int32_t y_hi = chart->y_top + chart->rows; // Exclusive
+  if (y_lo < ctx->y_offset)
+    y_lo = ctx->y_offset;
+  if (y_hi > ctx->y_offset + ctx->height)
+    y_hi = ctx->y_offset + ctx->height;
+  if (y_lo < ctx->clip_rect.y)
+    y_lo = ctx->clip_rect.y;
+  if (y_hi > ctx->clip_rect.y + ctx->clip_rect.h)
+    y_hi = ctx->clip_rect.y + ctx->clip_rect.h;
+
+  int16_t left = (int16_t)(chart->cx - chart->radius);
+  for (int32_t y = y_lo; y < y_hi; y++) {
+    uint16_t r = (uint16_t)(y - chart->y_top);
+    for (uint16_t i = chart->row_first[r]; i < chart->row_first[r + 1]; i++) {
+      const meas_span_t *s = &chart->spans[i];
+      api->fill_rect(ctx, (int16_t)(left + s->x0), (int16_t)y,
+                     (int16_t)(s->x1 - s->x0 + 1), 1, alpha);
+    }
+  }
+}
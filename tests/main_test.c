@@ -21,6 +21,23 @@ void run_core_object_tests(void);
 void run_core_trace_tests(void);
 void run_node_window_tests(void);
 void run_scpi_tests(void);
+void run_scpi_block_tests(void);
+void run_scpi_status_tests(void);
+void run_scpi_queue_tests(void);
+void run_scpi_prop_tests(void);
+void run_render_service_tests(void);
+void run_remote_display_tests(void);
+void run_shell_service_tests(void);
+void run_screenshot_tests(void);
+void run_fat_tests(void);
+void run_display_list_tests(void);
+void run_font_atlas_tests(void);
+void run_gesture_tests(void);
+void run_widget_tests(void);
+void run_layer_cache_tests(void);
+void run_palette_tests(void);
+void run_render_cell_tests(void);
+void run_smith_tests(void);
 
 int main(void) {
   printf("======================================\n");
@@ -39,6 +56,23 @@ int main(void) {
   run_vna_sanity_tests();
   run_vna_pipeline_tests();
   run_scpi_tests();
+  run_scpi_block_tests();
+  run_scpi_status_tests();
+  run_scpi_queue_tests();
+  run_scpi_prop_tests();
+  run_render_service_tests();
+  run_screenshot_tests();
+  run_fat_tests();
+  run_remote_display_tests();
+  run_shell_service_tests();
+  run_display_list_tests();
+  run_font_atlas_tests();
+  run_gesture_tests();
+  run_widget_tests();
+  run_layer_cache_tests();
+  run_palette_tests();
+  run_render_cell_tests();
+  run_smith_tests();
 
   printf("\nAll Tests Passed Successfully.\n");
   return 0;
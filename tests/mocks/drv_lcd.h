@@ -2,9 +2,17 @@
 #define DRV_LCD_H
 
 #include "measlib/types.h"
+#include <stdbool.h>
 #include <stdint.h>
 
+typedef void (*meas_drv_lcd_done_cb_t)(void *user);
+
 void *meas_drv_lcd_init(void);
 void meas_drv_lcd_blit(void *handle, meas_rect_t rect, const void *pixels);
+meas_status_t meas_drv_lcd_blit_async(void *handle, meas_rect_t rect,
+                                      const void *pixels,
+                                      meas_drv_lcd_done_cb_t done, void *user);
+bool meas_drv_lcd_is_busy(void *handle);
+void meas_drv_lcd_wait(void *handle);
 
 #endif // DRV_LCD_H
@@ -84,6 +84,101 @@ void sys_enter_critical(void) {
 
 void sys_exit_critical(uint32_t status) { (void)status; }
 
+// Host time only advances when a test moves it
+uint32_t mock_sys_tick_ms = 0;
+
+uint32_t sys_get_tick(void) { return mock_sys_tick_ms; }
+
 void sys_wait_for_interrupt(void) {
   // Return immediately to keep test running
 }
+
+// -- LCD Driver --
+// Captures blits into a host framebuffer. Async transfers complete lazily
+// (on wait), so a renderer that touches a buffer still owned by the "DMA"
+// is detected as tearing.
+
+#include "drv_lcd.h"
+
+#define MOCK_LCD_WIDTH 320
+#define MOCK_LCD_HEIGHT 240
+
+meas_pixel_t mock_lcd_framebuffer[MOCK_LCD_WIDTH * MOCK_LCD_HEIGHT];
+uint32_t mock_lcd_blit_count = 0;
+uint32_t mock_lcd_tear_count = 0;
+
+static int mock_lcd_handle;
+static struct {
+  bool busy;
+  meas_rect_t rect;
+  const meas_pixel_t *pixels;
+  uint32_t checksum;
+  meas_drv_lcd_done_cb_t done;
+  void *user;
+} mock_lcd_xfer;
+
+static uint32_t mock_lcd_checksum(const meas_pixel_t *px, uint32_t n) {
+  uint32_t sum = 0;
+  for (uint32_t i = 0; i < n; i++) {
+    sum = (sum * 31U) + px[i];
+  }
+  return sum;
+}
+
+static void mock_lcd_copy(meas_rect_t rect, const meas_pixel_t *px) {
+  for (int16_t row = 0; row < rect.h; row++) {
+    int32_t y = rect.y + row;
+    if (y < 0 || y >= MOCK_LCD_HEIGHT)
+      continue;
+    for (int16_t col = 0; col < rect.w; col++) {
+      int32_t x = rect.x + col;
+      if (x >= 0 && x < MOCK_LCD_WIDTH)
+        mock_lcd_framebuffer[y * MOCK_LCD_WIDTH + x] = px[row * rect.w + col];
+    }
+  }
+  mock_lcd_blit_count++;
+}
+
+void *meas_drv_lcd_init(void) { return &mock_lcd_handle; }
+
+void meas_drv_lcd_blit(void *handle, meas_rect_t rect, const void *pixels) {
+  (void)handle;
+  meas_drv_lcd_wait(handle);
+  mock_lcd_copy(rect, (const meas_pixel_t *)pixels);
+}
+
+meas_status_t meas_drv_lcd_blit_async(void *handle, meas_rect_t rect,
+                                      const void *pixels,
+                                      meas_drv_lcd_done_cb_t done,
+                                      void *user) {
+  (void)handle;
+  if (mock_lcd_xfer.busy)
+    return MEAS_BUSY;
+  mock_lcd_xfer.busy = true;
+  mock_lcd_xfer.rect = rect;
+  mock_lcd_xfer.pixels = (const meas_pixel_t *)pixels;
+  mock_lcd_xfer.checksum =
+      mock_lcd_checksum(mock_lcd_xfer.pixels, (uint32_t)rect.w * rect.h);
+  mock_lcd_xfer.done = done;
+  mock_lcd_xfer.user = user;
+  return MEAS_OK;
+}
+
+bool meas_drv_lcd_is_busy(void *handle) {
+  (void)handle;
+  return mock_lcd_xfer.busy;
+}
+
+void meas_drv_lcd_wait(void *handle) {
+  (void)handle;
+  if (!mock_lcd_xfer.busy)
+    return;
+  uint32_t n = (uint32_t)mock_lcd_xfer.rect.w * mock_lcd_xfer.rect.h;
+  if (mock_lcd_checksum(mock_lcd_xfer.pixels, n) != mock_lcd_xfer.checksum) {
+    mock_lcd_tear_count++; // Source modified while "DMA" owned it
+  }
+  mock_lcd_copy(mock_lcd_xfer.rect, mock_lcd_xfer.pixels);
+  mock_lcd_xfer.busy = false;
+  if (mock_lcd_xfer.done)
+    mock_lcd_xfer.done(mock_lcd_xfer.user);
+}
@@ -12,6 +12,7 @@
 #include "measlib/core/event.h"
 #include "measlib/drivers/hal.h"
 #include "measlib/modules/vna/channel.h"
+#include "measlib/modules/vna/trace.h"
 #include "test_framework.h"
 #include <string.h>
 
@@ -92,10 +93,41 @@ void test_vna_start_sweep(void) {
   TEST_ASSERT_EQUAL(VNA_CH_STATE_WAIT_DMA, vna_ch.state);
 }
 
-// Global entry point for this test suite
+void test_vna_trace_axis(void) {
+  static meas_real_t freq[4];
+  static meas_complex_t data[4];
+  meas_vna_trace_t t;
+  meas_vna_channel_t ch;
+  memset(&ch, 0, sizeof(ch));
+  ch.start_freq_hz = 1000000;
+  ch.stop_freq_hz = 4000000;
+  TEST_ASSERT_EQUAL(MEAS_OK, meas_vna_trace_init(&t, &ch, freq, data, 4));
+
+  // Sink delivers more points than the trace holds: clamped to capacity
+  meas_complex_t in[5] = {{1, 0}, {2, 0}, {3, 0}, {4, 0}, {5, 0}};
+  TEST_ASSERT_EQUAL(MEAS_OK, meas_trace_copy_data(&t.base, in, sizeof(in)));
+
+  const meas_real_t *x = NULL;
+  const meas_real_t *y = NULL;
+  size_t n = 0;
+  TEST_ASSERT_EQUAL(MEAS_OK, meas_trace_get_data(&t.base, &x, &y, &n));
+  TEST_ASSERT_EQUAL(4, n);
+  TEST_ASSERT_EQUAL(1000000, (int64_t)x[0]);
+  TEST_ASSERT_EQUAL(2000000, (int64_t)x[1]);
+  TEST_ASSERT_EQUAL(4000000, (int64_t)x[3]);
+  TEST_ASSERT_EQUAL(4, (int)y[6]); // Re of point 3, interleaved re/im
+  TEST_ASSERT_EQUAL(TRACE_FMT_COMPLEX, meas_trace_get_format(&t.base));
+
+  // Axis follows a new sweep plan on the next delivery
+  ch.stop_freq_hz = 7000000;
+  meas_trace_copy_data(&t.base, in, sizeof(in));
+  TEST_ASSERT_EQUAL(3000000, (int64_t)x[1]);
+}
+
 // Global entry point for this test suite
 void run_vna_sanity_tests(void) {
   printf("--- Running VNA Tests ---\n");
   RUN_TEST(test_vna_init_state);
   RUN_TEST(test_vna_start_sweep);
+  RUN_TEST(test_vna_trace_axis);
 }
@@ -0,0 +1,48 @@
+/**
+ * @file mock_channel.c
+ * @brief Mock Channel Shared by the SCPI Tests.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "mock_channel.h"
+#include "measlib/core/event.h"
+#include <stdbool.h>
+
+int mock_sweeps_started;
+static bool sweep_running;
+
+static meas_status_t mock_start_sweep(meas_channel_t *ch) {
+  (void)ch;
+  mock_sweeps_started++;
+  sweep_running = true;
+  return MEAS_OK;
+}
+
+static meas_status_t mock_abort_sweep(meas_channel_t *ch) {
+  if (sweep_running)
+    meas_channel_publish_done(ch);
+  sweep_running = false;
+  return MEAS_OK;
+}
+
+static const meas_channel_api_t mock_channel_api = {
+    .start_sweep = mock_start_sweep, .abort_sweep = mock_abort_sweep};
+
+meas_channel_t mock_channel = {.base = {.api = &mock_channel_api.base}};
+
+void mock_channel_reset(void) {
+  mock_sweeps_started = 0;
+  sweep_running = false;
+}
+
+void mock_sweep_end(void) {
+  sweep_running = false;
+  meas_channel_publish_done(&mock_channel);
+}
+
+void mock_sweep_finish(void) {
+  mock_sweep_end();
+  meas_dispatch_events();
+}
@@ -0,0 +1,35 @@
+/**
+ * @file mock_channel.h
+ * @brief Mock Channel Shared by the SCPI Tests.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Sweeps never end on their own: the test ends them. Like the VNA channel,
+ * aborting a running sweep reports its end.
+ */
+
+#ifndef TEST_MOCK_CHANNEL_H
+#define TEST_MOCK_CHANNEL_H
+
+#include "measlib/core/channel.h"
+
+extern meas_channel_t mock_channel;
+extern int mock_sweeps_started;
+
+/**
+ * @brief Forget running sweeps and zero the start count.
+ */
+void mock_channel_reset(void);
+
+/**
+ * @brief End the running sweep; its event waits for the next dispatch.
+ */
+void mock_sweep_end(void);
+
+/**
+ * @brief End the running sweep and dispatch its event.
+ */
+void mock_sweep_finish(void);
+
+#endif // TEST_MOCK_CHANNEL_H
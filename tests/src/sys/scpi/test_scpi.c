@@ -7,6 +7,7 @@
  */
 
 #include "measlib/sys/scpi/scpi_core.h"
+#include "measlib/sys/scpi/scpi_hash.h"
 #include "test_framework.h"
 #include <stdio.h>
 #include <string.h>
@@ -136,6 +137,197 @@ void test_scpi_params(void) {
   TEST_ASSERT_EQUAL(SCPI_RES_OK, res);
 }
 
+// --- Compiled (hashed) command tree ---
+
+static int hits_volt;
+static int hits_volt_query;
+static int hits_curr;
+
+static scpi_status_t cmd_volt(scpi_context_t *ctx) {
+  (void)ctx;
+  hits_volt++;
+  return SCPI_RES_OK;
+}
+
+static scpi_status_t cmd_volt_query(scpi_context_t *ctx) {
+  (void)ctx;
+  hits_volt_query++;
+  return SCPI_RES_OK;
+}
+
+static scpi_status_t cmd_curr(scpi_context_t *ctx) {
+  (void)ctx;
+  hits_curr++;
+  return SCPI_RES_OK;
+}
+
+static const scpi_command_t meas_cmds[] = {
+    {.pattern = "VOLTage", .callback = cmd_volt, .children = NULL},
+    {.pattern = "VOLTage?", .callback = cmd_volt_query, .children = NULL},
+    {.pattern = "CURRent", .callback = cmd_curr, .children = NULL},
+    SCPI_CMD_LIST_END};
+
+// VOLTage also exists on the root level, with a different handler
+static const scpi_command_t hash_root_cmds[] = {
+    {.pattern = "MEASure", .callback = NULL, .children = meas_cmds},
+    {.pattern = "VOLTage", .callback = cmd_curr, .children = NULL},
+    SCPI_CMD_LIST_END};
+
+static scpi_status_t run_line(const char *line) {
+  return scpi_process(&ctx, line, strlen(line));
+}
+
+void test_scpi_hash_forms(void) {
+  memset(&ctx, 0, sizeof(ctx));
+  scpi_init(&ctx, line_buf, sizeof(line_buf), NULL, NULL);
+  TEST_ASSERT(scpi_register_tree(hash_root_cmds));
+
+  hits_volt = hits_volt_query = hits_curr = 0;
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("MEAS:VOLT\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("measure:voltage\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("Meas:Volt?\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("MEASURE:VOLTAGE?\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line(":MEAS:CURR\n"));
+  TEST_ASSERT_EQUAL(2, hits_volt);
+  TEST_ASSERT_EQUAL(2, hits_volt_query);
+  TEST_ASSERT_EQUAL(1, hits_curr);
+
+  // Only the short or the long form, never something in between
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_INVALID_HEADER, run_line("MEASU:VOLT\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_INVALID_HEADER, run_line("MEAS:VOLTA\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_INVALID_HEADER, run_line("MEAS:VOL\n"));
+
+  // Headers resolve per level
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("VOLT\n"));
+  TEST_ASSERT_EQUAL(2, hits_curr);
+  TEST_ASSERT_EQUAL(2, hits_volt);
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_INVALID_HEADER, run_line("CURR\n"));
+
+  uint8_t level = SCPI_HASH_ROOT;
+  TEST_ASSERT(scpi_hash_find(&level, "meas") == &hash_root_cmds[0]);
+  TEST_ASSERT(scpi_hash_find(&level, "curr") == &meas_cmds[2]);
+}
+
+#define VOCAB_SIZE 100
+
+static char vocab_names[VOCAB_SIZE][16];
+static scpi_command_t vocab_cmds[VOCAB_SIZE + 1];
+
+void test_scpi_hash_vocabulary(void) {
+  for (int i = 0; i < VOCAB_SIZE; i++) {
+    snprintf(vocab_names[i], sizeof(vocab_names[i]), "CMD%03dvalue", i);
+    vocab_cmds[i] = (scpi_command_t){.pattern = vocab_names[i],
+                                     .callback = cmd_volt};
+  }
+  vocab_cmds[VOCAB_SIZE] = (scpi_command_t)SCPI_CMD_LIST_END;
+  TEST_ASSERT(scpi_register_tree(vocab_cmds));
+
+  // Every header found in both forms, nothing else
+  for (int i = 0; i < VOCAB_SIZE; i++) {
+    char token[16];
+    uint8_t level = SCPI_HASH_ROOT;
+    TEST_ASSERT(scpi_hash_find(&level, vocab_names[i]) == &vocab_cmds[i]);
+    snprintf(token, sizeof(token), "cmd%03d", i);
+    level = SCPI_HASH_ROOT;
+    TEST_ASSERT(scpi_hash_find(&level, token) == &vocab_cmds[i]);
+    snprintf(token, sizeof(token), "CMD%03dVAL", i);
+    level = SCPI_HASH_ROOT;
+    TEST_ASSERT(scpi_hash_find(&level, token) == NULL);
+  }
+}
+
+void test_scpi_hash_fallback(void) {
+  // Ambiguous level (long form of one equals another): linear walk
+  static const scpi_command_t dup_cmds[] = {
+      {.pattern = "VOLTage", .callback = cmd_volt, .children = NULL},
+      {.pattern = "VOLTAGE", .callback = cmd_curr, .children = NULL},
+      SCPI_CMD_LIST_END};
+  memset(&ctx, 0, sizeof(ctx));
+  scpi_init(&ctx, line_buf, sizeof(line_buf), NULL, NULL);
+  TEST_ASSERT(!scpi_register_tree(dup_cmds));
+
+  hits_volt = hits_curr = 0;
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("VOLT\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("VOLTAGE\n"));
+  TEST_ASSERT_EQUAL(2, hits_volt);
+  TEST_ASSERT_EQUAL(0, hits_curr);
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_INVALID_HEADER, run_line("VOLTS\n"));
+}
+
+// --- Compound messages (IEEE 488.2) ---
+
+static char text_param[16];
+
+static scpi_status_t cmd_text(scpi_context_t *ctx) {
+  return scpi_param_string(ctx, text_param, sizeof(text_param));
+}
+
+static const scpi_command_t text_cmds[] = {
+    {.pattern = "TEXT", .callback = cmd_text, .children = NULL},
+    {.pattern = "VOLTage", .callback = cmd_volt, .children = NULL},
+    SCPI_CMD_LIST_END};
+
+static const scpi_command_t text_root_cmds[] = {
+    {.pattern = "DISPlay", .callback = NULL, .children = text_cmds},
+    {.pattern = "VOLTage", .callback = cmd_curr, .children = NULL},
+    SCPI_CMD_LIST_END};
+
+void test_scpi_compound_paths(void) {
+  memset(&ctx, 0, sizeof(ctx));
+  scpi_init(&ctx, line_buf, sizeof(line_buf), NULL, NULL);
+  TEST_ASSERT(scpi_register_tree(hash_root_cmds));
+
+  // After MEAS:VOLT, VOLT and CURR are relative to MEASure; ':' is absolute
+  hits_volt = hits_volt_query = hits_curr = 0;
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("MEAS:VOLT;VOLT;VOLT?;CURR;:VOLT\n"));
+  TEST_ASSERT_EQUAL(2, hits_volt);
+  TEST_ASSERT_EQUAL(1, hits_volt_query);
+  TEST_ASSERT_EQUAL(2, hits_curr);
+
+  // The path does not outlive the message
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_INVALID_HEADER, run_line("CURR\n"));
+
+  // Headers missing on the kept level resolve from the root
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("MEAS:CURR;MEAS:VOLT\n"));
+  TEST_ASSERT_EQUAL(3, hits_volt);
+
+  // An error discards the rest of the message
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_INVALID_HEADER,
+                    run_line("MEAS:BOGUS;CURR\n"));
+  TEST_ASSERT_EQUAL(3, hits_curr);
+
+  // ';' inside a quoted parameter does not split the message
+  TEST_ASSERT(scpi_register_tree(text_root_cmds));
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("DISP:TEXT \"a;b\";VOLT\n"));
+  TEST_ASSERT_EQUAL_STRING("\"a;b\"", text_param);
+  TEST_ASSERT_EQUAL(4, hits_volt);
+}
+
+void test_scpi_compound_queries(void) {
+  memset(&ctx, 0, sizeof(ctx));
+  scpi_init(&ctx, line_buf, sizeof(line_buf), NULL, mock_write);
+  scpi_def_init();
+  output_pos = 0;
+
+  // Queries of one message share one response message
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("*IDN?;FORM?;FORM:BORD?\n"));
+  TEST_ASSERT_EQUAL_STRING("MOMENTICS,MeasLib,0,0.1;ASC,0;NORM\r\n",
+                           output_buf);
+
+  // Setup batched in one message; common commands keep the path
+  output_pos = 0;
+  output_buf[0] = '\0';
+  TEST_ASSERT_EQUAL(SCPI_RES_OK,
+                    run_line("*RST;FORM:BORD SWAP;DATA REAL,64;*RST;BORD NORM;"
+                             "BORD SWAP;DATA INT\n"));
+  TEST_ASSERT_EQUAL_STRING("", output_buf);
+  TEST_ASSERT_EQUAL(SCPI_FORMAT_INT32, ctx.format);
+  TEST_ASSERT(ctx.swapped);
+
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("FORM:DATA?;BORD?;:FORM?\n"));
+  TEST_ASSERT_EQUAL_STRING("INT,32;SWAP;INT,32\r\n", output_buf);
+}
+
 void run_scpi_tests(void) {
   printf("--- Running SCPI Tests ---\n");
   RUN_TEST(test_scpi_idn);
@@ -144,4 +336,9 @@ void run_scpi_tests(void) {
   RUN_TEST(test_scpi_case_insensitive);
   RUN_TEST(test_scpi_fragmented);
   RUN_TEST(test_scpi_params);
+  RUN_TEST(test_scpi_hash_forms);
+  RUN_TEST(test_scpi_hash_vocabulary);
+  RUN_TEST(test_scpi_hash_fallback);
+  RUN_TEST(test_scpi_compound_paths);
+  RUN_TEST(test_scpi_compound_queries);
 }
@@ -0,0 +1,182 @@
+/**
+ * @file test_scpi_block.c
+ * @brief SCPI FORMat and Block Response Tests.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/core/trace.h"
+#include "measlib/sys/scpi/scpi_core.h"
+#include "measlib/sys/scpi/scpi_def.h"
+#include "test_framework.h"
+#include <stdio.h>
+#include <string.h>
+
+#define POINTS 1024
+
+static scpi_context_t ctx;
+static char line_buf[128];
+
+// Recording link: keeps the bytes and the source of every write
+static uint8_t output_buf[POINTS * 2 * sizeof(meas_real_t) + 64];
+static size_t output_pos;
+static const char *write_src[16];
+static size_t write_count;
+
+static size_t record_write(scpi_context_t *c, const char *data, size_t len) {
+  (void)c;
+  if (output_pos + len >= sizeof(output_buf))
+    return 0;
+  if (write_count < 16)
+    write_src[write_count] = data;
+  write_count++;
+  memcpy(output_buf + output_pos, data, len);
+  output_pos += len;
+  output_buf[output_pos] = '\0';
+  return len;
+}
+
+// --- Mock complex trace ---
+
+static meas_real_t freq[POINTS];
+static meas_real_t iq[POINTS * 2];
+
+static meas_status_t mock_get_data(meas_trace_t *t, const meas_real_t **x,
+                                   const meas_real_t **y, size_t *count) {
+  (void)t;
+  *x = freq;
+  *y = iq;
+  *count = POINTS;
+  return MEAS_OK;
+}
+
+static meas_trace_fmt_t mock_get_format(meas_trace_t *t) {
+  (void)t;
+  return TRACE_FMT_COMPLEX;
+}
+
+static const meas_trace_api_t mock_trace_api = {
+    .get_data = mock_get_data, .get_format = mock_get_format};
+static meas_trace_t mock_trace = {.base = {.api = &mock_trace_api.base}};
+
+static void setup(void) {
+  memset(&ctx, 0, sizeof(ctx));
+  scpi_init(&ctx, line_buf, sizeof(line_buf), NULL, record_write);
+  scpi_def_init();
+  for (int i = 0; i < POINTS; i++) {
+    freq[i] = 1.0e6 + 1.0e3 * i;
+    iq[2 * i] = 0.5 + i;
+    iq[2 * i + 1] = -0.25 * i;
+  }
+  scpi_def_set_trace(1, &mock_trace);
+}
+
+static scpi_status_t run_line(const char *line) {
+  output_pos = 0;
+  output_buf[0] = '\0';
+  write_count = 0;
+  return scpi_process(&ctx, line, strlen(line));
+}
+
+static uint32_t load_be32(const uint8_t *p) {
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+         ((uint32_t)p[2] << 8) | p[3];
+}
+
+void test_scpi_format_query(void) {
+  setup();
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("FORM?\n"));
+  TEST_ASSERT_EQUAL_STRING("ASC,0\r\n", (const char *)output_buf);
+
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("FORMAT:DATA REAL,64\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("FORM:DATA?\n"));
+  TEST_ASSERT_EQUAL_STRING("REAL,64\r\n", (const char *)output_buf);
+
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("FORM INTeger\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("FORM?\n"));
+  TEST_ASSERT_EQUAL_STRING("INT,32\r\n", (const char *)output_buf);
+
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("FORM:BORD SWAP\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("FORM:BORD?\n"));
+  TEST_ASSERT_EQUAL_STRING("SWAP\r\n", (const char *)output_buf);
+
+  // Unsupported encodings leave the format unchanged
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_DATA_TYPE, run_line("FORM REAL,16\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_DATA_TYPE, run_line("FORM HEX\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_DATA_TYPE, run_line("FORM:BORD BIG\n"));
+  TEST_ASSERT_EQUAL(SCPI_FORMAT_INT32, ctx.format);
+
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("*RST\n"));
+  TEST_ASSERT_EQUAL(SCPI_FORMAT_ASCII, ctx.format);
+  TEST_ASSERT(!ctx.swapped);
+}
+
+void test_scpi_trace_native_block(void) {
+  setup();
+  const uint16_t probe = 1;
+  const char *order = (*(const uint8_t *)&probe) ? "SWAP" : "NORM";
+  char line[32];
+  snprintf(line, sizeof(line), "FORM:BORD %s\n", order);
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line(line));
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("FORM REAL,64\n"));
+
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("TRAC:DATA?\n"));
+  // 1024 complex points = 2048 doubles = 16384 bytes
+  TEST_ASSERT_EQUAL(0, memcmp(output_buf, "#516384", 7));
+  TEST_ASSERT_EQUAL(0, memcmp(output_buf + 7, iq, sizeof(iq)));
+  TEST_ASSERT_EQUAL(0, memcmp(output_buf + 7 + sizeof(iq), "\r\n", 2));
+  TEST_ASSERT_EQUAL(7 + sizeof(iq) + 2, output_pos);
+
+  // Header, the trace buffer itself, terminator
+  TEST_ASSERT_EQUAL(3, write_count);
+  TEST_ASSERT(write_src[1] == (const char *)iq);
+
+  // Stimulus is a real array
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("TRACE:STIM? 1\n"));
+  TEST_ASSERT_EQUAL(0, memcmp(output_buf, "#48192", 6));
+  TEST_ASSERT(write_src[1] == (const char *)freq);
+}
+
+void test_scpi_trace_converted_block(void) {
+  setup();
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("FORM REAL,32\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("TRAC:DATA?\n"));
+  TEST_ASSERT_EQUAL(0, memcmp(output_buf, "#48192", 6));
+  TEST_ASSERT_EQUAL(6 + 8192 + 2, output_pos);
+
+  // NORMal order: big-endian IEEE 754 single precision
+  for (int i = 0; i < POINTS * 2; i += 401) {
+    float f = (float)iq[i];
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    TEST_ASSERT_EQUAL(bits, load_be32(output_buf + 6 + 4 * i));
+  }
+
+  // INTeger,32 rounds to nearest
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("FORM INT,32\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("TRAC:DATA?\n"));
+  TEST_ASSERT_EQUAL(1, (int32_t)load_be32(output_buf + 6));       // 0.5
+  TEST_ASSERT_EQUAL(-1, (int32_t)load_be32(output_buf + 6 + 28)); // -0.75
+}
+
+void test_scpi_trace_ascii(void) {
+  setup();
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("TRAC:STIM?\n"));
+  TEST_ASSERT_EQUAL(0, memcmp(output_buf, "1000000,1001000,1002000,", 24));
+  TEST_ASSERT_EQUAL(0, memcmp(output_buf + output_pos - 9, "2023000\r\n", 9));
+
+  // Unassigned and out-of-range traces fail
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_EXECUTION, run_line("TRAC:DATA? 2\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_EXECUTION, run_line("TRAC:DATA? 9\n"));
+  scpi_def_set_trace(1, NULL);
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_EXECUTION, run_line("TRAC:DATA?\n"));
+}
+
+void run_scpi_block_tests(void) {
+  printf("\n--- Running SCPI Block Tests ---\n");
+  RUN_TEST(test_scpi_format_query);
+  RUN_TEST(test_scpi_trace_native_block);
+  RUN_TEST(test_scpi_trace_converted_block);
+  RUN_TEST(test_scpi_trace_ascii);
+}
@@ -0,0 +1,218 @@
+/**
+ * @file test_scpi_prop.c
+ * @brief SCPI Commands Generated from Property Descriptors Tests.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/modules/vna/channel.h"
+#include "measlib/sys/scpi/scpi_core.h"
+#include "measlib/sys/scpi/scpi_def.h"
+#include "measlib/sys/scpi/scpi_prop.h"
+#include "test_framework.h"
+#include <stdio.h>
+#include <string.h>
+
+static scpi_context_t ctx;
+static char line_buf[128];
+static char output_buf[256];
+static size_t output_pos;
+
+static size_t mock_write(scpi_context_t *c, const char *data, size_t len) {
+  (void)c;
+  if (output_pos + len >= sizeof(output_buf))
+    return 0;
+  memcpy(output_buf + output_pos, data, len);
+  output_pos += len;
+  output_buf[output_pos] = '\0';
+  return len;
+}
+
+static scpi_status_t run_line(const char *line) {
+  output_pos = 0;
+  output_buf[0] = '\0';
+  return scpi_process(&ctx, line, strlen(line));
+}
+
+// --- Mock object: a level, a power switch and a property without SCPI ---
+
+#define PROP_LEVEL 1
+#define PROP_POWER 2
+#define PROP_SPAN 3
+#define PROP_SECRET 4
+
+static meas_real_t level;
+static bool power;
+static int64_t span;
+
+static const meas_prop_desc_t mock_props[] = {
+    {.key = PROP_LEVEL,
+     .name = "Level",
+     .scpi = "SOURce:POWer:LEVel",
+     .type = PROP_TYPE_REAL,
+     .unit = "DBM",
+     .min = -40,
+     .max = 10},
+    {.key = PROP_POWER,
+     .name = "Output",
+     .scpi = "OUTPut",
+     .type = PROP_TYPE_BOOL},
+    {.key = PROP_SPAN,
+     .name = "Span",
+     .scpi = "SOURce:SPAN",
+     .type = PROP_TYPE_INT64,
+     .unit = "HZ"},
+    {.key = PROP_SECRET, .name = "Secret", .type = PROP_TYPE_INT64},
+};
+
+static meas_status_t mock_set_prop(meas_object_t *obj, meas_id_t key,
+                                   meas_variant_t val) {
+  (void)obj;
+  switch (key) {
+  case PROP_LEVEL:
+    level = val.r_val;
+    return MEAS_OK;
+  case PROP_POWER:
+    power = val.b_val;
+    return MEAS_OK;
+  case PROP_SPAN:
+    span = val.i_val;
+    return MEAS_OK;
+  default:
+    return MEAS_ERROR;
+  }
+}
+
+static meas_status_t mock_get_prop(meas_object_t *obj, meas_id_t key,
+                                   meas_variant_t *val) {
+  (void)obj;
+  switch (key) {
+  case PROP_LEVEL:
+    *val = (meas_variant_t){.type = PROP_TYPE_REAL, .r_val = level};
+    return MEAS_OK;
+  case PROP_POWER:
+    *val = (meas_variant_t){.type = PROP_TYPE_BOOL, .b_val = power};
+    return MEAS_OK;
+  case PROP_SPAN:
+    *val = (meas_variant_t){.type = PROP_TYPE_INT64, .i_val = span};
+    return MEAS_OK;
+  default:
+    return MEAS_ERROR;
+  }
+}
+
+static const meas_prop_desc_t *mock_get_props(meas_object_t *obj,
+                                              size_t *count) {
+  (void)obj;
+  *count = sizeof(mock_props) / sizeof(mock_props[0]);
+  return mock_props;
+}
+
+static const meas_object_api_t mock_api = {.set_prop = mock_set_prop,
+                                           .get_prop = mock_get_prop,
+                                           .get_props = mock_get_props};
+static meas_object_t mock_obj = {.api = &mock_api};
+
+static scpi_command_t generated_root[8];
+
+void test_scpi_prop_generated_tree(void) {
+  scpi_prop_reset();
+  TEST_ASSERT(scpi_prop_bind(&mock_obj));
+  size_t n = scpi_prop_build(generated_root, 7);
+  // SOURce, OUTPut, OUTPut?
+  TEST_ASSERT_EQUAL(3, n);
+  generated_root[n] = (scpi_command_t)SCPI_CMD_LIST_END;
+  TEST_ASSERT(scpi_rebuild_tree(generated_root));
+  memset(&ctx, 0, sizeof(ctx));
+  scpi_init(&ctx, line_buf, sizeof(line_buf), NULL, mock_write);
+
+  // Shared nodes, relative headers, unit and multiplier suffixes
+  TEST_ASSERT_EQUAL(SCPI_RES_OK,
+                    run_line("SOUR:POW:LEV -12.5 dBm;LEV?;:SOUR:SPAN 2.5 "
+                             "MHz;SPAN?\n"));
+  TEST_ASSERT_EQUAL_STRING("-12.5;2500000\r\n", output_buf);
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("SOURCE:SPAN 1.5G;SPAN?\n"));
+  TEST_ASSERT_EQUAL_STRING("1500000000\r\n", output_buf);
+
+  // IEEE 488.2 multipliers: M is milli, MA mega; MHZ stays mega
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("SOUR:POW:LEV -500 m;LEV?\n"));
+  TEST_ASSERT_EQUAL_STRING("-0.5\r\n", output_buf);
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("SOUR:POW:LEV 2500MDBM;LEV?\n"));
+  TEST_ASSERT_EQUAL_STRING("2.5\r\n", output_buf);
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("SOUR:SPAN 3 MA;SPAN?\n"));
+  TEST_ASSERT_EQUAL_STRING("3000000\r\n", output_buf);
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("SOUR:SPAN 4 mhz;SPAN?\n"));
+  TEST_ASSERT_EQUAL_STRING("4000000\r\n", output_buf);
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("SOUR:SPAN 5000 mahz;SPAN?\n"));
+  TEST_ASSERT_EQUAL_STRING("5000000000\r\n", output_buf);
+
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("OUTP ON;OUTP?\n"));
+  TEST_ASSERT_EQUAL_STRING("1\r\n", output_buf);
+  TEST_ASSERT(power);
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("OUTPUT 0\n"));
+  TEST_ASSERT(!power);
+
+  // Range, MINimum / MAXimum, suffix and type errors
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_OUT_OF_RANGE,
+                    run_line("SOUR:POW:LEV 11\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("SOUR:POW:LEV MAX;LEV?\n"));
+  TEST_ASSERT_EQUAL_STRING("10\r\n", output_buf);
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("SOUR:POW:LEV minimum;LEV?\n"));
+  TEST_ASSERT_EQUAL_STRING("-40\r\n", output_buf);
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_INVALID_SUFFIX,
+                    run_line("SOUR:POW:LEV 1 V\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_INVALID_SUFFIX,
+                    run_line("SOUR:SPAN 1 kdBm\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_INVALID_SUFFIX,
+                    run_line("SOUR:SPAN 1 E\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_DATA_TYPE, run_line("SOUR:SPAN MAX\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_DATA_TYPE, run_line("OUTP maybe\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_MISSING_PARAM, run_line("SOUR:SPAN\n"));
+  TEST_ASSERT_EQUAL(-40.0, level);
+
+  // Not enough room for the top level
+  TEST_ASSERT_EQUAL(0, scpi_prop_build(generated_root, 2));
+  scpi_prop_reset();
+  scpi_rebuild_tree(NULL);
+}
+
+void test_scpi_prop_vna_channel(void) {
+  static meas_vna_channel_t vna;
+  static meas_trace_t trace;
+  memset(&vna, 0, sizeof(vna));
+  memset(&trace, 0, sizeof(trace));
+  TEST_ASSERT_EQUAL(MEAS_OK, meas_vna_channel_init(&vna, &trace));
+
+  memset(&ctx, 0, sizeof(ctx));
+  scpi_init(&ctx, line_buf, sizeof(line_buf), NULL, mock_write);
+  scpi_def_init();
+  scpi_def_set_channel(&vna.base);
+
+  // The channel's descriptor table is the whole binding
+  TEST_ASSERT_EQUAL(SCPI_RES_OK,
+                    run_line("SENS:FREQ:STAR 1.5 GHz;STOP 3e9;STAR?;STOP?\n"));
+  TEST_ASSERT_EQUAL_STRING("1500000000;3000000000\r\n", output_buf);
+  TEST_ASSERT_EQUAL(1500000000ULL, vna.start_freq_hz);
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("SENSE:SWEEP:POINTS 201\n"));
+  TEST_ASSERT_EQUAL(201, vna.points);
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_OUT_OF_RANGE,
+                    run_line("SENS:FREQ:STOP 7 GHz\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("SENS:FREQ:STAR MIN;STAR?\n"));
+  TEST_ASSERT_EQUAL_STRING("10000\r\n", output_buf);
+
+  // Fixed commands are still there
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, run_line("*IDN?\n"));
+  TEST_ASSERT_EQUAL_STRING("MOMENTICS,MeasLib,0,0.1\r\n", output_buf);
+
+  // Without the channel its subsystem is gone
+  scpi_def_set_channel(NULL);
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_INVALID_HEADER,
+                    run_line("SENS:SWE:POIN?\n"));
+}
+
+void run_scpi_prop_tests(void) {
+  printf("\n--- Running SCPI Property Binding Tests ---\n");
+  RUN_TEST(test_scpi_prop_generated_tree);
+  RUN_TEST(test_scpi_prop_vna_channel);
+}
@@ -0,0 +1,295 @@
+/**
+ * @file test_scpi_queue.c
+ * @brief SCPI Input Queue and Overlapped Command Tests.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/core/storage.h"
+#include "measlib/core/trace.h"
+#include "measlib/sys/scpi/scpi_core.h"
+#include "measlib/sys/scpi/scpi_def.h"
+#include "measlib/sys/scpi/scpi_status.h"
+#include "mock_channel.h"
+#include "test_framework.h"
+#include <stdio.h>
+#include <string.h>
+
+#define POINTS 100
+
+static scpi_context_t ctx;
+static char line_buf[128];
+static char output_buf[512];
+static size_t output_pos;
+
+static size_t mock_write(scpi_context_t *c, const char *data, size_t len) {
+  (void)c;
+  if (output_pos + len >= sizeof(output_buf))
+    return 0;
+  memcpy(output_buf + output_pos, data, len);
+  output_pos += len;
+  output_buf[output_pos] = '\0';
+  return len;
+}
+
+// --- Mock real-valued trace ---
+
+static meas_real_t freq[POINTS];
+static meas_real_t mag[POINTS];
+
+static meas_status_t mock_get_data(meas_trace_t *t, const meas_real_t **x,
+                                   const meas_real_t **y, size_t *count) {
+  (void)t;
+  *x = freq;
+  *y = mag;
+  *count = POINTS;
+  return MEAS_OK;
+}
+
+static const meas_trace_api_t mock_trace_api = {.get_data = mock_get_data};
+static meas_trace_t mock_trace = {.base = {.api = &mock_trace_api.base}};
+
+// --- Mock filesystem: one file in RAM ---
+
+static meas_file_t mock_file;
+static char file_name[32];
+static char file_data[4096];
+static size_t file_len;
+static int file_writes;
+static bool file_open;
+static bool fail_writes;
+
+static meas_status_t mock_open(meas_object_t *drv, const char *path,
+                               meas_file_t **out) {
+  (void)drv;
+  snprintf(file_name, sizeof(file_name), "%s", path);
+  file_len = 0;
+  file_writes = 0;
+  file_open = true;
+  *out = &mock_file;
+  return MEAS_OK;
+}
+
+static meas_status_t mock_fwrite(meas_file_t *f, const void *data,
+                                 size_t size) {
+  (void)f;
+  if (fail_writes || file_len + size > sizeof(file_data))
+    return MEAS_ERROR;
+  memcpy(file_data + file_len, data, size);
+  file_len += size;
+  file_writes++;
+  return MEAS_OK;
+}
+
+static meas_status_t mock_close(meas_file_t *f) {
+  (void)f;
+  file_open = false;
+  return MEAS_OK;
+}
+
+static const meas_fs_api_t mock_fs = {
+    .open = mock_open, .write = mock_fwrite, .close = mock_close};
+
+static void setup(void) {
+  memset(&ctx, 0, sizeof(ctx));
+  scpi_init(&ctx, line_buf, sizeof(line_buf), NULL, mock_write);
+  scpi_def_init();
+  scpi_def_set_channel(&mock_channel);
+  scpi_def_set_trace(1, &mock_trace);
+  scpi_def_set_storage(&mock_fs, NULL);
+  for (int i = 0; i < POINTS; i++) {
+    freq[i] = 1.0e6 + 1.0e3 * i;
+    mag[i] = 0.5 * i - 10.0;
+  }
+  mock_channel_reset();
+  file_open = false;
+  fail_writes = false;
+  output_pos = 0;
+  output_buf[0] = '\0';
+}
+
+static size_t receive(const char *line) {
+  return scpi_receive(&ctx, line, strlen(line));
+}
+
+void test_scpi_queue_parses_while_pending(void) {
+  setup();
+
+  // Received, not executed
+  TEST_ASSERT_EQUAL(16, receive("INIT;*WAI;*STB?\n"));
+  TEST_ASSERT_EQUAL(3, scpi_queued(&ctx));
+  TEST_ASSERT_EQUAL(0, mock_sweeps_started);
+
+  TEST_ASSERT_EQUAL(SCPI_RES_PENDING, scpi_execute(&ctx));
+  TEST_ASSERT_EQUAL(1, mock_sweeps_started);
+
+  // Input keeps being accepted behind the wait, errors included
+  TEST_ASSERT_EQUAL(6, receive("*IDN?\n"));
+  TEST_ASSERT_EQUAL(6, receive("BOGUS\n"));
+  TEST_ASSERT_EQUAL(6, receive("*ESR?\n"));
+  TEST_ASSERT_EQUAL(SCPI_RES_PENDING, scpi_execute(&ctx));
+  TEST_ASSERT_EQUAL(0, output_pos);
+
+  // Everything runs in order once the sweep is done
+  mock_sweep_finish();
+  scpi_execute(&ctx);
+  TEST_ASSERT_EQUAL_STRING("0\r\nMOMENTICS,MeasLib,0,0.1\r\n160\r\n",
+                           output_buf); // CME | PON
+  TEST_ASSERT_EQUAL(0, scpi_queued(&ctx));
+}
+
+void test_scpi_queue_full_holds_input(void) {
+  setup();
+  receive("INIT;*WAI\n");
+  scpi_execute(&ctx);
+
+  // One pending unit; queries fill the queue and the line buffer
+  char input[(SCPI_QUEUE_DEPTH + 1) * 8];
+  size_t len = 0;
+  for (int i = 0; i <= SCPI_QUEUE_DEPTH; i++)
+    len += (size_t)snprintf(input + len, sizeof(input) - len, "*ESE?\n");
+  size_t taken = receive(input);
+  TEST_ASSERT(taken < len);
+  TEST_ASSERT_EQUAL(SCPI_QUEUE_DEPTH, scpi_queued(&ctx));
+  TEST_ASSERT_EQUAL(0, receive(input + taken));
+
+  mock_sweep_finish();
+  scpi_status_t res;
+  TEST_ASSERT_EQUAL(len - taken,
+                    scpi_feed(&ctx, input + taken, len - taken, &res));
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, res);
+  TEST_ASSERT_EQUAL((SCPI_QUEUE_DEPTH + 1) * 3, output_pos); // "0\r\n"
+  TEST_ASSERT_EQUAL(0, scpi_queued(&ctx));
+
+  // A message longer than the queue is parsed as it drains
+  const char *message = "*ESE 1;*ESE?;*ESE?;*ESE?;*ESE?;*ESE?;*ESE?;*ESE?;"
+                        "*ESE?;*ESE?\n";
+  output_pos = 0;
+  TEST_ASSERT_EQUAL(SCPI_RES_OK,
+                    scpi_process(&ctx, message, strlen(message)));
+  TEST_ASSERT_EQUAL_STRING("1;1;1;1;1;1;1;1;1\r\n", output_buf);
+}
+
+void test_scpi_queue_parse_errors(void) {
+  setup();
+  scpi_status_t res;
+
+  // Units before a bad header still run; the rest is discarded
+  scpi_feed(&ctx, "*ESE 4;BOGUS;*ESE 8\n", 20, &res);
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_INVALID_HEADER, res);
+  scpi_feed(&ctx, "*ESE?\n", 6, &res);
+  TEST_ASSERT_EQUAL_STRING("4\r\n", output_buf);
+
+  // Parameters that do not fit a queue entry
+  char line[SCPI_QUEUE_PARAM_LEN + 16];
+  memset(line, '1', sizeof(line));
+  memcpy(line, "*ESE ", 5);
+  line[sizeof(line) - 1] = '\n';
+  scpi_feed(&ctx, line, sizeof(line), &res);
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_TOO_MUCH_DATA, res);
+  TEST_ASSERT_EQUAL(SCPI_ESR_EXE | SCPI_ESR_CME | SCPI_ESR_PON,
+                    scpi_status_read_esr());
+}
+
+void test_scpi_mmem_store_overlapped(void) {
+  setup();
+  scpi_status_t res;
+
+  const char *line = "MMEM:STOR:TRAC 1,\"s21.csv\";*OPC?\n";
+  TEST_ASSERT_EQUAL(strlen(line), scpi_feed(&ctx, line, strlen(line), &res));
+  TEST_ASSERT_EQUAL(SCPI_RES_PENDING, res);
+  TEST_ASSERT_EQUAL_STRING("s21.csv", file_name);
+  TEST_ASSERT(file_open);
+
+  // The parser and other commands keep running while the file is written
+  TEST_ASSERT_EQUAL(6, receive("*IDN?\n"));
+  int polls = 0;
+  while (file_open && polls < 100) {
+    scpi_def_poll();
+    scpi_execute(&ctx);
+    polls++;
+  }
+  TEST_ASSERT(polls > 1);
+  TEST_ASSERT_EQUAL(polls, file_writes);
+  TEST_ASSERT_EQUAL_STRING("1\r\nMOMENTICS,MeasLib,0,0.1\r\n", output_buf);
+
+  // One line per point
+  TEST_ASSERT_EQUAL(0, memcmp(file_data, "1000000,-10\n1001000,-9.5\n", 24));
+  TEST_ASSERT_EQUAL(0, memcmp(file_data + file_len - 13, "1099000,39.5\n",
+                              13));
+
+  // One store at a time; a failed write is a device-dependent error
+  scpi_feed(&ctx, "MMEM:STOR:TRAC 1,'a.csv'\n", 25, &res);
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, res);
+  scpi_feed(&ctx, "MMEM:STOR:TRAC 1,'b.csv'\n", 25, &res);
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_EXECUTION, res);
+  fail_writes = true;
+  scpi_def_poll();
+  TEST_ASSERT(!file_open);
+  TEST_ASSERT_EQUAL(SCPI_ESR_DDE | SCPI_ESR_EXE | SCPI_ESR_PON,
+                    scpi_status_read_esr());
+
+  // Bad parameters
+  scpi_feed(&ctx, "MMEM:STOR:TRAC 1,c.csv\n", 23, &res);
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_DATA_TYPE, res);
+  scpi_feed(&ctx, "MMEM:STOR:TRAC 3,\"c.csv\"\n", 25, &res);
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_EXECUTION, res);
+}
+
+void test_scpi_mmem_store_one_sweep(void) {
+  setup();
+  scpi_status_t res;
+
+  // A store behind a running sweep waits for its end
+  const char *line = "INIT;MMEM:STOR:TRAC 1,'a.csv';*OPC?\n";
+  scpi_feed(&ctx, line, strlen(line), &res);
+  TEST_ASSERT_EQUAL(SCPI_RES_PENDING, res);
+  scpi_def_poll();
+  scpi_def_poll();
+  TEST_ASSERT(file_open);
+  TEST_ASSERT_EQUAL(0, file_writes);
+  mock_sweep_finish();
+  while (file_open)
+    scpi_def_poll();
+  scpi_execute(&ctx);
+  TEST_ASSERT_EQUAL_STRING("1\r\n", output_buf);
+  TEST_ASSERT_EQUAL(0, memcmp(file_data, "1000000,-10\n", 12));
+
+  // A sweep behind a running store waits for the file to be complete
+  output_pos = 0;
+  line = "MMEM:STOR:TRAC 1,'b.csv';INIT;*OPC?\n";
+  scpi_feed(&ctx, line, strlen(line), &res);
+  TEST_ASSERT_EQUAL(SCPI_RES_PENDING, res);
+  TEST_ASSERT_EQUAL(1, mock_sweeps_started);
+  while (file_open) {
+    scpi_def_poll();
+    scpi_execute(&ctx);
+  }
+  scpi_execute(&ctx);
+  TEST_ASSERT_EQUAL(2, mock_sweeps_started);
+  TEST_ASSERT_EQUAL(0, output_pos);
+  mock_sweep_finish();
+  scpi_execute(&ctx);
+  TEST_ASSERT_EQUAL_STRING("1\r\n", output_buf);
+
+  // *RST ends a running store; nothing stays pending
+  output_pos = 0;
+  scpi_feed(&ctx, "MMEM:STOR:TRAC 1,'c.csv'\n", 25, &res);
+  TEST_ASSERT(file_open);
+  scpi_feed(&ctx, "*RST;*OPC?\n", 11, &res);
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, res);
+  TEST_ASSERT(!file_open);
+  TEST_ASSERT_EQUAL_STRING("1\r\n", output_buf);
+  scpi_def_poll();
+  TEST_ASSERT_EQUAL(0, file_writes);
+}
+
+void run_scpi_queue_tests(void) {
+  printf("\n--- Running SCPI Queue Tests ---\n");
+  RUN_TEST(test_scpi_queue_parses_while_pending);
+  RUN_TEST(test_scpi_queue_full_holds_input);
+  RUN_TEST(test_scpi_queue_parse_errors);
+  RUN_TEST(test_scpi_mmem_store_overlapped);
+  RUN_TEST(test_scpi_mmem_store_one_sweep);
+}
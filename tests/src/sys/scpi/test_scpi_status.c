@@ -0,0 +1,198 @@
+/**
+ * @file test_scpi_status.c
+ * @brief SCPI Status Model and Operation Complete Tests.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/core/channel.h"
+#include "measlib/core/event.h"
+#include "measlib/sys/scpi/scpi_core.h"
+#include "measlib/sys/scpi/scpi_def.h"
+#include "measlib/sys/scpi/scpi_status.h"
+#include "mock_channel.h"
+#include "test_framework.h"
+#include <stdio.h>
+#include <string.h>
+
+static scpi_context_t ctx;
+static char line_buf[128];
+static char output_buf[256];
+static size_t output_pos;
+
+static size_t mock_write(scpi_context_t *c, const char *data, size_t len) {
+  (void)c;
+  if (output_pos + len >= sizeof(output_buf))
+    return 0;
+  memcpy(output_buf + output_pos, data, len);
+  output_pos += len;
+  output_buf[output_pos] = '\0';
+  return len;
+}
+
+static int srq_count;
+static uint8_t srq_stb;
+
+static void on_srq(void *user, uint8_t stb) {
+  (void)user;
+  srq_count++;
+  srq_stb = stb;
+}
+
+static void setup(void) {
+  memset(&ctx, 0, sizeof(ctx));
+  scpi_init(&ctx, line_buf, sizeof(line_buf), NULL, mock_write);
+  scpi_def_init();
+  scpi_def_set_channel(&mock_channel);
+  scpi_status_set_srq_handler(on_srq, NULL);
+  mock_channel_reset();
+  srq_count = 0;
+  srq_stb = 0;
+}
+
+// Feed a whole line; returns the bytes consumed
+static size_t feed(const char *line, scpi_status_t *res) {
+  output_pos = 0;
+  output_buf[0] = '\0';
+  return scpi_feed(&ctx, line, strlen(line), res);
+}
+
+void test_scpi_status_registers(void) {
+  setup();
+  scpi_status_t res;
+
+  // Power-on event, cleared by reading
+  feed("*ESR?;*ESR?\n", &res);
+  TEST_ASSERT_EQUAL_STRING("128;0\r\n", output_buf);
+
+  feed("*ESE 36;*ESE?;*SRE?\n", &res);
+  TEST_ASSERT_EQUAL_STRING("36;0\r\n", output_buf);
+
+  // A command error latches CME; enabled in ESE it sets ESB
+  feed("BOGUS\n", &res);
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_INVALID_HEADER, res);
+  TEST_ASSERT_EQUAL(0, srq_count);
+  feed("*STB?\n", &res);
+  TEST_ASSERT_EQUAL_STRING("32\r\n", output_buf);
+
+  // Enabling ESB in SRE requests service once
+  feed("*SRE 32\n", &res);
+  TEST_ASSERT_EQUAL(1, srq_count);
+  TEST_ASSERT_EQUAL(SCPI_STB_ESB | SCPI_STB_MSS, srq_stb);
+  feed("FORM HEX\n", &res);
+  TEST_ASSERT_EQUAL(1, srq_count);
+
+  feed("*CLS;*STB?;*ESR?\n", &res);
+  TEST_ASSERT_EQUAL_STRING("0;0\r\n", output_buf);
+
+  // Execution errors
+  scpi_def_set_channel(NULL);
+  feed("INIT\n", &res);
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_EXECUTION, res);
+  feed("*ESR?\n", &res);
+  TEST_ASSERT_EQUAL_STRING("16\r\n", output_buf);
+}
+
+void test_scpi_opc_query_waits_for_sweep(void) {
+  setup();
+  scpi_status_t res;
+  const char *line = "INIT:IMM;*OPC?\n";
+
+  TEST_ASSERT_EQUAL(strlen(line), feed(line, &res));
+  TEST_ASSERT_EQUAL(SCPI_RES_PENDING, res);
+  TEST_ASSERT_EQUAL(1, mock_sweeps_started);
+  TEST_ASSERT(scpi_busy(&ctx));
+  TEST_ASSERT_EQUAL(0, output_pos);
+
+  // Later input is queued behind the answer
+  TEST_ASSERT_EQUAL(6, feed("*IDN?\n", &res));
+  TEST_ASSERT_EQUAL(SCPI_RES_PENDING, scpi_resume(&ctx));
+  TEST_ASSERT_EQUAL(0, output_pos);
+
+  // Answered exactly when the channel reports the sweep done
+  mock_sweep_finish();
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, scpi_resume(&ctx));
+  TEST_ASSERT_EQUAL_STRING("1\r\nMOMENTICS,MeasLib,0,0.1\r\n", output_buf);
+  TEST_ASSERT(!scpi_busy(&ctx));
+
+  // Nothing pending: immediate; ABORt also completes the operation
+  feed("*OPC?\n", &res);
+  TEST_ASSERT_EQUAL_STRING("1\r\n", output_buf);
+  feed("INIT;ABOR;*OPC?\n", &res);
+  TEST_ASSERT_EQUAL_STRING("1\r\n", output_buf);
+
+  // Another channel finishing does not count
+  feed("INIT;*OPC?\n", &res);
+  meas_event_t other = {
+      .type = EVENT_STATE_CHANGED,
+      .source = NULL,
+      .payload = {.type = PROP_TYPE_INT64, .i_val = mock_channel.sweep_seq}};
+  meas_event_publish(other);
+  meas_dispatch_events();
+  TEST_ASSERT_EQUAL(SCPI_RES_PENDING, scpi_resume(&ctx));
+  mock_sweep_finish();
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, scpi_resume(&ctx));
+}
+
+// The end of an earlier sweep, still queued, does not complete a new one
+static void check_stale_end_ignored(const char *line) {
+  scpi_status_t res;
+  feed(line, &res);
+  TEST_ASSERT_EQUAL(SCPI_RES_PENDING, res);
+  meas_dispatch_events();
+  TEST_ASSERT_EQUAL(SCPI_RES_PENDING, scpi_resume(&ctx));
+  TEST_ASSERT_EQUAL(0, output_pos);
+
+  mock_sweep_finish();
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, scpi_resume(&ctx));
+  TEST_ASSERT_EQUAL_STRING("1\r\n", output_buf);
+}
+
+void test_scpi_opc_ignores_stale_sweep_end(void) {
+  setup();
+  scpi_status_t res;
+
+  // Aborted sweeps (ABORt, *RST) report their end after the new INITiate
+  feed("INIT\n", &res);
+  check_stale_end_ignored("ABOR;:INIT;*OPC?\n");
+  feed("INIT\n", &res);
+  check_stale_end_ignored("*RST;:INIT;*OPC?\n");
+
+  // A sweep that completed right before INITiate
+  feed("INIT\n", &res);
+  mock_sweep_end();
+  check_stale_end_ignored("INIT;*OPC?\n");
+  TEST_ASSERT_EQUAL(6, mock_sweeps_started);
+}
+
+void test_scpi_opc_and_wai(void) {
+  setup();
+  scpi_status_t res;
+
+  // *OPC: the OPC event requests service when the sweep ends
+  feed("*ESE 1;*SRE 32;INIT;*OPC\n", &res);
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, res);
+  TEST_ASSERT_EQUAL(0, srq_count);
+  mock_sweep_finish();
+  TEST_ASSERT_EQUAL(1, srq_count);
+  TEST_ASSERT_EQUAL(SCPI_STB_ESB | SCPI_STB_MSS, srq_stb);
+  feed("*ESR?\n", &res);
+  TEST_ASSERT_EQUAL_STRING("129\r\n", output_buf); // OPC | PON
+
+  // *WAI holds the rest of the message
+  feed("INIT;*WAI;*IDN?\n", &res);
+  TEST_ASSERT_EQUAL(SCPI_RES_PENDING, res);
+  TEST_ASSERT_EQUAL(0, output_pos);
+  mock_sweep_finish();
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, scpi_resume(&ctx));
+  TEST_ASSERT_EQUAL_STRING("MOMENTICS,MeasLib,0,0.1\r\n", output_buf);
+}
+
+void run_scpi_status_tests(void) {
+  printf("\n--- Running SCPI Status Tests ---\n");
+  RUN_TEST(test_scpi_status_registers);
+  RUN_TEST(test_scpi_opc_query_waits_for_sweep);
+  RUN_TEST(test_scpi_opc_ignores_stale_sweep_end);
+  RUN_TEST(test_scpi_opc_and_wai);
+}
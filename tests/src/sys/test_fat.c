@@ -0,0 +1,406 @@
+/**
+ * @file test_fat.c
+ * @brief FAT16 / FAT32 Filesystem Tests.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Volumes live on a sparse RAM disk and are formatted here the way a PC
+ * formatter lays them out, so the checks on raw sectors are also checks
+ * against what a PC would read.
+ */
+
+#include "measlib/sys/fat.h"
+#include "test_framework.h"
+#include <stdio.h>
+#include <string.h>
+
+// --- Sparse RAM disk: sectors never written read as zeros ---
+
+#define DISK_SLOTS 512
+
+static uint32_t disk_lba[DISK_SLOTS];
+static uint8_t disk_data[DISK_SLOTS][512];
+static size_t disk_used;
+static uint32_t disk_sectors;
+static int disk_reads;
+static int disk_writes;
+static uint32_t disk_burst; // Largest multi-sector write
+static bool disk_fail;
+
+static uint8_t *disk_sector(uint32_t lba, bool create) {
+  for (size_t i = 0; i < disk_used; i++) {
+    if (disk_lba[i] == lba)
+      return disk_data[i];
+  }
+  if (!create || disk_used >= DISK_SLOTS)
+    return NULL;
+  disk_lba[disk_used] = lba;
+  memset(disk_data[disk_used], 0, 512);
+  return disk_data[disk_used++];
+}
+
+static meas_status_t disk_read(void *ctx, uint32_t sector, void *buffer,
+                               uint32_t count) {
+  (void)ctx;
+  if (disk_fail || sector + count > disk_sectors)
+    return MEAS_ERROR;
+  disk_reads++;
+  for (uint32_t i = 0; i < count; i++) {
+    const uint8_t *s = disk_sector(sector + i, false);
+    if (s)
+      memcpy((uint8_t *)buffer + i * 512, s, 512);
+    else
+      memset((uint8_t *)buffer + i * 512, 0, 512);
+  }
+  return MEAS_OK;
+}
+
+static meas_status_t disk_write(void *ctx, uint32_t sector,
+                                const void *buffer, uint32_t count) {
+  (void)ctx;
+  if (disk_fail || sector + count > disk_sectors)
+    return MEAS_ERROR;
+  disk_writes++;
+  if (count > disk_burst)
+    disk_burst = count;
+  for (uint32_t i = 0; i < count; i++) {
+    uint8_t *s = disk_sector(sector + i, true);
+    if (!s)
+      return MEAS_ERROR;
+    memcpy(s, (const uint8_t *)buffer + i * 512, 512);
+  }
+  return MEAS_OK;
+}
+
+static uint32_t disk_capacity(void *ctx) {
+  (void)ctx;
+  return disk_sectors;
+}
+
+static bool disk_ready(void *ctx) {
+  (void)ctx;
+  return true;
+}
+
+static const meas_hal_storage_api_t disk_api = {
+    .read = disk_read,
+    .write = disk_write,
+    .get_capacity = disk_capacity,
+    .is_ready = disk_ready,
+};
+
+static void put16(uint8_t *p, uint16_t v) {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t *p, uint32_t v) {
+  put16(p, (uint16_t)v);
+  put16(p + 2, (uint16_t)(v >> 16));
+}
+
+static uint32_t get32(const uint8_t *p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+         ((uint32_t)p[3] << 24);
+}
+
+// --- Formatter ---
+
+typedef struct {
+  uint32_t fat;  ///< First FAT
+  uint32_t fat_sectors;
+  uint32_t root; ///< FAT16 root region / FAT32 root cluster sector
+  uint32_t clusters;
+} layout_t;
+
+/**
+ * @brief Format a volume at @p start (behind an MBR when not 0).
+ */
+static layout_t format(uint32_t start, uint32_t sectors, uint8_t spc,
+                       bool fat32) {
+  memset(disk_lba, 0, sizeof(disk_lba));
+  disk_used = 0;
+  disk_sectors = start + sectors;
+  disk_reads = 0;
+  disk_writes = 0;
+  disk_burst = 0;
+  disk_fail = false;
+
+  uint32_t reserved = fat32 ? 32 : 1;
+  uint32_t root_sectors = fat32 ? 0 : 32; // 512 entries
+  uint32_t fat_size = 1;
+  uint32_t clusters;
+  for (;;) {
+    clusters = (sectors - reserved - 2 * fat_size - root_sectors) / spc;
+    uint32_t need = ((clusters + 2) * (fat32 ? 4 : 2) + 511) / 512;
+    if (need <= fat_size)
+      break;
+    fat_size = need;
+  }
+
+  if (start) {
+    uint8_t *mbr = disk_sector(0, true);
+    uint8_t *p = &mbr[446];
+    p[4] = fat32 ? 0x0C : 0x06;
+    put32(p + 8, start);
+    put32(p + 12, sectors);
+    put16(&mbr[510], 0xAA55);
+  }
+
+  uint8_t *b = disk_sector(start, true);
+  b[0] = 0xEB;
+  b[1] = 0x58;
+  b[2] = 0x90;
+  memcpy(&b[3], "MSWIN4.1", 8);
+  put16(&b[11], 512);
+  b[13] = spc;
+  put16(&b[14], (uint16_t)reserved);
+  b[16] = 2;
+  put16(&b[17], fat32 ? 0 : 512);
+  if (!fat32 && sectors < 65536)
+    put16(&b[19], (uint16_t)sectors);
+  else
+    put32(&b[32], sectors);
+  b[21] = 0xF8;
+  put32(&b[28], start);
+  if (fat32) {
+    put32(&b[36], fat_size);
+    put32(&b[44], 2); // Root directory cluster
+    put16(&b[48], 1); // FSInfo
+    put16(&b[50], 6); // Backup boot sector
+    b[66] = 0x29;
+    memcpy(&b[71], "NO NAME    FAT32   ", 19);
+  } else {
+    put16(&b[22], (uint16_t)fat_size);
+    b[38] = 0x29;
+    memcpy(&b[43], "NO NAME    FAT16   ", 19);
+  }
+  put16(&b[510], 0xAA55);
+
+  if (fat32) {
+    uint8_t *fsi = disk_sector(start + 1, true);
+    put32(&fsi[0], 0x41615252);
+    put32(&fsi[484], 0x61417272);
+    put32(&fsi[488], clusters - 1);
+    put32(&fsi[492], 3);
+    put32(&fsi[508], 0xAA550000);
+  }
+
+  // Media and end-of-chain entries (and the FAT32 root cluster)
+  layout_t l = {.fat = start + reserved, .fat_sectors = fat_size};
+  for (uint32_t n = 0; n < 2; n++) {
+    uint8_t *f = disk_sector(l.fat + n * fat_size, true);
+    if (fat32) {
+      put32(&f[0], 0x0FFFFFF8);
+      put32(&f[4], 0x0FFFFFFF);
+      put32(&f[8], 0x0FFFFFFF);
+    } else {
+      put16(&f[0], 0xFFF8);
+      put16(&f[2], 0xFFFF);
+    }
+  }
+  l.root = l.fat + 2 * fat_size;
+  l.clusters = clusters;
+  return l;
+}
+
+static uint32_t free_clusters(const layout_t *l, bool fat32) {
+  uint32_t per_sector = fat32 ? 128 : 256;
+  uint32_t n = 0;
+  const uint8_t *s = NULL;
+  for (uint32_t c = 2; c < l->clusters + 2; c++) {
+    uint32_t i = c % per_sector;
+    if (c == 2 || i == 0)
+      s = disk_sector(l->fat + c / per_sector, false);
+    uint32_t v = 0;
+    if (s && fat32)
+      v = get32(&s[i * 4]) & 0x0FFFFFFF;
+    else if (s)
+      v = (uint32_t)(s[i * 2] | (s[i * 2 + 1] << 8));
+    if (v == 0)
+      n++;
+  }
+  return n;
+}
+
+static const uint8_t *find_entry(uint32_t lba, const char *name11) {
+  const uint8_t *s = disk_sector(lba, false);
+  for (int i = 0; s && i < 16; i++) {
+    if (memcmp(&s[i * 32], name11, 11) == 0)
+      return &s[i * 32];
+  }
+  return NULL;
+}
+
+static meas_fat_t vol;
+static uint8_t pattern[12000];
+static uint8_t readback[12000];
+
+static const meas_fs_api_t *mount(void) {
+  const meas_fs_api_t *fs = meas_fat_get_api();
+  TEST_ASSERT_EQUAL(MEAS_OK, meas_fat_init(&vol, &disk_api, NULL));
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->mount(&vol.base));
+  for (size_t i = 0; i < sizeof(pattern); i++)
+    pattern[i] = (uint8_t)(i * 7 + (i >> 9));
+  return fs;
+}
+
+void test_fat16_write_read(void) {
+  layout_t l = format(0, 16384, 2, false);
+  const meas_fs_api_t *fs = mount();
+  TEST_ASSERT_EQUAL(16, vol.fat_bits);
+  uint32_t free_before = free_clusters(&l, false);
+
+  // Odd-sized chunks around whole-sector runs
+  meas_file_t *f;
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->open(&vol.base, "trace.csv", &f));
+  static const size_t chunks[] = {100, 3000, 7, 6893};
+  size_t pos = 0;
+  for (size_t i = 0; i < 4; i++) {
+    TEST_ASSERT_EQUAL(MEAS_OK, fs->write(f, pattern + pos, chunks[i]));
+    pos += chunks[i];
+  }
+  TEST_ASSERT(disk_burst >= 4); // Multi-sector transfers
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->close(f));
+
+  // What a PC sees: the root entry, the cluster count, both FATs alike
+  const uint8_t *e = find_entry(l.root, "TRACE   CSV");
+  TEST_ASSERT(e != NULL);
+  TEST_ASSERT_EQUAL(10000, get32(e + 28));
+  TEST_ASSERT_EQUAL(free_before - 10, free_clusters(&l, false));
+  TEST_ASSERT_EQUAL(0, memcmp(disk_sector(l.fat, false),
+                              disk_sector(l.fat + l.fat_sectors, false), 512));
+
+  // Read back after a fresh mount: in one go, then in odd pieces
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->unmount(&vol.base));
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->mount(&vol.base));
+  size_t n, size;
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->stat(&vol.base, "/TRACE.CSV", &size));
+  TEST_ASSERT_EQUAL(10000, size);
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->open(&vol.base, "TRACE.CSV", &f));
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->read(f, readback, sizeof(readback), &n));
+  TEST_ASSERT_EQUAL(10000, n);
+  TEST_ASSERT_EQUAL(0, memcmp(readback, pattern, 10000));
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->seek(f, 1234));
+  memset(readback, 0, sizeof(readback));
+  for (pos = 1234; pos < 10000; pos += n) {
+    TEST_ASSERT_EQUAL(MEAS_OK, fs->read(f, readback + pos, 777, &n));
+    TEST_ASSERT(n > 0);
+  }
+  TEST_ASSERT_EQUAL(0, memcmp(readback + 1234, pattern + 1234, 10000 - 1234));
+
+  // Writing from 0 replaces the file; after seek(size) it appends
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->seek(f, 0));
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->write(f, pattern + 1, 600));
+  size_t at;
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->tell(f, &at));
+  TEST_ASSERT_EQUAL(600, at);
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->write(f, pattern + 601, 100));
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->close(f));
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->stat(&vol.base, "trace.csv", &size));
+  TEST_ASSERT_EQUAL(700, size);
+  TEST_ASSERT_EQUAL(free_before - 1, free_clusters(&l, false));
+
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->open(&vol.base, "trace.csv", &f));
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->seek(f, 700));
+  TEST_ASSERT_EQUAL(MEAS_ERROR, fs->seek(f, 701));
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->write(f, pattern + 701, 2000));
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->seek(f, 0));
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->read(f, readback, sizeof(readback), &n));
+  TEST_ASSERT_EQUAL(2700, n);
+  TEST_ASSERT_EQUAL(0, memcmp(readback, pattern + 1, 2700));
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->close(f));
+}
+
+void test_fat_small_writes_cached(void) {
+  layout_t l = format(0, 16384, 2, false);
+  const meas_fs_api_t *fs = mount();
+
+  // 256-byte records (one MMEMory:STORe chunk) reach the disk per sector
+  meas_file_t *f;
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->open(&vol.base, "LOG.TXT", &f));
+  disk_writes = 0;
+  for (int i = 0; i < 40; i++)
+    TEST_ASSERT_EQUAL(MEAS_OK, fs->write(f, pattern + i * 256, 256));
+  TEST_ASSERT(disk_writes <= 20);
+  TEST_ASSERT_EQUAL(MEAS_OK, meas_fat_sync(&vol));
+  const uint8_t *e = find_entry(l.root, "LOG     TXT");
+  TEST_ASSERT(e != NULL);
+  TEST_ASSERT_EQUAL(40 * 256, get32(e + 28));
+
+  // A second handle, then no more
+  meas_file_t *g, *h;
+  TEST_ASSERT_EQUAL(MEAS_BUSY, fs->open(&vol.base, "LOG.TXT", &g));
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->open(&vol.base, "OTHER.BIN", &g));
+  TEST_ASSERT_EQUAL(MEAS_BUSY, fs->open(&vol.base, "THIRD.BIN", &h));
+  TEST_ASSERT_EQUAL(MEAS_BUSY, fs->remove(&vol.base, "LOG.TXT"));
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->close(g));
+
+  // Device errors come back to the caller
+  disk_fail = true;
+  TEST_ASSERT_EQUAL(MEAS_ERROR, fs->write(f, pattern, 4096));
+  disk_fail = false;
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->close(f));
+  TEST_ASSERT_EQUAL(MEAS_ERROR, fs->close(f));
+
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->unmount(&vol.base));
+  TEST_ASSERT_EQUAL(MEAS_ERROR, fs->open(&vol.base, "LOG.TXT", &f));
+}
+
+void test_fat32_directories(void) {
+  // FAT32 in the first partition, one sector per cluster
+  layout_t l = format(2048, 131072, 1, true);
+  const meas_fs_api_t *fs = mount();
+  TEST_ASSERT_EQUAL(32, vol.fat_bits);
+
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->mkdir(&vol.base, "LOGS"));
+  TEST_ASSERT_EQUAL(MEAS_ERROR, fs->mkdir(&vol.base, "logs"));
+  TEST_ASSERT(find_entry(l.root, "LOGS       ") != NULL);
+  TEST_ASSERT_EQUAL(0xFFFFFFFFUL, get32(disk_sector(2049, false) + 488));
+
+  // More files than one directory cluster holds
+  char path[24];
+  meas_file_t *f;
+  for (int i = 0; i < 20; i++) {
+    snprintf(path, sizeof(path), "logs/run%d.dat", i);
+    TEST_ASSERT_EQUAL(MEAS_OK, fs->open(&vol.base, path, &f));
+    TEST_ASSERT_EQUAL(MEAS_OK, fs->write(f, pattern + i, 1000 + i));
+    TEST_ASSERT_EQUAL(MEAS_OK, fs->close(f));
+  }
+  size_t size, n;
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->stat(&vol.base, "LOGS/RUN19.DAT", &size));
+  TEST_ASSERT_EQUAL(1019, size);
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->open(&vol.base, "Logs\\Run7.Dat", &f));
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->read(f, readback, sizeof(readback), &n));
+  TEST_ASSERT_EQUAL(1007, n);
+  TEST_ASSERT_EQUAL(0, memcmp(readback, pattern + 7, 1007));
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->close(f));
+
+  // Names and paths that do not resolve
+  TEST_ASSERT_EQUAL(MEAS_ERROR, fs->open(&vol.base, "LONGFILENAME.TXT", &f));
+  TEST_ASSERT_EQUAL(MEAS_ERROR, fs->open(&vol.base, "DATA.TEXT", &f));
+  TEST_ASSERT_EQUAL(MEAS_ERROR, fs->open(&vol.base, "NODIR/A.TXT", &f));
+  TEST_ASSERT_EQUAL(MEAS_ERROR, fs->open(&vol.base, "LOGS", &f));
+  TEST_ASSERT_EQUAL(MEAS_ERROR, fs->stat(&vol.base, "LOGS/NONE.DAT", &size));
+
+  // Directories go once empty; their clusters come back
+  uint32_t free_full = free_clusters(&l, true);
+  TEST_ASSERT_EQUAL(MEAS_ERROR, fs->remove(&vol.base, "LOGS"));
+  for (int i = 0; i < 20; i++) {
+    snprintf(path, sizeof(path), "LOGS/RUN%d.DAT", i);
+    TEST_ASSERT_EQUAL(MEAS_OK, fs->remove(&vol.base, path));
+  }
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->remove(&vol.base, "LOGS"));
+  TEST_ASSERT_EQUAL(MEAS_ERROR, fs->stat(&vol.base, "LOGS", &size));
+  TEST_ASSERT_EQUAL(l.clusters - 1, free_clusters(&l, true));
+  TEST_ASSERT(free_full < l.clusters - 1);
+  TEST_ASSERT_EQUAL(MEAS_OK, fs->unmount(&vol.base));
+}
+
+void run_fat_tests(void) {
+  printf("\n--- Running FAT Filesystem Tests ---\n");
+  RUN_TEST(test_fat16_write_read);
+  RUN_TEST(test_fat_small_writes_cached);
+  RUN_TEST(test_fat32_directories);
+}
@@ -0,0 +1,169 @@
+/**
+ * @file test_remote_display.c
+ * @brief Remote Display Mirroring Tests.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Streams the render service output through a mock IO stream into the host
+ * decoder (tests/tools/remote_viewer) and compares with the mock LCD.
+ */
+
+#include "drv_lcd.h"
+#include "measlib/sys/remote_display.h"
+#include "measlib/sys/render_service.h"
+#include "measlib/ui/components/label.h"
+#include "measlib/ui/fonts.h"
+#include "remote_decoder.h"
+#include "test_framework.h"
+#include <string.h>
+
+#define SCREEN_W 320
+#define SCREEN_H 240
+
+extern meas_pixel_t mock_lcd_framebuffer[SCREEN_W * SCREEN_H];
+extern uint32_t mock_sys_tick_ms;
+
+static remote_decoder_t decoder;
+static size_t link_bytes;
+static bool link_up;
+static bool link_unflushed_twice;
+static int link_queued; // Sends since the last flush
+static bool link_fail;   // Sends refused (buffer lost)
+
+static meas_status_t link_send(meas_io_t *io, const void *data, size_t size) {
+  (void)io;
+  if (link_fail)
+    return MEAS_ERROR;
+  if (++link_queued > 1)
+    link_unflushed_twice = true; // Two buffers on the wire
+  link_bytes += size;
+  remote_decoder_feed(&decoder, (const uint8_t *)data, size);
+  return MEAS_OK;
+}
+
+static meas_status_t link_flush(meas_io_t *io) {
+  (void)io;
+  link_queued = 0;
+  return MEAS_OK;
+}
+
+static bool link_connected(meas_io_t *io) {
+  (void)io;
+  return link_up;
+}
+
+static const meas_io_api_t link_api = {
+    .send = link_send, .flush = link_flush, .is_connected = link_connected};
+
+static meas_io_t link = {.base = {.api = (const meas_object_api_t *)&link_api}};
+
+static void render_pending(void) {
+  mock_sys_tick_ms += 1000;
+  do {
+    meas_render_service_update();
+  } while (meas_render_service_busy());
+}
+
+static bool mirror_matches(void) {
+  return decoder.width == SCREEN_W && decoder.height == SCREEN_H &&
+         memcmp(decoder.screen, mock_lcd_framebuffer,
+                sizeof(mock_lcd_framebuffer)) == 0;
+}
+
+void test_remote_display_mirror(void) {
+  meas_ui_t *ui = meas_render_service_init(meas_drv_lcd_init());
+  static meas_widget_tree_t tree;
+  static meas_readout_t readout;
+  meas_widget_tree_init(&tree, ui);
+  meas_readout_init(&readout, (meas_rect_t){10, 200, 100, 8}, 1, NULL);
+  readout.base.font = &font_5x7;
+  meas_widget_add(&tree.root, &readout.base);
+
+  remote_decoder_init(&decoder);
+  link_bytes = 0;
+  link_up = true;
+  link_queued = 0;
+  link_unflushed_twice = false;
+  link_fail = false;
+
+  // Start: HELLO plus the full screen
+  TEST_ASSERT_EQUAL(MEAS_OK, meas_remote_display_start(&link, ui));
+  render_pending();
+  TEST_ASSERT_EQUAL(1, (int)decoder.hellos);
+  TEST_ASSERT(mirror_matches());
+  meas_remote_stats_t st = meas_remote_display_stats();
+  TEST_ASSERT_EQUAL(SCREEN_H, (int)st.rows_sent);
+  size_t full_bytes = link_bytes;
+
+  // Full redraw with nothing changed: no rows on the wire
+  meas_ui_force_redraw(ui);
+  render_pending();
+  st = meas_remote_display_stats();
+  TEST_ASSERT_EQUAL(SCREEN_H, (int)st.rows_sent);
+  TEST_ASSERT_EQUAL(SCREEN_H, (int)st.rows_skipped);
+  TEST_ASSERT_EQUAL((int)full_bytes, (int)link_bytes);
+
+  // Small change: only the rows that differ, a fraction of a full frame
+  meas_readout_set_value(&readout, 42);
+  render_pending();
+  st = meas_remote_display_stats();
+  TEST_ASSERT(st.rows_sent > SCREEN_H && st.rows_sent <= SCREEN_H + 8);
+  TEST_ASSERT(link_bytes - full_bytes < full_bytes / 10);
+  TEST_ASSERT(mirror_matches());
+
+  TEST_ASSERT(!link_unflushed_twice);
+  TEST_ASSERT_EQUAL(0, (int)decoder.errors);
+
+  // Refused send: the lost rows go again with the next frame
+  link_fail = true;
+  meas_readout_set_value(&readout, 43);
+  render_pending();
+  TEST_ASSERT(!mirror_matches());
+  TEST_ASSERT(ui->dirty_map != 0);
+  link_fail = false;
+  render_pending();
+  TEST_ASSERT(mirror_matches());
+
+  // Host away: nothing sent; reconnect brings a full screen again
+  link_up = false;
+  size_t before = link_bytes;
+  meas_readout_set_value(&readout, 7);
+  render_pending();
+  TEST_ASSERT_EQUAL((int)before, (int)link_bytes);
+  link_up = true;
+  remote_decoder_init(&decoder);
+  meas_readout_set_value(&readout, 8);
+  render_pending(); // Reconnect seen: HELLO + forced redraw
+  render_pending();
+  TEST_ASSERT(mirror_matches());
+
+  meas_remote_display_stop();
+  ui->widgets = NULL;
+}
+
+void test_remote_decoder_resync(void) {
+  meas_ui_t *ui = meas_render_service_init(meas_drv_lcd_init());
+  remote_decoder_init(&decoder);
+  link_up = true;
+  meas_remote_display_start(&link, ui);
+  render_pending();
+  TEST_ASSERT(mirror_matches());
+
+  // Garbage and a corrupted message: dropped, later messages still decode
+  static const uint8_t noise[] = {0xA5, 0xA5, 0x5A, 0x02, 0x04, 0x00,
+                                  0x00, 0x00, 0x81, 0xFF, 0x00, 0x11};
+  uint32_t errors = decoder.errors;
+  remote_decoder_feed(&decoder, noise, sizeof(noise));
+  TEST_ASSERT_EQUAL((int)errors + 1, (int)decoder.errors);
+  meas_remote_display_refresh();
+  render_pending();
+  TEST_ASSERT(mirror_matches());
+  meas_remote_display_stop();
+}
+
+void run_remote_display_tests(void) {
+  printf("\n--- Running Remote Display Tests ---\n");
+  RUN_TEST(test_remote_display_mirror);
+  RUN_TEST(test_remote_decoder_resync);
+}
@@ -0,0 +1,210 @@
+/**
+ * @file test_render_service.c
+ * @brief Render Service Pipeline Tests.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Renders the main layout through the tiled service (mock LCD) and compares
+ * the captured framebuffer against a single full-screen reference pass.
+ */
+
+#include "drv_lcd.h"
+#include "measlib/sys/render_service.h"
+#include "measlib/ui/palette.h"
+#include "measlib/ui/render.h"
+#include "test_framework.h"
+#include <string.h>
+
+#define SCREEN_W 320
+#define SCREEN_H 240
+#define TILE_H MEAS_UI_TILE_HEIGHT
+
+// LCD transfers per tile: indexed tiles go out one expanded row at a time
+#ifdef MEAS_UI_INDEXED_COLOR
+#define TILE_BLITS TILE_H
+#else
+#define TILE_BLITS 1
+#endif
+#define FRAME_BLITS (MEAS_UI_TILE_COUNT * TILE_BLITS)
+
+extern const meas_render_api_t meas_render_cell_api;
+extern const meas_ui_api_t layout_main_api;
+
+// Mock LCD capture (tests/mocks/mock_hal.c)
+extern meas_pixel_t mock_lcd_framebuffer[SCREEN_W * SCREEN_H];
+extern uint32_t mock_lcd_blit_count;
+extern uint32_t mock_lcd_tear_count;
+
+// Host clock (tests/mocks/mock_hal.c)
+extern uint32_t mock_sys_tick_ms;
+
+static meas_tile_pixel_t reference_tiles[SCREEN_W * SCREEN_H];
+static meas_pixel_t reference[SCREEN_W * SCREEN_H];
+
+// Wait for the next frame slot, then run updates until the frame is out
+static int render_frame(void) {
+  int calls = 0;
+  mock_sys_tick_ms += 1000;
+  do {
+    meas_render_service_update();
+    calls++;
+  } while (meas_render_service_busy());
+  return calls;
+}
+
+static void render_reference(void) {
+  static meas_ui_t ref_ui;
+  meas_render_ctx_t ctx = {.buffer = reference_tiles,
+                           .width = SCREEN_W,
+                           .height = SCREEN_H,
+                           .x_offset = 0,
+                           .y_offset = 0,
+                           .fg_color = 0xFFFF,
+                           .bg_color = 0x0000,
+                           .clip_rect = {0, 0, SCREEN_W, SCREEN_H}};
+  memset(reference_tiles, 0, sizeof(reference_tiles));
+  layout_main_api.draw(&ref_ui, &ctx, &meas_render_cell_api);
+
+  // Compare in LCD format
+#ifdef MEAS_UI_INDEXED_COLOR
+  meas_palette_expand(reference, reference_tiles, SCREEN_W * SCREEN_H);
+#else
+  memcpy(reference, reference_tiles, sizeof(reference));
+#endif
+}
+
+void test_render_full_frame(void) {
+  meas_ui_t *ui = meas_render_service_init(meas_drv_lcd_init());
+  TEST_ASSERT(ui != NULL);
+
+  memset(mock_lcd_framebuffer, 0, sizeof(mock_lcd_framebuffer));
+  mock_lcd_blit_count = 0;
+  mock_lcd_tear_count = 0;
+
+  meas_ui_force_redraw(ui);
+  render_frame();
+
+  // Every tile flushed exactly once without tearing
+  TEST_ASSERT_EQUAL(FRAME_BLITS, (int)mock_lcd_blit_count);
+  TEST_ASSERT_EQUAL(0, (int)mock_lcd_tear_count);
+  TEST_ASSERT(!meas_drv_lcd_is_busy(NULL));
+  TEST_ASSERT_EQUAL(0, (int)ui->dirty_map);
+
+  render_reference();
+  TEST_ASSERT(memcmp(reference, mock_lcd_framebuffer, sizeof(reference)) == 0);
+}
+
+void test_render_dirty_tiles_only(void) {
+  meas_ui_t *ui = meas_render_service_init(meas_drv_lcd_init());
+  render_frame(); // Settle any pending redraw
+
+  mock_lcd_blit_count = 0;
+  meas_ui_invalidate_rect(ui, 0, 100, 10, 20); // Rows 100..119
+  render_frame();
+
+  int tiles = 119 / TILE_H - 100 / TILE_H + 1;
+  TEST_ASSERT_EQUAL(tiles * TILE_BLITS, (int)mock_lcd_blit_count);
+  TEST_ASSERT_EQUAL(0, (int)mock_lcd_tear_count);
+  TEST_ASSERT_EQUAL(0, (int)ui->dirty_map);
+}
+
+void test_render_static_cache(void) {
+  meas_ui_t *ui = meas_render_service_init(meas_drv_lcd_init());
+  render_reference();
+
+  // Static layers are drawn once, then every redraw decodes the cache
+  for (int frame = 0; frame < 3; frame++) {
+    memset(mock_lcd_framebuffer, 0, sizeof(mock_lcd_framebuffer));
+    if (frame == 2) {
+      meas_ui_invalidate_static(ui); // Rebuild path
+    } else {
+      meas_ui_force_redraw(ui);
+    }
+    render_frame();
+    TEST_ASSERT(memcmp(reference, mock_lcd_framebuffer, sizeof(reference)) ==
+                0);
+    TEST_ASSERT_EQUAL(0, (int)ui->stage_skip);
+    TEST_ASSERT(!ui->static_dirty);
+  }
+}
+
+void test_render_static_invalidate_mid_frame(void) {
+  meas_ui_t *ui = meas_render_service_init(meas_drv_lcd_init());
+  render_frame(); // Settle: cache filled
+  render_reference();
+  memset(mock_lcd_framebuffer, 0, sizeof(mock_lcd_framebuffer));
+  meas_render_service_set_budget(4, 0);
+
+  meas_ui_force_redraw(ui);
+  mock_sys_tick_ms += 1000;
+  meas_render_service_update();
+  TEST_ASSERT(meas_render_service_busy());
+
+  // The rest of this frame already draws the static layers afresh
+  meas_ui_invalidate_static(ui);
+  meas_render_service_update();
+  TEST_ASSERT(!ui->static_dirty);
+  while (meas_render_service_busy())
+    meas_render_service_update();
+  TEST_ASSERT(memcmp(reference, mock_lcd_framebuffer, sizeof(reference)) == 0);
+
+  // Tiles sent before the invalidation go again in the next frame
+  TEST_ASSERT(ui->dirty_map != 0);
+  render_frame();
+  TEST_ASSERT_EQUAL(0, (int)ui->dirty_map);
+
+  meas_render_service_set_budget(MEAS_RENDER_TILES_PER_UPDATE,
+                                 MEAS_RENDER_BUDGET_MS);
+}
+
+void test_render_incremental_frames(void) {
+  meas_ui_t *ui = meas_render_service_init(meas_drv_lcd_init());
+  render_frame(); // Settle
+  render_reference();
+  memset(mock_lcd_framebuffer, 0, sizeof(mock_lcd_framebuffer));
+  meas_render_service_set_budget(4, 0);
+
+  // A full redraw is spread over ceil(tiles / 4) calls
+  mock_lcd_blit_count = 0;
+  meas_ui_force_redraw(ui);
+  mock_sys_tick_ms += 1000;
+  meas_render_service_update();
+  TEST_ASSERT_EQUAL(4 * TILE_BLITS, (int)mock_lcd_blit_count);
+  TEST_ASSERT(meas_render_service_busy());
+  TEST_ASSERT(!meas_drv_lcd_is_busy(NULL)); // Bus released between slices
+  TEST_ASSERT_EQUAL(0, (int)ui->stage_skip);
+
+  // Mid-frame invalidation waits for the next frame
+  meas_ui_invalidate_rect(ui, 0, 0, 10, TILE_H); // Tile 0, already sent
+  int calls = 1;
+  while (meas_render_service_busy()) {
+    meas_render_service_update();
+    calls++;
+  }
+  TEST_ASSERT_EQUAL((MEAS_UI_TILE_COUNT + 3) / 4, calls);
+  TEST_ASSERT_EQUAL(FRAME_BLITS, (int)mock_lcd_blit_count);
+  TEST_ASSERT_EQUAL(0, (int)mock_lcd_tear_count);
+  TEST_ASSERT(memcmp(reference, mock_lcd_framebuffer, sizeof(reference)) == 0);
+  TEST_ASSERT_EQUAL(1, (int)ui->dirty_map);
+
+  // Governor: nothing starts before the frame slot, then the tile goes out
+  meas_render_service_update();
+  TEST_ASSERT_EQUAL(FRAME_BLITS, (int)mock_lcd_blit_count);
+  mock_sys_tick_ms += 1000 / MEAS_RENDER_TARGET_FPS;
+  meas_render_service_update();
+  TEST_ASSERT_EQUAL(FRAME_BLITS + TILE_BLITS, (int)mock_lcd_blit_count);
+  TEST_ASSERT(!meas_render_service_busy());
+
+  meas_render_service_set_budget(MEAS_RENDER_TILES_PER_UPDATE,
+                                 MEAS_RENDER_BUDGET_MS);
+}
+
+void run_render_service_tests(void) {
+  printf("\n--- Running Render Service Tests ---\n");
+  RUN_TEST(test_render_full_frame);
+  RUN_TEST(test_render_dirty_tiles_only);
+  RUN_TEST(test_render_static_cache);
+  RUN_TEST(test_render_static_invalidate_mid_frame);
+  RUN_TEST(test_render_incremental_frames);
+}
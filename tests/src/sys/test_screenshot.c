@@ -0,0 +1,258 @@
+/**
+ * @file test_screenshot.c
+ * @brief Streaming Screenshot Tests.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Captures through the render service (mock LCD) and checks the streamed BMP
+ * and RLE images against what the LCD received.
+ */
+
+#include "drv_lcd.h"
+#include "measlib/sys/render_service.h"
+#include "measlib/sys/scpi/scpi_core.h"
+#include "measlib/sys/screenshot.h"
+#include "test_framework.h"
+#include <string.h>
+
+#define SCREEN_W 320
+#define SCREEN_H 240
+#define BMP_SIZE (66 + SCREEN_W * SCREEN_H * 2)
+
+// Strips per capture: indexed tiles are expanded one row at a time
+#ifdef MEAS_UI_INDEXED_COLOR
+#define CAPTURE_STRIPS SCREEN_H
+#else
+#define CAPTURE_STRIPS MEAS_UI_TILE_COUNT
+#endif
+
+extern meas_pixel_t mock_lcd_framebuffer[SCREEN_W * SCREEN_H];
+extern uint32_t mock_sys_tick_ms;
+
+// Host-side sink: collects the stream
+static uint8_t sink_buf[BMP_SIZE + 64];
+static size_t sink_len;
+static int sink_calls;
+static int sink_fail_after; // 0 = never fail
+
+static meas_status_t mem_sink(void *user_data, const void *data, size_t size) {
+  (void)user_data;
+  if (sink_fail_after && sink_calls >= sink_fail_after)
+    return MEAS_ERROR;
+  sink_calls++;
+  if (sink_len + size > sizeof(sink_buf))
+    return MEAS_ERROR;
+  memcpy(&sink_buf[sink_len], data, size);
+  sink_len += size;
+  return MEAS_OK;
+}
+
+static void sink_reset(void) {
+  sink_len = 0;
+  sink_calls = 0;
+  sink_fail_after = 0;
+}
+
+static uint32_t rd_u32(const uint8_t *p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+         ((uint32_t)p[3] << 24);
+}
+
+static uint16_t rd_u16(const uint8_t *p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static void render_all(meas_ui_t *ui) {
+  meas_ui_force_redraw(ui);
+  mock_sys_tick_ms += 1000;
+  do {
+    meas_render_service_update();
+  } while (meas_render_service_busy());
+}
+
+// Decodes sink_buf as RLE; returns false on malformed input or mismatch
+static bool rle_matches_lcd(void) {
+  if (sink_len < 8 || memcmp(sink_buf, "MRLE", 4) != 0 ||
+      rd_u16(&sink_buf[4]) != SCREEN_W || rd_u16(&sink_buf[6]) != SCREEN_H)
+    return false;
+  size_t pos = 8;
+  for (int y = 0; y < SCREEN_H; y++) {
+    int x = 0;
+    while (x < SCREEN_W) {
+      if (pos >= sink_len)
+        return false;
+      uint8_t h = sink_buf[pos++];
+      int n = (h & 0x7F) + 1;
+      if (x + n > SCREEN_W) // Packets never span rows
+        return false;
+      for (int i = 0; i < n; i++, x++) {
+        size_t at = (h & 0x80) ? pos : pos + 2 * (size_t)i;
+        if (rd_u16(&sink_buf[at]) != mock_lcd_framebuffer[y * SCREEN_W + x])
+          return false;
+      }
+      pos += (h & 0x80) ? 2 : 2 * (size_t)n;
+    }
+  }
+  return pos == sink_len;
+}
+
+void test_screenshot_bmp(void) {
+  meas_ui_t *ui = meas_render_service_init(meas_drv_lcd_init());
+  render_all(ui);
+
+  sink_reset();
+  TEST_ASSERT_EQUAL(MEAS_OK,
+                    meas_screenshot_write(MEAS_SCREENSHOT_BMP, mem_sink, NULL));
+  TEST_ASSERT_EQUAL(BMP_SIZE, (int)sink_len);
+  TEST_ASSERT_EQUAL(BMP_SIZE, (int)meas_screenshot_size(MEAS_SCREENSHOT_BMP));
+
+  TEST_ASSERT(sink_buf[0] == 'B' && sink_buf[1] == 'M');
+  TEST_ASSERT_EQUAL(BMP_SIZE, (int)rd_u32(&sink_buf[2]));
+  TEST_ASSERT_EQUAL(66, (int)rd_u32(&sink_buf[10]));
+  TEST_ASSERT_EQUAL(SCREEN_W, (int)rd_u32(&sink_buf[18]));
+  TEST_ASSERT_EQUAL(-SCREEN_H, (int32_t)rd_u32(&sink_buf[22])); // Top-down
+  TEST_ASSERT_EQUAL(16, rd_u16(&sink_buf[28]));
+  TEST_ASSERT_EQUAL(3, (int)rd_u32(&sink_buf[30])); // BI_BITFIELDS
+  TEST_ASSERT_EQUAL(0xF800, (int)rd_u32(&sink_buf[54]));
+
+  for (int i = 0; i < SCREEN_W * SCREEN_H; i++) {
+    if (rd_u16(&sink_buf[66 + 2 * i]) != mock_lcd_framebuffer[i]) {
+      TEST_ASSERT(false);
+    }
+  }
+  // Header plus one write per strip: nothing is buffered beyond a tile
+  TEST_ASSERT_EQUAL(1 + CAPTURE_STRIPS, sink_calls);
+}
+
+void test_screenshot_rle(void) {
+  meas_ui_t *ui = meas_render_service_init(meas_drv_lcd_init());
+  render_all(ui);
+
+  sink_reset();
+  TEST_ASSERT_EQUAL(MEAS_OK,
+                    meas_screenshot_write(MEAS_SCREENSHOT_RLE, mem_sink, NULL));
+  TEST_ASSERT(rle_matches_lcd());
+  TEST_ASSERT(sink_len < BMP_SIZE / 2); // Gradient rows compress
+  TEST_ASSERT_EQUAL((int)sink_len,
+                    (int)meas_screenshot_size(MEAS_SCREENSHOT_RLE));
+
+  // A failing sink stops the capture
+  sink_reset();
+  sink_fail_after = 3;
+  TEST_ASSERT(meas_screenshot_write(MEAS_SCREENSHOT_RLE, mem_sink, NULL) !=
+              MEAS_OK);
+  TEST_ASSERT_EQUAL(3, sink_calls);
+}
+
+void test_screenshot_mid_frame(void) {
+  meas_ui_t *ui = meas_render_service_init(meas_drv_lcd_init());
+  render_all(ui);
+
+  // Capture while a frame is half out; the frame still completes intact
+  meas_render_service_set_budget(3, 0);
+  meas_ui_force_redraw(ui);
+  mock_sys_tick_ms += 1000;
+  meas_render_service_update();
+  TEST_ASSERT(meas_render_service_busy());
+
+  sink_reset();
+  TEST_ASSERT_EQUAL(MEAS_OK,
+                    meas_screenshot_write(MEAS_SCREENSHOT_RLE, mem_sink, NULL));
+  while (meas_render_service_busy())
+    meas_render_service_update();
+  TEST_ASSERT(rle_matches_lcd());
+
+  meas_render_service_set_budget(MEAS_RENDER_TILES_PER_UPDATE,
+                                 MEAS_RENDER_BUDGET_MS);
+}
+
+// --- IO stream and SCPI ---
+
+static size_t io_bytes;
+static bool io_unflushed;
+static bool io_overlap;
+
+static meas_status_t io_send(meas_io_t *io, const void *data, size_t size) {
+  (void)io;
+  (void)data;
+  if (io_unflushed)
+    io_overlap = true; // Buffer handed over before the last one drained
+  io_unflushed = true;
+  io_bytes += size;
+  return MEAS_OK;
+}
+
+static meas_status_t io_flush(meas_io_t *io) {
+  (void)io;
+  io_unflushed = false;
+  return MEAS_OK;
+}
+
+static const meas_io_api_t mock_io_api = {.send = io_send, .flush = io_flush};
+
+void test_screenshot_to_io(void) {
+  meas_render_service_init(meas_drv_lcd_init());
+  meas_io_t io = {.base = {.api = (const meas_object_api_t *)&mock_io_api}};
+
+  io_bytes = 0;
+  io_unflushed = false;
+  io_overlap = false;
+  TEST_ASSERT_EQUAL(MEAS_OK, meas_screenshot_to_io(&io, MEAS_SCREENSHOT_BMP));
+  TEST_ASSERT_EQUAL(BMP_SIZE, (int)io_bytes);
+  TEST_ASSERT(!io_overlap && !io_unflushed);
+}
+
+static size_t scpi_out_write(scpi_context_t *ctx, const char *data,
+                             size_t len) {
+  (void)ctx;
+  return (mem_sink(NULL, data, len) == MEAS_OK) ? len : 0;
+}
+
+void scpi_def_init(void);
+
+void test_screenshot_scpi_block(void) {
+  meas_render_service_init(meas_drv_lcd_init());
+
+  static scpi_context_t ctx;
+  static char line[64];
+  scpi_init(&ctx, line, sizeof(line), NULL, scpi_out_write);
+  scpi_def_init();
+
+  sink_reset();
+  const char *cmd = "HCOP:SDUM:DATA?\n";
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, scpi_process(&ctx, cmd, strlen(cmd)));
+  TEST_ASSERT(memcmp(sink_buf, "#6153666BM", 10) == 0);
+  TEST_ASSERT_EQUAL(8 + BMP_SIZE + 2, (int)sink_len);
+
+  // RLE: indefinite-length block, ended by the terminator
+  size_t len = meas_screenshot_size(MEAS_SCREENSHOT_RLE);
+  sink_reset();
+  cmd = "HCOPy:SDUMp:DATA? rle\n";
+  TEST_ASSERT_EQUAL(SCPI_RES_OK, scpi_process(&ctx, cmd, strlen(cmd)));
+  TEST_ASSERT(memcmp(sink_buf, "#0MRLE", 6) == 0);
+  TEST_ASSERT_EQUAL((int)(2 + len + 2), (int)sink_len);
+  TEST_ASSERT(memcmp(&sink_buf[sink_len - 2], "\r\n", 2) == 0);
+
+  // A link that stops taking data mid-image is an execution error
+  sink_reset();
+  sink_fail_after = 3;
+  cmd = "HCOP:SDUM:DATA?\n";
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_EXECUTION,
+                    scpi_process(&ctx, cmd, strlen(cmd)));
+  TEST_ASSERT(sink_len < BMP_SIZE);
+  sink_fail_after = 0;
+
+  cmd = "HCOP:SDUM:DATA? PNG\n";
+  TEST_ASSERT_EQUAL(SCPI_RES_ERR_DATA_TYPE,
+                    scpi_process(&ctx, cmd, strlen(cmd)));
+}
+
+void run_screenshot_tests(void) {
+  printf("\n--- Running Screenshot Tests ---\n");
+  RUN_TEST(test_screenshot_bmp);
+  RUN_TEST(test_screenshot_rle);
+  RUN_TEST(test_screenshot_mid_frame);
+  RUN_TEST(test_screenshot_to_io);
+  RUN_TEST(test_screenshot_scpi_block);
+}
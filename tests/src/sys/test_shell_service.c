@@ -0,0 +1,181 @@
+/**
+ * @file test_shell_service.c
+ * @brief Shell Service Transmit Path Tests.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/core/trace.h"
+#include "measlib/drivers/hal.h"
+#include "measlib/sys/scpi/scpi_def.h"
+#include "measlib/sys/shell_service.h"
+#include "test_framework.h"
+#include <stdio.h>
+#include <string.h>
+
+#define POINTS 2048
+#define IDN_REPLY ";MOMENTICS,MeasLib,0,0.1\r\n"
+
+// --- Mock link: host side of the USB pipe ---
+
+static const char *rx_script;
+static uint8_t host_buf[POINTS * 8];
+static size_t host_len;
+static size_t max_transfer;
+
+static struct {
+  const uint8_t *data;
+  size_t len;
+  meas_hal_link_done_t done;
+  void *user;
+  bool busy;
+} xfer;
+
+static void host_take(const void *data, size_t len) {
+  if (host_len + len <= sizeof(host_buf)) {
+    memcpy(host_buf + host_len, data, len);
+    host_len += len;
+  }
+  if (len > max_transfer)
+    max_transfer = len;
+}
+
+static meas_status_t mock_recv(void *ctx, void *data, size_t len,
+                               size_t *read) {
+  (void)ctx;
+  size_t n = rx_script ? strlen(rx_script) : 0;
+  if (n > len)
+    n = len;
+  memcpy(data, rx_script, n);
+  rx_script = NULL;
+  *read = n;
+  return MEAS_OK;
+}
+
+static meas_status_t mock_send(void *ctx, const void *data, size_t len) {
+  (void)ctx;
+  host_take(data, len);
+  return MEAS_OK;
+}
+
+// Completes only when the test says so (the endpoint interrupt)
+static meas_status_t mock_send_async(void *ctx, const void *data, size_t len,
+                                     meas_hal_link_done_t done, void *user) {
+  (void)ctx;
+  if (xfer.busy)
+    return MEAS_BUSY;
+  xfer.data = data;
+  xfer.len = len;
+  xfer.done = done;
+  xfer.user = user;
+  xfer.busy = true;
+  return MEAS_OK;
+}
+
+static bool mock_complete(void) {
+  if (!xfer.busy)
+    return false;
+  host_take(xfer.data, xfer.len);
+  xfer.busy = false;
+  xfer.done(xfer.user, xfer.len); // May start the next transfer
+  return true;
+}
+
+static const meas_hal_link_api_t async_link = {.recv = mock_recv,
+                                               .send_async = mock_send_async};
+static const meas_hal_link_api_t sync_link = {.recv = mock_recv,
+                                              .send = mock_send};
+
+// --- Mock real-valued trace ---
+
+static meas_real_t values[POINTS];
+
+static meas_status_t mock_get_data(meas_trace_t *t, const meas_real_t **x,
+                                   const meas_real_t **y, size_t *count) {
+  (void)t;
+  *x = values;
+  *y = values;
+  *count = POINTS;
+  return MEAS_OK;
+}
+
+static const meas_trace_api_t mock_trace_api = {.get_data = mock_get_data};
+static meas_trace_t mock_trace = {.base = {.api = &mock_trace_api.base}};
+
+static void setup(const meas_hal_link_api_t *link, const char *script) {
+  memset(&xfer, 0, sizeof(xfer));
+  host_len = 0;
+  max_transfer = 0;
+  rx_script = script;
+  for (int i = 0; i < POINTS; i++)
+    values[i] = (meas_real_t)i;
+  meas_shell_service_init(link, NULL);
+  scpi_def_set_trace(1, &mock_trace);
+}
+
+void test_shell_long_query_does_not_block(void) {
+  // One message: the query after the long one joins the same response
+  setup(&async_link, "FORM INT,32;TRAC:DATA?;*IDN?\n");
+  const size_t block = 6 + POINTS * 4; // "#48192" payload
+
+  // One poll fills the ring and returns; the link has one packet in flight
+  meas_shell_service_poll();
+  TEST_ASSERT_EQUAL(MEAS_SHELL_TX_SIZE, meas_shell_service_tx_pending());
+  TEST_ASSERT(xfer.busy);
+  TEST_ASSERT_EQUAL(0, host_len);
+
+  // Each endpoint interrupt chains the next packet; polls refill the ring
+  int polls = 1;
+  while (host_len < block + strlen(IDN_REPLY) && polls < 1000) {
+    while (mock_complete()) {
+    }
+    meas_shell_service_poll();
+    polls++;
+  }
+  TEST_ASSERT_EQUAL(block + strlen(IDN_REPLY), host_len);
+  TEST_ASSERT(polls > (int)(block / MEAS_SHELL_TX_SIZE));
+  TEST_ASSERT(max_transfer <= MEAS_SHELL_TX_CHUNK);
+  TEST_ASSERT_EQUAL(0, meas_shell_service_tx_pending());
+
+  // Block intact and the next command ran only after it
+  TEST_ASSERT_EQUAL(0, memcmp(host_buf, "#48192", 6));
+  for (int i = 0; i < POINTS; i += 97) {
+    const uint8_t *p = host_buf + 6 + 4 * i;
+    uint32_t v = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+                 ((uint32_t)p[2] << 8) | p[3];
+    TEST_ASSERT_EQUAL((uint32_t)i, v);
+  }
+  TEST_ASSERT_EQUAL(0, memcmp(host_buf + block, IDN_REPLY, strlen(IDN_REPLY)));
+}
+
+void test_shell_short_reply_flushed(void) {
+  // Below the watermark, a complete reply still goes out on the same poll
+  setup(&async_link, "*IDN?\n");
+  meas_shell_service_poll();
+  TEST_ASSERT(xfer.busy);
+  TEST_ASSERT_EQUAL(strlen(IDN_REPLY) - 1, xfer.len);
+  TEST_ASSERT(mock_complete());
+  TEST_ASSERT_EQUAL(0, memcmp(host_buf, IDN_REPLY + 1, xfer.len));
+  TEST_ASSERT_EQUAL(0, meas_shell_service_tx_pending());
+}
+
+void test_shell_sync_link(void) {
+  // Without send_async the ring drains through send() in the poll loop
+  setup(&sync_link, "FORM ASC\nTRAC:DATA?\n");
+  int polls = 0;
+  do {
+    meas_shell_service_poll();
+    polls++;
+  } while (meas_shell_service_tx_pending() && polls < 1000);
+  TEST_ASSERT_EQUAL(0, memcmp(host_buf, "0,1,2,3,", 8));
+  TEST_ASSERT_EQUAL(0, memcmp(host_buf + host_len - 6, "2047\r\n", 6));
+  TEST_ASSERT(max_transfer <= MEAS_SHELL_TX_CHUNK);
+}
+
+void run_shell_service_tests(void) {
+  printf("\n--- Running Shell Service Tests ---\n");
+  RUN_TEST(test_shell_long_query_does_not_block);
+  RUN_TEST(test_shell_short_reply_flushed);
+  RUN_TEST(test_shell_sync_link);
+}
@@ -0,0 +1,237 @@
+/**
+ * @file test_display_list.c
+ * @brief Display List Recording / Binning Tests.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/ui/display_list.h"
+#include "measlib/ui/fonts.h"
+#include "test_framework.h"
+#include <string.h>
+
+#define SCREEN_W MEAS_UI_SCREEN_WIDTH
+#define SCREEN_H MEAS_UI_SCREEN_HEIGHT
+
+extern const meas_render_api_t meas_render_cell_api;
+
+static meas_dl_t dl;
+static meas_tile_pixel_t direct[SCREEN_W * SCREEN_H];
+static meas_tile_pixel_t replayed[SCREEN_W * SCREEN_H];
+
+static void full_ctx(meas_render_ctx_t *ctx, meas_tile_pixel_t *buf) {
+  memset(ctx, 0, sizeof(*ctx));
+  ctx->buffer = buf;
+  ctx->width = SCREEN_W;
+  ctx->height = SCREEN_H;
+  ctx->fg_color = 0xFFFF;
+  ctx->clip_rect = (meas_rect_t){0, 0, SCREEN_W, SCREEN_H};
+}
+
+// Mixed scene; points and strings live on the stack on purpose
+static void draw_scene(meas_render_ctx_t *ctx, const meas_render_api_t *api) {
+  api->fill_gradient_v(ctx, 0, 0, SCREEN_W, SCREEN_H, 0x001F, 0x0000,
+                       MEAS_ALPHA_OPAQUE);
+  ctx->fg_color = 0x07E0;
+  api->draw_line(ctx, 0, 0, 319, 239, MEAS_ALPHA_OPAQUE);
+  api->draw_circle(ctx, 60, 60, 30, MEAS_ALPHA_OPAQUE);
+
+  meas_point_t poly[] = {{200, 20}, {260, 60}, {230, 110}, {180, 70}};
+  ctx->fg_color = 0xFFE0;
+  api->fill_polygon(ctx, poly, 4, MEAS_ALPHA_50);
+
+  meas_point_t trace[] = {{0, 140}, {70, 95}, {150, 180}, {319, 120}};
+  ctx->fg_color = 0xF81F;
+  api->draw_polyline_aa(ctx, trace, 4, MEAS_ALPHA_75);
+
+  api->push_clip_rect(ctx, (meas_rect_t){100, 150, 80, 30});
+  ctx->fg_color = 0xF800;
+  api->fill_circle(ctx, 140, 165, 40, MEAS_ALPHA_OPAQUE);
+  api->pop_clip_rect(ctx);
+
+  char label[16];
+  strcpy(label, "DL 123");
+  api->set_font(ctx, &font_11x14);
+  ctx->fg_color = 0xFFFF;
+  api->draw_text(ctx, 10, 200, label, MEAS_ALPHA_OPAQUE);
+  api->draw_text_aligned(ctx, 300, 230, label,
+                         MEAS_ALIGN_RIGHT | MEAS_ALIGN_BOTTOM,
+                         MEAS_ALPHA_OPAQUE);
+  api->set_font(ctx, &font_5x7);
+  api->draw_number(ctx, 200, 226, -12345, 3, MEAS_ALPHA_75);
+  label[0] = 'X'; // Mutating after the call must not affect the recording
+}
+
+static void replay_tiles(void) {
+  for (int16_t y = 0; y < SCREEN_H; y += MEAS_UI_TILE_HEIGHT) {
+    meas_render_ctx_t tile;
+    full_ctx(&tile, &replayed[y * SCREEN_W]);
+    tile.height = MEAS_UI_TILE_HEIGHT;
+    tile.y_offset = y;
+    meas_dl_replay(&dl, &tile, &meas_render_cell_api);
+  }
+}
+
+void test_dl_matches_immediate(void) {
+  meas_render_ctx_t ctx;
+  full_ctx(&ctx, direct);
+  memset(direct, 0, sizeof(direct));
+  draw_scene(&ctx, &meas_render_cell_api);
+
+  meas_render_ctx_t rec;
+  meas_dl_begin(&dl, &rec);
+  draw_scene(&rec, &meas_render_dl_api);
+  TEST_ASSERT(meas_dl_end(&dl));
+
+  memset(replayed, 0, sizeof(replayed));
+  replay_tiles();
+  TEST_ASSERT(memcmp(direct, replayed, sizeof(direct)) == 0);
+}
+
+// Entries in the list of tile @p t
+static uint16_t tile_len(uint16_t t) {
+  return dl.tile_refs[t + 1] - dl.tile_refs[t];
+}
+
+void test_dl_binning(void) {
+  meas_render_ctx_t rec;
+  meas_dl_begin(&dl, &rec);
+  meas_render_dl_api.fill_rect(&rec, 0, 100, 50, 10, MEAS_ALPHA_OPAQUE);
+  meas_render_dl_api.fill_rect(&rec, 0, 300, 50, 10, MEAS_ALPHA_OPAQUE);
+  meas_render_dl_api.push_clip_rect(&rec, (meas_rect_t){0, 0, 320, 16});
+  meas_render_dl_api.draw_line(&rec, 0, 0, 0, 239, MEAS_ALPHA_OPAQUE);
+  TEST_ASSERT(meas_dl_end(&dl));
+
+  // Off-screen rect culled, clipped line limited to rows 0..15
+  TEST_ASSERT_EQUAL(2, dl.cmd_count);
+  TEST_ASSERT_EQUAL(0, tile_len(100 / MEAS_UI_TILE_HEIGHT - 1));
+  for (uint16_t t = 100 / MEAS_UI_TILE_HEIGHT; t <= 109 / MEAS_UI_TILE_HEIGHT;
+       t++) {
+    TEST_ASSERT_EQUAL(1, tile_len(t));
+    TEST_ASSERT_EQUAL(0, dl.refs[dl.tile_refs[t]].cmd);
+  }
+  for (uint16_t t = 0; t <= 15 / MEAS_UI_TILE_HEIGHT; t++) {
+    TEST_ASSERT_EQUAL(1, tile_len(t));
+    TEST_ASSERT_EQUAL(1, dl.refs[dl.tile_refs[t]].cmd);
+  }
+  TEST_ASSERT_EQUAL(0, tile_len(15 / MEAS_UI_TILE_HEIGHT + 1));
+  TEST_ASSERT_EQUAL(2 + 109 / MEAS_UI_TILE_HEIGHT - 100 / MEAS_UI_TILE_HEIGHT +
+                        15 / MEAS_UI_TILE_HEIGHT,
+                    dl.tile_refs[MEAS_UI_TILE_COUNT]);
+}
+
+void test_dl_polyline_spans(void) {
+  // Trace sweeping down the screen: one command, each tile replays only the
+  // segments crossing it
+  meas_point_t trace[161];
+  for (int i = 0; i < 161; i++) {
+    trace[i] = (meas_point_t){(int16_t)(i * 2), (int16_t)(i * 3 / 2)};
+  }
+
+  meas_render_ctx_t rec;
+  meas_dl_begin(&dl, &rec);
+  meas_render_dl_api.draw_polyline(&rec, trace, 161, MEAS_ALPHA_OPAQUE);
+  TEST_ASSERT(meas_dl_end(&dl));
+  TEST_ASSERT_EQUAL(1, dl.cmd_count);
+  TEST_ASSERT(dl.cmds[0].data == trace); // Long list kept by reference
+
+  uint32_t replayed_points = 0;
+  for (uint16_t t = 0; t < MEAS_UI_TILE_COUNT; t++) {
+    TEST_ASSERT_EQUAL(1, tile_len(t));
+    const meas_dl_ref_t *ref = &dl.refs[dl.tile_refs[t]];
+    TEST_ASSERT(ref->first + ref->count <= 161);
+    replayed_points += ref->count;
+  }
+  TEST_ASSERT_EQUAL(0, dl.refs[dl.tile_refs[0]].first);
+  TEST_ASSERT(dl.refs[dl.tile_refs[MEAS_UI_TILE_COUNT - 1]].first > 0);
+  TEST_ASSERT(replayed_points <= 160 + 2 * MEAS_UI_TILE_COUNT);
+
+  // Replay equals a direct draw
+  meas_render_ctx_t ctx;
+  full_ctx(&ctx, direct);
+  memset(direct, 0, sizeof(direct));
+  meas_render_cell_api.draw_polyline(&ctx, trace, 161, MEAS_ALPHA_OPAQUE);
+  memset(replayed, 0, sizeof(replayed));
+  replay_tiles();
+  TEST_ASSERT(memcmp(direct, replayed, sizeof(direct)) == 0);
+}
+
+// Full-resolution traces (VNA_MAX_POINTS and two screen-wide ones)
+#define TRACE_POINTS 1024
+
+static meas_point_t trace_full[TRACE_POINTS];
+static meas_point_t trace_s11[SCREEN_W];
+static meas_point_t trace_s21[SCREEN_W];
+
+static void draw_traces(meas_render_ctx_t *ctx, const meas_render_api_t *api) {
+  ctx->fg_color = 0xFFE0;
+  api->draw_polyline_aa(ctx, trace_full, TRACE_POINTS, MEAS_ALPHA_OPAQUE);
+  ctx->fg_color = 0x07FF;
+  api->draw_polyline_aa(ctx, trace_s11, SCREEN_W, MEAS_ALPHA_75);
+  ctx->fg_color = 0xF81F;
+  api->draw_polyline(ctx, trace_s21, SCREEN_W, MEAS_ALPHA_OPAQUE);
+}
+
+void test_dl_full_resolution_traces(void) {
+  for (int i = 0; i < TRACE_POINTS; i++) {
+    // Noisy trace over the whole screen height
+    trace_full[i] = (meas_point_t){(int16_t)(i * (SCREEN_W - 1) /
+                                             (TRACE_POINTS - 1)),
+                                   (int16_t)((i * 37) % SCREEN_H)};
+  }
+  for (int i = 0; i < SCREEN_W; i++) {
+    trace_s11[i] = (meas_point_t){(int16_t)i, (int16_t)(60 + (i % 40))};
+    trace_s21[i] = (meas_point_t){(int16_t)i, (int16_t)(200 - i / 8)};
+  }
+
+  meas_render_ctx_t rec;
+  meas_dl_begin(&dl, &rec);
+  draw_traces(&rec, &meas_render_dl_api);
+  TEST_ASSERT(meas_dl_end(&dl));
+  TEST_ASSERT_EQUAL(3, dl.cmd_count);
+  TEST_ASSERT_EQUAL(0, dl.arena_used);
+
+  // Smooth traces only reach the tiles they cross
+  TEST_ASSERT(dl.tile_refs[MEAS_UI_TILE_COUNT] < 3 * MEAS_UI_TILE_COUNT);
+
+  meas_render_ctx_t ctx;
+  full_ctx(&ctx, direct);
+  memset(direct, 0, sizeof(direct));
+  draw_traces(&ctx, &meas_render_cell_api);
+  memset(replayed, 0, sizeof(replayed));
+  replay_tiles();
+  TEST_ASSERT(memcmp(direct, replayed, sizeof(direct)) == 0);
+
+  // A context spanning several tiles replays them band by band
+  full_ctx(&ctx, replayed);
+  memset(replayed, 0, sizeof(replayed));
+  meas_dl_replay(&dl, &ctx, &meas_render_cell_api);
+  TEST_ASSERT(memcmp(direct, replayed, sizeof(direct)) == 0);
+}
+
+void test_dl_overflow(void) {
+  meas_render_ctx_t rec;
+  meas_dl_begin(&dl, &rec);
+  for (int i = 0; i <= MEAS_DL_MAX_CMDS; i++) {
+    meas_render_dl_api.draw_pixel(&rec, (int16_t)i, 10, MEAS_ALPHA_OPAQUE);
+  }
+  TEST_ASSERT(!meas_dl_end(&dl));
+
+  // Tile lists: full-screen commands take an entry in every tile
+  meas_dl_begin(&dl, &rec);
+  for (int i = 0; i <= MEAS_DL_MAX_REFS / MEAS_UI_TILE_COUNT; i++) {
+    meas_render_dl_api.fill_rect(&rec, 0, 0, SCREEN_W, SCREEN_H,
+                                 MEAS_ALPHA_50);
+  }
+  TEST_ASSERT(!meas_dl_end(&dl));
+}
+
+void run_display_list_tests(void) {
+  printf("\n--- Running Display List Tests ---\n");
+  RUN_TEST(test_dl_matches_immediate);
+  RUN_TEST(test_dl_binning);
+  RUN_TEST(test_dl_polyline_spans);
+  RUN_TEST(test_dl_full_resolution_traces);
+  RUN_TEST(test_dl_overflow);
+}
@@ -0,0 +1,185 @@
+/**
+ * @file test_font_atlas.c
+ * @brief Run-Encoded Font Atlas and Numeric Readout Tests.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/ui/display_list.h"
+#include "measlib/ui/font_atlas.h"
+#include "measlib/ui/fonts.h"
+#include "test_framework.h"
+#include <string.h>
+
+#define SCREEN_W MEAS_UI_SCREEN_WIDTH
+#define SCREEN_H MEAS_UI_SCREEN_HEIGHT
+
+extern const meas_render_api_t meas_render_cell_api;
+
+static meas_dl_t dl;
+static meas_tile_pixel_t ref[SCREEN_W * SCREEN_H];
+static meas_tile_pixel_t out[SCREEN_W * SCREEN_H];
+
+static void make_ctx(meas_render_ctx_t *ctx, meas_tile_pixel_t *b, int16_t y0,
+                     int16_t h, const meas_font_t *font) {
+  memset(ctx, 0, sizeof(*ctx));
+  ctx->buffer = b;
+  ctx->width = SCREEN_W;
+  ctx->height = h;
+  ctx->y_offset = y0;
+  ctx->fg_color = 0xFFE0;
+  ctx->clip_rect = (meas_rect_t){0, 0, SCREEN_W, SCREEN_H};
+  ctx->font = font;
+}
+
+// Same font with the atlas detached: the renderer decodes the bitmap
+static meas_font_t bitmap_only(const meas_font_t *f) {
+  meas_font_t copy = *f;
+  copy.atlas = NULL;
+  return copy;
+}
+
+static void fill_pattern(meas_tile_pixel_t *b) {
+  for (int i = 0; i < SCREEN_W * SCREEN_H; i++) {
+    b[i] = (meas_tile_pixel_t)(i * 2654435761U >> 16);
+  }
+}
+
+// Draw @p text in tile strips with a clip that cuts glyphs on both sides
+static void draw_tiled(meas_tile_pixel_t *b, const meas_font_t *font, int16_t x,
+                       int16_t y, const char *text, uint8_t alpha) {
+  for (int16_t ty = 0; ty < SCREEN_H; ty += MEAS_UI_TILE_HEIGHT) {
+    meas_render_ctx_t ctx;
+    make_ctx(&ctx, &b[ty * SCREEN_W], ty, MEAS_UI_TILE_HEIGHT, font);
+    ctx.clip_rect = (meas_rect_t){x + 3, 0, 250, SCREEN_H};
+    meas_render_cell_api.draw_text(&ctx, x, y, text, alpha);
+  }
+}
+
+void test_atlas_matches_bitmap(void) {
+  const meas_font_t *fonts[] = {&font_5x7, &font_11x14};
+  for (int fi = 0; fi < 2; fi++) {
+    const meas_font_t *f = fonts[fi];
+    meas_font_t plain = bitmap_only(f);
+    TEST_ASSERT(f->atlas != NULL);
+
+    // Every encoded character plus two that fall back
+    char text[128];
+    int n = 0;
+    for (int c = f->start_char; c <= f->end_char && n < 40; c++)
+      text[n++] = (char)c;
+    text[n++] = (char)0x7F;
+    text[n++] = (char)0x01;
+    text[n] = '\0';
+
+    for (int pass = 0; pass < 3; pass++) {
+      const char *s = (pass == 0) ? text : (pass == 1) ? &text[20] : "0123.9";
+      for (int a = 0; a < 2; a++) {
+        uint8_t alpha = a ? MEAS_ALPHA_50 : MEAS_ALPHA_OPAQUE;
+        fill_pattern(ref);
+        fill_pattern(out);
+        // Straddle a tile boundary
+        int16_t y = (int16_t)(MEAS_UI_TILE_HEIGHT * 5 - 3 + pass);
+        draw_tiled(ref, &plain, 2, y, s, alpha);
+        draw_tiled(out, f, 2, y, s, alpha);
+        TEST_ASSERT(memcmp(ref, out, sizeof(ref)) == 0);
+
+        meas_render_ctx_t ctx;
+        make_ctx(&ctx, out, 0, SCREEN_H, f);
+        int16_t w_atlas = meas_render_cell_api.get_text_width(&ctx, s);
+        ctx.font = &plain;
+        TEST_ASSERT_EQUAL(meas_render_cell_api.get_text_width(&ctx, s),
+                          w_atlas);
+      }
+    }
+  }
+}
+
+void test_atlas_kerning(void) {
+  static const meas_kern_pair_t pairs[] = {{'A', 'V', -1}, {'V', 'A', -2}};
+  meas_font_atlas_t kerned = font_5x7_atlas;
+  kerned.kern = pairs;
+  kerned.kern_count = 2;
+  meas_font_t font = font_5x7;
+  font.atlas = &kerned;
+
+  TEST_ASSERT_EQUAL(-1, meas_font_atlas_kern(&kerned, 'A', 'V'));
+  TEST_ASSERT_EQUAL(-2, meas_font_atlas_kern(&kerned, 'V', 'A'));
+  TEST_ASSERT_EQUAL(0, meas_font_atlas_kern(&kerned, 'A', 'A'));
+
+  meas_render_ctx_t ctx;
+  make_ctx(&ctx, out, 0, SCREEN_H, &font);
+  int16_t adv_a = meas_font_atlas_glyph(&kerned, 'A')->advance;
+  int16_t adv_v = meas_font_atlas_glyph(&kerned, 'V')->advance;
+  TEST_ASSERT_EQUAL(2 * adv_a + adv_v - 3,
+                    meas_render_cell_api.get_text_width(&ctx, "AVA"));
+
+  // Kerned pair equals the glyphs placed at the adjusted pen positions
+  memset(out, 0, sizeof(out));
+  meas_render_cell_api.draw_text(&ctx, 10, 10, "AVA", MEAS_ALPHA_OPAQUE);
+  memset(ref, 0, sizeof(ref));
+  ctx.buffer = ref;
+  meas_render_cell_api.draw_text(&ctx, 10, 10, "A", MEAS_ALPHA_OPAQUE);
+  meas_render_cell_api.draw_text(&ctx, 10 + adv_a - 1, 10, "V",
+                                 MEAS_ALPHA_OPAQUE);
+  meas_render_cell_api.draw_text(&ctx, 10 + adv_a + adv_v - 3, 10, "A",
+                                 MEAS_ALPHA_OPAQUE);
+  TEST_ASSERT(memcmp(ref, out, sizeof(ref)) == 0);
+}
+
+void test_draw_number_matches_text(void) {
+  static const struct {
+    int32_t value;
+    uint8_t decimals;
+    const char *text;
+  } cases[] = {
+      {0, 0, "0"},
+      {7, 0, "7"},
+      {12345, 2, "123.45"},
+      {-5, 3, "-0.005"},
+      {-120000, 3, "-120.000"},
+      {100, 9, "0.000000100"},
+      {INT32_MIN, 0, "-2147483648"},
+      {INT32_MAX, 4, "214748.3647"},
+  };
+
+  for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+    meas_render_ctx_t ctx;
+    make_ctx(&ctx, ref, 0, SCREEN_H, &font_11x14);
+    memset(ref, 0, sizeof(ref));
+    meas_render_cell_api.draw_text(&ctx, 4, 100, cases[i].text,
+                                   MEAS_ALPHA_OPAQUE);
+
+    ctx.buffer = out;
+    memset(out, 0, sizeof(out));
+    meas_render_cell_api.draw_number(&ctx, 4, 100, cases[i].value,
+                                     cases[i].decimals, MEAS_ALPHA_OPAQUE);
+    TEST_ASSERT(memcmp(ref, out, sizeof(ref)) == 0);
+
+    // Recorded readouts carry the value in the command, not the arena
+    meas_render_ctx_t rec;
+    meas_dl_begin(&dl, &rec);
+    rec.font = &font_11x14;
+    rec.fg_color = 0xFFE0;
+    meas_render_dl_api.draw_number(&rec, 4, 100, cases[i].value,
+                                   cases[i].decimals, MEAS_ALPHA_OPAQUE);
+    TEST_ASSERT(meas_dl_end(&dl));
+    TEST_ASSERT_EQUAL(0, dl.arena_used);
+
+    memset(out, 0, sizeof(out));
+    for (int16_t ty = 0; ty < SCREEN_H; ty += MEAS_UI_TILE_HEIGHT) {
+      meas_render_ctx_t tile;
+      make_ctx(&tile, &out[ty * SCREEN_W], ty, MEAS_UI_TILE_HEIGHT, NULL);
+      meas_dl_replay(&dl, &tile, &meas_render_cell_api);
+    }
+    TEST_ASSERT(memcmp(ref, out, sizeof(ref)) == 0);
+  }
+}
+
+void run_font_atlas_tests(void) {
+  printf("\n--- Running Font Atlas Tests ---\n");
+  RUN_TEST(test_atlas_matches_bitmap);
+  RUN_TEST(test_atlas_kerning);
+  RUN_TEST(test_draw_number_matches_text);
+}
@@ -0,0 +1,273 @@
+/**
+ * @file test_gesture.c
+ * @brief Gesture Recognizer and Touch Service Tests.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/core/event.h"
+#include "measlib/sys/touch_service.h"
+#include "measlib/ui/gesture.h"
+#include "test_framework.h"
+#include <string.h>
+
+#define MAX_LOG 64
+
+static meas_gesture_event_t log_ev[MAX_LOG];
+static int log_count;
+
+static void log_sink(const meas_gesture_event_t *ev, void *user_data) {
+  (void)user_data;
+  if (log_count < MAX_LOG)
+    log_ev[log_count++] = *ev;
+}
+
+static int count_kind(meas_gesture_kind_t kind) {
+  int n = 0;
+  for (int i = 0; i < log_count; i++) {
+    if (log_ev[i].kind == kind)
+      n++;
+  }
+  return n;
+}
+
+static void sum_kind(meas_gesture_kind_t kind, int32_t *dx, int32_t *dy) {
+  *dx = 0;
+  *dy = 0;
+  for (int i = 0; i < log_count; i++) {
+    if (log_ev[i].kind == kind) {
+      *dx += log_ev[i].dx;
+      *dy += log_ev[i].dy;
+    }
+  }
+}
+
+static void feed_at(meas_gesture_t *g, int16_t x, int16_t y, uint32_t t) {
+  meas_point_t pt = {x, y};
+  meas_gesture_feed(g, &pt, t);
+  meas_gesture_tick(g, t);
+}
+
+void test_gesture_tap_and_long_press(void) {
+  meas_gesture_t g;
+  meas_gesture_init(&g, NULL, log_sink, NULL);
+
+  // Jittery short touch: tap at the down point
+  log_count = 0;
+  feed_at(&g, 100, 100, 0);
+  feed_at(&g, 102, 99, 10);
+  feed_at(&g, 99, 101, 20);
+  meas_gesture_feed(&g, NULL, 30);
+  TEST_ASSERT_EQUAL(3, log_count);
+  TEST_ASSERT_EQUAL(MEAS_GESTURE_PRESS, log_ev[0].kind);
+  TEST_ASSERT_EQUAL(MEAS_GESTURE_TAP, log_ev[1].kind);
+  TEST_ASSERT_EQUAL(100, log_ev[1].x);
+  TEST_ASSERT_EQUAL(MEAS_GESTURE_RELEASE, log_ev[2].kind);
+  TEST_ASSERT(!meas_gesture_active(&g));
+
+  // Held: long press, no tap on release
+  log_count = 0;
+  for (uint32_t t = 0; t <= 700; t += 20)
+    feed_at(&g, 50, 60, 1000 + t);
+  meas_gesture_feed(&g, NULL, 1720);
+  TEST_ASSERT_EQUAL(1, count_kind(MEAS_GESTURE_LONG_PRESS));
+  TEST_ASSERT_EQUAL(0, count_kind(MEAS_GESTURE_TAP));
+  TEST_ASSERT_EQUAL(1, count_kind(MEAS_GESTURE_RELEASE));
+}
+
+void test_gesture_drag_filters_spikes(void) {
+  meas_gesture_t g;
+  meas_gesture_init(&g, NULL, log_sink, NULL);
+  log_count = 0;
+
+  // Slow drag to the right with one wild sample in the middle
+  uint32_t t = 0;
+  for (int i = 0; i <= 30; i++, t += 20) {
+    int16_t y = (i == 15) ? 230 : 120;
+    feed_at(&g, (int16_t)(40 + i * 4), y, t);
+  }
+  // Finger rests before lifting: no fling
+  feed_at(&g, 160, 120, t + 100);
+  meas_gesture_feed(&g, NULL, t + 200);
+
+  TEST_ASSERT(count_kind(MEAS_GESTURE_DRAG) > 5);
+  TEST_ASSERT_EQUAL(0, count_kind(MEAS_GESTURE_FLING));
+  TEST_ASSERT_EQUAL(0, count_kind(MEAS_GESTURE_TAP));
+  for (int i = 0; i < log_count; i++) {
+    TEST_ASSERT(log_ev[i].y == 120); // Spike removed by the median
+  }
+
+  // Deltas add up to the filtered travel
+  int32_t dx, dy;
+  sum_kind(MEAS_GESTURE_DRAG, &dx, &dy);
+  TEST_ASSERT(dx >= 110 && dx <= 120);
+  TEST_ASSERT_EQUAL(0, dy);
+}
+
+void test_gesture_fling_and_inertia(void) {
+  meas_gesture_t g;
+  meas_gesture_init(&g, NULL, log_sink, NULL);
+  log_count = 0;
+
+  // Fast upward swipe: 8 px per 10 ms
+  uint32_t t = 0;
+  for (int i = 0; i <= 12; i++, t += 10)
+    feed_at(&g, 160, (int16_t)(200 - i * 8), t);
+  meas_gesture_feed(&g, NULL, t);
+
+  TEST_ASSERT_EQUAL(1, count_kind(MEAS_GESTURE_FLING));
+  const meas_gesture_event_t *fling = NULL;
+  for (int i = 0; i < log_count; i++) {
+    if (log_ev[i].kind == MEAS_GESTURE_FLING)
+      fling = &log_ev[i];
+  }
+  TEST_ASSERT(fling && fling->dy < -300 && fling->dx == 0);
+  TEST_ASSERT(meas_gesture_active(&g));
+
+  // Coasting: upward steps with decreasing size, then it stops
+  int first_scroll = log_count;
+  for (uint32_t s = 1; s <= 200 && meas_gesture_active(&g); s++)
+    meas_gesture_tick(&g, t + s * MEAS_GESTURE_TICK_MS);
+  TEST_ASSERT(!meas_gesture_active(&g));
+
+  int scrolls = 0;
+  int16_t prev = INT16_MIN;
+  for (int i = first_scroll; i < log_count; i++) {
+    TEST_ASSERT_EQUAL(MEAS_GESTURE_SCROLL, log_ev[i].kind);
+    TEST_ASSERT(log_ev[i].dy < 0);
+    TEST_ASSERT(log_ev[i].dy >= prev - 1); // Friction (1 px rounding)
+    prev = log_ev[i].dy;
+    scrolls++;
+  }
+  TEST_ASSERT(scrolls > 10);
+
+  // Late tick: due steps are reported as one event, not a burst
+  meas_gesture_init(&g, NULL, log_sink, NULL);
+  log_count = 0;
+  t = 0;
+  for (int i = 0; i <= 12; i++, t += 10)
+    feed_at(&g, 160, (int16_t)(200 - i * 8), t);
+  meas_gesture_feed(&g, NULL, t);
+  int before = log_count;
+  meas_gesture_tick(&g, t + 5 * MEAS_GESTURE_TICK_MS);
+  TEST_ASSERT_EQUAL(before + 1, log_count);
+
+  // A new touch stops coasting
+  feed_at(&g, 10, 10, t + 6 * MEAS_GESTURE_TICK_MS);
+  TEST_ASSERT_EQUAL(MEAS_GESTURE_PRESS, log_ev[log_count - 1].kind);
+  int scrolls_before = count_kind(MEAS_GESTURE_SCROLL);
+  meas_gesture_tick(&g, t + 20 * MEAS_GESTURE_TICK_MS);
+  TEST_ASSERT_EQUAL(scrolls_before, count_kind(MEAS_GESTURE_SCROLL));
+}
+
+void test_gesture_zoom_after_long_press(void) {
+  meas_gesture_t g;
+  meas_gesture_init(&g, NULL, log_sink, NULL);
+  log_count = 0;
+
+  uint32_t t = 0;
+  for (; t <= 640; t += 20)
+    feed_at(&g, 160, 120, t);
+  for (int i = 1; i <= 10; i++, t += 20)
+    feed_at(&g, 160, (int16_t)(120 + i * 3), t);
+  TEST_ASSERT_EQUAL(1, count_kind(MEAS_GESTURE_LONG_PRESS));
+  TEST_ASSERT(count_kind(MEAS_GESTURE_ZOOM) > 0);
+  TEST_ASSERT_EQUAL(0, count_kind(MEAS_GESTURE_DRAG));
+}
+
+void test_gesture_pack_roundtrip(void) {
+  meas_gesture_event_t in = {MEAS_GESTURE_FLING, 319, 239, -1200, 32000};
+  meas_gesture_event_t out;
+  meas_gesture_unpack(meas_gesture_pack(&in), &out);
+  TEST_ASSERT_EQUAL(in.kind, out.kind);
+  TEST_ASSERT_EQUAL(in.x, out.x);
+  TEST_ASSERT_EQUAL(in.y, out.y);
+  TEST_ASSERT_EQUAL(in.dx, out.dx);
+  TEST_ASSERT_EQUAL(in.dy, out.dy);
+}
+
+// --- Touch Service (coalescing through the event queue) ---
+
+extern uint32_t mock_sys_tick_ms;
+
+static meas_point_t panel_pt;
+static bool panel_down;
+
+static meas_status_t panel_read(void *ctx, meas_point_t *pt) {
+  (void)ctx;
+  if (!panel_down)
+    return MEAS_ERROR;
+  *pt = panel_pt;
+  return MEAS_OK;
+}
+
+static const meas_hal_touch_api_t panel_api = {.read_point = panel_read};
+
+static int drag_events;
+static int32_t drag_dx;
+static int other_events;
+
+static void gesture_listener(const meas_event_t *e, void *ctx) {
+  (void)ctx;
+  if (e->type != EVENT_INPUT_GESTURE)
+    return;
+  meas_gesture_event_t gev;
+  meas_gesture_unpack(e->payload.i_val, &gev);
+  if (gev.kind == MEAS_GESTURE_DRAG) {
+    drag_events++;
+    drag_dx += gev.dx;
+  } else {
+    other_events++;
+  }
+}
+
+void test_touch_service_coalesces_drag(void) {
+  meas_dispatch_events(); // Drain anything left by earlier tests
+  meas_subscribe(NULL, gesture_listener, NULL);
+  meas_touch_service_init(&panel_api, NULL);
+
+  drag_events = 0;
+  drag_dx = 0;
+  other_events = 0;
+
+  // 40 samples without a dispatch in between
+  panel_down = true;
+  for (int i = 0; i < 40; i++) {
+    mock_sys_tick_ms += 10;
+    panel_pt = (meas_point_t){(int16_t)(20 + i * 2), 100};
+    meas_touch_service_poll();
+  }
+  meas_dispatch_events();
+
+  // PRESS plus a single merged drag carrying the whole travel
+  TEST_ASSERT_EQUAL(1, other_events);
+  TEST_ASSERT_EQUAL(1, drag_events);
+  TEST_ASSERT(drag_dx >= 70 && drag_dx <= 78);
+
+  // Once dispatched, the next step queues again
+  mock_sys_tick_ms += 10;
+  panel_pt.x += 6;
+  meas_touch_service_poll();
+  meas_dispatch_events();
+  TEST_ASSERT_EQUAL(2, drag_events);
+
+  // Release after resting: RELEASE only, no fling
+  mock_sys_tick_ms += 200;
+  meas_touch_service_poll();
+  panel_down = false;
+  mock_sys_tick_ms += 10;
+  meas_touch_service_poll();
+  meas_dispatch_events();
+  TEST_ASSERT_EQUAL(2, other_events);
+}
+
+void run_gesture_tests(void) {
+  printf("\n--- Running Gesture Tests ---\n");
+  RUN_TEST(test_gesture_tap_and_long_press);
+  RUN_TEST(test_gesture_drag_filters_spikes);
+  RUN_TEST(test_gesture_fling_and_inertia);
+  RUN_TEST(test_gesture_zoom_after_long_press);
+  RUN_TEST(test_gesture_pack_roundtrip);
+  RUN_TEST(test_touch_service_coalesces_drag);
+}
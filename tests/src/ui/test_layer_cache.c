@@ -0,0 +1,73 @@
+/**
+ * @file test_layer_cache.c
+ * @brief Static Layer Cache (RLE) Tests.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/ui/layer_cache.h"
+#include "test_framework.h"
+#include <string.h>
+
+#define TILE_PIXELS (MEAS_UI_SCREEN_WIDTH * MEAS_UI_TILE_HEIGHT)
+
+static meas_layer_cache_t cache;
+static meas_tile_pixel_t tile[TILE_PIXELS];
+static meas_tile_pixel_t out[TILE_PIXELS];
+
+// Gradient rows with a vertical grid line every 32 pixels
+static void make_grid_tile(uint16_t seed) {
+  for (int y = 0; y < MEAS_UI_TILE_HEIGHT; y++) {
+    for (int x = 0; x < MEAS_UI_SCREEN_WIDTH; x++) {
+      tile[y * MEAS_UI_SCREEN_WIDTH + x] =
+          (meas_tile_pixel_t)((x % 32 == 0) ? 0x07E0 : seed + y / 3);
+    }
+  }
+}
+
+void test_layer_cache_roundtrip(void) {
+  meas_layer_cache_reset(&cache);
+  make_grid_tile(0x0010);
+
+  TEST_ASSERT_EQUAL(MEAS_OK,
+                    meas_layer_cache_store(&cache, 3, tile, TILE_PIXELS));
+  TEST_ASSERT(cache.tile_runs[3] <= 2 * 10 * MEAS_UI_TILE_HEIGHT + 1);
+
+  memset(out, 0xA5, sizeof(out));
+  TEST_ASSERT(meas_layer_cache_restore(&cache, 3, out, TILE_PIXELS));
+  TEST_ASSERT(memcmp(tile, out, sizeof(tile)) == 0);
+
+  // Uncached tile and mismatched geometry are refused
+  TEST_ASSERT(!meas_layer_cache_restore(&cache, 4, out, TILE_PIXELS));
+  TEST_ASSERT(!meas_layer_cache_restore(&cache, 3, out, TILE_PIXELS / 2));
+
+  meas_layer_cache_reset(&cache);
+  TEST_ASSERT(!meas_layer_cache_restore(&cache, 3, out, TILE_PIXELS));
+}
+
+void test_layer_cache_pool_full(void) {
+  meas_layer_cache_reset(&cache);
+
+  // Checkerboard: one run per pixel, never fits the pool
+  for (int i = 0; i < TILE_PIXELS; i++) {
+    tile[i] = (i & 1) ? 0xFFFF : 0x0000;
+  }
+  TEST_ASSERT_EQUAL(MEAS_ERROR,
+                    meas_layer_cache_store(&cache, 0, tile, TILE_PIXELS));
+  TEST_ASSERT(!meas_layer_cache_restore(&cache, 0, out, TILE_PIXELS));
+
+  // Once full, no further tiles are encoded until the next reset
+  make_grid_tile(0);
+  TEST_ASSERT_EQUAL(MEAS_ERROR,
+                    meas_layer_cache_store(&cache, 1, tile, TILE_PIXELS));
+  meas_layer_cache_reset(&cache);
+  TEST_ASSERT_EQUAL(MEAS_OK,
+                    meas_layer_cache_store(&cache, 1, tile, TILE_PIXELS));
+}
+
+void run_layer_cache_tests(void) {
+  printf("\n--- Running Layer Cache Tests ---\n");
+  RUN_TEST(test_layer_cache_roundtrip);
+  RUN_TEST(test_layer_cache_pool_full);
+}
@@ -0,0 +1,101 @@
+/**
+ * @file test_palette.c
+ * @brief Indexed Color Palette Tests.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/ui/colors.h"
+#include "measlib/ui/palette.h"
+#include "test_framework.h"
+#include <stdlib.h>
+#include <string.h>
+
+static int channel_error(meas_pixel_t a, meas_pixel_t b) {
+  int dr = abs((int)(a >> 11) - (int)(b >> 11)) * 2;
+  int dg = abs((int)((a >> 5) & 0x3F) - (int)((b >> 5) & 0x3F));
+  int db = abs((int)(a & 0x1F) - (int)(b & 0x1F)) * 2;
+  int m = (dr > dg) ? dr : dg;
+  return (m > db) ? m : db;
+}
+
+void test_palette_theme_colors_exact(void) {
+  meas_palette_init();
+  for (int i = 0; i < MEAS_UI_COLOR_MAX; i++) {
+    meas_pixel_t c = meas_ui_theme_default[i];
+    TEST_ASSERT_EQUAL(c, meas_palette_color(meas_palette_match(c)));
+    // Memoized lookup gives the same index
+    TEST_ASSERT_EQUAL(meas_palette_match(c), meas_palette_match(c));
+  }
+  TEST_ASSERT_EQUAL(0xFFFF, meas_palette_color(meas_palette_match(0xFFFF)));
+  TEST_ASSERT_EQUAL(0x0000, meas_palette_color(meas_palette_match(0x0000)));
+}
+
+void test_palette_quantize_is_close(void) {
+  meas_palette_init();
+
+  // Every RGB565 color lands within about one cube step (6-bit scale)
+  int worst = 0;
+  for (uint32_t c = 0; c <= 0xFFFF; c++) {
+    meas_pixel_t q = meas_palette_color(meas_palette_quantize((uint16_t)c));
+    int e = channel_error((uint16_t)c, q);
+    if (e > worst)
+      worst = e;
+  }
+  TEST_ASSERT(worst <= 10);
+
+  // Exact match is never worse than the table
+  meas_pixel_t odd = 0x5AEB;
+  TEST_ASSERT(channel_error(odd, meas_palette_color(meas_palette_match(odd))) <=
+              channel_error(odd,
+                            meas_palette_color(meas_palette_quantize(odd))));
+}
+
+void test_palette_load_and_expand(void) {
+  static const meas_pixel_t colors[] = {0x0000, 0xF800, 0x07E0, 0x001F};
+  TEST_ASSERT_EQUAL(MEAS_ERROR, meas_palette_load(colors, 0));
+  TEST_ASSERT_EQUAL(MEAS_ERROR, meas_palette_load(NULL, 4));
+  TEST_ASSERT_EQUAL(MEAS_OK, meas_palette_load(colors, 4));
+
+  TEST_ASSERT_EQUAL(2, meas_palette_match(0x07E0));
+  TEST_ASSERT_EQUAL(1, meas_palette_match(0xE000)); // Dark red -> red
+  TEST_ASSERT_EQUAL(3, meas_palette_quantize(0x0018));
+  TEST_ASSERT_EQUAL(0x001F, meas_palette_color(200)); // Padded with the last
+
+  const uint8_t idx[7] = {3, 2, 1, 0, 1, 2, 3};
+  meas_pixel_t out[8] = {0};
+  out[7] = 0x1234;
+  meas_palette_expand(out, idx, 7);
+  for (int i = 0; i < 7; i++)
+    TEST_ASSERT_EQUAL(colors[idx[i]], out[i]);
+  TEST_ASSERT_EQUAL(0x1234, out[7]);
+
+  meas_palette_init();
+}
+
+void test_palette_lookups_before_init(void) {
+  // Power-up state: tables zeroed, nothing loaded
+  memset(meas_palette_lut, 0, sizeof(meas_palette_lut));
+  memset(meas_palette_inverse, 0, sizeof(meas_palette_inverse));
+  meas_palette_ready = false;
+  TEST_ASSERT_EQUAL(meas_ui_theme_default[0], meas_palette_color(0));
+
+  meas_palette_ready = false;
+  meas_pixel_t q = meas_palette_color(meas_palette_quantize(0xFFFF));
+  TEST_ASSERT(channel_error(0xFFFF, q) <= 10);
+
+  meas_palette_ready = false;
+  const uint8_t idx[2] = {0, 0};
+  meas_pixel_t out[2] = {0};
+  meas_palette_expand(out, idx, 2);
+  TEST_ASSERT_EQUAL(meas_ui_theme_default[0], out[1]);
+}
+
+void run_palette_tests(void) {
+  printf("\n--- Running Palette Tests ---\n");
+  RUN_TEST(test_palette_theme_colors_exact);
+  RUN_TEST(test_palette_quantize_is_close);
+  RUN_TEST(test_palette_load_and_expand);
+  RUN_TEST(test_palette_lookups_before_init);
+}
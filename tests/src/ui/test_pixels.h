@@ -0,0 +1,42 @@
+/**
+ * @file test_pixels.h
+ * @brief Tile Pixel Helpers for the UI Tests.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Tiles hold RGB565 pixels or, with MEAS_UI_INDEXED_COLOR, palette indices.
+ * Tests state colors in RGB565 and map them with the same rules as the
+ * rasterizer: solid primitive colors take their exact palette entry, blend
+ * results the nearest one.
+ */
+
+#ifndef TEST_PIXELS_H
+#define TEST_PIXELS_H
+
+#include "measlib/ui/palette.h"
+#include "measlib/ui/render.h"
+
+#ifdef MEAS_UI_INDEXED_COLOR
+
+static inline meas_tile_pixel_t tile_px(meas_pixel_t c) {
+  return meas_palette_match(c);
+}
+
+static inline meas_tile_pixel_t tile_mix(meas_pixel_t c) {
+  return meas_palette_quantize(c);
+}
+
+static inline meas_pixel_t tile_color(meas_tile_pixel_t p) {
+  return meas_palette_color(p);
+}
+
+#else
+
+static inline meas_tile_pixel_t tile_px(meas_pixel_t c) { return c; }
+static inline meas_tile_pixel_t tile_mix(meas_pixel_t c) { return c; }
+static inline meas_pixel_t tile_color(meas_tile_pixel_t p) { return p; }
+
+#endif
+
+#endif // TEST_PIXELS_H
@@ -0,0 +1,608 @@
+/**
+ * @file test_render_cell.c
+ * @brief Software Rasterizer (render_cell) Tests.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/ui/fonts.h"
+#include "measlib/ui/render.h"
+#include "test_framework.h"
+#include "test_pixels.h"
+#include <string.h>
+
+#define BUF_W 64
+#define BUF_H 32
+
+extern const meas_render_api_t meas_render_cell_api;
+
+static meas_tile_pixel_t buf[BUF_W * BUF_H];
+static meas_tile_pixel_t tiled[BUF_W * BUF_H];
+
+static void make_ctx(meas_render_ctx_t *ctx, meas_tile_pixel_t *b, int16_t y0,
+                     int16_t h) {
+  memset(ctx, 0, sizeof(*ctx));
+  ctx->buffer = b;
+  ctx->width = BUF_W;
+  ctx->height = h;
+  ctx->y_offset = y0;
+  ctx->fg_color = 0xFFFF;
+  ctx->clip_rect = (meas_rect_t){0, 0, BUF_W, BUF_H};
+}
+
+// Reference decode: both fonts are row-major, MSB = leftmost column
+static bool glyph_bit(const meas_font_t *f, char c, int row, int col) {
+  uint8_t w, h;
+  const uint8_t *g = f->get_glyph(f->bitmap, c, &w, &h);
+  if (col >= w || row >= h)
+    return false;
+  if (f->height > 8)
+    return (((const uint16_t *)g)[row] & (0x8000U >> col)) != 0;
+  return (g[row] & (0x80U >> col)) != 0;
+}
+
+void test_text_glyph_decode(void) {
+  const meas_font_t *fonts[] = {&font_5x7, &font_11x14};
+  for (int fi = 0; fi < 2; fi++) {
+    const meas_font_t *f = fonts[fi];
+    meas_render_ctx_t ctx;
+    make_ctx(&ctx, buf, 0, BUF_H);
+    ctx.font = f;
+    memset(buf, 0, sizeof(buf));
+    meas_render_cell_api.draw_text(&ctx, 3, 2, "0", MEAS_ALPHA_OPAQUE);
+
+    uint8_t w, h;
+    f->get_glyph(f->bitmap, '0', &w, &h);
+    TEST_ASSERT(w <= f->width_max + 1);
+    for (int y = 0; y < BUF_H; y++) {
+      for (int x = 0; x < BUF_W; x++) {
+        bool set = (x >= 3 && y >= 2) && glyph_bit(f, '0', y - 2, x - 3);
+        TEST_ASSERT_EQUAL(set ? tile_px(0xFFFF) : 0, buf[y * BUF_W + x]);
+      }
+    }
+  }
+}
+
+void test_text_tiles_and_clip(void) {
+  meas_render_ctx_t ctx;
+  const char *s = "Ab9%";
+  meas_tile_pixel_t bg = tile_px(0x1234);
+
+  // Reference: single pass, clipped to a window crossing the glyphs
+  make_ctx(&ctx, buf, 0, BUF_H);
+  ctx.font = &font_11x14;
+  ctx.fg_color = 0x07E0;
+  ctx.clip_rect = (meas_rect_t){5, 4, 30, 20};
+  for (int i = 0; i < BUF_W * BUF_H; i++)
+    buf[i] = bg;
+  meas_render_cell_api.draw_text(&ctx, 1, 3, s, MEAS_ALPHA_50);
+
+  // Same text rendered through 8-row tiles must match exactly
+  for (int i = 0; i < BUF_W * BUF_H; i++)
+    tiled[i] = bg;
+  for (int16_t y = 0; y < BUF_H; y += 8) {
+    make_ctx(&ctx, &tiled[y * BUF_W], y, 8);
+    ctx.font = &font_11x14;
+    ctx.fg_color = 0x07E0;
+    ctx.clip_rect = (meas_rect_t){5, 4, 30, 20};
+    meas_render_cell_api.draw_text(&ctx, 1, 3, s, MEAS_ALPHA_50);
+  }
+  TEST_ASSERT(memcmp(buf, tiled, sizeof(buf)) == 0);
+
+  // Nothing outside the clip window, something inside it
+  int inside = 0;
+  for (int y = 0; y < BUF_H; y++) {
+    for (int x = 0; x < BUF_W; x++) {
+      bool in_clip = x >= 5 && x < 35 && y >= 4 && y < 24;
+      if (!in_clip)
+        TEST_ASSERT_EQUAL(bg, buf[y * BUF_W + x]);
+      else if (buf[y * BUF_W + x] != bg)
+        inside++;
+    }
+  }
+  TEST_ASSERT(inside > 0);
+}
+
+void test_text_alpha_matches_pixel(void) {
+  meas_render_ctx_t ctx;
+  make_ctx(&ctx, buf, 0, BUF_H);
+  ctx.font = &font_5x7;
+  ctx.fg_color = 0xF81F;
+  for (int i = 0; i < BUF_W * BUF_H; i++)
+    buf[i] = tile_px(0x07E0);
+  meas_render_cell_api.draw_text(&ctx, 0, 0, "1", MEAS_ALPHA_25);
+
+  // Same pixel through the generic per-pixel path
+  memcpy(tiled, buf, sizeof(buf));
+  tiled[0] = tile_px(0x07E0);
+  make_ctx(&ctx, tiled, 0, BUF_H);
+  ctx.fg_color = 0xF81F;
+  meas_render_cell_api.draw_pixel(&ctx, 0, 0, MEAS_ALPHA_25);
+
+  // '1' covers column 2 of row 0 in the 5x7 font
+  TEST_ASSERT(glyph_bit(&font_5x7, '1', 0, 2));
+  TEST_ASSERT_EQUAL(tiled[0], buf[2]);
+}
+
+// Reference: full Bresenham walk with per-pixel clip (original algorithm)
+static void ref_line(meas_tile_pixel_t *b, int16_t y_off, int16_t h,
+                     meas_rect_t clip, int32_t x0, int32_t y0, int32_t x1,
+                     int32_t y1, uint8_t pattern) {
+  int32_t dx = abs(x1 - x0);
+  int32_t dy = abs(y1 - y0);
+  int32_t sx = (x0 < x1) ? 1 : -1;
+  int32_t sy = (y0 < y1) ? 1 : -1;
+  int32_t err = (dx > dy ? dx : -dy) / 2;
+  uint8_t bit = 0;
+  while (1) {
+    bool on = pattern & (0x80 >> (bit++ & 7));
+    if (on && x0 >= clip.x && x0 < clip.x + clip.w && y0 >= clip.y &&
+        y0 < clip.y + clip.h && x0 >= 0 && x0 < BUF_W && y0 >= y_off &&
+        y0 < y_off + h)
+      b[(y0 - y_off) * BUF_W + x0] = tile_px(0xFFFF);
+    if (x0 == x1 && y0 == y1)
+      break;
+    int32_t e2 = err;
+    if (e2 > -dx) {
+      err -= dy;
+      x0 += sx;
+    }
+    if (e2 < dy) {
+      err += dx;
+      y0 += sy;
+    }
+  }
+}
+
+void test_line_clipped_matches_bresenham(void) {
+  srand(1234);
+  for (int iter = 0; iter < 4000; iter++) {
+    int16_t x0 = (int16_t)(rand() % 140 - 40);
+    int16_t y0 = (int16_t)(rand() % 90 - 30);
+    int16_t x1 = (int16_t)(rand() % 140 - 40);
+    int16_t y1 = (int16_t)(rand() % 90 - 30);
+    int16_t tile_y = (int16_t)((rand() % 4) * 8);
+    meas_rect_t clip = {(int16_t)(rand() % 20), (int16_t)(rand() % 20),
+                        (int16_t)(rand() % 60 + 1), (int16_t)(rand() % 30 + 1)};
+    uint8_t pattern = (iter & 1) ? MEAS_PATTERN_SOLID : MEAS_PATTERN_DASH_DOT;
+
+    memset(buf, 0, sizeof(buf));
+    memset(tiled, 0, sizeof(tiled));
+    ref_line(buf, tile_y, 8, clip, x0, y0, x1, y1, pattern);
+
+    meas_render_ctx_t ctx;
+    make_ctx(&ctx, tiled, tile_y, 8);
+    ctx.clip_rect = clip;
+    meas_render_cell_api.draw_line_patt(&ctx, x0, y0, x1, y1, pattern,
+                                        MEAS_ALPHA_OPAQUE);
+    TEST_ASSERT(memcmp(buf, tiled, BUF_W * 8 * sizeof(meas_tile_pixel_t)) == 0);
+  }
+}
+
+static int16_t clamp_i16(int32_t v) {
+  return (int16_t)(v < INT16_MIN ? INT16_MIN : (v > INT16_MAX ? INT16_MAX : v));
+}
+
+void test_line_extreme_endpoints(void) {
+  // Spans of up to 65535 pixels per axis: products must not overflow
+  static const int16_t fixed[][4] = {
+      {INT16_MIN, INT16_MIN, INT16_MAX, INT16_MAX},
+      {INT16_MAX, INT16_MIN, INT16_MIN, INT16_MAX},
+      {INT16_MIN, 20, INT16_MAX, 21},
+      {50, INT16_MAX, 51, INT16_MIN},
+      {INT16_MIN, INT16_MAX - 1, INT16_MAX, INT16_MIN + 2},
+  };
+  srand(4321);
+  for (int iter = 0; iter < 200; iter++) {
+    int16_t x0, y0, x1, y1;
+    if (iter < (int)(sizeof(fixed) / sizeof(fixed[0]))) {
+      x0 = fixed[iter][0];
+      y0 = fixed[iter][1];
+      x1 = fixed[iter][2];
+      y1 = fixed[iter][3];
+    } else {
+      // Extreme start, end mirrored through a point near the buffer
+      int32_t cx = rand() % BUF_W;
+      int32_t cy = rand() % 32;
+      x0 = (iter & 1) ? (int16_t)(INT16_MIN + rand() % 64)
+                      : (int16_t)(rand() % 65536 - 32768);
+      y0 = (iter & 1) ? (int16_t)(rand() % 65536 - 32768)
+                      : (int16_t)(INT16_MAX - rand() % 64);
+      x1 = clamp_i16(2 * cx - x0);
+      y1 = clamp_i16(2 * cy - y0);
+    }
+    int16_t tile_y = (int16_t)((rand() % 4) * 8);
+    meas_rect_t clip = {0, 0, BUF_W, 32};
+
+    memset(buf, 0, sizeof(buf));
+    memset(tiled, 0, sizeof(tiled));
+    ref_line(buf, tile_y, 8, clip, x0, y0, x1, y1, MEAS_PATTERN_SOLID);
+
+    meas_render_ctx_t ctx;
+    make_ctx(&ctx, tiled, tile_y, 8);
+    ctx.clip_rect = clip;
+    meas_render_cell_api.draw_line(&ctx, x0, y0, x1, y1, MEAS_ALPHA_OPAQUE);
+    TEST_ASSERT(memcmp(buf, tiled, BUF_W * 8 * sizeof(meas_tile_pixel_t)) == 0);
+  }
+}
+
+void test_polyline_skips_other_tiles(void) {
+  // A long trace entirely below the tile leaves it untouched
+  meas_point_t pts[64];
+  for (int i = 0; i < 64; i++) {
+    pts[i] = (meas_point_t){(int16_t)i, (int16_t)(20 + (i & 3))};
+  }
+  meas_render_ctx_t ctx;
+  make_ctx(&ctx, tiled, 0, 8);
+  memset(tiled, 0, sizeof(tiled));
+  meas_render_cell_api.draw_polyline(&ctx, pts, 64, MEAS_ALPHA_OPAQUE);
+  for (int i = 0; i < BUF_W * 8; i++)
+    TEST_ASSERT_EQUAL(0, tiled[i]);
+
+  // ...and the tile containing it gets every segment
+  make_ctx(&ctx, tiled, 16, 8);
+  meas_render_cell_api.draw_polyline(&ctx, pts, 64, MEAS_ALPHA_OPAQUE);
+  for (int i = 0; i < 64; i++)
+    TEST_ASSERT_EQUAL(tile_px(0xFFFF),
+                      tiled[(pts[i].y - 16) * BUF_W + pts[i].x]);
+}
+
+// Per-channel reference: (fg * a + bg * (32 - a)) >> 5, a = 5-bit weight
+static meas_pixel_t ref_blend(meas_pixel_t bg, meas_pixel_t fg, uint8_t alpha) {
+  uint32_t a = ((uint32_t)alpha + 4U) >> 3;
+  uint32_t r = (((fg >> 11) & 0x1F) * a + ((bg >> 11) & 0x1F) * (32 - a)) >> 5;
+  uint32_t g = (((fg >> 5) & 0x3F) * a + ((bg >> 5) & 0x3F) * (32 - a)) >> 5;
+  uint32_t b = ((fg & 0x1F) * a + (bg & 0x1F) * (32 - a)) >> 5;
+  return (meas_pixel_t)((r << 11) | (g << 5) | b);
+}
+
+void test_span_blend_matches_reference(void) {
+  static meas_pixel_t src[BUF_W * BUF_H];
+  srand(77);
+  for (int iter = 0; iter < 500; iter++) {
+    for (int i = 0; i < BUF_W * BUF_H; i++) {
+      buf[i] = (meas_tile_pixel_t)rand();
+      src[i] = (meas_pixel_t)rand();
+    }
+    memcpy(tiled, buf, sizeof(buf));
+
+    // Odd/even start columns and lengths exercise the unaligned edges
+    int16_t x = (int16_t)(rand() % 40);
+    int16_t y = (int16_t)(rand() % 20);
+    int16_t w = (int16_t)(rand() % 24 + 1);
+    int16_t h = (int16_t)(rand() % 12 + 1);
+    uint8_t alpha = (uint8_t)(rand() & 0xFF);
+    meas_pixel_t color = (meas_pixel_t)rand();
+
+    meas_render_ctx_t ctx;
+    make_ctx(&ctx, tiled, 0, BUF_H);
+    ctx.fg_color = color;
+    if (iter & 1) {
+      meas_render_cell_api.fill_rect(&ctx, x, y, w, h, alpha);
+    } else {
+      meas_render_cell_api.blit(&ctx, x, y, w, h, &src[1], alpha);
+    }
+
+    for (int py = 0; py < BUF_H; py++) {
+      for (int px = 0; px < BUF_W; px++) {
+        meas_tile_pixel_t expect = buf[py * BUF_W + px];
+        bool inside = px >= x && px < x + w && py >= y && py < y + h &&
+                      px < BUF_W && py < BUF_H;
+        if (inside && alpha != MEAS_ALPHA_TRANSPARENT) {
+          meas_pixel_t fg =
+              (iter & 1) ? color : src[1 + (py - y) * w + (px - x)];
+          // Full-weight fills store the solid color, the rest blend results
+          if ((iter & 1) && ((alpha + 4) >> 3) == 32)
+            expect = tile_px(fg);
+          else
+            expect = tile_mix(ref_blend(tile_color(expect), fg, alpha));
+        }
+        TEST_ASSERT_EQUAL(expect, tiled[py * BUF_W + px]);
+      }
+    }
+  }
+}
+
+// Every covered pixel is blended exactly once: the fill is uniform
+static void check_uniform(meas_tile_pixel_t bg, meas_tile_pixel_t fill) {
+  int covered = 0;
+  for (int i = 0; i < BUF_W * BUF_H; i++) {
+    if (tiled[i] != bg) {
+      TEST_ASSERT_EQUAL(fill, tiled[i]);
+      covered++;
+    }
+  }
+  TEST_ASSERT(covered > 0);
+}
+
+void test_round_fills_blend_once(void) {
+  meas_tile_pixel_t bg = tile_px(0x2104);
+  meas_tile_pixel_t fill =
+      tile_mix(ref_blend(tile_color(bg), 0xFFFF, MEAS_ALPHA_50));
+
+  for (int16_t r = 0; r <= 15; r++) {
+    for (int16_t y0 = 0; y0 < BUF_H; y0 += 8) {
+      meas_render_ctx_t ctx;
+      make_ctx(&ctx, &tiled[y0 * BUF_W], y0, 8);
+      if (y0 == 0) {
+        for (int i = 0; i < BUF_W * BUF_H; i++)
+          tiled[i] = bg;
+      }
+      meas_render_cell_api.fill_round_rect(&ctx, (meas_rect_t){3, 1, 50, 30},
+                                           r, MEAS_ALPHA_50);
+    }
+    check_uniform(bg, fill);
+
+    for (int i = 0; i < BUF_W * BUF_H; i++)
+      tiled[i] = bg;
+    meas_render_ctx_t ctx;
+    make_ctx(&ctx, tiled, 0, BUF_H);
+    meas_render_cell_api.fill_circle(&ctx, 30, 15, r, MEAS_ALPHA_50);
+    check_uniform(bg, fill);
+  }
+}
+
+#ifdef MEAS_UI_INDEXED_COLOR
+#define AA_SUM_MIN 52
+#else
+#define AA_SUM_MIN 60
+#endif
+
+// Full coverage: the solid color or, from the blend path, its nearest entry
+static bool is_full_white(meas_tile_pixel_t p) {
+  return p == tile_px(0xFFFF) || p == tile_mix(0xFFFF);
+}
+
+void test_aa_line_coverage(void) {
+  meas_render_ctx_t ctx;
+  make_ctx(&ctx, buf, 0, BUF_H);
+
+  // Axis-aligned and diagonal segments are exact pixels
+  memset(buf, 0, sizeof(buf));
+  meas_point_t hv[] = {{0, 10}, {63, 10}, {63, 31}, {32, 0}};
+  meas_render_cell_api.draw_polyline_aa(&ctx, hv, 2, MEAS_ALPHA_OPAQUE);
+  for (int x = 0; x < BUF_W; x++)
+    TEST_ASSERT_EQUAL(0xFFFF, tile_color(buf[10 * BUF_W + x]));
+  meas_render_cell_api.draw_polyline_aa(&ctx, &hv[2], 2, MEAS_ALPHA_OPAQUE);
+  for (int i = 0; i <= 31; i++)
+    TEST_ASSERT_EQUAL(0xFFFF, tile_color(buf[(31 - i) * BUF_W + 63 - i]));
+
+  // Shallow line: per column one or two adjacent pixels whose coverages add
+  // up to full intensity (green channel, 6 bits; palette entries are coarser)
+  memset(buf, 0, sizeof(buf));
+  meas_point_t shallow[] = {{0, 5}, {63, 20}};
+  meas_render_cell_api.draw_polyline_aa(&ctx, shallow, 2, MEAS_ALPHA_OPAQUE);
+  int partial = 0;
+  for (int x = 0; x < BUF_W; x++) {
+    int first = -1, lit = 0, sum = 0;
+    for (int y = 0; y < BUF_H; y++) {
+      meas_pixel_t p = tile_color(buf[y * BUF_W + x]);
+      if (p) {
+        if (first < 0)
+          first = y;
+        TEST_ASSERT(y - first <= 1);
+        lit++;
+        sum += (p >> 5) & 0x3F;
+      }
+    }
+    TEST_ASSERT(lit >= 1 && lit <= 2);
+    TEST_ASSERT(sum >= AA_SUM_MIN && sum <= 64);
+    partial += (lit == 2);
+  }
+  TEST_ASSERT(partial > 32); // Actually anti-aliased
+  TEST_ASSERT(is_full_white(buf[5 * BUF_W]));
+  TEST_ASSERT(is_full_white(buf[20 * BUF_W + 63]));
+}
+
+void test_aa_polyline_tiles_match_full(void) {
+  srand(4321);
+  for (int iter = 0; iter < 1000; iter++) {
+    meas_point_t pts[5];
+    for (int i = 0; i < 5; i++) {
+      pts[i] = (meas_point_t){(int16_t)(rand() % 120 - 30),
+                              (int16_t)(rand() % 70 - 20)};
+    }
+    meas_rect_t clip = {(int16_t)(rand() % 20), (int16_t)(rand() % 12),
+                        (int16_t)(rand() % 60 + 1), (int16_t)(rand() % 30 + 1)};
+    uint8_t alpha = (iter & 1) ? MEAS_ALPHA_OPAQUE : (uint8_t)(rand() & 0xFF);
+    meas_pixel_t color = (meas_pixel_t)rand();
+
+    for (int i = 0; i < BUF_W * BUF_H; i++)
+      buf[i] = (meas_tile_pixel_t)(i * 37);
+    memcpy(tiled, buf, sizeof(buf));
+
+    meas_render_ctx_t ctx;
+    make_ctx(&ctx, buf, 0, BUF_H);
+    ctx.clip_rect = clip;
+    ctx.fg_color = color;
+    meas_render_cell_api.draw_polyline_aa(&ctx, pts, 5, alpha);
+
+    for (int16_t y0 = 0; y0 < BUF_H; y0 += 8) {
+      make_ctx(&ctx, &tiled[y0 * BUF_W], y0, 8);
+      ctx.clip_rect = clip;
+      ctx.fg_color = color;
+      meas_render_cell_api.draw_polyline_aa(&ctx, pts, 5, alpha);
+    }
+    TEST_ASSERT(memcmp(buf, tiled, sizeof(buf)) == 0);
+  }
+}
+
+void test_polygon_fill_rows(void) {
+  meas_render_ctx_t ctx;
+
+  // Axis-aligned quad: rows (top, bottom], columns [left, right)
+  meas_point_t quad[] = {{10, 5}, {30, 5}, {30, 15}, {10, 15}};
+  make_ctx(&ctx, buf, 0, BUF_H);
+  memset(buf, 0, sizeof(buf));
+  meas_render_cell_api.fill_polygon(&ctx, quad, 4, MEAS_ALPHA_OPAQUE);
+  make_ctx(&ctx, tiled, 0, BUF_H);
+  memset(tiled, 0, sizeof(tiled));
+  meas_render_cell_api.fill_rect(&ctx, 10, 6, 20, 10, MEAS_ALPHA_OPAQUE);
+  TEST_ASSERT(memcmp(buf, tiled, sizeof(buf)) == 0);
+
+  // Comb with 12 teeth: 24 crossings per row above the spine
+  meas_point_t comb[2 + 12 * 4];
+  int n = 0;
+  comb[n++] = (meas_point_t){2, 25};
+  for (int t = 0; t < 12; t++) {
+    int16_t x = (int16_t)(2 + 3 * t);
+    comb[n++] = (meas_point_t){x, 5};
+    comb[n++] = (meas_point_t){(int16_t)(x + 2), 5};
+    if (t < 11) {
+      comb[n++] = (meas_point_t){(int16_t)(x + 2), 20};
+      comb[n++] = (meas_point_t){(int16_t)(x + 3), 20};
+    }
+  }
+  comb[n++] = (meas_point_t){37, 25};
+  make_ctx(&ctx, buf, 0, BUF_H);
+  memset(buf, 0, sizeof(buf));
+  meas_render_cell_api.fill_polygon(&ctx, comb, (uint16_t)n,
+                                    MEAS_ALPHA_OPAQUE);
+  for (int y = 0; y < BUF_H; y++) {
+    for (int x = 0; x < BUF_W; x++) {
+      bool set;
+      if (y <= 5 || y > 25 || x < 2 || x >= 37)
+        set = false;
+      else if (y > 20)
+        set = true;
+      else
+        set = ((x - 2) % 3) < 2;
+      TEST_ASSERT_EQUAL(set ? tile_px(0xFFFF) : 0, buf[y * BUF_W + x]);
+    }
+  }
+}
+
+void test_polygon_tiles_match_full(void) {
+  srand(8765);
+  for (int iter = 0; iter < 1000; iter++) {
+    meas_point_t pts[7];
+    for (int i = 0; i < 7; i++) {
+      pts[i] = (meas_point_t){(int16_t)(rand() % 120 - 30),
+                              (int16_t)(rand() % 70 - 20)};
+    }
+    meas_rect_t clip = {(int16_t)(rand() % 20), (int16_t)(rand() % 12),
+                        (int16_t)(rand() % 60 + 1), (int16_t)(rand() % 30 + 1)};
+    uint8_t alpha = (iter & 1) ? MEAS_ALPHA_OPAQUE : (uint8_t)(rand() & 0xFF);
+    meas_pixel_t color = (meas_pixel_t)rand();
+
+    for (int i = 0; i < BUF_W * BUF_H; i++)
+      buf[i] = (meas_tile_pixel_t)(i * 37);
+    memcpy(tiled, buf, sizeof(buf));
+
+    meas_render_ctx_t ctx;
+    make_ctx(&ctx, buf, 0, BUF_H);
+    ctx.clip_rect = clip;
+    ctx.fg_color = color;
+    meas_render_cell_api.fill_polygon(&ctx, pts, 7, alpha);
+
+    for (int16_t y0 = 0; y0 < BUF_H; y0 += 8) {
+      make_ctx(&ctx, &tiled[y0 * BUF_W], y0, 8);
+      ctx.clip_rect = clip;
+      ctx.fg_color = color;
+      meas_render_cell_api.fill_polygon(&ctx, pts, 7, alpha);
+    }
+    TEST_ASSERT(memcmp(buf, tiled, sizeof(buf)) == 0);
+  }
+}
+
+// Band with a zig-zag top (61 points at y 97/99) over a flat bottom at 103
+static meas_tile_pixel_t band[320 * 8];
+static meas_tile_pixel_t band_halves[320 * 8];
+
+static void fill_band(meas_tile_pixel_t *b, const meas_point_t *pts,
+                      uint16_t n) {
+  meas_render_ctx_t ctx;
+  memset(&ctx, 0, sizeof(ctx));
+  ctx.buffer = b;
+  ctx.width = 320;
+  ctx.height = 8;
+  ctx.y_offset = 96;
+  ctx.fg_color = 0xFFFF;
+  ctx.clip_rect = (meas_rect_t){0, 0, 320, 240};
+  meas_render_cell_api.fill_polygon(&ctx, pts, n, MEAS_ALPHA_OPAQUE);
+}
+
+void test_polygon_many_edges(void) {
+  meas_point_t pts[63];
+  for (int i = 0; i <= 60; i++)
+    pts[i] = (meas_point_t){(int16_t)(5 * i), (int16_t)((i & 1) ? 99 : 97)};
+  pts[61] = (meas_point_t){300, 103};
+  pts[62] = (meas_point_t){0, 103};
+
+  // 62 edges reach the tile, more than the active edge table holds
+  TEST_ASSERT(62 > MEAS_MAX_POLYGON_EDGES);
+  memset(band, 0, sizeof(band));
+  fill_band(band, pts, 63);
+  for (int y = 100; y <= 103; y++) {
+    for (int x = 0; x < 320; x++)
+      TEST_ASSERT_EQUAL(x < 300 ? tile_px(0xFFFF) : 0,
+                        band[(y - 96) * 320 + x]);
+  }
+
+  // Same pixels as the two halves split at x = 150 (32 edges each)
+  meas_point_t half[33];
+  memset(band_halves, 0, sizeof(band_halves));
+  memcpy(half, pts, 31 * sizeof(meas_point_t));
+  half[31] = (meas_point_t){150, 103};
+  half[32] = (meas_point_t){0, 103};
+  fill_band(band_halves, half, 33);
+  memcpy(half, &pts[30], 31 * sizeof(meas_point_t));
+  half[31] = (meas_point_t){300, 103};
+  half[32] = (meas_point_t){150, 103};
+  fill_band(band_halves, half, 33);
+  TEST_ASSERT(memcmp(band, band_halves, sizeof(band)) == 0);
+}
+
+void test_polygon_parity_matches_edge_table(void) {
+  // Whole-buffer contexts take more edges than the table holds; one-row
+  // contexts see only the edges crossing their row
+  srand(4321);
+  for (int iter = 0; iter < 200; iter++) {
+    meas_point_t pts[48];
+    for (int i = 0; i < 48; i++) {
+      pts[i] = (meas_point_t){(int16_t)(rand() % 90 - 13),
+                              (int16_t)(rand() % 40 - 4)};
+    }
+    meas_rect_t clip = {(int16_t)(rand() % 10), (int16_t)(rand() % 6),
+                        (int16_t)(rand() % 60 + 1), (int16_t)(rand() % 30 + 1)};
+    uint8_t alpha = (iter & 1) ? MEAS_ALPHA_OPAQUE : (uint8_t)(rand() & 0xFF);
+    meas_pixel_t color = (meas_pixel_t)rand();
+
+    for (int i = 0; i < BUF_W * BUF_H; i++)
+      buf[i] = (meas_tile_pixel_t)(i * 37);
+    memcpy(tiled, buf, sizeof(buf));
+
+    meas_render_ctx_t ctx;
+    make_ctx(&ctx, buf, 0, BUF_H);
+    ctx.clip_rect = clip;
+    ctx.fg_color = color;
+    meas_render_cell_api.fill_polygon(&ctx, pts, 48, alpha);
+
+    for (int16_t y0 = 0; y0 < BUF_H; y0++) {
+      make_ctx(&ctx, &tiled[y0 * BUF_W], y0, 1);
+      ctx.clip_rect = clip;
+      ctx.fg_color = color;
+      meas_render_cell_api.fill_polygon(&ctx, pts, 48, alpha);
+    }
+    TEST_ASSERT(memcmp(buf, tiled, sizeof(buf)) == 0);
+  }
+}
+
+void run_render_cell_tests(void) {
+  printf("\n--- Running Render Cell Tests ---\n");
+  RUN_TEST(test_text_glyph_decode);
+  RUN_TEST(test_text_tiles_and_clip);
+  RUN_TEST(test_text_alpha_matches_pixel);
+  RUN_TEST(test_line_clipped_matches_bresenham);
+  RUN_TEST(test_line_extreme_endpoints);
+  RUN_TEST(test_polyline_skips_other_tiles);
+  RUN_TEST(test_span_blend_matches_reference);
+  RUN_TEST(test_round_fills_blend_once);
+  RUN_TEST(test_aa_line_coverage);
+  RUN_TEST(test_aa_polyline_tiles_match_full);
+  RUN_TEST(test_polygon_fill_rows);
+  RUN_TEST(test_polygon_tiles_match_full);
+  RUN_TEST(test_polygon_many_edges);
+  RUN_TEST(test_polygon_parity_matches_edge_table);
+}
@@ -0,0 +1,161 @@
+/**
+ * @file test_smith.c
+ * @brief Smith / Polar Graticule Span Table Tests.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/ui/smith.h"
+#include "test_framework.h"
+#include "test_pixels.h"
+#include <string.h>
+
+#define SCREEN_W MEAS_UI_SCREEN_WIDTH
+#define SCREEN_H MEAS_UI_SCREEN_HEIGHT
+#define INK 0x07E0
+
+extern const meas_render_api_t meas_render_cell_api;
+extern const meas_ui_api_t layout_main_api;
+
+static meas_smith_t chart;
+static meas_tile_pixel_t full[SCREEN_W * SCREEN_H];
+static meas_tile_pixel_t tiled[SCREEN_W * SCREEN_H];
+
+static void make_ctx(meas_render_ctx_t *ctx, meas_tile_pixel_t *buf, int16_t y,
+                     int16_t h) {
+  memset(ctx, 0, sizeof(*ctx));
+  ctx->buffer = buf;
+  ctx->width = SCREEN_W;
+  ctx->height = h;
+  ctx->y_offset = y;
+  ctx->fg_color = INK;
+  ctx->clip_rect = (meas_rect_t){0, 0, SCREEN_W, SCREEN_H};
+}
+
+static void render_full(void) {
+  meas_render_ctx_t ctx;
+  make_ctx(&ctx, full, 0, SCREEN_H);
+  memset(full, 0, sizeof(full));
+  meas_smith_draw(&chart, &ctx, &meas_render_cell_api, MEAS_ALPHA_OPAQUE);
+}
+
+static bool ink(int x, int y) { return full[y * SCREEN_W + x] == tile_px(INK); }
+
+// Spans sorted, disjoint, and inside the |Gamma| = 1 disk (+1 px)
+static void check_spans(void) {
+  for (uint16_t r = 0; r < chart.rows; r++) {
+    int32_t dy = chart.y_top + r - chart.cy;
+    int32_t limit = (chart.radius + 1) * (chart.radius + 1);
+    for (uint16_t i = chart.row_first[r]; i < chart.row_first[r + 1]; i++) {
+      const meas_span_t *s = &chart.spans[i];
+      TEST_ASSERT(s->x0 <= s->x1);
+      if (i > chart.row_first[r])
+        TEST_ASSERT(s->x0 > chart.spans[i - 1].x1 + 1);
+      int32_t d0 = s->x0 - chart.radius;
+      int32_t d1 = s->x1 - chart.radius;
+      TEST_ASSERT(d0 * d0 + dy * dy <= limit);
+      TEST_ASSERT(d1 * d1 + dy * dy <= limit);
+    }
+  }
+}
+
+void test_smith_impedance_geometry(void) {
+  TEST_ASSERT_EQUAL(MEAS_OK, meas_smith_build(&chart, MEAS_SMITH_IMPEDANCE,
+                                              160, 120, 110));
+  TEST_ASSERT(chart.span_count > 0);
+  check_spans();
+  render_full();
+
+  // Outer circle extremes, real axis, r = 1 circle through the center
+  TEST_ASSERT(ink(50, 120) && ink(270, 120));
+  TEST_ASSERT(ink(160, 10) && ink(160, 230));
+  TEST_ASSERT(ink(100, 120));
+  TEST_ASSERT(ink(215, 65) && ink(215, 175)); // r = 1 top / bottom
+
+  // Nothing outside the chart box
+  TEST_ASSERT(!ink(49, 120) && !ink(271, 120) && !ink(160, 9));
+
+  // Mirror symmetric about the real axis (+X above, -X below)
+  for (int d = 1; d <= 110; d++) {
+    for (int x = 40; x < 280; x++) {
+      TEST_ASSERT(ink(x, 120 - d) == ink(x, 120 + d));
+    }
+  }
+}
+
+void test_smith_polar_geometry(void) {
+  TEST_ASSERT_EQUAL(MEAS_OK,
+                    meas_smith_build(&chart, MEAS_SMITH_POLAR, 120, 120, 100));
+  check_spans();
+  render_full();
+
+  TEST_ASSERT(ink(120, 120));                  // Radials meet at the center
+  TEST_ASSERT(ink(220, 120) && ink(20, 120));  // 0 / 180 degree radials
+  TEST_ASSERT(ink(120, 40) && ink(120, 60));   // |Gamma| = 0.8, 0.6 at 90 deg
+  TEST_ASSERT(ink(120 + 87, 120 - 50));        // 30 degree radial end
+  TEST_ASSERT(!ink(221, 120) && !ink(120, 19));
+}
+
+void test_smith_tiles_match_full(void) {
+  static const meas_smith_style_t styles[] = {MEAS_SMITH_IMPEDANCE,
+                                              MEAS_SMITH_POLAR};
+  for (int s = 0; s < 2; s++) {
+    TEST_ASSERT_EQUAL(MEAS_OK,
+                      meas_smith_build(&chart, styles[s], 150, 119, 119));
+    render_full();
+
+    memset(tiled, 0, sizeof(tiled));
+    for (int16_t y = 0; y < SCREEN_H; y += MEAS_UI_TILE_HEIGHT) {
+      meas_render_ctx_t ctx;
+      make_ctx(&ctx, &tiled[y * SCREEN_W], y, MEAS_UI_TILE_HEIGHT);
+      meas_smith_draw(&chart, &ctx, &meas_render_cell_api, MEAS_ALPHA_OPAQUE);
+    }
+    TEST_ASSERT(memcmp(full, tiled, sizeof(full)) == 0);
+  }
+}
+
+void test_smith_rejects_oversize(void) {
+  TEST_ASSERT_EQUAL(MEAS_ERROR, meas_smith_build(&chart, MEAS_SMITH_IMPEDANCE,
+                                                 160, 120, 120));
+  TEST_ASSERT_EQUAL(0, chart.rows);
+
+  // Empty chart draws nothing
+  render_full();
+  for (int i = 0; i < SCREEN_W * SCREEN_H; i++) {
+    TEST_ASSERT(full[i] == 0);
+  }
+}
+
+void test_smith_layout_draws_chart(void) {
+  TEST_ASSERT_EQUAL(MEAS_OK, meas_smith_build(&chart, MEAS_SMITH_IMPEDANCE,
+                                              160, 120, 100));
+  render_full();
+
+  // Grid stage only: the attached chart replaces the crosshair
+  static meas_ui_t ui;
+  memset(&ui, 0, sizeof(ui));
+  ui.chart = &chart;
+  ui.stage_skip = (uint8_t)~(1U << RENDER_STAGE_GRID);
+  meas_render_ctx_t ctx;
+  make_ctx(&ctx, tiled, 0, SCREEN_H);
+  memset(tiled, 0, sizeof(tiled));
+  TEST_ASSERT_EQUAL(MEAS_OK,
+                    layout_main_api.draw(&ui, &ctx, &meas_render_cell_api));
+  TEST_ASSERT(memcmp(full, tiled, sizeof(full)) == 0);
+
+  // Detached: the rectangular grid is back
+  ui.chart = NULL;
+  memset(tiled, 0, sizeof(tiled));
+  layout_main_api.draw(&ui, &ctx, &meas_render_cell_api);
+  TEST_ASSERT(tiled[10 * SCREEN_W + 160] == tile_px(INK));
+}
+
+void run_smith_tests(void) {
+  printf("\n--- Running Smith Chart Tests ---\n");
+  RUN_TEST(test_smith_impedance_geometry);
+  RUN_TEST(test_smith_polar_geometry);
+  RUN_TEST(test_smith_tiles_match_full);
+  RUN_TEST(test_smith_rejects_oversize);
+  RUN_TEST(test_smith_layout_draws_chart);
+}
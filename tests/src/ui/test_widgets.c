@@ -0,0 +1,341 @@
+/**
+ * @file test_widgets.c
+ * @brief Retained Widget Tree Tests.
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "measlib/ui/components/button.h"
+#include "measlib/ui/components/graph.h"
+#include "measlib/ui/components/label.h"
+#include "measlib/ui/components/menu_view.h"
+#include "measlib/ui/fonts.h"
+#include "test_framework.h"
+#include <string.h>
+
+#define SCREEN_W MEAS_UI_SCREEN_WIDTH
+#define SCREEN_H MEAS_UI_SCREEN_HEIGHT
+
+extern const meas_render_api_t meas_render_cell_api;
+extern const meas_ui_api_t layout_main_api;
+
+static meas_ui_t ui;
+static meas_widget_tree_t tree;
+
+static uint32_t tiles_of(int16_t y, int16_t h) {
+  uint32_t map = 0;
+  for (int16_t t = y / MEAS_UI_TILE_HEIGHT;
+       t <= (y + h - 1) / MEAS_UI_TILE_HEIGHT; t++)
+    map |= 1U << t;
+  return map;
+}
+
+static void reset_tree(void) {
+  memset(&ui, 0, sizeof(ui));
+  meas_widget_tree_init(&tree, &ui);
+}
+
+// --- Spy widget: counts draw calls ---
+
+static int spy_draws;
+
+static void spy_draw(const meas_widget_t *w, meas_render_ctx_t *ctx,
+                     const meas_render_api_t *api) {
+  spy_draws++;
+  ctx->fg_color = w->fg_color;
+  api->fill_rect(ctx, w->bounds.x, w->bounds.y, w->bounds.w, w->bounds.h,
+                 MEAS_ALPHA_OPAQUE);
+}
+
+static const meas_widget_api_t spy_api = {.draw = spy_draw,
+                                          .on_gesture = NULL};
+
+void test_widget_invalidation_is_local(void) {
+  reset_tree();
+  meas_readout_t freq;
+  meas_readout_init(&freq, (meas_rect_t){200, 40, 100, 14}, 3, "MHz");
+  meas_widget_add(&tree.root, &freq.base);
+  TEST_ASSERT_EQUAL(tiles_of(40, 14), ui.dirty_map); // Attaching draws it
+
+  // Changed value: only the readout's tiles
+  ui.dirty_map = 0;
+  meas_readout_set_value(&freq, 1234567);
+  TEST_ASSERT_EQUAL(tiles_of(40, 14), ui.dirty_map);
+
+  // Same value: nothing
+  ui.dirty_map = 0;
+  meas_readout_set_value(&freq, 1234567);
+  TEST_ASSERT_EQUAL(0, ui.dirty_map);
+
+  // Same text in a different buffer: nothing
+  static const char a[] = "Ch1";
+  char b[4] = "Ch1";
+  meas_label_t label;
+  meas_label_init(&label, (meas_rect_t){0, 100, 60, 10}, a, MEAS_ALIGN_LEFT);
+  meas_widget_add(&tree.root, &label.base);
+  ui.dirty_map = 0;
+  meas_label_set_text(&label, b);
+  TEST_ASSERT_EQUAL(0, ui.dirty_map);
+
+  // Hidden parent: children do not dirty anything
+  meas_widget_t panel;
+  meas_widget_init(&panel, &meas_widget_panel_api,
+                   (meas_rect_t){0, 160, 320, 80});
+  meas_readout_t hidden;
+  meas_readout_init(&hidden, (meas_rect_t){10, 170, 80, 14}, 0, NULL);
+  meas_widget_add(&panel, &hidden.base);
+  ui.dirty_map = 0;
+  meas_readout_set_value(&hidden, 5); // Detached
+  TEST_ASSERT_EQUAL(0, ui.dirty_map);
+  meas_widget_add(&tree.root, &panel);
+  meas_widget_set_visible(&panel, false);
+  TEST_ASSERT_EQUAL(tiles_of(160, 80), ui.dirty_map); // Area it vacated
+  ui.dirty_map = 0;
+  meas_readout_set_value(&hidden, 6);
+  TEST_ASSERT_EQUAL(0, ui.dirty_map);
+
+  // Moving dirties both the old and the new place
+  ui.dirty_map = 0;
+  meas_widget_set_bounds(&freq.base, (meas_rect_t){200, 8, 100, 14});
+  TEST_ASSERT_EQUAL(tiles_of(40, 14) | tiles_of(8, 14), ui.dirty_map);
+}
+
+void test_widget_hit_test_order(void) {
+  reset_tree();
+  meas_widget_t low, high, child;
+  meas_widget_init(&low, &spy_api, (meas_rect_t){0, 0, 200, 100});
+  meas_widget_init(&high, &spy_api, (meas_rect_t){100, 50, 200, 100});
+  meas_widget_init(&child, &spy_api, (meas_rect_t){120, 60, 20, 20});
+  meas_widget_add(&tree.root, &low);
+  meas_widget_add(&tree.root, &high);
+  meas_widget_add(&high, &child);
+
+  TEST_ASSERT(meas_widget_hit_test(&tree.root, 10, 10) == &low);
+  TEST_ASSERT(meas_widget_hit_test(&tree.root, 150, 70) == &high);
+  TEST_ASSERT(meas_widget_hit_test(&tree.root, 125, 65) == &child);
+
+  meas_widget_set_visible(&high, false);
+  TEST_ASSERT(meas_widget_hit_test(&tree.root, 125, 65) == &low);
+
+  meas_widget_set_enabled(&low, false);
+  TEST_ASSERT(meas_widget_hit_test(&tree.root, 125, 65) == &tree.root);
+
+  meas_widget_remove(&low);
+  TEST_ASSERT(low.tree == NULL && tree.root.first_child == &high);
+}
+
+static int clicks;
+
+static void count_click(void *user_data) {
+  (void)user_data;
+  clicks++;
+}
+
+static void send(meas_gesture_kind_t kind, int16_t x, int16_t y) {
+  meas_gesture_event_t ev = {.kind = kind, .x = x, .y = y};
+  meas_widget_tree_dispatch(&tree, &ev);
+}
+
+void test_widget_button_click(void) {
+  reset_tree();
+  meas_button_t ok;
+  meas_button_init(&ok, (meas_rect_t){20, 200, 80, 24}, "OK", count_click,
+                   NULL);
+  meas_widget_add(&tree.root, &ok.base);
+  clicks = 0;
+
+  ui.dirty_map = 0;
+  send(MEAS_GESTURE_PRESS, 30, 210);
+  TEST_ASSERT(ok.base.flags & MEAS_WIDGET_PRESSED);
+  TEST_ASSERT_EQUAL(tiles_of(200, 24), ui.dirty_map);
+  send(MEAS_GESTURE_TAP, 30, 210);
+  send(MEAS_GESTURE_RELEASE, 31, 211);
+  TEST_ASSERT_EQUAL(1, clicks);
+  TEST_ASSERT(!(ok.base.flags & MEAS_WIDGET_PRESSED));
+
+  // Touch started elsewhere: a release over the button does not click it
+  send(MEAS_GESTURE_PRESS, 200, 50);
+  send(MEAS_GESTURE_TAP, 200, 50);
+  send(MEAS_GESTURE_RELEASE, 30, 210);
+  TEST_ASSERT_EQUAL(1, clicks);
+
+  // Disabled: no click
+  meas_widget_set_enabled(&ok.base, false);
+  send(MEAS_GESTURE_PRESS, 30, 210);
+  send(MEAS_GESTURE_TAP, 30, 210);
+  send(MEAS_GESTURE_RELEASE, 30, 210);
+  TEST_ASSERT_EQUAL(1, clicks);
+}
+
+void test_layout_routes_gesture_events(void) {
+  reset_tree();
+  meas_button_t ok;
+  meas_button_init(&ok, (meas_rect_t){20, 200, 80, 24}, "OK", NULL, NULL);
+  meas_widget_add(&tree.root, &ok.base);
+
+  // A key code is an INT64 payload as well: never read as a gesture
+  meas_gesture_event_t press = {.kind = MEAS_GESTURE_PRESS, .x = 30, .y = 210};
+  meas_event_t ev = {.type = EVENT_INPUT_KEY,
+                     .payload = {.type = PROP_TYPE_INT64,
+                                 .i_val = meas_gesture_pack(&press)}};
+  TEST_ASSERT_EQUAL(MEAS_OK, layout_main_api.handle_input(&ui, &ev));
+  TEST_ASSERT(!(ok.base.flags & MEAS_WIDGET_PRESSED));
+
+  ev.type = EVENT_INPUT_GESTURE;
+  TEST_ASSERT_EQUAL(MEAS_OK, layout_main_api.handle_input(&ui, &ev));
+  TEST_ASSERT(ok.base.flags & MEAS_WIDGET_PRESSED);
+}
+
+static int32_t pan_dx;
+
+static void on_pan(void *user_data, int16_t dx, int16_t dy) {
+  (void)user_data;
+  (void)dy;
+  pan_dx += dx;
+}
+
+void test_widget_graph_keeps_inertia(void) {
+  reset_tree();
+  meas_graph_t graph;
+  meas_graph_init(&graph, (meas_rect_t){0, 20, 320, 180}, 0xFFE0);
+  graph.on_pan = on_pan;
+  meas_widget_add(&tree.root, &graph.base);
+  pan_dx = 0;
+
+  send(MEAS_GESTURE_PRESS, 100, 100);
+  meas_gesture_event_t ev = {.kind = MEAS_GESTURE_DRAG, .x = 110, .dx = 10};
+  meas_widget_tree_dispatch(&tree, &ev);
+  send(MEAS_GESTURE_RELEASE, 110, 100);
+  // Coasting continues to the graph after the finger is up
+  ev = (meas_gesture_event_t){.kind = MEAS_GESTURE_SCROLL, .x = 400, .dx = 5};
+  meas_widget_tree_dispatch(&tree, &ev);
+  TEST_ASSERT_EQUAL(15, pan_dx);
+}
+
+static bool opt_avg;
+static int actions;
+
+static void count_action(void *user_data) {
+  (void)user_data;
+  actions++;
+}
+
+static const meas_menu_item_t sub_menu[] = {
+    {.label = "Run", .type = MENU_ITEM_ACTION, .action = count_action},
+    {.label = NULL}};
+
+static const meas_menu_item_t main_menu[] = {
+    {.label = "Sweep", .type = MENU_ITEM_SUBMENU, .submenu = sub_menu},
+    {.label = "Average", .type = MENU_ITEM_TOGGLE,
+     .toggle = {.check_target = &opt_avg}},
+    {.label = "Marker", .type = MENU_ITEM_ACTION, .action = count_action},
+    {.label = "Trace", .type = MENU_ITEM_ACTION, .action = count_action},
+    {.label = NULL}};
+
+void test_widget_menu_rows(void) {
+  reset_tree();
+  meas_menu_view_t menu;
+  meas_menu_view_init(&menu, (meas_rect_t){240, 0, 80, 160}, main_menu, 32);
+  meas_widget_add(&tree.root, &menu.base);
+  TEST_ASSERT_EQUAL(4, menu.count);
+
+  // Selection: only the two rows involved
+  ui.dirty_map = 0;
+  meas_menu_view_set_selected(&menu, 3);
+  TEST_ASSERT_EQUAL(tiles_of(0, 32) | tiles_of(96, 32), ui.dirty_map);
+
+  // Tap on a toggle flips it and redraws its row
+  opt_avg = false;
+  ui.dirty_map = 0;
+  send(MEAS_GESTURE_PRESS, 250, 40);
+  send(MEAS_GESTURE_TAP, 250, 40);
+  send(MEAS_GESTURE_RELEASE, 250, 40);
+  TEST_ASSERT(opt_avg);
+  TEST_ASSERT_EQUAL(tiles_of(32, 32) | tiles_of(96, 32), ui.dirty_map);
+
+  // Submenu, action inside, long press back to the parent selection
+  actions = 0;
+  send(MEAS_GESTURE_PRESS, 250, 10);
+  send(MEAS_GESTURE_TAP, 250, 10);
+  TEST_ASSERT(menu.items == sub_menu && menu.count == 1);
+  send(MEAS_GESTURE_TAP, 250, 10);
+  TEST_ASSERT_EQUAL(1, actions);
+  send(MEAS_GESTURE_LONG_PRESS, 250, 10);
+  TEST_ASSERT(menu.items == main_menu && menu.selected == 0);
+  TEST_ASSERT(!meas_menu_view_back(&menu));
+}
+
+static meas_tile_pixel_t full_buf[SCREEN_W * SCREEN_H];
+static meas_tile_pixel_t tiled_buf[SCREEN_W * SCREEN_H];
+
+static void screen_ctx(meas_render_ctx_t *ctx, meas_tile_pixel_t *buf) {
+  memset(ctx, 0, sizeof(*ctx));
+  ctx->buffer = buf;
+  ctx->width = SCREEN_W;
+  ctx->height = SCREEN_H;
+  ctx->font = &font_5x7;
+  ctx->clip_rect = (meas_rect_t){0, 0, SCREEN_W, SCREEN_H};
+}
+
+void test_widget_tiled_draw(void) {
+  reset_tree();
+  static meas_menu_view_t menu;
+  static meas_button_t button;
+  static meas_readout_t readout;
+  static meas_widget_t spy;
+  static meas_point_t trace[] = {{10, 150}, {60, 90}, {120, 180}, {200, 120}};
+  static meas_graph_t graph;
+
+  meas_graph_init(&graph, (meas_rect_t){0, 80, 230, 120}, 0xFFE0);
+  meas_graph_set_trace(&graph, trace, 4);
+  meas_menu_view_init(&menu, (meas_rect_t){240, 0, 80, 160}, main_menu, 32);
+  meas_button_init(&button, (meas_rect_t){20, 210, 80, 24}, "OK", NULL, NULL);
+  meas_readout_init(&readout, (meas_rect_t){10, 10, 120, 14}, 2, "dB");
+  meas_readout_set_value(&readout, -4217);
+  meas_widget_init(&spy, &spy_api, (meas_rect_t){150, 20, 40, 20});
+  spy.font = &font_11x14;
+  meas_widget_add(&tree.root, &graph.base);
+  meas_widget_add(&tree.root, &menu.base);
+  meas_widget_add(&tree.root, &button.base);
+  meas_widget_add(&tree.root, &readout.base);
+  meas_widget_add(&tree.root, &spy);
+
+  meas_render_ctx_t ctx;
+  screen_ctx(&ctx, full_buf);
+  memset(full_buf, 0, sizeof(full_buf));
+  spy_draws = 0;
+  meas_widget_tree_draw(&tree, &ctx, &meas_render_cell_api);
+  TEST_ASSERT_EQUAL(1, spy_draws);
+  TEST_ASSERT(ctx.font == &font_5x7); // Widget font restored
+
+  // Tile by tile: same pixels, spy drawn only in the tiles it covers
+  memset(tiled_buf, 0, sizeof(tiled_buf));
+  spy_draws = 0;
+  for (int16_t y = 0; y < SCREEN_H; y += MEAS_UI_TILE_HEIGHT) {
+    screen_ctx(&ctx, &tiled_buf[y * SCREEN_W]);
+    ctx.height = MEAS_UI_TILE_HEIGHT;
+    ctx.y_offset = y;
+    meas_widget_tree_draw(&tree, &ctx, &meas_render_cell_api);
+  }
+  TEST_ASSERT_EQUAL(__builtin_popcount(tiles_of(20, 20)), spy_draws);
+  TEST_ASSERT(memcmp(full_buf, tiled_buf, sizeof(full_buf)) == 0);
+
+  // Clip outside the spy: pruned
+  screen_ctx(&ctx, full_buf);
+  ctx.clip_rect = (meas_rect_t){0, 100, SCREEN_W, 40};
+  spy_draws = 0;
+  meas_widget_tree_draw(&tree, &ctx, &meas_render_cell_api);
+  TEST_ASSERT_EQUAL(0, spy_draws);
+}
+
+void run_widget_tests(void) {
+  printf("\n--- Running Widget Tests ---\n");
+  RUN_TEST(test_widget_invalidation_is_local);
+  RUN_TEST(test_widget_hit_test_order);
+  RUN_TEST(test_widget_button_click);
+  RUN_TEST(test_layout_routes_gesture_events);
+  RUN_TEST(test_widget_graph_keeps_inertia);
+  RUN_TEST(test_widget_menu_rows);
+  RUN_TEST(test_widget_tiled_draw);
+}
@@ -0,0 +1,111 @@
+/**
+ * @file remote_decoder.c
+ * @brief Remote Display Stream Decoder (Host Side).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ */
+
+#include "remote_decoder.h"
+#include <string.h>
+
+static uint16_t rd_u16(const uint8_t *p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+void remote_decoder_init(remote_decoder_t *d) {
+  memset(d, 0, sizeof(*d));
+  d->need = 2;
+}
+
+static bool decode_row(remote_decoder_t *d, const uint8_t *p, size_t len) {
+  if (!d->width || len < 2)
+    return false;
+  uint16_t y = rd_u16(p);
+  if (y >= d->height)
+    return false;
+
+  meas_pixel_t *row = &d->screen[(size_t)y * d->width];
+  size_t pos = 2;
+  uint16_t x = 0;
+  while (x < d->width) {
+    if (pos >= len)
+      return false;
+    uint8_t h = p[pos++];
+    uint16_t n = (uint16_t)((h & 0x7F) + 1);
+    size_t data = (h & 0x80) ? 2 : 2 * (size_t)n;
+    if (x + n > d->width || pos + data > len)
+      return false;
+    for (uint16_t i = 0; i < n; i++)
+      row[x + i] = rd_u16(&p[pos + ((h & 0x80) ? 0 : 2 * (size_t)i)]);
+    x += n;
+    pos += data;
+  }
+  d->rows++;
+  return pos == len;
+}
+
+static void decode_message(remote_decoder_t *d) {
+  const uint8_t *m = d->msg;
+  size_t len = rd_u16(&m[3]);
+  uint8_t sum = 0;
+  for (size_t i = 2; i < 6 + len; i++)
+    sum += m[i];
+  if (sum != 0) {
+    d->errors++;
+    return;
+  }
+
+  const uint8_t *p = &m[5];
+  switch (m[2]) {
+  case MEAS_REMOTE_MSG_HELLO:
+    if (len < 4 || rd_u16(p) > REMOTE_DECODER_MAX_W ||
+        rd_u16(&p[2]) > REMOTE_DECODER_MAX_H) {
+      d->errors++;
+      return;
+    }
+    d->width = rd_u16(p);
+    d->height = rd_u16(&p[2]);
+    memset(d->screen, 0, sizeof(d->screen));
+    d->hellos++;
+    break;
+  case MEAS_REMOTE_MSG_ROW:
+    if (!decode_row(d, p, len))
+      d->errors++;
+    break;
+  default:
+    break; // Unknown types are skipped
+  }
+}
+
+void remote_decoder_feed(remote_decoder_t *d, const uint8_t *data,
+                         size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    uint8_t b = data[i];
+
+    // Hunt for the sync pattern
+    if (d->fill == 0) {
+      if (b == MEAS_REMOTE_SYNC0)
+        d->msg[d->fill++] = b;
+      continue;
+    }
+    if (d->fill == 1) {
+      if (b == MEAS_REMOTE_SYNC1)
+        d->msg[d->fill++] = b;
+      else
+        d->fill = (b == MEAS_REMOTE_SYNC0) ? 1 : 0;
+      continue;
+    }
+
+    d->msg[d->fill++] = b;
+    if (d->fill == 5)
+      d->need = 6 + rd_u16(&d->msg[3]); // Header complete: full length
+    else if (d->fill < 5)
+      d->need = 5;
+    if (d->fill == d->need) {
+      decode_message(d);
+      d->fill = 0;
+      d->need = 2;
+    }
+  }
+}
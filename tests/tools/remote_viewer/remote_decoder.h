@@ -0,0 +1,47 @@
+/**
+ * @file remote_decoder.h
+ * @brief Remote Display Stream Decoder (Host Side).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Incremental decoder for the stream produced by measlib/sys/remote_display.
+ * Bytes may arrive in any split; corrupt messages are dropped and the decoder
+ * resynchronizes on the next sync pattern.
+ */
+
+#ifndef MEAS_TESTS_REMOTE_DECODER_H
+#define MEAS_TESTS_REMOTE_DECODER_H
+
+#include "measlib/sys/remote_display.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define REMOTE_DECODER_MAX_W 480
+#define REMOTE_DECODER_MAX_H 320
+
+typedef struct {
+  meas_pixel_t screen[REMOTE_DECODER_MAX_W * REMOTE_DECODER_MAX_H];
+  uint16_t width; /**< 0 until HELLO */
+  uint16_t height;
+
+  // Message assembly
+  uint8_t msg[5 + 65535 + 1];
+  size_t fill;
+  size_t need;
+
+  // Counters
+  uint32_t hellos;
+  uint32_t rows;
+  uint32_t errors; /**< Bad checksum or malformed payload */
+} remote_decoder_t;
+
+void remote_decoder_init(remote_decoder_t *d);
+
+/**
+ * @brief Feed received bytes; complete messages update `screen`.
+ */
+void remote_decoder_feed(remote_decoder_t *d, const uint8_t *data,
+                         size_t len);
+
+#endif // MEAS_TESTS_REMOTE_DECODER_H
@@ -0,0 +1,98 @@
+/**
+ * @file remote_viewer.c
+ * @brief Remote Display Viewer (Host Tool).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Reads a remote-display stream (a captured file, or the instrument's serial
+ * device) and keeps writing the mirrored screen as a BMP.
+ *
+ * Usage:
+ *   meas_remote_viewer <stream> <out.bmp>
+ *
+ * The image is rewritten after every chunk that changed rows, so an image
+ * viewer with auto-reload shows the instrument screen live.
+ */
+
+#include "remote_decoder.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static void put_u16(FILE *f, uint16_t v) {
+  fputc(v & 0xFF, f);
+  fputc(v >> 8, f);
+}
+
+static void put_u32(FILE *f, uint32_t v) {
+  put_u16(f, (uint16_t)v);
+  put_u16(f, (uint16_t)(v >> 16));
+}
+
+// 16 bpp BI_BITFIELDS, top-down (same layout as the on-device screenshot)
+static int write_bmp(const char *path, const remote_decoder_t *d) {
+  FILE *f = fopen(path, "wb");
+  if (!f)
+    return -1;
+  uint32_t row = (uint32_t)d->width * 2;
+  uint32_t pad = (4 - row % 4) % 4;
+  uint32_t image = (row + pad) * d->height;
+
+  fputc('B', f);
+  fputc('M', f);
+  put_u32(f, 66 + image);
+  put_u32(f, 0);
+  put_u32(f, 66);
+  put_u32(f, 40);
+  put_u32(f, d->width);
+  put_u32(f, (uint32_t)-(int32_t)d->height);
+  put_u16(f, 1);
+  put_u16(f, 16);
+  put_u32(f, 3);
+  put_u32(f, image);
+  put_u32(f, 2835);
+  put_u32(f, 2835);
+  put_u32(f, 0);
+  put_u32(f, 0);
+  put_u32(f, 0xF800);
+  put_u32(f, 0x07E0);
+  put_u32(f, 0x001F);
+  for (uint16_t y = 0; y < d->height; y++) {
+    for (uint16_t x = 0; x < d->width; x++)
+      put_u16(f, d->screen[(size_t)y * d->width + x]);
+    for (uint32_t i = 0; i < pad; i++)
+      fputc(0, f);
+  }
+  return fclose(f);
+}
+
+int main(int argc, char **argv) {
+  if (argc != 3) {
+    fprintf(stderr, "usage: %s <stream> <out.bmp>\n", argv[0]);
+    return 2;
+  }
+  FILE *in = fopen(argv[1], "rb");
+  if (!in) {
+    perror(argv[1]);
+    return 1;
+  }
+
+  static remote_decoder_t dec;
+  remote_decoder_init(&dec);
+
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), in)) > 0) {
+    uint32_t rows = dec.rows;
+    remote_decoder_feed(&dec, chunk, n);
+    if (dec.width && dec.rows != rows && write_bmp(argv[2], &dec) != 0) {
+      perror(argv[2]);
+      fclose(in);
+      return 1;
+    }
+  }
+  fclose(in);
+
+  printf("%u rows, %u errors\n", (unsigned)dec.rows, (unsigned)dec.errors);
+  return dec.errors ? 1 : 0;
+}
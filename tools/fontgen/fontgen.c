@@ -0,0 +1,280 @@
+/**
+ * @file fontgen.c
+ * @brief Font Atlas Generator (Host Tool).
+ *
+ * @author Architected by momentics <momentics@gmail.com>
+ * @copyright (c) 2026 momentics
+ *
+ * Converts the built-in bitmap fonts into the run-encoded atlas described in
+ * measlib/ui/font_atlas.h and writes src/ui/fonts/font_atlas.c.
+ *
+ * Usage:
+ *   meas_fontgen <out.c>          Write the atlas source.
+ *   meas_fontgen --check <file>   Exit non-zero if @p file is out of date.
+ *
+ * The tool links the font sources built with MEAS_FONTGEN, so the glyph data
+ * it reads is exactly what the firmware's bitmap path would draw.
+ */
+
+#include "measlib/ui/font_atlas.h"
+#include "measlib/ui/fonts.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define OUT_CAPACITY (256U * 1024U)
+#define RUNS_CAPACITY 8192U
+#define GLYPH_MAX_WIDTH 16
+
+/**
+ * @brief Kerning input (terminated by a zero entry).
+ * Neither built-in font needs pairs yet: their widths already include the
+ * inter-glyph gap. Add pairs here, in any order, and regenerate.
+ */
+static const meas_kern_pair_t kern_5x7[] = {{0, 0, 0}};
+static const meas_kern_pair_t kern_11x14[] = {{0, 0, 0}};
+
+typedef struct {
+  const char *name;
+  const meas_font_t *font;
+  const meas_kern_pair_t *kern;
+} font_job_t;
+
+static const font_job_t jobs[] = {
+    {"font_5x7", &font_5x7, kern_5x7},
+    {"font_11x14", &font_11x14, kern_11x14},
+};
+
+// --- Output Buffer ---
+
+static char out_buf[OUT_CAPACITY];
+static size_t out_len = 0;
+
+static void emit(const char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(&out_buf[out_len], OUT_CAPACITY - out_len, fmt, ap);
+  va_end(ap);
+  if (n < 0 || (size_t)n >= OUT_CAPACITY - out_len) {
+    fprintf(stderr, "fontgen: output buffer exhausted\n");
+    exit(2);
+  }
+  out_len += (size_t)n;
+}
+
+// --- Glyph Decoding (same layout rules as the renderer) ---
+
+static uint16_t row_bits(const meas_font_t *f, const uint8_t *glyph,
+                         int row) {
+  if (f->height > 8) {
+    uint16_t v;
+    memcpy(&v, &glyph[row * 2], sizeof(v));
+    return v;
+  }
+  return (uint16_t)((uint16_t)glyph[row] << 8);
+}
+
+static void emit_char_comment(uint8_t c) {
+  if (c == '\\' || c == '\'')
+    emit("'\\%c'", c);
+  else if (c >= 0x20 && c < 0x7F)
+    emit("'%c'", c);
+  else
+    emit("0x%02X", c);
+}
+
+static int cmp_kern(const void *a, const void *b) {
+  const meas_kern_pair_t *pa = a;
+  const meas_kern_pair_t *pb = b;
+  int ka = ((uint8_t)pa->left << 8) | (uint8_t)pa->right;
+  int kb = ((uint8_t)pb->left << 8) | (uint8_t)pb->right;
+  return ka - kb;
+}
+
+static void generate_font(const font_job_t *job) {
+  const meas_font_t *f = job->font;
+  static uint8_t runs[RUNS_CAPACITY];
+  static meas_atlas_glyph_t glyphs[256];
+  size_t used = 0;
+
+  for (int c = f->start_char; c <= f->end_char; c++) {
+    uint8_t gw = 0;
+    uint8_t gh = 0;
+    const uint8_t *glyph = f->get_glyph(f->bitmap, (char)c, &gw, &gh);
+    int w = (gw > GLYPH_MAX_WIDTH) ? GLYPH_MAX_WIDTH : gw;
+    uint16_t col_mask = (uint16_t)~(0xFFFFU >> w);
+
+    // Ink band: blank rows at either end are not stored
+    int top = gh;
+    int bottom = -1;
+    for (int r = 0; r < gh; r++) {
+      if (row_bits(f, glyph, r) & col_mask) {
+        if (top == gh)
+          top = r;
+        bottom = r;
+      }
+    }
+    if (bottom < 0)
+      top = 0;
+
+    meas_atlas_glyph_t *g = &glyphs[c - f->start_char];
+    g->offset = (uint16_t)used;
+    g->advance = gw;
+    g->top = (uint8_t)top;
+    g->rows = (uint8_t)(bottom - top + 1);
+
+    for (int r = top; r <= bottom; r++) {
+      uint16_t bits = row_bits(f, glyph, r) & col_mask;
+      size_t count_at = used++;
+      uint8_t n = 0;
+      int x = 0;
+      while (x < w) {
+        while (x < w && !(bits & (0x8000U >> x)))
+          x++;
+        int start = x;
+        while (x < w && (bits & (0x8000U >> x)))
+          x++;
+        if (x > start) {
+          runs[used++] = (uint8_t)((start << 4) | (x - start - 1));
+          n++;
+        }
+      }
+      runs[count_at] = n;
+      if (used + GLYPH_MAX_WIDTH + 1 > RUNS_CAPACITY) {
+        fprintf(stderr, "fontgen: run buffer exhausted\n");
+        exit(2);
+      }
+    }
+  }
+
+  // Runs
+  emit("static const uint8_t %s_runs[] = {\n", job->name);
+  for (int c = f->start_char; c <= f->end_char; c++) {
+    const meas_atlas_glyph_t *g = &glyphs[c - f->start_char];
+    size_t end = (c < f->end_char) ? glyphs[c + 1 - f->start_char].offset
+                                   : used;
+    if (end == g->offset)
+      continue;
+    emit("    // ");
+    emit_char_comment((uint8_t)c);
+    emit("\n   ");
+    for (size_t i = g->offset; i < end; i++) {
+      if (i > g->offset && (i - g->offset) % 12 == 0)
+        emit("\n   ");
+      emit(" 0x%02X,", runs[i]);
+    }
+    emit("\n");
+  }
+  if (used == 0)
+    emit("    0x00,\n");
+  emit("};\n\n");
+
+  // Glyph descriptors
+  emit("static const meas_atlas_glyph_t %s_glyphs[] = {\n", job->name);
+  for (int c = f->start_char; c <= f->end_char; c++) {
+    const meas_atlas_glyph_t *g = &glyphs[c - f->start_char];
+    char entry[32];
+    snprintf(entry, sizeof(entry), "{%u, %u, %u, %u},", g->offset, g->advance,
+             g->top, g->rows);
+    emit("    %-18s // ", entry);
+    emit_char_comment((uint8_t)c);
+    emit("\n");
+  }
+  emit("};\n\n");
+
+  // Kerning
+  size_t kern_count = 0;
+  while (job->kern[kern_count].left != 0)
+    kern_count++;
+  if (kern_count > 0) {
+    meas_kern_pair_t sorted[256];
+    if (kern_count > sizeof(sorted) / sizeof(sorted[0])) {
+      fprintf(stderr, "fontgen: too many kerning pairs\n");
+      exit(2);
+    }
+    memcpy(sorted, job->kern, kern_count * sizeof(sorted[0]));
+    qsort(sorted, kern_count, sizeof(sorted[0]), cmp_kern);
+    emit("static const meas_kern_pair_t %s_kern[] = {\n", job->name);
+    for (size_t i = 0; i < kern_count; i++) {
+      emit("    {");
+      emit_char_comment((uint8_t)sorted[i].left);
+      emit(", ");
+      emit_char_comment((uint8_t)sorted[i].right);
+      emit(", %d},\n", sorted[i].adjust);
+    }
+    emit("};\n\n");
+  }
+
+  emit("const meas_font_atlas_t %s_atlas = {\n", job->name);
+  emit("    .first_char = 0x%02X,\n", f->start_char);
+  emit("    .last_char = 0x%02X,\n", f->end_char);
+  emit("    .fallback = ' ',\n");
+  emit("    .glyphs = %s_glyphs,\n", job->name);
+  emit("    .runs = %s_runs,\n", job->name);
+  if (kern_count > 0) {
+    emit("    .kern = %s_kern,\n", job->name);
+    emit("    .kern_count = %u,\n", (unsigned)kern_count);
+  } else {
+    emit("    .kern = NULL,\n");
+    emit("    .kern_count = 0,\n");
+  }
+  emit("};\n");
+}
+
+static void generate(void) {
+  emit("/**\n");
+  emit(" * @file font_atlas.c\n");
+  emit(" * @brief Run-Encoded Font Atlases.\n");
+  emit(" *\n");
+  emit(" * @author Architected by momentics <momentics@gmail.com>\n");
+  emit(" * @copyright (c) 2026 momentics\n");
+  emit(" *\n");
+  emit(" * GENERATED by tools/fontgen from the bitmap fonts - do not edit.\n");
+  emit(" * Regenerate with the `font_atlas` target of the host build.\n");
+  emit(" */\n\n");
+  emit("#include \"measlib/ui/font_atlas.h\"\n");
+  emit("#include <stddef.h>\n");
+
+  for (size_t i = 0; i < sizeof(jobs) / sizeof(jobs[0]); i++) {
+    emit("\n// --- %s ---\n\n", jobs[i].name);
+    generate_font(&jobs[i]);
+  }
+}
+
+int main(int argc, char **argv) {
+  int check = (argc == 3 && strcmp(argv[1], "--check") == 0);
+  if (argc != 2 && !check) {
+    fprintf(stderr, "usage: %s [--check] <font_atlas.c>\n", argv[0]);
+    return 2;
+  }
+  const char *path = argv[argc - 1];
+
+  generate();
+
+  if (check) {
+    static char cur[OUT_CAPACITY];
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+      fprintf(stderr, "fontgen: cannot read %s\n", path);
+      return 1;
+    }
+    size_t n = fread(cur, 1, sizeof(cur), fp);
+    fclose(fp);
+    if (n != out_len || memcmp(cur, out_buf, n) != 0) {
+      fprintf(stderr, "fontgen: %s is out of date, rebuild `font_atlas`\n",
+              path);
+      return 1;
+    }
+    return 0;
+  }
+
+  FILE *fp = fopen(path, "wb");
+  if (!fp) {
+    fprintf(stderr, "fontgen: cannot write %s\n", path);
+    return 1;
+  }
+  fwrite(out_buf, 1, out_len, fp);
+  fclose(fp);
+  return 0;
+}